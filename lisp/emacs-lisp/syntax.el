@@ -436,6 +436,7 @@ syntax-ppss--marker-position
 (defun syntax-ppss-invalidate-cache (beg &rest _args)
   "Invalidate ppss data after BEG."
   (setq syntax-propertize--done (min beg syntax-propertize--done))
+  (internal--syntax-invalidate-checkpoints beg)
   (cl-destructuring-bind ((last-pos . last-ppss) . cache)
       syntax-ppss--data
     (let ((before-beg (syntax-ppss--cached-before cache beg)))
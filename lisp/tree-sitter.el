@@ -22,7 +22,7 @@
 ;;; Code:
 
 (require 'font-lock)
-(declare-function tree-sitter-changed-range "tree-sitter.c")
+(declare-function tree-sitter-changed-ranges "tree-sitter.c")
 (declare-function tree-sitter-node-type "tree-sitter.c")
 (declare-function tree-sitter-highlight-region "tree-sitter.c")
 (declare-function tree-sitter-node-prev-sibling "tree-sitter.c")
@@ -195,18 +195,24 @@ tree-sitter-douse-fontify
       (put-text-property beg (min (point-max) (1+ beg)) 'fontified nil))))
 
 (defun tree-sitter-fontify-region (beg end loudly)
-  "Presumably widened in `font-lock-fontify-region'."
+  "Presumably widened in `font-lock-fontify-region'.
+Also refontify the ranges the parser reports changed that touch BEG
+to END.  Other changed ranges are marked unfontified, to be done when
+they are displayed, and unchanged text elsewhere is left alone."
   (with-silent-modifications
     (save-excursion
       (save-match-data
-        (let* ((changed-range (tree-sitter-changed-range))
-               (beg* (if changed-range
-                         (min beg (cl-first changed-range))
-                       beg))
-               (end* (if changed-range
-                         (min (point-max)
-                              (max (cl-second changed-range) end))
-                       end))
+        (let* ((beg* beg)
+               (end* end)
+               (_ (dolist (range (tree-sitter-changed-ranges))
+                    (let ((range-beg (max (point-min) (car range)))
+                          (range-end (min (point-max) (cdr range))))
+                      (cond ((and (<= range-beg end*) (>= range-end beg*))
+                             (setq beg* (min beg* range-beg)
+                                   end* (max end* range-end)))
+                            ((< range-beg range-end)
+                             (put-text-property range-beg range-end
+                                                'fontified nil))))))
                (bounds (tree-sitter-highlight-region beg* end*))
                (leftmost (if bounds (min beg* (car bounds)) beg*))
                (rightmost (if bounds (max end* (cdr bounds)) end*)))
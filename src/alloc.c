@@ -2138,7 +2138,8 @@ free_by_pvtype (struct Lisp_Vector *vector)
 	    ptrdiff_t bytes = (h->table_size * (2 * sizeof *h->key_and_value
 						+ sizeof *h->hash
 						+ sizeof *h->next)
-			       + hash_table_index_size (h) * sizeof *h->index);
+			       + (hash_table_index_size (h) / HASH_GROUP_WIDTH
+				  * sizeof *h->index));
 	    hash_table_allocated_bytes -= bytes;
 	  }
       }
@@ -2156,20 +2157,14 @@ free_by_pvtype (struct Lisp_Vector *vector)
       {
 	struct Lisp_Tree_Sitter *lisp_parser
 	  = PSEUDOVEC_STRUCT (vector, Lisp_Tree_Sitter);
-	if (lisp_parser->highlight_names != NULL)
-	  xfree (lisp_parser->highlight_names);
-	if (lisp_parser->highlights_query != NULL)
-	  xfree (lisp_parser->highlights_query);
 	if (lisp_parser->highlighter != NULL)
-	  ts_highlighter_delete (lisp_parser->highlighter);
+	  tree_sitter_release_highlighter (lisp_parser->highlighter);
 	if (lisp_parser->tree != NULL)
 	  ts_tree_delete(lisp_parser->tree);
 	if (lisp_parser->prev_tree != NULL)
 	  ts_tree_delete(lisp_parser->prev_tree);
-	if (lisp_parser->indents_query != NULL)
-	  ts_query_delete (lisp_parser->indents_query);
 	if (lisp_parser->parser != NULL)
-	  ts_parser_delete(lisp_parser->parser);
+	  tree_sitter_release_parser (lisp_parser->parser);
       }
       break;
     case PVEC_TREE_SITTER_NODE:
@@ -2188,6 +2183,9 @@ free_by_pvtype (struct Lisp_Vector *vector)
       /* clean s___ up.  To be implemented.  */
       break;
 #endif
+    case PVEC_JSON_STREAM:
+      xfree (PSEUDOVEC_STRUCT (vector, Lisp_JSON_Stream)->buf);
+      break;
     default:
       break;
     }
@@ -4106,13 +4104,17 @@ mark_buffer (struct buffer *buffer)
   if (!itree_empty_p (buffer->overlays))
     mark_overlays (buffer->overlays->root);
 
+  if (buffer->syntax_checkpoints)
+    mark_syntax_checkpoints (buffer->syntax_checkpoints);
+
   /* If this is an indirect buffer, mark its base buffer.  */
   if (buffer->base_buffer &&
       !vectorlike_marked_p (&buffer->base_buffer->header))
     mark_buffer (buffer->base_buffer);
 }
 
-/* Mark Lisp faces in the face cache C.  */
+/* Mark Lisp faces in the face cache C, and empty its memo of merged
+   faces rather than marking the face names in it.  */
 
 static void
 mark_face_cache (struct face_cache *c)
@@ -4131,6 +4133,8 @@ mark_face_cache (struct face_cache *c)
 	      mark_objects (face->lface, LFACE_VECTOR_SIZE);
 	    }
 	}
+
+      clear_face_memo (c);
     }
 }
 
@@ -4165,6 +4169,8 @@ mark_window (struct Lisp_Vector *ptr)
       mark_glyph_matrix (w->current_matrix);
       mark_glyph_matrix (w->desired_matrix);
     }
+
+  mark_sline_cache (w);
 }
 
 /* Entry of the mark stack.  */
@@ -4348,6 +4354,7 @@ garbage_collect (void)
   mark_charset ();
   mark_composite ();
   mark_profiler ();
+  mark_regexp_cache ();
 #ifdef HAVE_PGTK
   mark_pgtkterm ();
 #endif
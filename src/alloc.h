@@ -39,6 +39,8 @@ #define EMACS_ALLOC_H
 #include "tree-sitter.h"
 #endif
 
+#include "json.h"
+
 #include <flexmember.h>
 #include <verify.h>
 #include <execinfo.h>           /* For backtrace.  */
@@ -608,6 +608,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = NULL;
+  b->syntax_checkpoints = NULL;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -833,6 +835,8 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = NULL;
+  b->syntax_checkpoints = NULL;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -1303,9 +1307,6 @@ delete_all_overlays (struct buffer *b)
 {
   if (b->overlays)
     {
-      /* The general rule is that the tree cannot be modified from within
-	 ITREE_FOREACH, but here we bend this rule a little because we know
-	 that the POST_ORDER iterator will not need to look at `node` again.  */
       struct itree_node *node;
       ITREE_FOREACH (node, b->overlays, PTRDIFF_MIN, PTRDIFF_MAX, POST_ORDER)
 	{
@@ -1317,9 +1318,6 @@ delete_all_overlays (struct buffer *b)
 	      XOVERLAY (node->data)->buffer->proximity = NULL;
 	    }
 	  XOVERLAY (node->data)->buffer = NULL;
-	  node->parent = NULL;
-	  node->left = NULL;
-	  node->right = NULL;
 	}
       itree_clear (b->overlays);
       itree_destroy (b->overlays);
@@ -2360,6 +2358,16 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->line_index)
+    {
+      free_line_index (b->line_index);
+      b->line_index = NULL;
+    }
+  if (b->syntax_checkpoints)
+    {
+      free_syntax_checkpoints (b->syntax_checkpoints);
+      b->syntax_checkpoints = NULL;
+    }
   bset_width_table (b, Qnil);
   unblock_input ();
 
@@ -2791,6 +2799,8 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (line_index, struct line_index *);
+  swapfield (syntax_checkpoints, struct syntax_checkpoints *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield_ (undo_list, Lisp_Object);
@@ -3226,6 +3236,9 @@ DEFUN ("kill-all-local-variables", Fkill_all_local_variables,
    If EXTEND, make the vector bigger if necessary.  If not, never
    extend the vector, and store only as many overlays as will fit.
    But still return the total number of overlays.
+
+   This reads the overlays with itree_snapshot, which does not apply
+   pending offsets to the tree as ITREE_FOREACH does.
 */
 
 static ptrdiff_t
@@ -3234,11 +3247,13 @@ overlays_in (ptrdiff_t beg, ptrdiff_t end, bool extend,
 	     bool empty, bool trailing,
              ptrdiff_t *next_ptr)
 {
-  ptrdiff_t idx = 0;
+  ptrdiff_t idx;
   ptrdiff_t len = *len_ptr;
-  ptrdiff_t next = ZV;
+  ptrdiff_t next;
   Lisp_Object *vec = *vec_ptr;
-  struct itree_node *node;
+  struct itree_interval intervals[16], *iv = intervals;
+  ptrdiff_t nmax = ARRAYELTS (intervals);
+  USE_SAFE_ALLOCA;
 
   /* Extend the search range if overlays beginning at ZV are
      wanted.  */
@@ -3246,38 +3261,54 @@ overlays_in (ptrdiff_t beg, ptrdiff_t end, bool extend,
   if (end >= ZV && (empty || trailing))
     ++search_end;
 
-  ITREE_FOREACH (node, current_buffer->overlays, beg, search_end,
-                 ASCENDING)
+  /* Read the overlays that begin by END, and learn where the next
+     one begins.  Start over with room for twice as many as long as
+     they don't fit.  */
+  for (bool done = false; !done; )
     {
-      if (node->begin > end)
-        {
-          next = min (next, node->begin);
-          break;
-        }
-      else if (node->begin == end)
-        {
-          next = node->begin;
-          if ((!empty || end < ZV) && beg < end)
-            break;
-          if (empty && node->begin != node->end)
-            continue;
-        }
+      ptrdiff_t after;
+      ptrdiff_t n = itree_snapshot (current_buffer->overlays, beg,
+				    min (end + 1, search_end), iv, nmax,
+				    &after);
+      done = n < nmax;
+      idx = 0;
+      next = min (after, ZV);
+      for (ptrdiff_t i = 0; i < n; i++)
+	{
+	  if (iv[i].begin == end)
+	    {
+	      next = iv[i].begin;
+	      if ((!empty || end < ZV) && beg < end)
+		{
+		  done = true;
+		  break;
+		}
+	      if (empty && iv[i].begin != iv[i].end)
+		continue;
+	    }
 
-      if (!empty && node->begin == node->end)
-        continue;
+	  if (!empty && iv[i].begin == iv[i].end)
+	    continue;
 
-      if (extend && idx == len)
-        {
-          vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-                         sizeof *vec);
-          *vec_ptr = vec;
-          len = *len_ptr;
-        }
-      if (idx < len)
-        vec[idx] = node->data;
-      /* Keep counting overlays even if we can't return them all.  */
-      idx++;
+	  if (extend && idx == len)
+	    {
+	      vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
+			     sizeof *vec);
+	      *vec_ptr = vec;
+	      len = *len_ptr;
+	    }
+	  if (idx < len)
+	    vec[idx] = iv[i].data;
+	  /* Keep counting overlays even if we can't return them all.  */
+	  idx++;
+	}
+      if (!done)
+	{
+	  nmax *= 2;
+	  SAFE_NALLOCA (iv, 1, nmax);
+	}
     }
+  SAFE_FREE ();
   if (next_ptr)
     *next_ptr = next ? next : ZV;
 
@@ -3454,14 +3485,17 @@ compare_overlays (const void *v1, const void *v2)
     return XLI (s1->overlay) < XLI (s2->overlay) ? -1 : 1;
 }
 
+/* Fill in ITEM for OVERLAY, which spans BEG to END.  */
+
 void
-make_sortvec_item (struct sortvec *item, Lisp_Object overlay)
+make_sortvec_item (struct sortvec *item, Lisp_Object overlay,
+		   ptrdiff_t beg, ptrdiff_t end)
 {
   Lisp_Object tem;
   /* This overlay is good and counts: put it into sortvec.  */
   item->overlay = overlay;
-  item->beg = OVERLAY_START (overlay);
-  item->end = OVERLAY_END (overlay);
+  item->beg = beg;
+  item->end = end;
   tem = Foverlay_get (overlay, Qpriority);
   if (NILP (tem))
     {
@@ -3508,7 +3542,8 @@ sort_overlays (Lisp_Object *overlay_vec, ptrdiff_t noverlays, struct window *w)
              overlays that are limited to some other window.  */
           if (w && !overlay_matches_window (w, overlay))
             continue;
-          make_sortvec_item (sortvec + j, overlay);
+          make_sortvec_item (sortvec + j, overlay, OVERLAY_START (overlay),
+			     OVERLAY_END (overlay));
 	  j++;
 	}
     }
@@ -3917,6 +3952,22 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
   return overlay;
 }
 
+/* Mark the text of OVERLAY in OBUFFER as needing redisplay, because
+   OVERLAY is about to be deleted.  */
+
+static void
+modify_deleted_overlay (struct buffer *obuffer, Lisp_Object overlay)
+{
+  /* Turn off optimizations if overlay contained before- or
+     after-strings since they could contain newlines.  */
+  if (!windows_or_buffers_changed
+      && (!NILP (Foverlay_get (overlay, Qbefore_string))
+	  || !NILP (Foverlay_get (overlay, Qafter_string))))
+    obuffer->prevent_redisplay_optimizations_p = 1;
+
+  modify_overlay (obuffer, OVERLAY_START (overlay), OVERLAY_END (overlay));
+}
+
 DEFUN ("delete-overlay", Fdelete_overlay, Sdelete_overlay, 1, 1, 0,
        doc: /* Delete the OVERLAY from its buffer.  */)
   (Lisp_Object overlay)
@@ -3925,14 +3976,7 @@ DEFUN ("delete-overlay", Fdelete_overlay, Sdelete_overlay, 1, 1, 0,
   struct buffer *obuffer = OVERLAY_BUFFER (overlay);
   if (obuffer != NULL)
     {
-      /* Turn off optimizations if overlay contained before- or
-	 after-strings since they could contain newlines.  */
-      if (!windows_or_buffers_changed
-	  && (!NILP (Foverlay_get (overlay, Qbefore_string))
-	      || !NILP (Foverlay_get (overlay, Qafter_string))))
-	obuffer->prevent_redisplay_optimizations_p = 1;
-
-      modify_overlay (obuffer, OVERLAY_START (overlay), OVERLAY_END (overlay));
+      modify_deleted_overlay (obuffer, overlay);
       itree_remove (obuffer->overlays, XOVERLAY (overlay)->interval);
       /* Now kill mode-overlay buffer associated with OBUFFER.  */
       if (MODE_OVERLAY_INDIRECT_P (obuffer) /* don't touch base buffer! */
@@ -4012,6 +4056,194 @@ DEFUN ("delete-all-overlays", Fdelete_all_overlays, Sdelete_all_overlays, 0, 1,
   return Qnil;
 }
 
+/* Return the position POS, an integer or a marker, where an overlay
+   to be made in BUFFER begins or ends.  */
+
+static ptrdiff_t
+overlay_position (Lisp_Object pos, Lisp_Object buffer)
+{
+  if (MARKERP (pos) && !EQ (Fmarker_buffer (pos), buffer))
+    signal_error ("Marker points into wrong buffer", pos);
+  CHECK_FIXNUM_COERCE_MARKER (pos);
+  return XFIXNUM (pos);
+}
+
+DEFUN ("make-overlays", Fmake_overlays, Smake_overlays, 1, 4, 0,
+       doc: /* Create overlays in BUFFER as described by SPECS and return them.
+Each element of SPECS has the form (BEG END . PROPS), and describes an
+overlay with range BEG to END and the properties in the property list
+PROPS.  BEG and END may be integers or markers.  The value is a list
+of the new overlays, in the order of SPECS.
+If omitted, BUFFER defaults to the current buffer.
+FRONT-ADVANCE and REAR-ADVANCE apply to all the new overlays, and mean
+the same as for `make-overlay'.
+
+This does what calling `make-overlay' and `overlay-put' for each
+element of SPECS would do, but much faster when there are many.  */)
+  (Lisp_Object specs, Lisp_Object buffer, Lisp_Object front_advance,
+   Lisp_Object rear_advance)
+{
+  struct buffer *b;
+
+  if (NILP (buffer))
+    XSETBUFFER (buffer, current_buffer);
+  else
+    CHECK_BUFFER (buffer);
+
+  b = XBUFFER (buffer);
+  if (!BUFFER_LIVE_P (b))
+    error ("Attempt to create overlay in a dead buffer");
+
+  /* Check all of SPECS before making any overlay.  */
+  ptrdiff_t n = list_length (specs);
+  for (Lisp_Object tail = specs; CONSP (tail); tail = XCDR (tail))
+    {
+      Lisp_Object spec = XCAR (tail);
+      CHECK_CONS (spec);
+      CHECK_CONS (XCDR (spec));
+      overlay_position (XCAR (spec), buffer);
+      overlay_position (XCAR (XCDR (spec)), buffer);
+      Lisp_Object props = XCDR (XCDR (spec));
+      CHECK_TYPE (list_length (props) % 2 == 0, Qplistp, props);
+    }
+
+  struct itree_node **nodes;
+  Lisp_Object result = Qnil, last = Qnil;
+  ptrdiff_t i = 0, modified_beg = PTRDIFF_MAX, modified_end = 0;
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (nodes, 1, n);
+
+  for (Lisp_Object tail = specs; CONSP (tail); tail = XCDR (tail))
+    {
+      Lisp_Object spec = XCAR (tail);
+      ptrdiff_t beg = overlay_position (XCAR (spec), buffer);
+      ptrdiff_t end = overlay_position (XCAR (XCDR (spec)), buffer);
+      Lisp_Object props = XCDR (XCDR (spec));
+
+      if (beg > end)
+	{
+	  ptrdiff_t temp = beg;
+	  beg = end;
+	  end = temp;
+	}
+
+      ptrdiff_t obeg = clip_to_bounds (BUF_BEG (b), beg, BUF_Z (b));
+      ptrdiff_t oend = clip_to_bounds (obeg, end, BUF_Z (b));
+      Lisp_Object ov = build_overlay (!NILP (front_advance),
+				      !NILP (rear_advance),
+				      Fcopy_sequence (props), Qnil, Qnil);
+      XOVERLAY (ov)->buffer = b;
+      nodes[i] = XOVERLAY (ov)->interval;
+      nodes[i]->begin = obeg;
+      nodes[i]->end = oend;
+      i++;
+
+      /* Only the overlays born with properties need redisplay.  */
+      if (!NILP (props))
+	{
+	  modified_beg = min (modified_beg, obeg);
+	  modified_end = max (modified_end, oend);
+	}
+
+      Lisp_Object cell = list1 (ov);
+      if (NILP (last))
+	result = cell;
+      else
+	XSETCDR (last, cell);
+      last = cell;
+    }
+
+  if (!b->overlays)
+    b->overlays = itree_create ();
+  itree_insert_nodes (b->overlays, nodes, n);
+  SAFE_FREE ();
+
+  if (modified_beg <= modified_end)
+    modify_overlay (b, modified_beg, modified_end);
+
+  /* Delete the empty overlays that evaporate, as `overlay-put' would.  */
+  for (Lisp_Object tail = result; CONSP (tail); tail = XCDR (tail))
+    {
+      Lisp_Object ov = XCAR (tail);
+      if (OVERLAY_START (ov) == OVERLAY_END (ov)
+	  && !NILP (Foverlay_get (ov, Qevaporate)))
+	Fdelete_overlay (ov);
+    }
+
+  return result;
+}
+
+DEFUN ("delete-overlays-in", Fdelete_overlays_in, Sdelete_overlays_in,
+       2, 5, 0,
+       doc: /* Delete the overlays of BUFFER that overlap the region BEG ... END.
+These are the overlays that `overlays-in' returns for the region.
+If PROP is non-nil, delete only the overlays whose property PROP is
+`eq' to VALUE.
+BUFFER omitted or nil means the current buffer.
+Return the number of overlays deleted.
+
+This does what calling `delete-overlay' for each of the overlays would
+do, but much faster when there are many.  */)
+  (Lisp_Object beg, Lisp_Object end, Lisp_Object buffer, Lisp_Object prop,
+   Lisp_Object value)
+{
+  struct buffer *b;
+
+  if (NILP (buffer))
+    b = current_buffer;
+  else
+    {
+      CHECK_BUFFER (buffer);
+      b = XBUFFER (buffer);
+    }
+  CHECK_FIXNUM_COERCE_MARKER (beg);
+  CHECK_FIXNUM_COERCE_MARKER (end);
+
+  if (!b->overlays)
+    return make_fixnum (0);
+
+  ptrdiff_t len = 10, noverlays;
+  Lisp_Object *overlay_vec = xmalloc (len * sizeof *overlay_vec);
+  struct buffer *old = current_buffer;
+  set_buffer_temp (b);
+  noverlays = overlays_in (XFIXNUM (beg), XFIXNUM (end), true,
+			   &overlay_vec, &len, true, false, NULL);
+  set_buffer_temp (old);
+
+  /* Remove the overlays from the tree all at once, except those of
+     mode overlay buffers, which `delete-overlay' must clean up
+     after, and which are deleted last, as that runs Lisp.  */
+  struct itree_node **nodes = xmalloc (noverlays * sizeof *nodes);
+  Lisp_Object mode_overlays = Qnil;
+  ptrdiff_t ndeleted = 0, nnodes = 0;
+  for (ptrdiff_t i = 0; i < noverlays; i++)
+    {
+      Lisp_Object ov = overlay_vec[i];
+      struct buffer *obuffer = OVERLAY_BUFFER (ov);
+
+      if (!NILP (prop) && !EQ (Foverlay_get (ov, prop), value))
+	continue;
+      ndeleted++;
+      if (MODE_OVERLAY_INDIRECT_P (obuffer))
+	mode_overlays = Fcons (ov, mode_overlays);
+      else
+	{
+	  modify_deleted_overlay (obuffer, ov);
+	  nodes[nnodes++] = XOVERLAY (ov)->interval;
+	}
+    }
+  itree_remove_nodes (b->overlays, nodes, nnodes);
+  for (ptrdiff_t i = 0; i < nnodes; i++)
+    XOVERLAY (nodes[i]->data)->buffer = NULL;
+  xfree (nodes);
+  xfree (overlay_vec);
+
+  for (; CONSP (mode_overlays); mode_overlays = XCDR (mode_overlays))
+    Fdelete_overlay (XCAR (mode_overlays));
+
+  return make_fixnum (ndeleted);
+}
+
 /* Overlay dissection functions.  */
 
 DEFUN ("overlay-start", Foverlay_start, Soverlay_start, 1, 1, 0,
@@ -6151,6 +6383,8 @@ Functions (implicitly) running this hook are `get-buffer-create',
   defsubr (&Smake_overlay);
   defsubr (&Sdelete_overlay);
   defsubr (&Sdelete_all_overlays);
+  defsubr (&Smake_overlays);
+  defsubr (&Sdelete_overlays_in);
   defsubr (&Smove_overlay);
   defsubr (&Soverlay_start);
   defsubr (&Soverlay_end);
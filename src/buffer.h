@@ -712,6 +712,17 @@ #define UNDO_BOUNDARY Qnil
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* Newline counts of the text, chunk by chunk, so that line numbers
+     far from any known position can be found without scanning all
+     the text in between.  Null until a long scan needs it; see
+     search.c.  */
+  struct line_index *line_index;
+
+  /* Parse states saved at intervals through the text, from which
+     parse-partial-sexp and friends can resume.  Null until a parse
+     needs them; see syntax.c.  */
+  struct syntax_checkpoints *syntax_checkpoints;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -1678,6 +1689,7 @@ dec_both (ptrdiff_t *charpos, ptrdiff_t *bytepos)
 INLINE_HEADER_END
 
 int compare_overlays (const void *v1, const void *v2);
-void make_sortvec_item (struct sortvec *item, Lisp_Object overlay);
+void make_sortvec_item (struct sortvec *item, Lisp_Object overlay,
+			ptrdiff_t beg, ptrdiff_t end);
 
 #endif /* EMACS_BUFFER_H */
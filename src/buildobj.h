@@ -0,0 +1,78 @@
+"dispnew.o",
+"frame.o",
+"scroll.o",
+"xdisp.o",
+"menu.o",
+"window.o",
+"charset.o",
+"coding.o",
+"category.o",
+"ccl.o",
+"character.o",
+"chartab.o",
+"bidi.o",
+"cm.o",
+"term.o",
+"terminal.o",
+"xfaces.o",
+"emacs.o",
+"keyboard.o",
+"macros.o",
+"keymap.o",
+"sysdep.o",
+"bignum.o",
+"buffer.o",
+"filelock.o",
+"insdel.o",
+"marker.o",
+"minibuf.o",
+"fileio.o",
+"dired.o",
+"cmds.o",
+"casetab.o",
+"casefiddle.o",
+"indent.o",
+"search.o",
+"regex-emacs.o",
+"undo.o",
+"alloc.o",
+"mem_node.o",
+"pdumper_write.o",
+"pdumper_read.o",
+"data.o",
+"doc.o",
+"editfns.o",
+"callint.o",
+"eval.o",
+"floatfns.o",
+"fns.o",
+"sort.o",
+"font.o",
+"print.o",
+"lread.o",
+"emacs-module.o",
+"syntax.o",
+"bytecode.o",
+"comp.o",
+"dynlib.o",
+"process.o",
+"gnutls.o",
+"callproc.o",
+"region-cache.o",
+"sound.o",
+"timefns.o",
+"atimer.o",
+"doprnt.o",
+"intervals.o",
+"textprop.o",
+"composite.o",
+"xml.o",
+"lcms.o",
+"profiler.o",
+"decompress.o",
+"thread.o",
+"systhread.o",
+"itree.o",
+"json.o",
+"terminfo.o",
+"lastfile.o",
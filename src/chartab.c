@@ -542,6 +542,7 @@ DEFUN ("set-char-table-parent", Fset_char_table_parent, Sset_char_table_parent,
     }
 
   set_char_table_parent (char_table, parent);
+  clear_sline_caches ();
 
   return parent;
 }
@@ -573,6 +574,7 @@ DEFUN ("set-char-table-extra-slot", Fset_char_table_extra_slot,
     args_out_of_range (char_table, n);
 
   set_char_table_extras (char_table, XFIXNUM (n), value);
+  clear_sline_caches ();
   return value;
 }
 
@@ -638,6 +640,7 @@ DEFUN ("set-char-table-range", Fset_char_table_range, Sset_char_table_range,
   else
     error ("Invalid RANGE argument to `set-char-table-range'");
 
+  clear_sline_caches ();
   return value;
 }
 
@@ -390,6 +390,8 @@ DEFUN ("cl-type-of", Fcl_type_of, Scl_type_of, 1, 1, 0,
 	  return Qtree_sitter_node;
 	case PVEC_TREE_SITTER_CURSOR:
 	  return Qtree_sitter_cursor;
+	case PVEC_JSON_STREAM:
+	  return Qjson_stream;
         /* "Impossible" cases.  */
 	case PVEC_MISC_PTR:
         case PVEC_OTHER:
@@ -2308,6 +2310,8 @@ DEFUN ("aset", Faset, Saset, 3, 3, 0,
     {
       CHECK_CHARACTER (idx);
       CHAR_TABLE_SET (array, idxval, newelt);
+      /* Display tables and the like affect screen lines.  */
+      clear_sline_caches ();
     }
   else if (RECORDP (array))
     {
@@ -3896,6 +3900,7 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qtree_sitter, "tree-sitter");
   DEFSYM (Qtree_sitter_node, "tree-sitter-node");
   DEFSYM (Qtree_sitter_cursor, "tree-sitter-cursor");
+  DEFSYM (Qjson_stream, "json-stream");
   DEFSYM (Qsqlite, "sqlite");
   DEFSYM (Qobarray, "obarray");
 
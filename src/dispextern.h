@@ -1027,9 +1027,19 @@ #define CHECK_MATRIX(MATRIX) ((void) 0)
   /* Whether a stipple was ever drawn at this row.  */
   bool_bf stipple_p : 1;
 
+  /* Whether the line number was drawn in the face of the current
+     line.  */
+  bool_bf lnum_current_p : 1;
+
   /* Continuation lines width from row start.  */
   int continuation_lines_width;
 
+  /* The line number displayed in front of this row, counting from 1,
+     or zero if none, and the width in columns it was displayed with.
+     try_window_insdel reuses the row only if these still hold.  */
+  ptrdiff_t lnum;
+  int lnum_width;
+
 #ifdef HAVE_WINDOW_SYSTEM
   /* Current clipping area temporarily set while exposing a region.
      Coordinates are frame-relative.  */
@@ -1814,13 +1824,27 @@ #define FACE_UNIBYTE_P(FACE) ((FACE)->charset < 0)
 
 #define MAX_FACE_ID  ((1 << FACE_ID_BITS) - 1)
 
+/* An entry of the memo of a face cache: merging the face named
+   FACE_REF into the realized face BASE_FACE_ID, with the attribute
+   filter ATTR_FILTER, gave the realized face FACE_ID.  Unused entries
+   have a nil FACE_REF.  */
+
+struct face_memo
+{
+  Lisp_Object face_ref;
+  int base_face_id;
+  int attr_filter;
+  int face_id;
+};
+
 /* A cache of realized faces.  Each frame has its own cache because
    Emacs allows different frame-local face definitions.  */
 
 struct face_cache
 {
-  /* Hash table of cached realized faces.  */
+  /* Hash table of cached realized faces, and its number of buckets.  */
   struct face **buckets;
+  int buckets_size;
 
   /* Back-pointer to the frame this cache belongs to.  */
   struct frame *f;
@@ -1832,6 +1856,16 @@ #define MAX_FACE_ID  ((1 << FACE_ID_BITS) - 1)
   ptrdiff_t size;
   int used;
 
+  /* Memo of the faces that result from merging face references into
+     realized faces, an open-addressing hash table of MEMO_SIZE slots of
+     which MEMO_USED are used.  See lookup_merged_face.  */
+  struct face_memo *memo;
+  int memo_size, memo_used;
+
+  /* Number of lookups answered by the memo, and of those that were
+     not, since the statistics were last reset.  */
+  EMACS_INT memo_hits, memo_misses;
+
   /* Flag indicating that attributes of the `menu' face have been
      changed.  */
   bool_bf menu_face_changed_p : 1;
@@ -3350,6 +3384,12 @@ #define TTY_CAP_UNDERLINE_STYLED	(0x32 & TTY_CAP_UNDERLINE)
 int estimate_mode_line_height (struct frame *, enum face_id);
 int move_it_forward (struct it *, ptrdiff_t, int, int, bool *);
 void move_it_backward (struct it *, int, int);
+void free_sline_cache (struct window *);
+void mark_sline_cache (struct window *);
+ptrdiff_t window_next_overlay_change (struct window *, ptrdiff_t);
+ptrdiff_t window_overlays_at (struct window *, ptrdiff_t, Lisp_Object **,
+			      ptrdiff_t *, ptrdiff_t *);
+Lisp_Object *recorded_overlays_at (ptrdiff_t, ptrdiff_t *);
 void pixel_to_glyph_coords (struct frame *, int, int, int *, int *,
                             NativeRectangle *, bool);
 void remember_mouse_glyph (struct frame *, int, int, NativeRectangle *);
@@ -3368,6 +3408,8 @@ #define TTY_CAP_UNDERLINE_STYLED	(0x32 & TTY_CAP_UNDERLINE)
 bool in_display_vector_p (struct it *);
 int frame_mode_line_height (struct frame *);
 bool has_display_prop (Lisp_Object properties);
+void add_redisplay_update_statistic (struct window *, EMACS_INT,
+				     struct timespec);
 
 extern bool redisplaying_p;
 extern bool help_echo_showing_p;
@@ -3377,6 +3419,7 @@ #define TTY_CAP_UNDERLINE_STYLED	(0x32 & TTY_CAP_UNDERLINE)
 extern int last_tab_bar_item;
 extern int last_tool_bar_item;
 extern void reseat_preceding_line_start (struct it *);
+extern void reseat_preceding_sline_start (struct it *);
 extern Lisp_Object buffer_posn_from_coords (struct window *,
                                             int, int,
                                             struct display_pos *,
@@ -3569,6 +3612,7 @@ #define RGB_PIXEL_COLOR COLORREF
                          Lisp_Object, int, bool);
 void init_frame_faces (struct frame *);
 void free_frame_faces (struct frame *);
+void clear_face_memo (struct face_cache *);
 void recompute_basic_faces (struct frame *);
 int face_at_buffer_position (struct window *, ptrdiff_t, ptrdiff_t *,
                              ptrdiff_t, bool, int, enum lface_attribute_index);
@@ -1068,13 +1068,12 @@ line_hash_code (struct frame *f, struct glyph_row *row)
     {
       struct glyph *glyph = row->glyphs[TEXT_AREA];
       struct glyph *end = glyph + row->used[TEXT_AREA];
+      int space = FRAME_MUST_WRITE_SPACES (f) ? SPACEGLYPH : 0;
 
       while (glyph < end)
 	{
-	  int c = glyph->u.ch;
+	  int c = glyph->u.ch - space;
 	  int face_id = glyph->face_id;
-	  if (FRAME_MUST_WRITE_SPACES (f))
-	    c -= SPACEGLYPH;
 	  hash = (((hash << 4) + (hash >> 24)) & 0x0fffffff) + c;
 	  hash = (((hash << 4) + (hash >> 24)) & 0x0fffffff) + face_id;
 	  ++glyph;
@@ -1148,6 +1147,50 @@ line_draw_cost (struct frame *f, struct glyph_matrix *matrix, int vpos)
 }
 
 
+/* Number of glyphs count_equal_glyphs compares with one memcmp.  */
+
+enum { GLYPH_COMPARE_CHUNK = 16 };
+
+/* Return the number of glyphs at the start of the N glyphs at A and
+   B that are displayed equal, as GLYPH_EQUAL_P tells.  Glyphs that
+   are bytewise equal are equal, so skip such glyphs in chunks with
+   memcmp, which is vectorized, and compare glyphs member by member
+   only in chunks that differ, for example in their positions.  */
+
+static ptrdiff_t
+count_equal_glyphs (struct glyph *a, struct glyph *b, ptrdiff_t n)
+{
+  ptrdiff_t i = 0;
+
+  while (i < n)
+    {
+      ptrdiff_t end = min (n, i + GLYPH_COMPARE_CHUNK);
+
+      if (memcmp (a + i, b + i, (end - i) * sizeof *a) == 0)
+	i = end;
+      else
+	{
+	  for (; i < end; ++i)
+	    if (!GLYPH_EQUAL_P (a + i, b + i))
+	      return i;
+
+	  /* Glyphs that are equal without being bytewise equal come
+	     in runs, after an insertion, say.  Don't bother with
+	     memcmp for the rest of them.  */
+	  while (i < n && GLYPH_EQUAL_P (a + i, b + i))
+	    ++i;
+	  return i;
+	}
+    }
+
+  return i;
+}
+
+/* Number of glyphs row_equal_p has compared, for
+   `redisplay-statistics'.  */
+
+static EMACS_INT row_equal_glyphs;
+
 /* Return true if the glyph rows A and B have equal contents.
    MOUSE_FACE_P means compare the mouse_face_p flags of A and B, too.  */
 
@@ -1163,7 +1206,7 @@ row_equal_p (struct glyph_row *a, struct glyph_row *b, bool mouse_face_p)
     return 0;
   else
     {
-      struct glyph *a_glyph, *b_glyph, *a_end;
+      ptrdiff_t neq;
       int area;
 
       if (mouse_face_p && a->mouse_face_p != b->mouse_face_p)
@@ -1175,15 +1218,10 @@ row_equal_p (struct glyph_row *a, struct glyph_row *b, bool mouse_face_p)
 	  if (a->used[area] != b->used[area])
 	    return 0;
 
-	  a_glyph = a->glyphs[area];
-	  a_end = a_glyph + a->used[area];
-	  b_glyph = b->glyphs[area];
-
-	  while (a_glyph < a_end
-		 && GLYPH_EQUAL_P (a_glyph, b_glyph))
-	    ++a_glyph, ++b_glyph;
-
-	  if (a_glyph != a_end)
+	  neq = count_equal_glyphs (a->glyphs[area], b->glyphs[area],
+				    a->used[area]);
+	  row_equal_glyphs += neq;
+	  if (neq != a->used[area])
 	    return 0;
 	}
 
@@ -2299,6 +2337,7 @@ free_window_matrices (struct window *w)
 	  free_glyph_matrix (w->current_matrix);
 	  free_glyph_matrix (w->desired_matrix);
 	  w->current_matrix = w->desired_matrix = NULL;
+	  free_sline_cache (w);
 	}
 
       /* Next window on same level.  */
@@ -3124,6 +3163,9 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
       goto do_pause;
     }
 
+  if (redisplay_frame_updates < INTMAX_MAX)
+    redisplay_frame_updates++;
+
   if (FRAME_WINDOW_P (f))
     {
       /* We are working on window matrix basis.  All windows whose
@@ -3536,6 +3578,10 @@ update_window (struct window *w, bool force_p)
   eassert (FRAME_WINDOW_P (XFRAME (WINDOW_FRAME (w))));
 #endif
 
+  EMACS_INT glyphs = row_equal_glyphs;
+  struct timespec start = (redisplay_record_statistics
+			   ? current_timespec () : make_timespec (0, 0));
+
   /* Check pending input the first time so that we can quickly return.  */
   if (!force_p)
     detect_input_pending_ignore_squeezables ();
@@ -3752,6 +3798,9 @@ update_window (struct window *w, bool force_p)
   xwidget_end_redisplay (w, w->current_matrix);
   clear_glyph_matrix (desired_matrix);
 
+  if (redisplay_record_statistics)
+    add_redisplay_update_statistic (w, row_equal_glyphs - glyphs, start);
+
   return paused_p;
 }
 
@@ -4838,8 +4887,14 @@ update_frame_1 (struct frame *f, bool force_p, bool inhibit_id_p,
       if (MATRIX_ROW_ENABLED_P (desired_matrix, i))
 	{
 	  /* Note that output_buffer_size being 0 means that we want the
-	     old default behavior of flushing output every now and then.  */
-	  if (FRAME_TERMCAP_P (f) && FRAME_TTY (f)->output_buffer_size == 0)
+	     old default behavior of flushing output every now and then.
+	     That is moot if the terminal collects the update in memory
+	     to send it in one go.  */
+	  if (FRAME_TERMCAP_P (f) && FRAME_TTY (f)->output_buffer_size == 0
+#ifdef HAVE_OPEN_MEMSTREAM
+	      && !FRAME_TTY (f)->device_output
+#endif
+	      )
 	    {
 	      /* Flush out every so many lines.
 		 Also flush out if likely to have more than 1k buffered
@@ -5076,8 +5131,9 @@ count_blanks (struct glyph *r, int len)
 static int
 count_match (struct glyph *str1, struct glyph *end1, struct glyph *str2, struct glyph *end2)
 {
-  struct glyph *p1 = str1;
-  struct glyph *p2 = str2;
+  ptrdiff_t n = min (end1 - str1, end2 - str2);
+  struct glyph *p1 = str1 + count_equal_glyphs (str1, str2, n);
+  struct glyph *p2 = str2 + (p1 - str1);
 
   while (p1 < end1
 	 && p2 < end2
@@ -5202,7 +5258,8 @@ update_frame_line (struct frame *f, int vpos, bool updating_menu_p)
 
       /* Find the first glyph in desired row that doesn't agree with
 	 a glyph in the current row, and write the rest from there on.  */
-      for (i = 0; i < nlen; i++)
+      for (i = count_equal_glyphs (nbody, obody, min (nlen, olen));
+	   i < nlen; i++)
 	{
 	  if (i >= olen || !GLYPH_EQUAL_P (nbody + i, obody + i))
 	    {
@@ -6530,6 +6587,11 @@ syms_of_display (void)
      beginning of the next redisplay).  */
   redisplay_dont_pause = true;
 
+  DEFVAR_INT ("redisplay--frame-updates", redisplay_frame_updates,
+	      doc: /* Number of times a frame's display was updated.
+Internal use only, for benchmarks.  */);
+  redisplay_frame_updates = 0;
+
   DEFVAR_LISP ("x-show-tooltip-timeout", Vx_show_tooltip_timeout,
 	      doc: /* The default timeout (in seconds) for `x-show-tip'.  */);
   Vx_show_tooltip_timeout = make_fixnum (5);
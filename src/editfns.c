@@ -348,7 +348,8 @@ DEFUN ("get-pos-property", Fget_pos_property, Sget_pos_property, 2, 3, 0,
 
 	  struct sortvec *this = (result == items ? items + 1 : items);
           if (NILP (res)
-              || (make_sortvec_item (this, node->data),
+              || (make_sortvec_item (this, node->data,
+				     node->begin, node->end),
                   compare_overlays (result, this) < 0))
             {
               result = this;
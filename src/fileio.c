@@ -5099,6 +5099,13 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
     invalidate_region_cache (current_buffer,
                              current_buffer->newline_cache,
                              PT - BEG, Z - PT - inserted);
+  if (current_buffer->base_buffer && current_buffer->base_buffer->line_index)
+    invalidate_line_index (current_buffer->base_buffer->line_index,
+			   PT - BEG, Z - PT - inserted);
+  else if (current_buffer->line_index)
+    invalidate_line_index (current_buffer->line_index,
+			   PT - BEG, Z - PT - inserted);
+  invalidate_syntax_checkpoints (current_buffer, PT);
 
   if (read_quit)
     quit ();
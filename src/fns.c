@@ -4531,10 +4531,21 @@ set_hash_hash_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, hash_hash_t val)
   h->hash[idx] = val;
 }
 static void
-set_hash_index_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, ptrdiff_t val)
+set_hash_index_ctrl (struct Lisp_Hash_Table *h, ptrdiff_t slot,
+		     unsigned char ctrl)
 {
-  eassert (idx >= 0 && idx < hash_table_index_size (h));
-  h->index[idx] = val;
+  eassert (slot >= 0 && slot < hash_table_index_size (h));
+  h->index[slot >> HASH_GROUP_BITS].ctrl[slot & (HASH_GROUP_WIDTH - 1)]
+    = ctrl;
+}
+static void
+set_hash_index_slot (struct Lisp_Hash_Table *h, ptrdiff_t slot,
+		     ptrdiff_t idx, unsigned char ctrl)
+{
+  eassert (slot >= 0 && slot < hash_table_index_size (h));
+  struct hash_index_group *group = &h->index[slot >> HASH_GROUP_BITS];
+  group->ctrl[slot & (HASH_GROUP_WIDTH - 1)] = ctrl;
+  group->entry[slot & (HASH_GROUP_WIDTH - 1)] = idx;
 }
 
 /* If OBJ is a Lisp hash table, return a pointer to its struct
@@ -4590,8 +4601,8 @@ larger_vector (Lisp_Object vec, ptrdiff_t incr_min, ptrdiff_t nitems_max)
 }
 
 
-/* Return the index of the next entry in H following the one at IDX,
-   or -1 if none.  */
+/* Return the index of the free entry in H following the free entry
+   at IDX, or -1 if none.  */
 
 static ptrdiff_t
 HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
@@ -4600,14 +4611,23 @@ HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return h->next[idx];
 }
 
-/* Return the index of the element in hash table H that is the start
-   of the collision list at index IDX, or -1 if the list is empty.  */
+/* Return the control byte of slot SLOT of the index of H.  */
+
+static unsigned char
+HASH_INDEX_CTRL (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  eassert (slot >= 0 && slot < hash_table_index_size (h));
+  return h->index[slot >> HASH_GROUP_BITS].ctrl[slot & (HASH_GROUP_WIDTH - 1)];
+}
+
+/* Return the index of the element in hash table H that slot SLOT of
+   the index points to.  The slot must hold a tag.  */
 
 static ptrdiff_t
-HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t idx)
+HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t slot)
 {
-  eassert (idx >= 0 && idx < hash_table_index_size (h));
-  return h->index[idx];
+  eassert (HASH_INDEX_CTRL (h, slot) < HASH_CTRL_EMPTY);
+  return h->index[slot >> HASH_GROUP_BITS].entry[slot & (HASH_GROUP_WIDTH - 1)];
 }
 
 /* Restore a hash table's mutability after the critical section exits.  */
@@ -4737,16 +4757,40 @@ compute_hash_index_bits (hash_idx_t size)
   hash_idx_t upper_bound = min (MOST_POSITIVE_FIXNUM,
 				min (TYPE_MAXIMUM (hash_idx_t),
 				     PTRDIFF_MAX / sizeof (hash_idx_t)));
-  /* Use next higher power of 2.  This works even for size=0.  */
-  int bits = elogb (size) + 1;
+  /* Use a power of 2 that keeps the load factor of a full table
+     below 4/5, and at least one group.  */
+  int bits = max (elogb (size + (ptrdiff_t) size / 4) + 1, HASH_GROUP_BITS);
   if (bits >= TYPE_WIDTH (uintmax_t) || ((uintmax_t)1 << bits) > upper_bound)
     error ("Hash table too large");
   return bits;
 }
 
-/* Constant hash index vector used when the table size is zero.
+/* Number of slots of an index of INDEX_SIZE slots that may be claimed
+   before it must be rebuilt.  At least one slot in eight is kept empty
+   so that unsuccessful probes terminate early.  */
+static ptrdiff_t
+hash_index_capacity (ptrdiff_t index_size)
+{
+  return index_size - index_size / 8;
+}
+
+/* Number of bytes of an index of INDEX_SIZE slots.  */
+static ptrdiff_t
+hash_index_bytes (ptrdiff_t index_size)
+{
+  return index_size / HASH_GROUP_WIDTH * sizeof (struct hash_index_group);
+}
+
+/* Constant hash index used when the table size is zero.
    This avoids allocating it from the heap.  */
-static const hash_idx_t empty_hash_index_vector[] = {-1};
+static const struct hash_index_group empty_hash_index_group =
+  {
+    .ctrl = { HASH_CTRL_EMPTY, HASH_CTRL_EMPTY, HASH_CTRL_EMPTY,
+	      HASH_CTRL_EMPTY, HASH_CTRL_EMPTY, HASH_CTRL_EMPTY,
+	      HASH_CTRL_EMPTY, HASH_CTRL_EMPTY },
+  };
+
+static void hash_index_clear (struct Lisp_Hash_Table *);
 
 /* Create and initialize a new hash table.
 
@@ -4779,8 +4823,9 @@ make_hash_table (const struct hash_table_test *test, EMACS_INT size,
       h->key_and_value = NULL;
       h->hash = NULL;
       h->next = NULL;
-      h->index_bits = 0;
-      h->index = (hash_idx_t *)empty_hash_index_vector;
+      h->index_bits = HASH_GROUP_BITS;
+      h->index = (struct hash_index_group *)&empty_hash_index_group;
+      h->growth_left = 0;
       h->next_free = -1;
     }
   else
@@ -4799,10 +4844,9 @@ make_hash_table (const struct hash_table_test *test, EMACS_INT size,
 
       int index_bits = compute_hash_index_bits (size);
       h->index_bits = index_bits;
-      ptrdiff_t index_size = hash_table_index_size (h);
-      h->index = hash_table_alloc_bytes (index_size * sizeof *h->index);
-      for (ptrdiff_t i = 0; i < index_size; i++)
-	h->index[i] = -1;
+      h->index = hash_table_alloc_bytes (hash_index_bytes
+					 (hash_table_index_size (h)));
+      hash_index_clear (h);
 
       h->next_free = 0;
     }
@@ -4839,18 +4883,196 @@ copy_hash_table (struct Lisp_Hash_Table *h1)
       h2->next = hash_table_alloc_bytes (next_bytes);
       memcpy (h2->next, h1->next, next_bytes);
 
-      ptrdiff_t index_bytes = hash_table_index_size (h1) * sizeof *h1->index;
+      ptrdiff_t index_bytes = hash_index_bytes (hash_table_index_size (h1));
       h2->index = hash_table_alloc_bytes (index_bytes);
       memcpy (h2->index, h1->index, index_bytes);
     }
   return make_lisp_hash_table (h2);
 }
 
-/* Compute index into the index vector from a hash value.  */
+/* Compute the index group probed first for a hash value.  */
 static inline ptrdiff_t
 hash_index_index (struct Lisp_Hash_Table *h, hash_hash_t hash)
 {
-  return knuth_hash (hash, h->index_bits);
+  return knuth_hash (hash, h->index_bits - HASH_GROUP_BITS);
+}
+
+/* Compute the control byte tag of a hash value.  A second
+   multiplicative hash keeps the tag independent of the group that
+   hash_index_index picks, so that tags of colliding entries differ.  */
+static inline unsigned char
+hash_ctrl_tag (hash_hash_t hash)
+{
+  unsigned int product = (hash * 0x85ebca6bu) & 0xffffffffu;
+  return product >> 25;
+}
+
+/* The control bytes of an index group, loaded into a word so that all
+   of them are tested at once.  The hash_group_match functions return
+   a mask with bit 7 of byte I set when slot I of the group qualifies.  */
+typedef uint64_t hash_group_t;
+static_assert (sizeof (hash_group_t) == HASH_GROUP_WIDTH);
+
+#define HASH_GROUP_LSBS UINT64_C (0x0101010101010101)
+#define HASH_GROUP_MSBS UINT64_C (0x8080808080808080)
+
+static inline hash_group_t
+hash_group_load (const struct hash_index_group *group)
+{
+  hash_group_t ctrl;
+  memcpy (&ctrl, group->ctrl, sizeof ctrl);
+#ifdef WORDS_BIGENDIAN
+  ctrl = bswap_64 (ctrl);
+#endif
+  return ctrl;
+}
+
+/* Slots whose control byte in CTRL is TAG.  A slot just above a
+   matching one may be reported spuriously, but only if it is in use,
+   and the caller compares its key anyway.  */
+static inline hash_group_t
+hash_group_match (hash_group_t ctrl, unsigned char tag)
+{
+  hash_group_t x = ctrl ^ (HASH_GROUP_LSBS * tag);
+  return (x - HASH_GROUP_LSBS) & ~x & HASH_GROUP_MSBS;
+}
+
+/* Slots that are empty according to CTRL.  HASH_CTRL_EMPTY is the
+   only control byte with bit 7 set and bit 1 clear.  */
+static inline hash_group_t
+hash_group_match_empty (hash_group_t ctrl)
+{
+  return ctrl & ~(ctrl << 6) & HASH_GROUP_MSBS;
+}
+
+/* Slots that are empty or deleted according to CTRL.  */
+static inline hash_group_t
+hash_group_match_free (hash_group_t ctrl)
+{
+  return ctrl & HASH_GROUP_MSBS;
+}
+
+/* Position within its group of the first slot in the nonzero MATCH.  */
+static inline int
+hash_group_first (hash_group_t match)
+{
+  return stdc_trailing_zeros (match) / CHAR_BIT;
+}
+
+/* State of a probe through the index of a hash table.  Groups are
+   visited in triangular order, which covers every group of a
+   power-of-2 sized index exactly once.  */
+struct hash_probe
+{
+  ptrdiff_t group;
+  ptrdiff_t stride;
+  ptrdiff_t mask;
+};
+
+static inline struct hash_probe
+hash_probe_start (struct Lisp_Hash_Table *h, hash_hash_t hash)
+{
+  return (struct hash_probe) {
+    .group = hash_index_index (h, hash),
+    .stride = 0,
+    .mask = (hash_table_index_size (h) >> HASH_GROUP_BITS) - 1,
+  };
+}
+
+static inline void
+hash_probe_next (struct hash_probe *p)
+{
+  p->stride++;
+  p->group = (p->group + p->stride) & p->mask;
+}
+
+/* Point a free slot in the index of H at entry IDX, whose hash code
+   is HASH.  The caller ensures that H->growth_left is positive.  */
+static void
+hash_index_insert (struct Lisp_Hash_Table *h, ptrdiff_t idx,
+		   hash_hash_t hash)
+{
+  for (struct hash_probe p = hash_probe_start (h, hash); ;
+       hash_probe_next (&p))
+    {
+      hash_group_t free = hash_group_match_free (hash_group_load
+						 (&h->index[p.group]));
+      if (free)
+	{
+	  ptrdiff_t slot = (p.group << HASH_GROUP_BITS) + hash_group_first (free);
+	  if (HASH_INDEX_CTRL (h, slot) == HASH_CTRL_EMPTY)
+	    {
+	      eassert (h->growth_left > 0);
+	      h->growth_left--;
+	    }
+	  set_hash_index_slot (h, slot, idx, hash_ctrl_tag (hash));
+	  return;
+	}
+    }
+}
+
+/* Vacate slot SLOT of the index of H.  A probe stops at the first
+   group with an empty slot, so no entry can lie beyond such a group
+   in its probe sequence; if SLOT's group has one, SLOT can become
+   empty too, otherwise it must be marked deleted.  */
+static void
+hash_index_remove (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  eassert (slot >= 0 && slot < hash_table_index_size (h));
+  if (hash_group_match_empty (hash_group_load
+			      (&h->index[slot >> HASH_GROUP_BITS])))
+    {
+      set_hash_index_ctrl (h, slot, HASH_CTRL_EMPTY);
+      h->growth_left++;
+    }
+  else
+    set_hash_index_ctrl (h, slot, HASH_CTRL_DELETED);
+}
+
+/* Mark all slots of the index of H empty.  */
+static void
+hash_index_clear (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t index_size = hash_table_index_size (h);
+  for (ptrdiff_t g = 0; g < index_size >> HASH_GROUP_BITS; g++)
+    memset (h->index[g].ctrl, HASH_CTRL_EMPTY, sizeof h->index[g].ctrl);
+  h->growth_left = hash_index_capacity (index_size);
+}
+
+/* Recompute the index of H from the hash codes of its entries,
+   discarding deleted slots.  */
+static void
+hash_index_rebuild (struct Lisp_Hash_Table *h)
+{
+  hash_index_clear (h);
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); i++)
+    if (!hash_unused_entry_key_p (HASH_KEY (h, i)))
+      hash_index_insert (h, i, HASH_HASH (h, i));
+}
+
+/* Return the index slot of H pointing to entry IDX, counting the
+   groups probed to reach it in *NPROBES if non-null.  */
+static ptrdiff_t
+hash_index_slot_of_entry (struct Lisp_Hash_Table *h, ptrdiff_t idx,
+			  ptrdiff_t *nprobes)
+{
+  hash_hash_t hash = HASH_HASH (h, idx);
+  unsigned char tag = hash_ctrl_tag (hash);
+  ptrdiff_t n = 1;
+  for (struct hash_probe p = hash_probe_start (h, hash); ;
+       hash_probe_next (&p), n++)
+    {
+      struct hash_index_group *group = &h->index[p.group];
+      hash_group_t ctrl = hash_group_load (group);
+      for (hash_group_t m = hash_group_match (ctrl, tag); m; m &= m - 1)
+	if (group->entry[hash_group_first (m)] == idx)
+	  {
+	    if (nprobes)
+	      *nprobes = n;
+	    return (p.group << HASH_GROUP_BITS) + hash_group_first (m);
+	  }
+      eassert (!hash_group_match_empty (ctrl));
+    }
 }
 
 /* Resize hash table H if it's too full.  If H cannot be resized
@@ -4890,16 +5112,15 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
       ptrdiff_t old_index_size = hash_table_index_size (h);
       ptrdiff_t index_bits = compute_hash_index_bits (new_size);
       ptrdiff_t index_size = (ptrdiff_t)1 << index_bits;
-      hash_idx_t *index = hash_table_alloc_bytes (index_size * sizeof *index);
-      for (ptrdiff_t i = 0; i < index_size; i++)
-	index[i] = -1;
+      struct hash_index_group *index
+	= hash_table_alloc_bytes (hash_index_bytes (index_size));
 
       h->index_bits = index_bits;
       h->table_size = new_size;
       h->next_free = old_size;
 
-      if (old_index_size > 1)
-	hash_table_free_bytes (h->index, old_index_size * sizeof *h->index);
+      if (old_size > 0)
+	hash_table_free_bytes (h->index, hash_index_bytes (old_index_size));
       h->index = index;
 
       hash_table_free_bytes (h->key_and_value,
@@ -4915,13 +5136,7 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
       h->key_and_value = key_and_value;
 
       /* Rehash: all data occupy entries 0..old_size-1.  */
-      for (ptrdiff_t i = 0; i < old_size; i++)
-	{
-	  hash_hash_t hash_code = HASH_HASH (h, i);
-	  ptrdiff_t start_of_bucket = hash_index_index (h, hash_code);
-	  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-	  set_hash_index_slot (h, start_of_bucket, i);
-	}
+      hash_index_rebuild (h);
 
 #ifdef ENABLE_CHECKING
       if (HASH_TABLE_P (Vpdumper__pure_pool) && XHASH_TABLE (Vpdumper__pure_pool) == h)
@@ -4960,8 +5175,9 @@ hash_table_thaw (Lisp_Object hash_table)
       h->key_and_value = NULL;
       h->hash = NULL;
       h->next = NULL;
-      h->index_bits = 0;
-      h->index = (hash_idx_t *)empty_hash_index_vector;
+      h->index_bits = HASH_GROUP_BITS;
+      h->index = (struct hash_index_group *)&empty_hash_index_group;
+      h->growth_left = 0;
     }
   else
     {
@@ -4972,21 +5188,41 @@ hash_table_thaw (Lisp_Object hash_table)
 
       h->next = hash_table_alloc_bytes (size * sizeof *h->next);
 
-      ptrdiff_t index_size = hash_table_index_size (h);
-      h->index = hash_table_alloc_bytes (index_size * sizeof *h->index);
-      for (ptrdiff_t i = 0; i < index_size; i++)
-	h->index[i] = -1;
+      h->index = hash_table_alloc_bytes (hash_index_bytes
+					 (hash_table_index_size (h)));
 
       /* Recompute the hash codes for each entry in the table.  */
       for (ptrdiff_t i = 0; i < size; i++)
+	set_hash_hash_slot (h, i, hash_from_key (h, HASH_KEY (h, i)));
+
+      hash_index_rebuild (h);
+    }
+}
+
+/* Look up KEY with hash HASH in table H.
+   Return the index slot pointing to its entry or -1 if none.  */
+static inline ptrdiff_t
+hash_lookup_slot (struct Lisp_Hash_Table *h,
+		  Lisp_Object key, hash_hash_t hash)
+{
+  unsigned char tag = hash_ctrl_tag (hash);
+  for (struct hash_probe p = hash_probe_start (h, hash); ;
+       hash_probe_next (&p))
+    {
+      struct hash_index_group *group = &h->index[p.group];
+      hash_group_t ctrl = hash_group_load (group);
+      for (hash_group_t m = hash_group_match (ctrl, tag); m; m &= m - 1)
 	{
-	  Lisp_Object key = HASH_KEY (h, i);
-	  hash_hash_t hash_code = hash_from_key (h, key);
-	  ptrdiff_t start_of_bucket = hash_index_index (h, hash_code);
-	  set_hash_hash_slot (h, i, hash_code);
-	  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-	  set_hash_index_slot (h, start_of_bucket, i);
+	  int lane = hash_group_first (m);
+	  ptrdiff_t i = group->entry[lane];
+	  if (EQ (key, HASH_KEY (h, i))
+	      || (h->test->cmpfn
+		  && hash == HASH_HASH (h, i)
+		  && !NILP (h->test->cmpfn (key, HASH_KEY (h, i), h))))
+	    return (p.group << HASH_GROUP_BITS) + lane;
 	}
+      if (hash_group_match_empty (ctrl))
+	return -1;
     }
 }
 
@@ -4996,16 +5232,8 @@ hash_table_thaw (Lisp_Object hash_table)
 hash_lookup_with_hash (struct Lisp_Hash_Table *h,
 		       Lisp_Object key, hash_hash_t hash)
 {
-  ptrdiff_t start_of_bucket = hash_index_index (h, hash);
-  for (ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
-       0 <= i; i = HASH_NEXT (h, i))
-    if (EQ (key, HASH_KEY (h, i))
-	|| (h->test->cmpfn
-	    && hash == HASH_HASH (h, i)
-	    && !NILP (h->test->cmpfn (key, HASH_KEY (h, i), h))))
-      return i;
-
-  return -1;
+  ptrdiff_t slot = hash_lookup_slot (h, key, hash);
+  return slot < 0 ? -1 : HASH_INDEX (h, slot);
 }
 
 /* Look up KEY in table H.  Return entry index or -1 if none.  */
@@ -5044,6 +5272,8 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
   eassert (!hash_unused_entry_key_p (key));
   /* Increment count after resizing because resizing may fail.  */
   maybe_resize_hash_table (h);
+  if (h->growth_left == 0)
+    hash_index_rebuild (h);
   h->count++;
 
   /* Store key/value in the key_and_value vector.  */
@@ -5056,10 +5286,8 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
   /* Remember its hash code.  */
   set_hash_hash_slot (h, i, hash);
 
-  /* Add new entry to its collision chain.  */
-  ptrdiff_t start_of_bucket = hash_index_index (h, hash);
-  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-  set_hash_index_slot (h, start_of_bucket, i);
+  /* Point a slot of the index at the new entry.  */
+  hash_index_insert (h, i, hash);
   return i;
 }
 
@@ -5070,36 +5298,23 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
 hash_remove_from_table (struct Lisp_Hash_Table *h, Lisp_Object key)
 {
   hash_hash_t hashval = hash_from_key (h, key);
-  ptrdiff_t start_of_bucket = hash_index_index (h, hashval);
-  ptrdiff_t prev = -1;
+  ptrdiff_t slot = hash_lookup_slot (h, key, hashval);
 
-  for (ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
-       0 <= i;
-       i = HASH_NEXT (h, i))
+  if (slot >= 0)
     {
-      if (EQ (key, HASH_KEY (h, i))
-	  || (h->test->cmpfn
-	      && hashval == HASH_HASH (h, i)
-	      && !NILP (h->test->cmpfn (key, HASH_KEY (h, i), h))))
-	{
-	  /* Take entry out of collision chain.  */
-	  if (prev < 0)
-	    set_hash_index_slot (h, start_of_bucket, HASH_NEXT (h, i));
-	  else
-	    set_hash_next_slot (h, prev, HASH_NEXT (h, i));
+      ptrdiff_t i = HASH_INDEX (h, slot);
 
-	  /* Clear slots in key_and_value and add the slots to
-	     the free list.  */
-	  set_hash_key_slot (h, i, HASH_UNUSED_ENTRY_KEY);
-	  set_hash_value_slot (h, i, Qnil);
-	  set_hash_next_slot (h, i, h->next_free);
-	  h->next_free = i;
-	  h->count--;
-	  eassert (h->count >= 0);
-	  break;
-	}
+      /* Take entry out of the index.  */
+      hash_index_remove (h, slot);
 
-      prev = i;
+      /* Clear slots in key_and_value and add the slots to
+	 the free list.  */
+      set_hash_key_slot (h, i, HASH_UNUSED_ENTRY_KEY);
+      set_hash_value_slot (h, i, Qnil);
+      set_hash_next_slot (h, i, h->next_free);
+      h->next_free = i;
+      h->count--;
+      eassert (h->count >= 0);
     }
 }
 
@@ -5119,9 +5334,7 @@ hash_clear (struct Lisp_Hash_Table *h)
 	  set_hash_value_slot (h, i, Qnil);
 	}
 
-      ptrdiff_t index_size = hash_table_index_size (h);
-      for (ptrdiff_t i = 0; i < index_size; i++)
-	h->index[i] = -1;
+      hash_index_clear (h);
 
       h->next_free = 0;
       h->count = 0;
@@ -5154,69 +5367,55 @@ keep_entry_p (hash_table_weakness_t weakness,
 bool
 sweep_weak_table (struct Lisp_Hash_Table *h, bool remove_entries_p)
 {
-  ptrdiff_t n = hash_table_index_size (h);
   bool marked = false;
 
-  for (ptrdiff_t bucket = 0; bucket < n; ++bucket)
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); i++)
     {
-      /* Follow collision chain, removing entries that don't survive
-         this garbage collection.  */
-      for (ptrdiff_t next, prev = -1, i = HASH_INDEX (h, bucket);
-	   i >= 0;
-	   i = next)
-        {
-	  bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, i));
-	  bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, i));
-	  bool remove_p = !keep_entry_p (h->weakness,
-					 key_known_to_survive_p,
-					 value_known_to_survive_p);
+      if (hash_unused_entry_key_p (HASH_KEY (h, i)))
+	continue;
 
-	  next = HASH_NEXT (h, i);
+      bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, i));
+      bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, i));
+      bool remove_p = !keep_entry_p (h->weakness,
+				     key_known_to_survive_p,
+				     value_known_to_survive_p);
 
-	  if (remove_entries_p)
+      if (remove_entries_p)
+	{
+	  eassert (!remove_p
+		   == (key_known_to_survive_p && value_known_to_survive_p));
+	  if (remove_p)
 	    {
-              eassert (!remove_p
-                       == (key_known_to_survive_p && value_known_to_survive_p));
-	      if (remove_p)
-		{
-		  /* Take out of collision chain.  */
-		  if (prev < 0)
-		    set_hash_index_slot (h, bucket, next);
-		  else
-		    set_hash_next_slot (h, prev, next);
+	      /* Take out of the index.  */
+	      hash_index_remove (h, hash_index_slot_of_entry (h, i, NULL));
 
-		  /* Add to free list.  */
-		  set_hash_next_slot (h, i, h->next_free);
-		  h->next_free = i;
+	      /* Add to free list.  */
+	      set_hash_next_slot (h, i, h->next_free);
+	      h->next_free = i;
 
-		  /* Clear key and value.  */
-		  set_hash_key_slot (h, i, HASH_UNUSED_ENTRY_KEY);
-		  set_hash_value_slot (h, i, Qnil);
+	      /* Clear key and value.  */
+	      set_hash_key_slot (h, i, HASH_UNUSED_ENTRY_KEY);
+	      set_hash_value_slot (h, i, Qnil);
 
-                  eassert (h->count != 0);
-                  h->count--;
-                }
-	      else
-		{
-		  prev = i;
-		}
+	      eassert (h->count != 0);
+	      h->count--;
 	    }
-	  else
+	}
+      else
+	{
+	  if (!remove_p)
 	    {
-	      if (!remove_p)
+	      /* Make sure key and value survive.  */
+	      if (!key_known_to_survive_p)
 		{
-		  /* Make sure key and value survive.  */
-		  if (!key_known_to_survive_p)
-		    {
-		      mark_object (hash_key_addr (h, i));
-                      marked = true;
-		    }
+		  mark_object (hash_key_addr (h, i));
+		  marked = true;
+		}
 
-		  if (!value_known_to_survive_p)
-		    {
-		      mark_object (hash_value_addr (h, i));
-                      marked = true;
-		    }
+	      if (!value_known_to_survive_p)
+		{
+		  mark_object (hash_value_addr (h, i));
+		  marked = true;
 		}
 	    }
 	}
@@ -5875,23 +6074,23 @@ DEFUN ("internal--hash-table-histogram",
        Finternal__hash_table_histogram,
        Sinternal__hash_table_histogram,
        1, 1, 0,
-       doc: /* Bucket size histogram of HASH-TABLE.  Internal use only. */)
+       doc: /* Probe length histogram of HASH-TABLE.  Internal use only.
+Each element is (N . COUNT) where COUNT is the number of entries found
+after probing N groups of the index.  */)
   (Lisp_Object hash_table)
 {
   struct Lisp_Hash_Table *h = check_hash_table (hash_table);
-  ptrdiff_t size = HASH_TABLE_SIZE (h);
-  ptrdiff_t *freq = xzalloc (size * sizeof *freq);
-  ptrdiff_t index_size = hash_table_index_size (h);
-  for (ptrdiff_t i = 0; i < index_size; i++)
+  ptrdiff_t ngroups = (hash_table_index_size (h) + HASH_GROUP_WIDTH - 1)
+		      / HASH_GROUP_WIDTH;
+  ptrdiff_t *freq = xzalloc (ngroups * sizeof *freq);
+  DOHASH_SAFE (h, i)
     {
-      ptrdiff_t n = 0;
-      for (ptrdiff_t j = HASH_INDEX (h, i); j != -1; j = HASH_NEXT (h, j))
-	n++;
-      if (n > 0)
-	freq[n - 1]++;
+      ptrdiff_t n;
+      hash_index_slot_of_entry (h, i, &n);
+      freq[n - 1]++;
     }
   Lisp_Object ret = Qnil;
-  for (ptrdiff_t i = 0; i < size; i++)
+  for (ptrdiff_t i = 0; i < ngroups; i++)
     if (freq[i] > 0)
       ret = Fcons (Fcons (make_int (i + 1), make_int (freq[i])),
 		   ret);
@@ -5903,22 +6102,28 @@ DEFUN ("internal--hash-table-buckets",
        Finternal__hash_table_buckets,
        Sinternal__hash_table_buckets,
        1, 1, 0,
-       doc: /* (KEY . HASH) in HASH-TABLE, grouped by bucket.
+       doc: /* (KEY . HASH) in HASH-TABLE, grouped by index group.
 Internal use only. */)
   (Lisp_Object hash_table)
 {
   struct Lisp_Hash_Table *h = check_hash_table (hash_table);
   Lisp_Object ret = Qnil;
-  ptrdiff_t index_size = hash_table_index_size (h);
-  for (ptrdiff_t i = 0; i < index_size; i++)
-    {
-      Lisp_Object bucket = Qnil;
-      for (ptrdiff_t j = HASH_INDEX (h, i); j != -1; j = HASH_NEXT (h, j))
-	bucket = Fcons (Fcons (HASH_KEY (h, j), make_int (HASH_HASH (h, j))),
-			bucket);
-      if (!NILP (bucket))
-	ret = Fcons (Fnreverse (bucket), ret);
-    }
+  if (h->table_size > 0)
+    for (ptrdiff_t g = 0; g < hash_table_index_size (h);
+	 g += HASH_GROUP_WIDTH)
+      {
+	Lisp_Object bucket = Qnil;
+	for (ptrdiff_t slot = g; slot < g + HASH_GROUP_WIDTH; slot++)
+	  if (HASH_INDEX_CTRL (h, slot) < HASH_CTRL_EMPTY)
+	    {
+	      ptrdiff_t j = HASH_INDEX (h, slot);
+	      bucket = Fcons (Fcons (HASH_KEY (h, j),
+				     make_int (HASH_HASH (h, j))),
+			      bucket);
+	    }
+	if (!NILP (bucket))
+	  ret = Fcons (Fnreverse (bucket), ret);
+      }
   return Fnreverse (ret);
 }
 
@@ -0,0 +1,7938 @@
+/* This file was auto-generated by make-docfile.  */
+/* DO NOT EDIT.  */
+struct emacs_globals {
+  Lisp_Object f_Vafter_change_functions;
+#define Vafter_change_functions globals.f_Vafter_change_functions
+  Lisp_Object f_Vafter_delete_frame_functions;
+#define Vafter_delete_frame_functions globals.f_Vafter_delete_frame_functions
+  Lisp_Object f_Vafter_init_time;
+#define Vafter_init_time globals.f_Vafter_init_time
+  Lisp_Object f_Vafter_insert_file_functions;
+#define Vafter_insert_file_functions globals.f_Vafter_insert_file_functions
+  Lisp_Object f_Vafter_load_alist;
+#define Vafter_load_alist globals.f_Vafter_load_alist
+  Lisp_Object f_Vambiguous_width_chars;
+#define Vambiguous_width_chars globals.f_Vambiguous_width_chars
+  Lisp_Object f_Vauto_composition_emoji_eligible_codepoints;
+#define Vauto_composition_emoji_eligible_codepoints globals.f_Vauto_composition_emoji_eligible_codepoints
+  Lisp_Object f_Vauto_composition_function;
+#define Vauto_composition_function globals.f_Vauto_composition_function
+  Lisp_Object f_Vauto_composition_mode;
+#define Vauto_composition_mode globals.f_Vauto_composition_mode
+  Lisp_Object f_Vauto_fill_chars;
+#define Vauto_fill_chars globals.f_Vauto_fill_chars
+  Lisp_Object f_Vauto_resize_tab_bars;
+#define Vauto_resize_tab_bars globals.f_Vauto_resize_tab_bars
+  Lisp_Object f_Vauto_resize_tool_bars;
+#define Vauto_resize_tool_bars globals.f_Vauto_resize_tool_bars
+  Lisp_Object f_Vauto_save_include_big_deletions;
+#define Vauto_save_include_big_deletions globals.f_Vauto_save_include_big_deletions
+  Lisp_Object f_Vauto_save_list_file_name;
+#define Vauto_save_list_file_name globals.f_Vauto_save_list_file_name
+  Lisp_Object f_Vauto_save_timeout;
+#define Vauto_save_timeout globals.f_Vauto_save_timeout
+  Lisp_Object f_Vauto_save_visited_file_name;
+#define Vauto_save_visited_file_name globals.f_Vauto_save_visited_file_name
+  Lisp_Object f_Vbefore_change_functions;
+#define Vbefore_change_functions globals.f_Vbefore_change_functions
+  Lisp_Object f_Vbefore_init_time;
+#define Vbefore_init_time globals.f_Vbefore_init_time
+  Lisp_Object f_Vblink_cursor_alist;
+#define Vblink_cursor_alist globals.f_Vblink_cursor_alist
+  Lisp_Object f_Vbuffer_access_fontified_property;
+#define Vbuffer_access_fontified_property globals.f_Vbuffer_access_fontified_property
+  Lisp_Object f_Vbuffer_access_fontify_functions;
+#define Vbuffer_access_fontify_functions globals.f_Vbuffer_access_fontify_functions
+  Lisp_Object f_Vbuffer_list_update_hook;
+#define Vbuffer_list_update_hook globals.f_Vbuffer_list_update_hook
+  Lisp_Object f_Vbuild_files;
+#define Vbuild_files globals.f_Vbuild_files
+  Lisp_Object f_Vbyte_boolean_vars;
+#define Vbyte_boolean_vars globals.f_Vbyte_boolean_vars
+  Lisp_Object f_Vbyte_code_meter;
+#define Vbyte_code_meter globals.f_Vbyte_code_meter
+  Lisp_Object f_Vbytecomp_version_regexp;
+#define Vbytecomp_version_regexp globals.f_Vbytecomp_version_regexp
+  Lisp_Object f_Vcase_fold_search;
+#define Vcase_fold_search globals.f_Vcase_fold_search
+  Lisp_Object f_Vchange_major_mode_hook;
+#define Vchange_major_mode_hook globals.f_Vchange_major_mode_hook
+  Lisp_Object f_Vchar_code_property_alist;
+#define Vchar_code_property_alist globals.f_Vchar_code_property_alist
+  Lisp_Object f_Vchar_property_alias_alist;
+#define Vchar_property_alias_alist globals.f_Vchar_property_alias_alist
+  Lisp_Object f_Vchar_script_table;
+#define Vchar_script_table globals.f_Vchar_script_table
+  Lisp_Object f_Vchar_width_table;
+#define Vchar_width_table globals.f_Vchar_width_table
+  Lisp_Object f_Vcharset_list;
+#define Vcharset_list globals.f_Vcharset_list
+  Lisp_Object f_Vcharset_map_path;
+#define Vcharset_map_path globals.f_Vcharset_map_path
+  Lisp_Object f_Vcharset_revision_table;
+#define Vcharset_revision_table globals.f_Vcharset_revision_table
+  Lisp_Object f_Vclear_message_function;
+#define Vclear_message_function globals.f_Vclear_message_function
+  Lisp_Object f_Vcode_conversion_map_vector;
+#define Vcode_conversion_map_vector globals.f_Vcode_conversion_map_vector
+  Lisp_Object f_Vcoding_category_list;
+#define Vcoding_category_list globals.f_Vcoding_category_list
+  Lisp_Object f_Vcoding_system_alist;
+#define Vcoding_system_alist globals.f_Vcoding_system_alist
+  Lisp_Object f_Vcoding_system_for_read;
+#define Vcoding_system_for_read globals.f_Vcoding_system_for_read
+  Lisp_Object f_Vcoding_system_for_write;
+#define Vcoding_system_for_write globals.f_Vcoding_system_for_write
+  Lisp_Object f_Vcoding_system_list;
+#define Vcoding_system_list globals.f_Vcoding_system_list
+  Lisp_Object f_Vcommand_debug_status;
+#define Vcommand_debug_status globals.f_Vcommand_debug_status
+  Lisp_Object f_Vcommand_error_function;
+#define Vcommand_error_function globals.f_Vcommand_error_function
+  Lisp_Object f_Vcommand_history;
+#define Vcommand_history globals.f_Vcommand_history
+  Lisp_Object f_Vcommand_line_args;
+#define Vcommand_line_args globals.f_Vcommand_line_args
+  Lisp_Object f_Vcomment_use_syntax_ppss;
+#define Vcomment_use_syntax_ppss globals.f_Vcomment_use_syntax_ppss
+  Lisp_Object f_Vcomp_ctxt;
+#define Vcomp_ctxt globals.f_Vcomp_ctxt
+  Lisp_Object f_Vcomp_installed_trampolines_h;
+#define Vcomp_installed_trampolines_h globals.f_Vcomp_installed_trampolines_h
+  Lisp_Object f_Vcomp_loaded_comp_units_h;
+#define Vcomp_loaded_comp_units_h globals.f_Vcomp_loaded_comp_units_h
+  Lisp_Object f_Vcomp_native_version_dir;
+#define Vcomp_native_version_dir globals.f_Vcomp_native_version_dir
+  Lisp_Object f_Vcomp_subr_arities_h;
+#define Vcomp_subr_arities_h globals.f_Vcomp_subr_arities_h
+  Lisp_Object f_Vcomp_subr_list;
+#define Vcomp_subr_list globals.f_Vcomp_subr_list
+  Lisp_Object f_Vcompletion_ignored_extensions;
+#define Vcompletion_ignored_extensions globals.f_Vcompletion_ignored_extensions
+  Lisp_Object f_Vcompletion_regexp_list;
+#define Vcompletion_regexp_list globals.f_Vcompletion_regexp_list
+  Lisp_Object f_Vcompose_chars_after_function;
+#define Vcompose_chars_after_function globals.f_Vcompose_chars_after_function
+  Lisp_Object f_Vcomposition_function_table;
+#define Vcomposition_function_table globals.f_Vcomposition_function_table
+  Lisp_Object f_Vconfigure_info_directory;
+#define Vconfigure_info_directory globals.f_Vconfigure_info_directory
+  Lisp_Object f_Vcurrent_iso639_language;
+#define Vcurrent_iso639_language globals.f_Vcurrent_iso639_language
+  Lisp_Object f_Vcurrent_load_list;
+#define Vcurrent_load_list globals.f_Vcurrent_load_list
+  Lisp_Object f_Vcurrent_minibuffer_command;
+#define Vcurrent_minibuffer_command globals.f_Vcurrent_minibuffer_command
+  Lisp_Object f_Vcurrent_prefix_arg;
+#define Vcurrent_prefix_arg globals.f_Vcurrent_prefix_arg
+  Lisp_Object f_Vdata_directory;
+#define Vdata_directory globals.f_Vdata_directory
+  Lisp_Object f_Vdeactivate_mark;
+#define Vdeactivate_mark globals.f_Vdeactivate_mark
+  Lisp_Object f_Vdebug_ignored_errors;
+#define Vdebug_ignored_errors globals.f_Vdebug_ignored_errors
+  Lisp_Object f_Vdebug_on_error;
+#define Vdebug_on_error globals.f_Vdebug_on_error
+  Lisp_Object f_Vdebug_on_event;
+#define Vdebug_on_event globals.f_Vdebug_on_event
+  Lisp_Object f_Vdebug_on_message;
+#define Vdebug_on_message globals.f_Vdebug_on_message
+  Lisp_Object f_Vdebug_on_signal;
+#define Vdebug_on_signal globals.f_Vdebug_on_signal
+  Lisp_Object f_Vdebugger;
+#define Vdebugger globals.f_Vdebugger
+  Lisp_Object f_Vdefault_file_name_coding_system;
+#define Vdefault_file_name_coding_system globals.f_Vdefault_file_name_coding_system
+  Lisp_Object f_Vdefault_frame_alist;
+#define Vdefault_frame_alist globals.f_Vdefault_frame_alist
+  Lisp_Object f_Vdefault_frame_scroll_bars;
+#define Vdefault_frame_scroll_bars globals.f_Vdefault_frame_scroll_bars
+  Lisp_Object f_Vdefault_process_coding_system;
+#define Vdefault_process_coding_system globals.f_Vdefault_process_coding_system
+  Lisp_Object f_Vdefault_text_properties;
+#define Vdefault_text_properties globals.f_Vdefault_text_properties
+  Lisp_Object f_Vdelayed_warnings_list;
+#define Vdelayed_warnings_list globals.f_Vdelayed_warnings_list
+  Lisp_Object f_Vdelete_frame_functions;
+#define Vdelete_frame_functions globals.f_Vdelete_frame_functions
+  Lisp_Object f_Vdelete_terminal_functions;
+#define Vdelete_terminal_functions globals.f_Vdelete_terminal_functions
+  Lisp_Object f_Vdescribe_bindings_check_shadowing_in_ranges;
+#define Vdescribe_bindings_check_shadowing_in_ranges globals.f_Vdescribe_bindings_check_shadowing_in_ranges
+  Lisp_Object f_Vdisable_point_adjustment;
+#define Vdisable_point_adjustment globals.f_Vdisable_point_adjustment
+  Lisp_Object f_Vdisplay_fill_column_indicator_character;
+#define Vdisplay_fill_column_indicator_character globals.f_Vdisplay_fill_column_indicator_character
+  Lisp_Object f_Vdisplay_fill_column_indicator_column;
+#define Vdisplay_fill_column_indicator_column globals.f_Vdisplay_fill_column_indicator_column
+  Lisp_Object f_Vdisplay_line_numbers;
+#define Vdisplay_line_numbers globals.f_Vdisplay_line_numbers
+  Lisp_Object f_Vdisplay_line_numbers_current_absolute;
+#define Vdisplay_line_numbers_current_absolute globals.f_Vdisplay_line_numbers_current_absolute
+  Lisp_Object f_Vdisplay_line_numbers_width;
+#define Vdisplay_line_numbers_width globals.f_Vdisplay_line_numbers_width
+  Lisp_Object f_Vdisplay_monitors_changed_functions;
+#define Vdisplay_monitors_changed_functions globals.f_Vdisplay_monitors_changed_functions
+  Lisp_Object f_Vdisplay_pixels_per_inch;
+#define Vdisplay_pixels_per_inch globals.f_Vdisplay_pixels_per_inch
+  Lisp_Object f_Vdoc_directory;
+#define Vdoc_directory globals.f_Vdoc_directory
+  Lisp_Object f_Vdoc_file_name;
+#define Vdoc_file_name globals.f_Vdoc_file_name
+  Lisp_Object f_Vdouble_click_time;
+#define Vdouble_click_time globals.f_Vdouble_click_time
+  Lisp_Object f_Vdynamic_library_alist;
+#define Vdynamic_library_alist globals.f_Vdynamic_library_alist
+  Lisp_Object f_Vdynamic_library_suffixes;
+#define Vdynamic_library_suffixes globals.f_Vdynamic_library_suffixes
+  Lisp_Object f_Vecho_keystrokes;
+#define Vecho_keystrokes globals.f_Vecho_keystrokes
+  Lisp_Object f_Vemacs_copyright;
+#define Vemacs_copyright globals.f_Vemacs_copyright
+  Lisp_Object f_Vemacs_version;
+#define Vemacs_version globals.f_Vemacs_version
+  Lisp_Object f_Vemulation_mode_map_alists;
+#define Vemulation_mode_map_alists globals.f_Vemulation_mode_map_alists
+  Lisp_Object f_Venable_character_translation;
+#define Venable_character_translation globals.f_Venable_character_translation
+  Lisp_Object f_Venable_disabled_menus_and_buttons;
+#define Venable_disabled_menus_and_buttons globals.f_Venable_disabled_menus_and_buttons
+  Lisp_Object f_Veval_buffer_list;
+#define Veval_buffer_list globals.f_Veval_buffer_list
+  Lisp_Object f_Vexec_directory;
+#define Vexec_directory globals.f_Vexec_directory
+  Lisp_Object f_Vexec_path;
+#define Vexec_path globals.f_Vexec_path
+  Lisp_Object f_Vexec_suffixes;
+#define Vexec_suffixes globals.f_Vexec_suffixes
+  Lisp_Object f_Vexecuting_kbd_macro;
+#define Vexecuting_kbd_macro globals.f_Vexecuting_kbd_macro
+  Lisp_Object f_Vface_default_stipple;
+#define Vface_default_stipple globals.f_Vface_default_stipple
+  Lisp_Object f_Vface_font_lax_matched_attributes;
+#define Vface_font_lax_matched_attributes globals.f_Vface_font_lax_matched_attributes
+  Lisp_Object f_Vface_font_rescale_alist;
+#define Vface_font_rescale_alist globals.f_Vface_font_rescale_alist
+  Lisp_Object f_Vface_ignored_fonts;
+#define Vface_ignored_fonts globals.f_Vface_ignored_fonts
+  Lisp_Object f_Vface_new_frame_defaults;
+#define Vface_new_frame_defaults globals.f_Vface_new_frame_defaults
+  Lisp_Object f_Vface_remapping_alist;
+#define Vface_remapping_alist globals.f_Vface_remapping_alist
+  Lisp_Object f_Vfeatures;
+#define Vfeatures globals.f_Vfeatures
+  Lisp_Object f_Vfile_coding_system_alist;
+#define Vfile_coding_system_alist globals.f_Vfile_coding_system_alist
+  Lisp_Object f_Vfile_name_coding_system;
+#define Vfile_name_coding_system globals.f_Vfile_name_coding_system
+  Lisp_Object f_Vfile_name_handler_alist;
+#define Vfile_name_handler_alist globals.f_Vfile_name_handler_alist
+  Lisp_Object f_Vfind_word_boundary_function_table;
+#define Vfind_word_boundary_function_table globals.f_Vfind_word_boundary_function_table
+  Lisp_Object f_Vfirst_change_hook;
+#define Vfirst_change_hook globals.f_Vfirst_change_hook
+  Lisp_Object f_Vfloat_output_format;
+#define Vfloat_output_format globals.f_Vfloat_output_format
+  Lisp_Object f_Vfont_ccl_encoder_alist;
+#define Vfont_ccl_encoder_alist globals.f_Vfont_ccl_encoder_alist
+  Lisp_Object f_Vfont_encoding_alist;
+#define Vfont_encoding_alist globals.f_Vfont_encoding_alist
+  Lisp_Object f_Vfont_log;
+#define Vfont_log globals.f_Vfont_log
+  Lisp_Object f_Vfont_slant_table;
+#define Vfont_slant_table globals.f_Vfont_slant_table
+  Lisp_Object f_Vfont_weight_table;
+#define Vfont_weight_table globals.f_Vfont_weight_table
+  Lisp_Object f_Vfont_width_table;
+#define Vfont_width_table globals.f_Vfont_width_table
+  Lisp_Object f_Vfontification_functions;
+#define Vfontification_functions globals.f_Vfontification_functions
+  Lisp_Object f_Vframe_alpha_lower_limit;
+#define Vframe_alpha_lower_limit globals.f_Vframe_alpha_lower_limit
+  Lisp_Object f_Vframe_title_format;
+#define Vframe_title_format globals.f_Vframe_title_format
+  Lisp_Object f_Vfunction_key_map;
+#define Vfunction_key_map globals.f_Vfunction_key_map
+  Lisp_Object f_Vgc_cons_percentage;
+#define Vgc_cons_percentage globals.f_Vgc_cons_percentage
+  Lisp_Object f_Vgc_elapsed;
+#define Vgc_elapsed globals.f_Vgc_elapsed
+  Lisp_Object f_Vglobal_disable_point_adjustment;
+#define Vglobal_disable_point_adjustment globals.f_Vglobal_disable_point_adjustment
+  Lisp_Object f_Vglobal_mark_ring;
+#define Vglobal_mark_ring globals.f_Vglobal_mark_ring
+  Lisp_Object f_Vglobal_mode_string;
+#define Vglobal_mode_string globals.f_Vglobal_mode_string
+  Lisp_Object f_Vglyph_table;
+#define Vglyph_table globals.f_Vglyph_table
+  Lisp_Object f_Vglyphless_char_display;
+#define Vglyphless_char_display globals.f_Vglyphless_char_display
+  Lisp_Object f_Vhelp_char;
+#define Vhelp_char globals.f_Vhelp_char
+  Lisp_Object f_Vhelp_event_list;
+#define Vhelp_event_list globals.f_Vhelp_event_list
+  Lisp_Object f_Vhelp_form;
+#define Vhelp_form globals.f_Vhelp_form
+  Lisp_Object f_Vhistory_add_new_input;
+#define Vhistory_add_new_input globals.f_Vhistory_add_new_input
+  Lisp_Object f_Vhistory_length;
+#define Vhistory_length globals.f_Vhistory_length
+  Lisp_Object f_Vhourglass_delay;
+#define Vhourglass_delay globals.f_Vhourglass_delay
+  Lisp_Object f_Vhscroll_step;
+#define Vhscroll_step globals.f_Vhscroll_step
+  Lisp_Object f_Vicon_title_format;
+#define Vicon_title_format globals.f_Vicon_title_format
+  Lisp_Object f_Vinhibit_changing_match_data;
+#define Vinhibit_changing_match_data globals.f_Vinhibit_changing_match_data
+  Lisp_Object f_Vinhibit_debugger;
+#define Vinhibit_debugger globals.f_Vinhibit_debugger
+  Lisp_Object f_Vinhibit_field_text_motion;
+#define Vinhibit_field_text_motion globals.f_Vinhibit_field_text_motion
+  Lisp_Object f_Vinhibit_file_name_handlers;
+#define Vinhibit_file_name_handlers globals.f_Vinhibit_file_name_handlers
+  Lisp_Object f_Vinhibit_file_name_operation;
+#define Vinhibit_file_name_operation globals.f_Vinhibit_file_name_operation
+  Lisp_Object f_Vinhibit_point_motion_hooks;
+#define Vinhibit_point_motion_hooks globals.f_Vinhibit_point_motion_hooks
+  Lisp_Object f_Vinhibit_quit;
+#define Vinhibit_quit globals.f_Vinhibit_quit
+  Lisp_Object f_Vinhibit_read_only;
+#define Vinhibit_read_only globals.f_Vinhibit_read_only
+  Lisp_Object f_Vinhibit_redisplay;
+#define Vinhibit_redisplay globals.f_Vinhibit_redisplay
+  Lisp_Object f_Vinitial_environment;
+#define Vinitial_environment globals.f_Vinitial_environment
+  Lisp_Object f_Vinitial_window_system;
+#define Vinitial_window_system globals.f_Vinitial_window_system
+  Lisp_Object f_Vinput_method_function;
+#define Vinput_method_function globals.f_Vinput_method_function
+  Lisp_Object f_Vinput_method_previous_message;
+#define Vinput_method_previous_message globals.f_Vinput_method_previous_message
+  Lisp_Object f_Vinstallation_directory;
+#define Vinstallation_directory globals.f_Vinstallation_directory
+  Lisp_Object f_Vinstalled_directory;
+#define Vinstalled_directory globals.f_Vinstalled_directory
+  Lisp_Object f_Vinternal__daemon_sockname;
+#define Vinternal__daemon_sockname globals.f_Vinternal__daemon_sockname
+  Lisp_Object f_Vinternal__top_level_message;
+#define Vinternal__top_level_message globals.f_Vinternal__top_level_message
+  Lisp_Object f_Vinternal_make_interpreted_closure_function;
+#define Vinternal_make_interpreted_closure_function globals.f_Vinternal_make_interpreted_closure_function
+  Lisp_Object f_Vinterrupt_process_functions;
+#define Vinterrupt_process_functions globals.f_Vinterrupt_process_functions
+  Lisp_Object f_Vinvocation_directory;
+#define Vinvocation_directory globals.f_Vinvocation_directory
+  Lisp_Object f_Vinvocation_name;
+#define Vinvocation_name globals.f_Vinvocation_name
+  Lisp_Object f_Vkbd_macro_termination_hook;
+#define Vkbd_macro_termination_hook globals.f_Vkbd_macro_termination_hook
+  Lisp_Object f_Vkey_translation_map;
+#define Vkey_translation_map globals.f_Vkey_translation_map
+  Lisp_Object f_Vkill_buffer_query_functions;
+#define Vkill_buffer_query_functions globals.f_Vkill_buffer_query_functions
+  Lisp_Object f_Vkill_emacs_hook;
+#define Vkill_emacs_hook globals.f_Vkill_emacs_hook
+  Lisp_Object f_Vlast_code_conversion_error;
+#define Vlast_code_conversion_error globals.f_Vlast_code_conversion_error
+  Lisp_Object f_Vlast_coding_system_used;
+#define Vlast_coding_system_used globals.f_Vlast_coding_system_used
+  Lisp_Object f_Vlast_event_device;
+#define Vlast_event_device globals.f_Vlast_event_device
+  Lisp_Object f_Vlast_event_frame;
+#define Vlast_event_frame globals.f_Vlast_event_frame
+  Lisp_Object f_Vlatin_extra_code_table;
+#define Vlatin_extra_code_table globals.f_Vlatin_extra_code_table
+  Lisp_Object f_Vlexical_binding;
+#define Vlexical_binding globals.f_Vlexical_binding
+  Lisp_Object f_Vlibgnutls_version;
+#define Vlibgnutls_version globals.f_Vlibgnutls_version
+  Lisp_Object f_Vline_number_display_limit;
+#define Vline_number_display_limit globals.f_Vline_number_display_limit
+  Lisp_Object f_Vline_prefix;
+#define Vline_prefix globals.f_Vline_prefix
+  Lisp_Object f_Vload_file_name;
+#define Vload_file_name globals.f_Vload_file_name
+  Lisp_Object f_Vload_file_rep_suffixes;
+#define Vload_file_rep_suffixes globals.f_Vload_file_rep_suffixes
+  Lisp_Object f_Vload_history;
+#define Vload_history globals.f_Vload_history
+  Lisp_Object f_Vload_path;
+#define Vload_path globals.f_Vload_path
+  Lisp_Object f_Vload_read_function;
+#define Vload_read_function globals.f_Vload_read_function
+  Lisp_Object f_Vload_source_file_function;
+#define Vload_source_file_function globals.f_Vload_source_file_function
+  Lisp_Object f_Vload_suffixes;
+#define Vload_suffixes globals.f_Vload_suffixes
+  Lisp_Object f_Vlocale_coding_system;
+#define Vlocale_coding_system globals.f_Vlocale_coding_system
+  Lisp_Object f_Vlread_unescaped_character_literals;
+#define Vlread_unescaped_character_literals globals.f_Vlread_unescaped_character_literals
+  Lisp_Object f_Vmacroexp__dynvars;
+#define Vmacroexp__dynvars globals.f_Vmacroexp__dynvars
+  Lisp_Object f_Vmain_thread;
+#define Vmain_thread globals.f_Vmain_thread
+  Lisp_Object f_Vmake_pointer_invisible;
+#define Vmake_pointer_invisible globals.f_Vmake_pointer_invisible
+  Lisp_Object f_Vmark_even_if_inactive;
+#define Vmark_even_if_inactive globals.f_Vmark_even_if_inactive
+  Lisp_Object f_Vmax_mini_window_height;
+#define Vmax_mini_window_height globals.f_Vmax_mini_window_height
+  Lisp_Object f_Vmaximum_scroll_margin;
+#define Vmaximum_scroll_margin globals.f_Vmaximum_scroll_margin
+  Lisp_Object f_Vmenu_bar_final_items;
+#define Vmenu_bar_final_items globals.f_Vmenu_bar_final_items
+  Lisp_Object f_Vmenu_bar_mode;
+#define Vmenu_bar_mode globals.f_Vmenu_bar_mode
+  Lisp_Object f_Vmenu_bar_update_hook;
+#define Vmenu_bar_update_hook globals.f_Vmenu_bar_update_hook
+  Lisp_Object f_Vmenu_updating_frame;
+#define Vmenu_updating_frame globals.f_Vmenu_updating_frame
+  Lisp_Object f_Vmessage_log_max;
+#define Vmessage_log_max globals.f_Vmessage_log_max
+  Lisp_Object f_Vmessages_buffer_name;
+#define Vmessages_buffer_name globals.f_Vmessages_buffer_name
+  Lisp_Object f_Vminibuf_scroll_window;
+#define Vminibuf_scroll_window globals.f_Vminibuf_scroll_window
+  Lisp_Object f_Vminibuffer_completing_file_name;
+#define Vminibuffer_completing_file_name globals.f_Vminibuffer_completing_file_name
+  Lisp_Object f_Vminibuffer_completion_confirm;
+#define Vminibuffer_completion_confirm globals.f_Vminibuffer_completion_confirm
+  Lisp_Object f_Vminibuffer_completion_predicate;
+#define Vminibuffer_completion_predicate globals.f_Vminibuffer_completion_predicate
+  Lisp_Object f_Vminibuffer_completion_table;
+#define Vminibuffer_completion_table globals.f_Vminibuffer_completion_table
+  Lisp_Object f_Vminibuffer_exit_hook;
+#define Vminibuffer_exit_hook globals.f_Vminibuffer_exit_hook
+  Lisp_Object f_Vminibuffer_help_form;
+#define Vminibuffer_help_form globals.f_Vminibuffer_help_form
+  Lisp_Object f_Vminibuffer_history_position;
+#define Vminibuffer_history_position globals.f_Vminibuffer_history_position
+  Lisp_Object f_Vminibuffer_history_variable;
+#define Vminibuffer_history_variable globals.f_Vminibuffer_history_variable
+  Lisp_Object f_Vminibuffer_local_map;
+#define Vminibuffer_local_map globals.f_Vminibuffer_local_map
+  Lisp_Object f_Vminibuffer_message_timeout;
+#define Vminibuffer_message_timeout globals.f_Vminibuffer_message_timeout
+  Lisp_Object f_Vminibuffer_prompt_properties;
+#define Vminibuffer_prompt_properties globals.f_Vminibuffer_prompt_properties
+  Lisp_Object f_Vminibuffer_setup_hook;
+#define Vminibuffer_setup_hook globals.f_Vminibuffer_setup_hook
+  Lisp_Object f_Vminor_mode_map_alist;
+#define Vminor_mode_map_alist globals.f_Vminor_mode_map_alist
+  Lisp_Object f_Vminor_mode_overriding_map_alist;
+#define Vminor_mode_overriding_map_alist globals.f_Vminor_mode_overriding_map_alist
+  Lisp_Object f_Vmode_line_compact;
+#define Vmode_line_compact globals.f_Vmode_line_compact
+  Lisp_Object f_Vmodule_file_suffix;
+#define Vmodule_file_suffix globals.f_Vmodule_file_suffix
+  Lisp_Object f_Vmost_negative_fixnum;
+#define Vmost_negative_fixnum globals.f_Vmost_negative_fixnum
+  Lisp_Object f_Vmost_positive_fixnum;
+#define Vmost_positive_fixnum globals.f_Vmost_positive_fixnum
+  Lisp_Object f_Vmouse_autoselect_window;
+#define Vmouse_autoselect_window globals.f_Vmouse_autoselect_window
+  Lisp_Object f_Vmouse_highlight;
+#define Vmouse_highlight globals.f_Vmouse_highlight
+  Lisp_Object f_Vmouse_leave_buffer_hook;
+#define Vmouse_leave_buffer_hook globals.f_Vmouse_leave_buffer_hook
+  Lisp_Object f_Vmouse_position_function;
+#define Vmouse_position_function globals.f_Vmouse_position_function
+  Lisp_Object f_Vmove_frame_functions;
+#define Vmove_frame_functions globals.f_Vmove_frame_functions
+  Lisp_Object f_Vnative_comp_disable_subr_trampolines;
+#define Vnative_comp_disable_subr_trampolines globals.f_Vnative_comp_disable_subr_trampolines
+  Lisp_Object f_Vnetwork_coding_system_alist;
+#define Vnetwork_coding_system_alist globals.f_Vnetwork_coding_system_alist
+  Lisp_Object f_Vnobreak_char_display;
+#define Vnobreak_char_display globals.f_Vnobreak_char_display
+  Lisp_Object f_Vobarray;
+#define Vobarray globals.f_Vobarray
+  Lisp_Object f_Voperating_system_release;
+#define Voperating_system_release globals.f_Voperating_system_release
+  Lisp_Object f_Vother_window_scroll_buffer;
+#define Vother_window_scroll_buffer globals.f_Vother_window_scroll_buffer
+  Lisp_Object f_Vother_window_scroll_default;
+#define Vother_window_scroll_default globals.f_Vother_window_scroll_default
+  Lisp_Object f_Voverlay_arrow_position;
+#define Voverlay_arrow_position globals.f_Voverlay_arrow_position
+  Lisp_Object f_Voverlay_arrow_string;
+#define Voverlay_arrow_string globals.f_Voverlay_arrow_string
+  Lisp_Object f_Voverlay_arrow_variable_list;
+#define Voverlay_arrow_variable_list globals.f_Voverlay_arrow_variable_list
+  Lisp_Object f_Voverriding_local_map;
+#define Voverriding_local_map globals.f_Voverriding_local_map
+  Lisp_Object f_Voverriding_local_map_menu_flag;
+#define Voverriding_local_map_menu_flag globals.f_Voverriding_local_map_menu_flag
+  Lisp_Object f_Voverriding_plist_environment;
+#define Voverriding_plist_environment globals.f_Voverriding_plist_environment
+  Lisp_Object f_Vpath_separator;
+#define Vpath_separator globals.f_Vpath_separator
+  Lisp_Object f_Vpdumper__pure_pool;
+#define Vpdumper__pure_pool globals.f_Vpdumper__pure_pool
+  Lisp_Object f_Vpolling_period;
+#define Vpolling_period globals.f_Vpolling_period
+  Lisp_Object f_Vpost_command_hook;
+#define Vpost_command_hook globals.f_Vpost_command_hook
+  Lisp_Object f_Vpost_gc_hook;
+#define Vpost_gc_hook globals.f_Vpost_gc_hook
+  Lisp_Object f_Vpost_select_region_hook;
+#define Vpost_select_region_hook globals.f_Vpost_select_region_hook
+  Lisp_Object f_Vpost_self_insert_hook;
+#define Vpost_self_insert_hook globals.f_Vpost_self_insert_hook
+  Lisp_Object f_Vpre_command_hook;
+#define Vpre_command_hook globals.f_Vpre_command_hook
+  Lisp_Object f_Vpre_redisplay_function;
+#define Vpre_redisplay_function globals.f_Vpre_redisplay_function
+  Lisp_Object f_Vprefix_help_command;
+#define Vprefix_help_command globals.f_Vprefix_help_command
+  Lisp_Object f_Vpreloaded_file_list;
+#define Vpreloaded_file_list globals.f_Vpreloaded_file_list
+  Lisp_Object f_Vprint__unreadable_callback_buffer;
+#define Vprint__unreadable_callback_buffer globals.f_Vprint__unreadable_callback_buffer
+  Lisp_Object f_Vprint_charset_text_property;
+#define Vprint_charset_text_property globals.f_Vprint_charset_text_property
+  Lisp_Object f_Vprint_circle;
+#define Vprint_circle globals.f_Vprint_circle
+  Lisp_Object f_Vprint_continuous_numbering;
+#define Vprint_continuous_numbering globals.f_Vprint_continuous_numbering
+  Lisp_Object f_Vprint_gensym;
+#define Vprint_gensym globals.f_Vprint_gensym
+  Lisp_Object f_Vprint_length;
+#define Vprint_length globals.f_Vprint_length
+  Lisp_Object f_Vprint_level;
+#define Vprint_level globals.f_Vprint_level
+  Lisp_Object f_Vprint_number_table;
+#define Vprint_number_table globals.f_Vprint_number_table
+  Lisp_Object f_Vprint_unreadable_function;
+#define Vprint_unreadable_function globals.f_Vprint_unreadable_function
+  Lisp_Object f_Vprintable_chars;
+#define Vprintable_chars globals.f_Vprintable_chars
+  Lisp_Object f_Vprocess_adaptive_read_buffering;
+#define Vprocess_adaptive_read_buffering globals.f_Vprocess_adaptive_read_buffering
+  Lisp_Object f_Vprocess_coding_system_alist;
+#define Vprocess_coding_system_alist globals.f_Vprocess_coding_system_alist
+  Lisp_Object f_Vprocess_connection_type;
+#define Vprocess_connection_type globals.f_Vprocess_connection_type
+  Lisp_Object f_Vprocess_environment;
+#define Vprocess_environment globals.f_Vprocess_environment
+  Lisp_Object f_Vquit_flag;
+#define Vquit_flag globals.f_Vquit_flag
+  Lisp_Object f_Vread_buffer_function;
+#define Vread_buffer_function globals.f_Vread_buffer_function
+  Lisp_Object f_Vread_circle;
+#define Vread_circle globals.f_Vread_circle
+  Lisp_Object f_Vread_expression_history;
+#define Vread_expression_history globals.f_Vread_expression_history
+  Lisp_Object f_Vread_hide_char;
+#define Vread_hide_char globals.f_Vread_hide_char
+  Lisp_Object f_Vread_symbol_shorthands;
+#define Vread_symbol_shorthands globals.f_Vread_symbol_shorthands
+  Lisp_Object f_Vreal_this_command;
+#define Vreal_this_command globals.f_Vreal_this_command
+  Lisp_Object f_Vrecenter_redisplay;
+#define Vrecenter_redisplay globals.f_Vrecenter_redisplay
+  Lisp_Object f_Vredisplay__all_windows_cause;
+#define Vredisplay__all_windows_cause globals.f_Vredisplay__all_windows_cause
+  Lisp_Object f_Vredisplay__mode_lines_cause;
+#define Vredisplay__mode_lines_cause globals.f_Vredisplay__mode_lines_cause
+  Lisp_Object f_Vregion_extract_function;
+#define Vregion_extract_function globals.f_Vregion_extract_function
+  Lisp_Object f_Vreport_emacs_bug_address;
+#define Vreport_emacs_bug_address globals.f_Vreport_emacs_bug_address
+  Lisp_Object f_Vresize_mini_windows;
+#define Vresize_mini_windows globals.f_Vresize_mini_windows
+  Lisp_Object f_Vresume_tty_functions;
+#define Vresume_tty_functions globals.f_Vresume_tty_functions
+  Lisp_Object f_Vring_bell_function;
+#define Vring_bell_function globals.f_Vring_bell_function
+  Lisp_Object f_Vsaved_region_selection;
+#define Vsaved_region_selection globals.f_Vsaved_region_selection
+  Lisp_Object f_Vscalable_fonts_allowed;
+#define Vscalable_fonts_allowed globals.f_Vscalable_fonts_allowed
+  Lisp_Object f_Vscript_representative_chars;
+#define Vscript_representative_chars globals.f_Vscript_representative_chars
+  Lisp_Object f_Vscroll_preserve_screen_position;
+#define Vscroll_preserve_screen_position globals.f_Vscroll_preserve_screen_position
+  Lisp_Object f_Vsearch_spaces_regexp;
+#define Vsearch_spaces_regexp globals.f_Vsearch_spaces_regexp
+  Lisp_Object f_Vselect_active_regions;
+#define Vselect_active_regions globals.f_Vselect_active_regions
+  Lisp_Object f_Vselect_safe_coding_system_function;
+#define Vselect_safe_coding_system_function globals.f_Vselect_safe_coding_system_function
+  Lisp_Object f_Vselection_inhibit_update_commands;
+#define Vselection_inhibit_update_commands globals.f_Vselection_inhibit_update_commands
+  Lisp_Object f_Vset_auto_coding_function;
+#define Vset_auto_coding_function globals.f_Vset_auto_coding_function
+  Lisp_Object f_Vset_message_function;
+#define Vset_message_function globals.f_Vset_message_function
+  Lisp_Object f_Vshared_game_score_directory;
+#define Vshared_game_score_directory globals.f_Vshared_game_score_directory
+  Lisp_Object f_Vshell_file_name;
+#define Vshell_file_name globals.f_Vshell_file_name
+  Lisp_Object f_Vshow_help_function;
+#define Vshow_help_function globals.f_Vshow_help_function
+  Lisp_Object f_Vshow_trailing_whitespace;
+#define Vshow_trailing_whitespace globals.f_Vshow_trailing_whitespace
+  Lisp_Object f_Vsignal_hook_function;
+#define Vsignal_hook_function globals.f_Vsignal_hook_function
+  Lisp_Object f_Vsignal_process_functions;
+#define Vsignal_process_functions globals.f_Vsignal_process_functions
+  Lisp_Object f_Vsource_directory;
+#define Vsource_directory globals.f_Vsource_directory
+  Lisp_Object f_Vspecial_event_map;
+#define Vspecial_event_map globals.f_Vspecial_event_map
+  Lisp_Object f_Vstandard_display_table;
+#define Vstandard_display_table globals.f_Vstandard_display_table
+  Lisp_Object f_Vstandard_input;
+#define Vstandard_input globals.f_Vstandard_input
+  Lisp_Object f_Vstandard_output;
+#define Vstandard_output globals.f_Vstandard_output
+  Lisp_Object f_Vstandard_translation_table_for_decode;
+#define Vstandard_translation_table_for_decode globals.f_Vstandard_translation_table_for_decode
+  Lisp_Object f_Vstandard_translation_table_for_encode;
+#define Vstandard_translation_table_for_encode globals.f_Vstandard_translation_table_for_encode
+  Lisp_Object f_Vsuspend_tty_functions;
+#define Vsuspend_tty_functions globals.f_Vsuspend_tty_functions
+  Lisp_Object f_Vsystem_configuration;
+#define Vsystem_configuration globals.f_Vsystem_configuration
+  Lisp_Object f_Vsystem_configuration_features;
+#define Vsystem_configuration_features globals.f_Vsystem_configuration_features
+  Lisp_Object f_Vsystem_configuration_options;
+#define Vsystem_configuration_options globals.f_Vsystem_configuration_options
+  Lisp_Object f_Vsystem_messages_locale;
+#define Vsystem_messages_locale globals.f_Vsystem_messages_locale
+  Lisp_Object f_Vsystem_name;
+#define Vsystem_name globals.f_Vsystem_name
+  Lisp_Object f_Vsystem_time_locale;
+#define Vsystem_time_locale globals.f_Vsystem_time_locale
+  Lisp_Object f_Vsystem_type;
+#define Vsystem_type globals.f_Vsystem_type
+  Lisp_Object f_Vtab_bar_border;
+#define Vtab_bar_border globals.f_Vtab_bar_border
+  Lisp_Object f_Vtab_bar_button_margin;
+#define Vtab_bar_button_margin globals.f_Vtab_bar_button_margin
+  Lisp_Object f_Vtab_bar_mode;
+#define Vtab_bar_mode globals.f_Vtab_bar_mode
+  Lisp_Object f_Vtab_bar_position;
+#define Vtab_bar_position globals.f_Vtab_bar_position
+  Lisp_Object f_Vtab_bar_separator_image_expression;
+#define Vtab_bar_separator_image_expression globals.f_Vtab_bar_separator_image_expression
+  Lisp_Object f_Vtemp_buffer_show_function;
+#define Vtemp_buffer_show_function globals.f_Vtemp_buffer_show_function
+  Lisp_Object f_Vtemporary_file_directory;
+#define Vtemporary_file_directory globals.f_Vtemporary_file_directory
+  Lisp_Object f_Vterminal_frame;
+#define Vterminal_frame globals.f_Vterminal_frame
+  Lisp_Object f_Vtext_property_default_nonsticky;
+#define Vtext_property_default_nonsticky globals.f_Vtext_property_default_nonsticky
+  Lisp_Object f_Vtext_quoting_style;
+#define Vtext_quoting_style globals.f_Vtext_quoting_style
+  Lisp_Object f_Vthis_command;
+#define Vthis_command globals.f_Vthis_command
+  Lisp_Object f_Vthis_command_keys_shift_translated;
+#define Vthis_command_keys_shift_translated globals.f_Vthis_command_keys_shift_translated
+  Lisp_Object f_Vthis_original_command;
+#define Vthis_original_command globals.f_Vthis_original_command
+  Lisp_Object f_Vthrow_on_input;
+#define Vthrow_on_input globals.f_Vthrow_on_input
+  Lisp_Object f_Vtimer_idle_list;
+#define Vtimer_idle_list globals.f_Vtimer_idle_list
+  Lisp_Object f_Vtimer_list;
+#define Vtimer_list globals.f_Vtimer_list
+  Lisp_Object f_Vtool_bar_border;
+#define Vtool_bar_border globals.f_Vtool_bar_border
+  Lisp_Object f_Vtool_bar_button_margin;
+#define Vtool_bar_button_margin globals.f_Vtool_bar_button_margin
+  Lisp_Object f_Vtool_bar_mode;
+#define Vtool_bar_mode globals.f_Vtool_bar_mode
+  Lisp_Object f_Vtool_bar_separator_image_expression;
+#define Vtool_bar_separator_image_expression globals.f_Vtool_bar_separator_image_expression
+  Lisp_Object f_Vtool_bar_style;
+#define Vtool_bar_style globals.f_Vtool_bar_style
+  Lisp_Object f_Vtop_level;
+#define Vtop_level globals.f_Vtop_level
+  Lisp_Object f_Vtransient_mark_mode;
+#define Vtransient_mark_mode globals.f_Vtransient_mark_mode
+  Lisp_Object f_Vtranslation_hash_table_vector;
+#define Vtranslation_hash_table_vector globals.f_Vtranslation_hash_table_vector
+  Lisp_Object f_Vtranslation_table_for_input;
+#define Vtranslation_table_for_input globals.f_Vtranslation_table_for_input
+  Lisp_Object f_Vtranslation_table_vector;
+#define Vtranslation_table_vector globals.f_Vtranslation_table_vector
+  Lisp_Object f_Vtruncate_partial_width_windows;
+#define Vtruncate_partial_width_windows globals.f_Vtruncate_partial_width_windows
+  Lisp_Object f_Vtty_defined_color_alist;
+#define Vtty_defined_color_alist globals.f_Vtty_defined_color_alist
+  Lisp_Object f_Vtty_erase_char;
+#define Vtty_erase_char globals.f_Vtty_erase_char
+  Lisp_Object f_Vundo_outer_limit;
+#define Vundo_outer_limit globals.f_Vundo_outer_limit
+  Lisp_Object f_Vundo_outer_limit_function;
+#define Vundo_outer_limit_function globals.f_Vundo_outer_limit_function
+  Lisp_Object f_Vunicode_category_table;
+#define Vunicode_category_table globals.f_Vunicode_category_table
+  Lisp_Object f_Vunread_command_events;
+#define Vunread_command_events globals.f_Vunread_command_events
+  Lisp_Object f_Vunread_input_method_events;
+#define Vunread_input_method_events globals.f_Vunread_input_method_events
+  Lisp_Object f_Vunread_post_input_method_events;
+#define Vunread_post_input_method_events globals.f_Vunread_post_input_method_events
+  Lisp_Object f_Vuser_full_name;
+#define Vuser_full_name globals.f_Vuser_full_name
+  Lisp_Object f_Vuser_init_file;
+#define Vuser_init_file globals.f_Vuser_init_file
+  Lisp_Object f_Vuser_login_name;
+#define Vuser_login_name globals.f_Vuser_login_name
+  Lisp_Object f_Vuser_real_login_name;
+#define Vuser_real_login_name globals.f_Vuser_real_login_name
+  Lisp_Object f_Vvalues;
+#define Vvalues globals.f_Vvalues
+  Lisp_Object f_Vvoid_text_area_pointer;
+#define Vvoid_text_area_pointer globals.f_Vvoid_text_area_pointer
+  Lisp_Object f_Vwhere_is_preferred_modifier;
+#define Vwhere_is_preferred_modifier globals.f_Vwhere_is_preferred_modifier
+  Lisp_Object f_Vwhile_no_input_ignore_events;
+#define Vwhile_no_input_ignore_events globals.f_Vwhile_no_input_ignore_events
+  Lisp_Object f_Vwindow_buffer_change_functions;
+#define Vwindow_buffer_change_functions globals.f_Vwindow_buffer_change_functions
+  Lisp_Object f_Vwindow_combination_limit;
+#define Vwindow_combination_limit globals.f_Vwindow_combination_limit
+  Lisp_Object f_Vwindow_combination_resize;
+#define Vwindow_combination_resize globals.f_Vwindow_combination_resize
+  Lisp_Object f_Vwindow_configuration_change_hook;
+#define Vwindow_configuration_change_hook globals.f_Vwindow_configuration_change_hook
+  Lisp_Object f_Vwindow_persistent_parameters;
+#define Vwindow_persistent_parameters globals.f_Vwindow_persistent_parameters
+  Lisp_Object f_Vwindow_point_insertion_type;
+#define Vwindow_point_insertion_type globals.f_Vwindow_point_insertion_type
+  Lisp_Object f_Vwindow_scroll_functions;
+#define Vwindow_scroll_functions globals.f_Vwindow_scroll_functions
+  Lisp_Object f_Vwindow_selection_change_functions;
+#define Vwindow_selection_change_functions globals.f_Vwindow_selection_change_functions
+  Lisp_Object f_Vwindow_size_change_functions;
+#define Vwindow_size_change_functions globals.f_Vwindow_size_change_functions
+  Lisp_Object f_Vwindow_state_change_functions;
+#define Vwindow_state_change_functions globals.f_Vwindow_state_change_functions
+  Lisp_Object f_Vwindow_state_change_hook;
+#define Vwindow_state_change_hook globals.f_Vwindow_state_change_hook
+  Lisp_Object f_Vword_combining_categories;
+#define Vword_combining_categories globals.f_Vword_combining_categories
+  Lisp_Object f_Vword_separating_categories;
+#define Vword_separating_categories globals.f_Vword_separating_categories
+  Lisp_Object f_Vwrap_prefix;
+#define Vwrap_prefix globals.f_Vwrap_prefix
+  Lisp_Object f_Vwrite_region_annotate_functions;
+#define Vwrite_region_annotate_functions globals.f_Vwrite_region_annotate_functions
+  Lisp_Object f_Vwrite_region_annotations_so_far;
+#define Vwrite_region_annotations_so_far globals.f_Vwrite_region_annotations_so_far
+  Lisp_Object f_Vwrite_region_post_annotation_function;
+#define Vwrite_region_post_annotation_function globals.f_Vwrite_region_post_annotation_function
+  Lisp_Object f_Vx_pre_popup_menu_hook;
+#define Vx_pre_popup_menu_hook globals.f_Vx_pre_popup_menu_hook
+  Lisp_Object f_Vx_resource_class;
+#define Vx_resource_class globals.f_Vx_resource_class
+  Lisp_Object f_Vx_resource_name;
+#define Vx_resource_name globals.f_Vx_resource_name
+  Lisp_Object f_Vx_show_tooltip_timeout;
+#define Vx_show_tooltip_timeout globals.f_Vx_show_tooltip_timeout
+  Lisp_Object f_Vyes_or_no_prompt;
+#define Vyes_or_no_prompt globals.f_Vyes_or_no_prompt
+  Lisp_Object f_automatic_hscrolling;
+#define automatic_hscrolling globals.f_automatic_hscrolling
+  Lisp_Object f_eol_mnemonic_dos;
+#define eol_mnemonic_dos globals.f_eol_mnemonic_dos
+  Lisp_Object f_eol_mnemonic_mac;
+#define eol_mnemonic_mac globals.f_eol_mnemonic_mac
+  Lisp_Object f_eol_mnemonic_undecided;
+#define eol_mnemonic_undecided globals.f_eol_mnemonic_undecided
+  Lisp_Object f_eol_mnemonic_unix;
+#define eol_mnemonic_unix globals.f_eol_mnemonic_unix
+  Lisp_Object f_focus_follows_mouse;
+#define focus_follows_mouse globals.f_focus_follows_mouse
+  Lisp_Object f_frame_inhibit_implied_resize;
+#define frame_inhibit_implied_resize globals.f_frame_inhibit_implied_resize
+  Lisp_Object f_frame_internal_parameters;
+#define frame_internal_parameters globals.f_frame_internal_parameters
+  Lisp_Object f_frame_size_history;
+#define frame_size_history globals.f_frame_size_history
+  Lisp_Object f_iconify_child_frame;
+#define iconify_child_frame globals.f_iconify_child_frame
+  Lisp_Object f_last_command_event;
+#define last_command_event globals.f_last_command_event
+  Lisp_Object f_last_input_event;
+#define last_input_event globals.f_last_input_event
+  Lisp_Object f_last_nonmenu_event;
+#define last_nonmenu_event globals.f_last_nonmenu_event
+  Lisp_Object f_menu_prompt_more_char;
+#define menu_prompt_more_char globals.f_menu_prompt_more_char
+  Lisp_Object f_meta_prefix_char;
+#define meta_prefix_char globals.f_meta_prefix_char
+  Lisp_Object f_minibuffer_follows_selected_frame;
+#define minibuffer_follows_selected_frame globals.f_minibuffer_follows_selected_frame
+  Lisp_Object f_resize_mini_frames;
+#define resize_mini_frames globals.f_resize_mini_frames
+  Lisp_Object f_track_mouse;
+#define track_mouse globals.f_track_mouse
+  Lisp_Object f_window_dead_windows_table;
+#define window_dead_windows_table globals.f_window_dead_windows_table
+  Lisp_Object f_window_restore_killed_buffer_windows;
+#define window_restore_killed_buffer_windows globals.f_window_restore_killed_buffer_windows
+  intmax_t f_auto_save_interval;
+#define auto_save_interval globals.f_auto_save_interval
+  intmax_t f_baud_rate;
+#define baud_rate globals.f_baud_rate
+  intmax_t f_cons_cells_consed;
+#define cons_cells_consed globals.f_cons_cells_consed
+  intmax_t f_display_line_numbers_major_tick;
+#define display_line_numbers_major_tick globals.f_display_line_numbers_major_tick
+  intmax_t f_display_line_numbers_minor_tick;
+#define display_line_numbers_minor_tick globals.f_display_line_numbers_minor_tick
+  intmax_t f_display_line_numbers_offset;
+#define display_line_numbers_offset globals.f_display_line_numbers_offset
+  intmax_t f_double_click_fuzz;
+#define double_click_fuzz globals.f_double_click_fuzz
+  intmax_t f_emacs_scroll_step;
+#define emacs_scroll_step globals.f_emacs_scroll_step
+  intmax_t f_executing_kbd_macro_index;
+#define executing_kbd_macro_index globals.f_executing_kbd_macro_index
+  intmax_t f_extra_keyboard_modifiers;
+#define extra_keyboard_modifiers globals.f_extra_keyboard_modifiers
+  intmax_t f_face_near_same_color_threshold;
+#define face_near_same_color_threshold globals.f_face_near_same_color_threshold
+  intmax_t f_floats_consed;
+#define floats_consed globals.f_floats_consed
+  intmax_t f_gc_cons_threshold;
+#define gc_cons_threshold globals.f_gc_cons_threshold
+  intmax_t f_gcs_done;
+#define gcs_done globals.f_gcs_done
+  intmax_t f_global_gnutls_log_level;
+#define global_gnutls_log_level globals.f_global_gnutls_log_level
+  intmax_t f_global_mark_ring_max;
+#define global_mark_ring_max globals.f_global_mark_ring_max
+  intmax_t f_hscroll_margin;
+#define hscroll_margin globals.f_hscroll_margin
+  intmax_t f_integer_width;
+#define integer_width globals.f_integer_width
+  intmax_t f_intervals_consed;
+#define intervals_consed globals.f_intervals_consed
+  intmax_t f_line_number_display_limit_width;
+#define line_number_display_limit_width globals.f_line_number_display_limit_width
+  intmax_t f_max_lisp_eval_depth;
+#define max_lisp_eval_depth globals.f_max_lisp_eval_depth
+  intmax_t f_next_screen_context_lines;
+#define next_screen_context_lines globals.f_next_screen_context_lines
+  intmax_t f_num_input_keys;
+#define num_input_keys globals.f_num_input_keys
+  intmax_t f_num_nonmacro_input_events;
+#define num_nonmacro_input_events globals.f_num_nonmacro_input_events
+  intmax_t f_overline_margin;
+#define overline_margin globals.f_overline_margin
+  intmax_t f_process_error_pause_time;
+#define process_error_pause_time globals.f_process_error_pause_time
+  intmax_t f_profiler_log_size;
+#define profiler_log_size globals.f_profiler_log_size
+  intmax_t f_profiler_max_stack_depth;
+#define profiler_max_stack_depth globals.f_profiler_max_stack_depth
+  intmax_t f_read_process_output_max;
+#define read_process_output_max globals.f_read_process_output_max
+  intmax_t f_redisplay_frame_updates;
+#define redisplay_frame_updates globals.f_redisplay_frame_updates
+  intmax_t f_regexp_cache_size;
+#define regexp_cache_size globals.f_regexp_cache_size
+  intmax_t f_scroll_conservatively;
+#define scroll_conservatively globals.f_scroll_conservatively
+  intmax_t f_scroll_margin;
+#define scroll_margin globals.f_scroll_margin
+  intmax_t f_string_chars_consed;
+#define string_chars_consed globals.f_string_chars_consed
+  intmax_t f_strings_consed;
+#define strings_consed globals.f_strings_consed
+  intmax_t f_symbols_consed;
+#define symbols_consed globals.f_symbols_consed
+  intmax_t f_syntax_propertize__done;
+#define syntax_propertize__done globals.f_syntax_propertize__done
+  intmax_t f_tab_bar_button_relief;
+#define tab_bar_button_relief globals.f_tab_bar_button_relief
+  intmax_t f_tool_bar_button_relief;
+#define tool_bar_button_relief globals.f_tool_bar_button_relief
+  intmax_t f_tool_bar_max_label_size;
+#define tool_bar_max_label_size globals.f_tool_bar_max_label_size
+  intmax_t f_underline_minimum_offset;
+#define underline_minimum_offset globals.f_underline_minimum_offset
+  intmax_t f_undo_limit;
+#define undo_limit globals.f_undo_limit
+  intmax_t f_vector_cells_consed;
+#define vector_cells_consed globals.f_vector_cells_consed
+  intmax_t f_when_entered_debugger;
+#define when_entered_debugger globals.f_when_entered_debugger
+  bool f_align_columns_display;
+#define align_columns_display globals.f_align_columns_display
+  bool f_attempt_orderly_shutdown_on_fatal_signal;
+#define attempt_orderly_shutdown_on_fatal_signal globals.f_attempt_orderly_shutdown_on_fatal_signal
+  bool f_attempt_stack_overflow_recovery;
+#define attempt_stack_overflow_recovery globals.f_attempt_stack_overflow_recovery
+  bool f_auto_raise_tab_bar_buttons_p;
+#define auto_raise_tab_bar_buttons_p globals.f_auto_raise_tab_bar_buttons_p
+  bool f_auto_raise_tool_bar_buttons_p;
+#define auto_raise_tool_bar_buttons_p globals.f_auto_raise_tool_bar_buttons_p
+  bool f_auto_save_no_message;
+#define auto_save_no_message globals.f_auto_save_no_message
+  bool f_auto_window_vscroll_p;
+#define auto_window_vscroll_p globals.f_auto_window_vscroll_p
+  bool f_backtrace_on_error_noninteractive;
+#define backtrace_on_error_noninteractive globals.f_backtrace_on_error_noninteractive
+  bool f_bidi_inhibit_bpa;
+#define bidi_inhibit_bpa globals.f_bidi_inhibit_bpa
+  bool f_binary_as_unsigned;
+#define binary_as_unsigned globals.f_binary_as_unsigned
+  bool f_byte_metering_on;
+#define byte_metering_on globals.f_byte_metering_on
+  bool f_cannot_suspend;
+#define cannot_suspend globals.f_cannot_suspend
+  bool f_case_symbols_as_words;
+#define case_symbols_as_words globals.f_case_symbols_as_words
+  bool f_coding_system_require_warning;
+#define coding_system_require_warning globals.f_coding_system_require_warning
+  bool f_comment_end_can_be_escaped;
+#define comment_end_can_be_escaped globals.f_comment_end_can_be_escaped
+  bool f_comp_sanitizer_active;
+#define comp_sanitizer_active globals.f_comp_sanitizer_active
+  bool f_completion_ignore_case;
+#define completion_ignore_case globals.f_completion_ignore_case
+  bool f_composition_break_at_point;
+#define composition_break_at_point globals.f_composition_break_at_point
+  bool f_create_lockfiles;
+#define create_lockfiles globals.f_create_lockfiles
+  bool f_current_time_list;
+#define current_time_list globals.f_current_time_list
+  bool f_cursor_in_echo_area;
+#define cursor_in_echo_area globals.f_cursor_in_echo_area
+  bool f_debug_on_next_call;
+#define debug_on_next_call globals.f_debug_on_next_call
+  bool f_debug_on_quit;
+#define debug_on_quit globals.f_debug_on_quit
+  bool f_debugger_may_continue;
+#define debugger_may_continue globals.f_debugger_may_continue
+  bool f_debugger_stack_frame_as_list;
+#define debugger_stack_frame_as_list globals.f_debugger_stack_frame_as_list
+  bool f_delete_auto_save_files;
+#define delete_auto_save_files globals.f_delete_auto_save_files
+  bool f_delete_by_moving_to_trash;
+#define delete_by_moving_to_trash globals.f_delete_by_moving_to_trash
+  bool f_delete_exited_processes;
+#define delete_exited_processes globals.f_delete_exited_processes
+  bool f_disable_ascii_optimization;
+#define disable_ascii_optimization globals.f_disable_ascii_optimization
+  bool f_display_fill_column_indicator;
+#define display_fill_column_indicator globals.f_display_fill_column_indicator
+  bool f_display_hourglass_p;
+#define display_hourglass_p globals.f_display_hourglass_p
+  bool f_display_line_numbers_widen;
+#define display_line_numbers_widen globals.f_display_line_numbers_widen
+  bool f_display_raw_bytes_as_hex;
+#define display_raw_bytes_as_hex globals.f_display_raw_bytes_as_hex
+  bool f_echo_keystrokes_help;
+#define echo_keystrokes_help globals.f_echo_keystrokes_help
+  bool f_enable_recursive_minibuffers;
+#define enable_recursive_minibuffers globals.f_enable_recursive_minibuffers
+  bool f_face_filters_always_match;
+#define face_filters_always_match globals.f_face_filters_always_match
+  bool f_fast_but_imprecise_scrolling;
+#define fast_but_imprecise_scrolling globals.f_fast_but_imprecise_scrolling
+  bool f_force_load_messages;
+#define force_load_messages globals.f_force_load_messages
+  bool f_frame_resize_pixelwise;
+#define frame_resize_pixelwise globals.f_frame_resize_pixelwise
+  bool f_highlight_nonselected_windows;
+#define highlight_nonselected_windows globals.f_highlight_nonselected_windows
+  bool f_history_delete_duplicates;
+#define history_delete_duplicates globals.f_history_delete_duplicates
+  bool f_indent_tabs_mode;
+#define indent_tabs_mode globals.f_indent_tabs_mode
+  bool f_inherit_process_coding_system;
+#define inherit_process_coding_system globals.f_inherit_process_coding_system
+  bool f_inhibit_bidi_mirroring;
+#define inhibit_bidi_mirroring globals.f_inhibit_bidi_mirroring
+  bool f_inhibit_compacting_font_caches;
+#define inhibit_compacting_font_caches globals.f_inhibit_compacting_font_caches
+  bool f_inhibit_eol_conversion;
+#define inhibit_eol_conversion globals.f_inhibit_eol_conversion
+  bool f_inhibit_eval_during_redisplay;
+#define inhibit_eval_during_redisplay globals.f_inhibit_eval_during_redisplay
+  bool f_inhibit_free_realized_faces;
+#define inhibit_free_realized_faces globals.f_inhibit_free_realized_faces
+  bool f_inhibit_interaction;
+#define inhibit_interaction globals.f_inhibit_interaction
+  bool f_inhibit_iso_escape_detection;
+#define inhibit_iso_escape_detection globals.f_inhibit_iso_escape_detection
+  bool f_inhibit_load_charset_map;
+#define inhibit_load_charset_map globals.f_inhibit_load_charset_map
+  bool f_inhibit_menubar_update;
+#define inhibit_menubar_update globals.f_inhibit_menubar_update
+  bool f_inhibit_message;
+#define inhibit_message globals.f_inhibit_message
+  bool f_inhibit_modification_hooks;
+#define inhibit_modification_hooks globals.f_inhibit_modification_hooks
+  bool f_inhibit_mouse_event_check;
+#define inhibit_mouse_event_check globals.f_inhibit_mouse_event_check
+  bool f_inhibit_null_byte_detection;
+#define inhibit_null_byte_detection globals.f_inhibit_null_byte_detection
+  bool f_inhibit_record_char;
+#define inhibit_record_char globals.f_inhibit_record_char
+  bool f_inhibit_x_resources;
+#define inhibit_x_resources globals.f_inhibit_x_resources
+  bool f_input_pending_p_filter_events;
+#define input_pending_p_filter_events globals.f_input_pending_p_filter_events
+  bool f_inverse_video;
+#define inverse_video globals.f_inverse_video
+  bool f_kill_buffer_delete_auto_save_files;
+#define kill_buffer_delete_auto_save_files globals.f_kill_buffer_delete_auto_save_files
+  bool f_load_convert_to_unibyte;
+#define load_convert_to_unibyte globals.f_load_convert_to_unibyte
+  bool f_load_dangerous_libraries;
+#define load_dangerous_libraries globals.f_load_dangerous_libraries
+  bool f_load_force_doc_strings;
+#define load_force_doc_strings globals.f_load_force_doc_strings
+  bool f_load_in_progress;
+#define load_in_progress globals.f_load_in_progress
+  bool f_lucid__menu_grab_keyboard;
+#define lucid__menu_grab_keyboard globals.f_lucid__menu_grab_keyboard
+  bool f_menu_prompting;
+#define menu_prompting globals.f_menu_prompting
+  bool f_message_truncate_lines;
+#define message_truncate_lines globals.f_message_truncate_lines
+  bool f_minibuffer_allow_text_properties;
+#define minibuffer_allow_text_properties globals.f_minibuffer_allow_text_properties
+  bool f_minibuffer_auto_raise;
+#define minibuffer_auto_raise globals.f_minibuffer_auto_raise
+  bool f_mode_line_in_non_selected_windows;
+#define mode_line_in_non_selected_windows globals.f_mode_line_in_non_selected_windows
+  bool f_mouse_fine_grained_tracking;
+#define mouse_fine_grained_tracking globals.f_mouse_fine_grained_tracking
+  bool f_multibyte_syntax_as_symbol;
+#define multibyte_syntax_as_symbol globals.f_multibyte_syntax_as_symbol
+  bool f_multiple_frames;
+#define multiple_frames globals.f_multiple_frames
+  bool f_mwheel_coalesce_scroll_events;
+#define mwheel_coalesce_scroll_events globals.f_mwheel_coalesce_scroll_events
+  bool f_no_redraw_on_reenter;
+#define no_redraw_on_reenter globals.f_no_redraw_on_reenter
+  bool f_nobreak_char_ascii_display;
+#define nobreak_char_ascii_display globals.f_nobreak_char_ascii_display
+  bool f_noninteractive1;
+#define noninteractive1 globals.f_noninteractive1
+  bool f_open_paren_in_column_0_is_defun_start;
+#define open_paren_in_column_0_is_defun_start globals.f_open_paren_in_column_0_is_defun_start
+  bool f_parse_sexp_ignore_comments;
+#define parse_sexp_ignore_comments globals.f_parse_sexp_ignore_comments
+  bool f_parse_sexp_lookup_properties;
+#define parse_sexp_lookup_properties globals.f_parse_sexp_lookup_properties
+  bool f_parse_sexp_use_tree_sitter;
+#define parse_sexp_use_tree_sitter globals.f_parse_sexp_use_tree_sitter
+  bool f_print_escape_control_characters;
+#define print_escape_control_characters globals.f_print_escape_control_characters
+  bool f_print_escape_multibyte;
+#define print_escape_multibyte globals.f_print_escape_multibyte
+  bool f_print_escape_newlines;
+#define print_escape_newlines globals.f_print_escape_newlines
+  bool f_print_escape_nonascii;
+#define print_escape_nonascii globals.f_print_escape_nonascii
+  bool f_print_integers_as_characters;
+#define print_integers_as_characters globals.f_print_integers_as_characters
+  bool f_print_quoted;
+#define print_quoted globals.f_print_quoted
+  bool f_query_all_font_backends;
+#define query_all_font_backends globals.f_query_all_font_backends
+  bool f_read_buffer_completion_ignore_case;
+#define read_buffer_completion_ignore_case globals.f_read_buffer_completion_ignore_case
+  bool f_read_minibuffer_restore_windows;
+#define read_minibuffer_restore_windows globals.f_read_minibuffer_restore_windows
+  bool f_record_all_keys;
+#define record_all_keys globals.f_record_all_keys
+  bool f_redisplay_adhoc_scroll_in_resize_mini_windows;
+#define redisplay_adhoc_scroll_in_resize_mini_windows globals.f_redisplay_adhoc_scroll_in_resize_mini_windows
+  bool f_redisplay_dont_pause;
+#define redisplay_dont_pause globals.f_redisplay_dont_pause
+  bool f_redisplay_record_statistics;
+#define redisplay_record_statistics globals.f_redisplay_record_statistics
+  bool f_redisplay_skip_fontification_on_input;
+#define redisplay_skip_fontification_on_input globals.f_redisplay_skip_fontification_on_input
+  bool f_redisplay_skip_initial_frame;
+#define redisplay_skip_initial_frame globals.f_redisplay_skip_initial_frame
+  bool f_scroll_bar_adjust_thumb_portion_p;
+#define scroll_bar_adjust_thumb_portion_p globals.f_scroll_bar_adjust_thumb_portion_p
+  bool f_scroll_minibuffer_conservatively;
+#define scroll_minibuffer_conservatively globals.f_scroll_minibuffer_conservatively
+  bool f_system_uses_terminfo;
+#define system_uses_terminfo globals.f_system_uses_terminfo
+  bool f_tab_bar__dragging_in_progress;
+#define tab_bar__dragging_in_progress globals.f_tab_bar__dragging_in_progress
+  bool f_text_quoting_flag;
+#define text_quoting_flag globals.f_text_quoting_flag
+  bool f_tooltip_reuse_hidden_frame;
+#define tooltip_reuse_hidden_frame globals.f_tooltip_reuse_hidden_frame
+  bool f_translate_upper_case_key_bindings;
+#define translate_upper_case_key_bindings globals.f_translate_upper_case_key_bindings
+  bool f_tty_menu_calls_mouse_position_function;
+#define tty_menu_calls_mouse_position_function globals.f_tty_menu_calls_mouse_position_function
+  bool f_unibyte_display_via_language_environment;
+#define unibyte_display_via_language_environment globals.f_unibyte_display_via_language_environment
+  bool f_use_dialog_box;
+#define use_dialog_box globals.f_use_dialog_box
+  bool f_use_file_dialog;
+#define use_file_dialog globals.f_use_file_dialog
+  bool f_use_short_answers;
+#define use_short_answers globals.f_use_short_answers
+  bool f_use_system_tooltips;
+#define use_system_tooltips globals.f_use_system_tooltips
+  bool f_visible_bell;
+#define visible_bell globals.f_visible_bell
+  bool f_visible_cursor;
+#define visible_cursor globals.f_visible_cursor
+  bool f_window_resize_pixelwise;
+#define window_resize_pixelwise globals.f_window_resize_pixelwise
+  bool f_word_wrap_by_category;
+#define word_wrap_by_category globals.f_word_wrap_by_category
+  bool f_words_include_escapes;
+#define words_include_escapes globals.f_words_include_escapes
+  bool f_write_region_inhibit_fsync;
+#define write_region_inhibit_fsync globals.f_write_region_inhibit_fsync
+  bool f_x_stretch_cursor_p;
+#define x_stretch_cursor_p globals.f_x_stretch_cursor_p
+  bool f_xft_ignore_color_fonts;
+#define xft_ignore_color_fonts globals.f_xft_ignore_color_fonts
+};
+extern struct emacs_globals globals;
+
+#ifndef DEFINE_SYMBOLS
+extern
+#endif
+struct Lisp_Symbol lispsym[1369];
+
+#define iQnil 0
+DEFINE_LISP_SYMBOL (Qnil)
+#define iQt 1
+DEFINE_LISP_SYMBOL (Qt)
+#define iQunbound 2
+DEFINE_LISP_SYMBOL (Qunbound)
+#define iQerror 3
+DEFINE_LISP_SYMBOL (Qerror)
+#define iQlambda 4
+DEFINE_LISP_SYMBOL (Qlambda)
+#define iQAutomatic_GC 5
+DEFINE_LISP_SYMBOL (QAutomatic_GC)
+#define iQCadstyle 6
+DEFINE_LISP_SYMBOL (QCadstyle)
+#define iQCadvertised_binding 7
+DEFINE_LISP_SYMBOL (QCadvertised_binding)
+#define iQCalign_to 8
+DEFINE_LISP_SYMBOL (QCalign_to)
+#define iQCantialias 9
+DEFINE_LISP_SYMBOL (QCantialias)
+#define iQCarray_type 10
+DEFINE_LISP_SYMBOL (QCarray_type)
+#define iQCascii_compatible_p 11
+DEFINE_LISP_SYMBOL (QCascii_compatible_p)
+#define iQCavgwidth 12
+DEFINE_LISP_SYMBOL (QCavgwidth)
+#define iQCbackground 13
+DEFINE_LISP_SYMBOL (QCbackground)
+#define iQCbold 14
+DEFINE_LISP_SYMBOL (QCbold)
+#define iQCbox 15
+DEFINE_LISP_SYMBOL (QCbox)
+#define iQCbuffer 16
+DEFINE_LISP_SYMBOL (QCbuffer)
+#define iQCbutton 17
+DEFINE_LISP_SYMBOL (QCbutton)
+#define iQCbytesize 18
+DEFINE_LISP_SYMBOL (QCbytesize)
+#define iQCcategory 19
+DEFINE_LISP_SYMBOL (QCcategory)
+#define iQCcipher_aead_capable 20
+DEFINE_LISP_SYMBOL (QCcipher_aead_capable)
+#define iQCcipher_blocksize 21
+DEFINE_LISP_SYMBOL (QCcipher_blocksize)
+#define iQCcipher_id 22
+DEFINE_LISP_SYMBOL (QCcipher_id)
+#define iQCcipher_ivsize 23
+DEFINE_LISP_SYMBOL (QCcipher_ivsize)
+#define iQCcipher_keysize 24
+DEFINE_LISP_SYMBOL (QCcipher_keysize)
+#define iQCcipher_tagsize 25
+DEFINE_LISP_SYMBOL (QCcipher_tagsize)
+#define iQCcoding 26
+DEFINE_LISP_SYMBOL (QCcoding)
+#define iQCcolor 27
+DEFINE_LISP_SYMBOL (QCcolor)
+#define iQCcombining_capability 28
+DEFINE_LISP_SYMBOL (QCcombining_capability)
+#define iQCcommand 29
+DEFINE_LISP_SYMBOL (QCcommand)
+#define iQCcomplete_negotiation 30
+DEFINE_LISP_SYMBOL (QCcomplete_negotiation)
+#define iQCconnection_type 31
+DEFINE_LISP_SYMBOL (QCconnection_type)
+#define iQCcrlfiles 32
+DEFINE_LISP_SYMBOL (QCcrlfiles)
+#define iQCdata 33
+DEFINE_LISP_SYMBOL (QCdata)
+#define iQCdebug_on_exit 34
+DEFINE_LISP_SYMBOL (QCdebug_on_exit)
+#define iQCdecode_translation_table 35
+DEFINE_LISP_SYMBOL (QCdecode_translation_table)
+#define iQCdefault_char 36
+DEFINE_LISP_SYMBOL (QCdefault_char)
+#define iQCdevice 37
+DEFINE_LISP_SYMBOL (QCdevice)
+#define iQCdigest_algorithm_id 38
+DEFINE_LISP_SYMBOL (QCdigest_algorithm_id)
+#define iQCdigest_algorithm_length 39
+DEFINE_LISP_SYMBOL (QCdigest_algorithm_length)
+#define iQCdistant_foreground 40
+DEFINE_LISP_SYMBOL (QCdistant_foreground)
+#define iQCdocumentation 41
+DEFINE_LISP_SYMBOL (QCdocumentation)
+#define iQCdpi 42
+DEFINE_LISP_SYMBOL (QCdpi)
+#define iQCenable 43
+DEFINE_LISP_SYMBOL (QCenable)
+#define iQCencode_translation_table 44
+DEFINE_LISP_SYMBOL (QCencode_translation_table)
+#define iQCeval 45
+DEFINE_LISP_SYMBOL (QCeval)
+#define iQCextend 46
+DEFINE_LISP_SYMBOL (QCextend)
+#define iQCfalse 47
+DEFINE_LISP_SYMBOL (QCfalse)
+#define iQCfalse_object 48
+DEFINE_LISP_SYMBOL (QCfalse_object)
+#define iQCfamily 49
+DEFINE_LISP_SYMBOL (QCfamily)
+#define iQCfile 50
+DEFINE_LISP_SYMBOL (QCfile)
+#define iQCfile_handler 51
+DEFINE_LISP_SYMBOL (QCfile_handler)
+#define iQCfilter 52
+DEFINE_LISP_SYMBOL (QCfilter)
+#define iQCfiltered 53
+DEFINE_LISP_SYMBOL (QCfiltered)
+#define iQCflags 54
+DEFINE_LISP_SYMBOL (QCflags)
+#define iQCflowcontrol 55
+DEFINE_LISP_SYMBOL (QCflowcontrol)
+#define iQCfont 56
+DEFINE_LISP_SYMBOL (QCfont)
+#define iQCfont_entity 57
+DEFINE_LISP_SYMBOL (QCfont_entity)
+#define iQCfontset 58
+DEFINE_LISP_SYMBOL (QCfontset)
+#define iQCforeground 59
+DEFINE_LISP_SYMBOL (QCforeground)
+#define iQCfoundry 60
+DEFINE_LISP_SYMBOL (QCfoundry)
+#define iQCheight 61
+DEFINE_LISP_SYMBOL (QCheight)
+#define iQChelp 62
+DEFINE_LISP_SYMBOL (QChelp)
+#define iQChost 63
+DEFINE_LISP_SYMBOL (QChost)
+#define iQChostname 64
+DEFINE_LISP_SYMBOL (QChostname)
+#define iQCignore_defface 65
+DEFINE_LISP_SYMBOL (QCignore_defface)
+#define iQCimage 66
+DEFINE_LISP_SYMBOL (QCimage)
+#define iQCin_place 67
+DEFINE_LISP_SYMBOL (QCin_place)
+#define iQCinherit 68
+DEFINE_LISP_SYMBOL (QCinherit)
+#define iQCinverse_video 69
+DEFINE_LISP_SYMBOL (QCinverse_video)
+#define iQCitalic 70
+DEFINE_LISP_SYMBOL (QCitalic)
+#define iQCkey 71
+DEFINE_LISP_SYMBOL (QCkey)
+#define iQCkey_sequence 72
+DEFINE_LISP_SYMBOL (QCkey_sequence)
+#define iQCkeylist 73
+DEFINE_LISP_SYMBOL (QCkeylist)
+#define iQCkeys 74
+DEFINE_LISP_SYMBOL (QCkeys)
+#define iQClabel 75
+DEFINE_LISP_SYMBOL (QClabel)
+#define iQClang 76
+DEFINE_LISP_SYMBOL (QClang)
+#define iQClessp 77
+DEFINE_LISP_SYMBOL (QClessp)
+#define iQCline_width 78
+DEFINE_LISP_SYMBOL (QCline_width)
+#define iQClocal 79
+DEFINE_LISP_SYMBOL (QClocal)
+#define iQClog 80
+DEFINE_LISP_SYMBOL (QClog)
+#define iQCloglevel 81
+DEFINE_LISP_SYMBOL (QCloglevel)
+#define iQCmac_algorithm_id 82
+DEFINE_LISP_SYMBOL (QCmac_algorithm_id)
+#define iQCmac_algorithm_keysize 83
+DEFINE_LISP_SYMBOL (QCmac_algorithm_keysize)
+#define iQCmac_algorithm_length 84
+DEFINE_LISP_SYMBOL (QCmac_algorithm_length)
+#define iQCmac_algorithm_noncesize 85
+DEFINE_LISP_SYMBOL (QCmac_algorithm_noncesize)
+#define iQCmap 86
+DEFINE_LISP_SYMBOL (QCmap)
+#define iQCmin_prime_bits 87
+DEFINE_LISP_SYMBOL (QCmin_prime_bits)
+#define iQCmnemonic 88
+DEFINE_LISP_SYMBOL (QCmnemonic)
+#define iQCname 89
+DEFINE_LISP_SYMBOL (QCname)
+#define iQCnoquery 90
+DEFINE_LISP_SYMBOL (QCnoquery)
+#define iQCnowait 91
+DEFINE_LISP_SYMBOL (QCnowait)
+#define iQCnull 92
+DEFINE_LISP_SYMBOL (QCnull)
+#define iQCnull_object 93
+DEFINE_LISP_SYMBOL (QCnull_object)
+#define iQCobject_type 94
+DEFINE_LISP_SYMBOL (QCobject_type)
+#define iQCotf 95
+DEFINE_LISP_SYMBOL (QCotf)
+#define iQCoverline 96
+DEFINE_LISP_SYMBOL (QCoverline)
+#define iQCparity 97
+DEFINE_LISP_SYMBOL (QCparity)
+#define iQCpass 98
+DEFINE_LISP_SYMBOL (QCpass)
+#define iQCplist 99
+DEFINE_LISP_SYMBOL (QCplist)
+#define iQCpointer 100
+DEFINE_LISP_SYMBOL (QCpointer)
+#define iQCport 101
+DEFINE_LISP_SYMBOL (QCport)
+#define iQCposition 102
+DEFINE_LISP_SYMBOL (QCposition)
+#define iQCpost_read_conversion 103
+DEFINE_LISP_SYMBOL (QCpost_read_conversion)
+#define iQCpre_write_conversion 104
+DEFINE_LISP_SYMBOL (QCpre_write_conversion)
+#define iQCpriority 105
+DEFINE_LISP_SYMBOL (QCpriority)
+#define iQCprocess 106
+DEFINE_LISP_SYMBOL (QCprocess)
+#define iQCpropertize 107
+DEFINE_LISP_SYMBOL (QCpropertize)
+#define iQCpurecopy 108
+DEFINE_LISP_SYMBOL (QCpurecopy)
+#define iQCradio 109
+DEFINE_LISP_SYMBOL (QCradio)
+#define iQCrcvbuf 110
+DEFINE_LISP_SYMBOL (QCrcvbuf)
+#define iQCrcvtimeo 111
+DEFINE_LISP_SYMBOL (QCrcvtimeo)
+#define iQCregistry 112
+DEFINE_LISP_SYMBOL (QCregistry)
+#define iQCrehash_size 113
+DEFINE_LISP_SYMBOL (QCrehash_size)
+#define iQCrehash_threshold 114
+DEFINE_LISP_SYMBOL (QCrehash_threshold)
+#define iQCrelative_height 115
+DEFINE_LISP_SYMBOL (QCrelative_height)
+#define iQCrelative_width 116
+DEFINE_LISP_SYMBOL (QCrelative_width)
+#define iQCremote 117
+DEFINE_LISP_SYMBOL (QCremote)
+#define iQCreverse 118
+DEFINE_LISP_SYMBOL (QCreverse)
+#define iQCrtl 119
+DEFINE_LISP_SYMBOL (QCrtl)
+#define iQCscalable 120
+DEFINE_LISP_SYMBOL (QCscalable)
+#define iQCscript 121
+DEFINE_LISP_SYMBOL (QCscript)
+#define iQCsentinel 122
+DEFINE_LISP_SYMBOL (QCsentinel)
+#define iQCserver 123
+DEFINE_LISP_SYMBOL (QCserver)
+#define iQCservice 124
+DEFINE_LISP_SYMBOL (QCservice)
+#define iQCsize 125
+DEFINE_LISP_SYMBOL (QCsize)
+#define iQCslant 126
+DEFINE_LISP_SYMBOL (QCslant)
+#define iQCsndbuf 127
+DEFINE_LISP_SYMBOL (QCsndbuf)
+#define iQCsndtimeo 128
+DEFINE_LISP_SYMBOL (QCsndtimeo)
+#define iQCspacing 129
+DEFINE_LISP_SYMBOL (QCspacing)
+#define iQCspeed 130
+DEFINE_LISP_SYMBOL (QCspeed)
+#define iQCstderr 131
+DEFINE_LISP_SYMBOL (QCstderr)
+#define iQCstipple 132
+DEFINE_LISP_SYMBOL (QCstipple)
+#define iQCstop 133
+DEFINE_LISP_SYMBOL (QCstop)
+#define iQCstopbits 134
+DEFINE_LISP_SYMBOL (QCstopbits)
+#define iQCstrike_through 135
+DEFINE_LISP_SYMBOL (QCstrike_through)
+#define iQCstyle 136
+DEFINE_LISP_SYMBOL (QCstyle)
+#define iQCsuccess 137
+DEFINE_LISP_SYMBOL (QCsuccess)
+#define iQCsummary 138
+DEFINE_LISP_SYMBOL (QCsummary)
+#define iQCtcpnodelay 139
+DEFINE_LISP_SYMBOL (QCtcpnodelay)
+#define iQCtest 140
+DEFINE_LISP_SYMBOL (QCtest)
+#define iQCtls_parameters 141
+DEFINE_LISP_SYMBOL (QCtls_parameters)
+#define iQCtoggle 142
+DEFINE_LISP_SYMBOL (QCtoggle)
+#define iQCtrustfiles 143
+DEFINE_LISP_SYMBOL (QCtrustfiles)
+#define iQCtype 144
+DEFINE_LISP_SYMBOL (QCtype)
+#define iQCunderline 145
+DEFINE_LISP_SYMBOL (QCunderline)
+#define iQCuse_external_socket 146
+DEFINE_LISP_SYMBOL (QCuse_external_socket)
+#define iQCuser_spec 147
+DEFINE_LISP_SYMBOL (QCuser_spec)
+#define iQCverify_error 148
+DEFINE_LISP_SYMBOL (QCverify_error)
+#define iQCverify_flags 149
+DEFINE_LISP_SYMBOL (QCverify_flags)
+#define iQCvert_only 150
+DEFINE_LISP_SYMBOL (QCvert_only)
+#define iQCvisible 151
+DEFINE_LISP_SYMBOL (QCvisible)
+#define iQCvolume 152
+DEFINE_LISP_SYMBOL (QCvolume)
+#define iQCweakness 153
+DEFINE_LISP_SYMBOL (QCweakness)
+#define iQCweight 154
+DEFINE_LISP_SYMBOL (QCweight)
+#define iQCwidth 155
+DEFINE_LISP_SYMBOL (QCwidth)
+#define iQCwindow 156
+DEFINE_LISP_SYMBOL (QCwindow)
+#define iQDiscarded_Samples 157
+DEFINE_LISP_SYMBOL (QDiscarded_Samples)
+#define iQL2R 158
+DEFINE_LISP_SYMBOL (QL2R)
+#define iQPRIMARY 159
+DEFINE_LISP_SYMBOL (QPRIMARY)
+#define iQR2L 160
+DEFINE_LISP_SYMBOL (QR2L)
+#define iQ__lambda_fixup 161
+DEFINE_LISP_SYMBOL (Q__lambda_fixup)
+#define iQabove 162
+DEFINE_LISP_SYMBOL (Qabove)
+#define iQabove_handle 163
+DEFINE_LISP_SYMBOL (Qabove_handle)
+#define iQabove_suspended 164
+DEFINE_LISP_SYMBOL (Qabove_suspended)
+#define iQaccess_file 165
+DEFINE_LISP_SYMBOL (Qaccess_file)
+#define iQactivate_input_method 166
+DEFINE_LISP_SYMBOL (Qactivate_input_method)
+#define iQactivate_menubar_hook 167
+DEFINE_LISP_SYMBOL (Qactivate_menubar_hook)
+#define iQadd1 168
+DEFINE_LISP_SYMBOL (Qadd1)
+#define iQadd_hook 169
+DEFINE_LISP_SYMBOL (Qadd_hook)
+#define iQadd_name_to_file 170
+DEFINE_LISP_SYMBOL (Qadd_name_to_file)
+#define iQadd_to_history 171
+DEFINE_LISP_SYMBOL (Qadd_to_history)
+#define iQafter_change_functions 172
+DEFINE_LISP_SYMBOL (Qafter_change_functions)
+#define iQafter_delete_frame_functions 173
+DEFINE_LISP_SYMBOL (Qafter_delete_frame_functions)
+#define iQafter_handle 174
+DEFINE_LISP_SYMBOL (Qafter_handle)
+#define iQafter_insert_file_set_coding 175
+DEFINE_LISP_SYMBOL (Qafter_insert_file_set_coding)
+#define iQafter_pdump_load_hook 176
+DEFINE_LISP_SYMBOL (Qafter_pdump_load_hook)
+#define iQafter_string 177
+DEFINE_LISP_SYMBOL (Qafter_string)
+#define iQalist 178
+DEFINE_LISP_SYMBOL (Qalist)
+#define iQall 179
+DEFINE_LISP_SYMBOL (Qall)
+#define iQalpha 180
+DEFINE_LISP_SYMBOL (Qalpha)
+#define iQalpha_background 181
+DEFINE_LISP_SYMBOL (Qalpha_background)
+#define iQand_optional 182
+DEFINE_LISP_SYMBOL (Qand_optional)
+#define iQand_rest 183
+DEFINE_LISP_SYMBOL (Qand_rest)
+#define iQapply 184
+DEFINE_LISP_SYMBOL (Qapply)
+#define iQaref 185
+DEFINE_LISP_SYMBOL (Qaref)
+#define iQargs 186
+DEFINE_LISP_SYMBOL (Qargs)
+#define iQargs_out_of_range 187
+DEFINE_LISP_SYMBOL (Qargs_out_of_range)
+#define iQarith_error 188
+DEFINE_LISP_SYMBOL (Qarith_error)
+#define iQarray 189
+DEFINE_LISP_SYMBOL (Qarray)
+#define iQarrayp 190
+DEFINE_LISP_SYMBOL (Qarrayp)
+#define iQarrow 191
+DEFINE_LISP_SYMBOL (Qarrow)
+#define iQascii 192
+DEFINE_LISP_SYMBOL (Qascii)
+#define iQascii_0 193
+DEFINE_LISP_SYMBOL (Qascii_0)
+#define iQascii_character 194
+DEFINE_LISP_SYMBOL (Qascii_character)
+#define iQaset 195
+DEFINE_LISP_SYMBOL (Qaset)
+#define iQassq_delete_all 196
+DEFINE_LISP_SYMBOL (Qassq_delete_all)
+#define iQassume 197
+DEFINE_LISP_SYMBOL (Qassume)
+#define iQauto_composed 198
+DEFINE_LISP_SYMBOL (Qauto_composed)
+#define iQauto_fill_chars 199
+DEFINE_LISP_SYMBOL (Qauto_fill_chars)
+#define iQauto_hscroll_mode 200
+DEFINE_LISP_SYMBOL (Qauto_hscroll_mode)
+#define iQauto_lower 201
+DEFINE_LISP_SYMBOL (Qauto_lower)
+#define iQauto_raise 202
+DEFINE_LISP_SYMBOL (Qauto_raise)
+#define iQauto_save_coding 203
+DEFINE_LISP_SYMBOL (Qauto_save_coding)
+#define iQautoload 204
+DEFINE_LISP_SYMBOL (Qautoload)
+#define iQautosaved 205
+DEFINE_LISP_SYMBOL (Qautosaved)
+#define iQbackground_color 206
+DEFINE_LISP_SYMBOL (Qbackground_color)
+#define iQbackground_mode 207
+DEFINE_LISP_SYMBOL (Qbackground_mode)
+#define iQbackquote 208
+DEFINE_LISP_SYMBOL (Qbackquote)
+#define iQbar 209
+DEFINE_LISP_SYMBOL (Qbar)
+#define iQbefore_change_functions 210
+DEFINE_LISP_SYMBOL (Qbefore_change_functions)
+#define iQbefore_handle 211
+DEFINE_LISP_SYMBOL (Qbefore_handle)
+#define iQbefore_revert_hook 212
+DEFINE_LISP_SYMBOL (Qbefore_revert_hook)
+#define iQbefore_string 213
+DEFINE_LISP_SYMBOL (Qbefore_string)
+#define iQbeginning_of_buffer 214
+DEFINE_LISP_SYMBOL (Qbeginning_of_buffer)
+#define iQbelow 215
+DEFINE_LISP_SYMBOL (Qbelow)
+#define iQbelow_handle 216
+DEFINE_LISP_SYMBOL (Qbelow_handle)
+#define iQbidi_class 217
+DEFINE_LISP_SYMBOL (Qbidi_class)
+#define iQbig 218
+DEFINE_LISP_SYMBOL (Qbig)
+#define iQbig5 219
+DEFINE_LISP_SYMBOL (Qbig5)
+#define iQbignum 220
+DEFINE_LISP_SYMBOL (Qbignum)
+#define iQbitmap_spec_p 221
+DEFINE_LISP_SYMBOL (Qbitmap_spec_p)
+#define iQblack 222
+DEFINE_LISP_SYMBOL (Qblack)
+#define iQbold 223
+DEFINE_LISP_SYMBOL (Qbold)
+#define iQbook 224
+DEFINE_LISP_SYMBOL (Qbook)
+#define iQbool_vector 225
+DEFINE_LISP_SYMBOL (Qbool_vector)
+#define iQbool_vector_p 226
+DEFINE_LISP_SYMBOL (Qbool_vector_p)
+#define iQboolean 227
+DEFINE_LISP_SYMBOL (Qboolean)
+#define iQbooleanp 228
+DEFINE_LISP_SYMBOL (Qbooleanp)
+#define iQborder 229
+DEFINE_LISP_SYMBOL (Qborder)
+#define iQborder_color 230
+DEFINE_LISP_SYMBOL (Qborder_color)
+#define iQborder_width 231
+DEFINE_LISP_SYMBOL (Qborder_width)
+#define iQboth 232
+DEFINE_LISP_SYMBOL (Qboth)
+#define iQboth_horiz 233
+DEFINE_LISP_SYMBOL (Qboth_horiz)
+#define iQbottom 234
+DEFINE_LISP_SYMBOL (Qbottom)
+#define iQbottom_divider 235
+DEFINE_LISP_SYMBOL (Qbottom_divider)
+#define iQbottom_divider_width 236
+DEFINE_LISP_SYMBOL (Qbottom_divider_width)
+#define iQbottom_edge 237
+DEFINE_LISP_SYMBOL (Qbottom_edge)
+#define iQbottom_left_corner 238
+DEFINE_LISP_SYMBOL (Qbottom_left_corner)
+#define iQbottom_right_corner 239
+DEFINE_LISP_SYMBOL (Qbottom_right_corner)
+#define iQboundary 240
+DEFINE_LISP_SYMBOL (Qboundary)
+#define iQbounds 241
+DEFINE_LISP_SYMBOL (Qbounds)
+#define iQbox 242
+DEFINE_LISP_SYMBOL (Qbox)
+#define iQbracket_type 243
+DEFINE_LISP_SYMBOL (Qbracket_type)
+#define iQbuffer 244
+DEFINE_LISP_SYMBOL (Qbuffer)
+#define iQbuffer_access_fontify_functions 245
+DEFINE_LISP_SYMBOL (Qbuffer_access_fontify_functions)
+#define iQbuffer_file_coding_system 246
+DEFINE_LISP_SYMBOL (Qbuffer_file_coding_system)
+#define iQbuffer_list 247
+DEFINE_LISP_SYMBOL (Qbuffer_list)
+#define iQbuffer_list_update_hook 248
+DEFINE_LISP_SYMBOL (Qbuffer_list_update_hook)
+#define iQbuffer_name_history 249
+DEFINE_LISP_SYMBOL (Qbuffer_name_history)
+#define iQbuffer_or_string_p 250
+DEFINE_LISP_SYMBOL (Qbuffer_or_string_p)
+#define iQbuffer_position 251
+DEFINE_LISP_SYMBOL (Qbuffer_position)
+#define iQbuffer_predicate 252
+DEFINE_LISP_SYMBOL (Qbuffer_predicate)
+#define iQbuffer_read_only 253
+DEFINE_LISP_SYMBOL (Qbuffer_read_only)
+#define iQbuffer_stale_function 254
+DEFINE_LISP_SYMBOL (Qbuffer_stale_function)
+#define iQbufferp 255
+DEFINE_LISP_SYMBOL (Qbufferp)
+#define iQbuffers 256
+DEFINE_LISP_SYMBOL (Qbuffers)
+#define iQburied_buffer_list 257
+DEFINE_LISP_SYMBOL (Qburied_buffer_list)
+#define iQbyte_code_function 258
+DEFINE_LISP_SYMBOL (Qbyte_code_function)
+#define iQbyte_code_function_p 259
+DEFINE_LISP_SYMBOL (Qbyte_code_function_p)
+#define iQbyte_code_meter 260
+DEFINE_LISP_SYMBOL (Qbyte_code_meter)
+#define iQc 261
+DEFINE_LISP_SYMBOL (Qc)
+#define iQcall 262
+DEFINE_LISP_SYMBOL (Qcall)
+#define iQcall_process 263
+DEFINE_LISP_SYMBOL (Qcall_process)
+#define iQcall_process_region 264
+DEFINE_LISP_SYMBOL (Qcall_process_region)
+#define iQcallref 265
+DEFINE_LISP_SYMBOL (Qcallref)
+#define iQcanonical_combining_class 266
+DEFINE_LISP_SYMBOL (Qcanonical_combining_class)
+#define iQcar 267
+DEFINE_LISP_SYMBOL (Qcar)
+#define iQcar_less_than_car 268
+DEFINE_LISP_SYMBOL (Qcar_less_than_car)
+#define iQcase_fold_search 269
+DEFINE_LISP_SYMBOL (Qcase_fold_search)
+#define iQcase_symbols_as_words 270
+DEFINE_LISP_SYMBOL (Qcase_symbols_as_words)
+#define iQcase_table 271
+DEFINE_LISP_SYMBOL (Qcase_table)
+#define iQcase_table_p 272
+DEFINE_LISP_SYMBOL (Qcase_table_p)
+#define iQcatcher 273
+DEFINE_LISP_SYMBOL (Qcatcher)
+#define iQcategory 274
+DEFINE_LISP_SYMBOL (Qcategory)
+#define iQcategory_table 275
+DEFINE_LISP_SYMBOL (Qcategory_table)
+#define iQcategory_table_p 276
+DEFINE_LISP_SYMBOL (Qcategory_table_p)
+#define iQcategoryp 277
+DEFINE_LISP_SYMBOL (Qcategoryp)
+#define iQcategorysetp 278
+DEFINE_LISP_SYMBOL (Qcategorysetp)
+#define iQccl 279
+DEFINE_LISP_SYMBOL (Qccl)
+#define iQccl_program_idx 280
+DEFINE_LISP_SYMBOL (Qccl_program_idx)
+#define iQcclp 281
+DEFINE_LISP_SYMBOL (Qcclp)
+#define iQcdr 282
+DEFINE_LISP_SYMBOL (Qcdr)
+#define iQceiling 283
+DEFINE_LISP_SYMBOL (Qceiling)
+#define iQcenter 284
+DEFINE_LISP_SYMBOL (Qcenter)
+#define iQchange_frame_size 285
+DEFINE_LISP_SYMBOL (Qchange_frame_size)
+#define iQchange_major_mode_hook 286
+DEFINE_LISP_SYMBOL (Qchange_major_mode_hook)
+#define iQchar_code_property_table 287
+DEFINE_LISP_SYMBOL (Qchar_code_property_table)
+#define iQchar_from_name 288
+DEFINE_LISP_SYMBOL (Qchar_from_name)
+#define iQchar_or_string_p 289
+DEFINE_LISP_SYMBOL (Qchar_or_string_p)
+#define iQchar_script_table 290
+DEFINE_LISP_SYMBOL (Qchar_script_table)
+#define iQchar_table 291
+DEFINE_LISP_SYMBOL (Qchar_table)
+#define iQchar_table_extra_slots 292
+DEFINE_LISP_SYMBOL (Qchar_table_extra_slots)
+#define iQchar_table_p 293
+DEFINE_LISP_SYMBOL (Qchar_table_p)
+#define iQcharacterp 294
+DEFINE_LISP_SYMBOL (Qcharacterp)
+#define iQcharset 295
+DEFINE_LISP_SYMBOL (Qcharset)
+#define iQcharsetp 296
+DEFINE_LISP_SYMBOL (Qcharsetp)
+#define iQchild_frame_border 297
+DEFINE_LISP_SYMBOL (Qchild_frame_border)
+#define iQchild_frame_border_width 298
+DEFINE_LISP_SYMBOL (Qchild_frame_border_width)
+#define iQchoice 299
+DEFINE_LISP_SYMBOL (Qchoice)
+#define iQcircle 300
+DEFINE_LISP_SYMBOL (Qcircle)
+#define iQcircular_list 301
+DEFINE_LISP_SYMBOL (Qcircular_list)
+#define iQclone_indirect_buffer_hook 302
+DEFINE_LISP_SYMBOL (Qclone_indirect_buffer_hook)
+#define iQclone_of 303
+DEFINE_LISP_SYMBOL (Qclone_of)
+#define iQclose_tab 304
+DEFINE_LISP_SYMBOL (Qclose_tab)
+#define iQclosed 305
+DEFINE_LISP_SYMBOL (Qclosed)
+#define iQcmajflt 306
+DEFINE_LISP_SYMBOL (Qcmajflt)
+#define iQcminflt 307
+DEFINE_LISP_SYMBOL (Qcminflt)
+#define iQcode_conversion_map 308
+DEFINE_LISP_SYMBOL (Qcode_conversion_map)
+#define iQcode_conversion_map_id 309
+DEFINE_LISP_SYMBOL (Qcode_conversion_map_id)
+#define iQcodeset 310
+DEFINE_LISP_SYMBOL (Qcodeset)
+#define iQcoding 311
+DEFINE_LISP_SYMBOL (Qcoding)
+#define iQcoding_system_define_form 312
+DEFINE_LISP_SYMBOL (Qcoding_system_define_form)
+#define iQcoding_system_error 313
+DEFINE_LISP_SYMBOL (Qcoding_system_error)
+#define iQcoding_system_history 314
+DEFINE_LISP_SYMBOL (Qcoding_system_history)
+#define iQcoding_system_p 315
+DEFINE_LISP_SYMBOL (Qcoding_system_p)
+#define iQcolumns 316
+DEFINE_LISP_SYMBOL (Qcolumns)
+#define iQcomm 317
+DEFINE_LISP_SYMBOL (Qcomm)
+#define iQcomma 318
+DEFINE_LISP_SYMBOL (Qcomma)
+#define iQcomma_at 319
+DEFINE_LISP_SYMBOL (Qcomma_at)
+#define iQcommand_debug_status 320
+DEFINE_LISP_SYMBOL (Qcommand_debug_status)
+#define iQcommand_execute 321
+DEFINE_LISP_SYMBOL (Qcommand_execute)
+#define iQcommand_modes 322
+DEFINE_LISP_SYMBOL (Qcommand_modes)
+#define iQcommandp 323
+DEFINE_LISP_SYMBOL (Qcommandp)
+#define iQcomment 324
+DEFINE_LISP_SYMBOL (Qcomment)
+#define iQcomment_end_can_be_escaped 325
+DEFINE_LISP_SYMBOL (Qcomment_end_can_be_escaped)
+#define iQcomp_libgccjit_reproducer 326
+DEFINE_LISP_SYMBOL (Qcomp_libgccjit_reproducer)
+#define iQcomp_maybe_gc_or_quit 327
+DEFINE_LISP_SYMBOL (Qcomp_maybe_gc_or_quit)
+#define iQcomp_mvar 328
+DEFINE_LISP_SYMBOL (Qcomp_mvar)
+#define iQcomp_sanitizer_error 329
+DEFINE_LISP_SYMBOL (Qcomp_sanitizer_error)
+#define iQcomp_subr_trampoline_install 330
+DEFINE_LISP_SYMBOL (Qcomp_subr_trampoline_install)
+#define iQcomp_trampoline_dir 331
+DEFINE_LISP_SYMBOL (Qcomp_trampoline_dir)
+#define iQcompletion_ignore_case 332
+DEFINE_LISP_SYMBOL (Qcompletion_ignore_case)
+#define iQcomposition 333
+DEFINE_LISP_SYMBOL (Qcomposition)
+#define iQcond_jump 334
+DEFINE_LISP_SYMBOL (Qcond_jump)
+#define iQcond_jump_narg_leq 335
+DEFINE_LISP_SYMBOL (Qcond_jump_narg_leq)
+#define iQcondition_case 336
+DEFINE_LISP_SYMBOL (Qcondition_case)
+#define iQcondition_variable 337
+DEFINE_LISP_SYMBOL (Qcondition_variable)
+#define iQcondition_variable_p 338
+DEFINE_LISP_SYMBOL (Qcondition_variable_p)
+#define iQconfig_changed_event 339
+DEFINE_LISP_SYMBOL (Qconfig_changed_event)
+#define iQconfiguration 340
+DEFINE_LISP_SYMBOL (Qconfiguration)
+#define iQconnect 341
+DEFINE_LISP_SYMBOL (Qconnect)
+#define iQcons 342
+DEFINE_LISP_SYMBOL (Qcons)
+#define iQconses 343
+DEFINE_LISP_SYMBOL (Qconses)
+#define iQconsp 344
+DEFINE_LISP_SYMBOL (Qconsp)
+#define iQcopy_directory 345
+DEFINE_LISP_SYMBOL (Qcopy_directory)
+#define iQcopy_file 346
+DEFINE_LISP_SYMBOL (Qcopy_file)
+#define iQcstime 347
+DEFINE_LISP_SYMBOL (Qcstime)
+#define iQctime 348
+DEFINE_LISP_SYMBOL (Qctime)
+#define iQcurrent 349
+DEFINE_LISP_SYMBOL (Qcurrent)
+#define iQcurrent_input_method 350
+DEFINE_LISP_SYMBOL (Qcurrent_input_method)
+#define iQcurrent_line 351
+DEFINE_LISP_SYMBOL (Qcurrent_line)
+#define iQcurrent_load_list 352
+DEFINE_LISP_SYMBOL (Qcurrent_load_list)
+#define iQcurrent_minibuffer_command 353
+DEFINE_LISP_SYMBOL (Qcurrent_minibuffer_command)
+#define iQcursor 354
+DEFINE_LISP_SYMBOL (Qcursor)
+#define iQcursor_color 355
+DEFINE_LISP_SYMBOL (Qcursor_color)
+#define iQcursor_in_echo_area 356
+DEFINE_LISP_SYMBOL (Qcursor_in_echo_area)
+#define iQcursor_type 357
+DEFINE_LISP_SYMBOL (Qcursor_type)
+#define iQcurve 358
+DEFINE_LISP_SYMBOL (Qcurve)
+#define iQcustom_variable_history 359
+DEFINE_LISP_SYMBOL (Qcustom_variable_history)
+#define iQcustom_variable_p 360
+DEFINE_LISP_SYMBOL (Qcustom_variable_p)
+#define iQcutime 361
+DEFINE_LISP_SYMBOL (Qcutime)
+#define iQcycle_sort_function 362
+DEFINE_LISP_SYMBOL (Qcycle_sort_function)
+#define iQcyclic_function_indirection 363
+DEFINE_LISP_SYMBOL (Qcyclic_function_indirection)
+#define iQcyclic_variable_indirection 364
+DEFINE_LISP_SYMBOL (Qcyclic_variable_indirection)
+#define iQd 365
+DEFINE_LISP_SYMBOL (Qd)
+#define iQd_default 366
+DEFINE_LISP_SYMBOL (Qd_default)
+#define iQd_ephemeral 367
+DEFINE_LISP_SYMBOL (Qd_ephemeral)
+#define iQdashes 368
+DEFINE_LISP_SYMBOL (Qdashes)
+#define iQdata 369
+DEFINE_LISP_SYMBOL (Qdata)
+#define iQdatagram 370
+DEFINE_LISP_SYMBOL (Qdatagram)
+#define iQdays 371
+DEFINE_LISP_SYMBOL (Qdays)
+#define iQdbus_event 372
+DEFINE_LISP_SYMBOL (Qdbus_event)
+#define iQdeactivate_mark 373
+DEFINE_LISP_SYMBOL (Qdeactivate_mark)
+#define iQdebug 374
+DEFINE_LISP_SYMBOL (Qdebug)
+#define iQdebug_early 375
+DEFINE_LISP_SYMBOL (Qdebug_early)
+#define iQdebugger 376
+DEFINE_LISP_SYMBOL (Qdebugger)
+#define iQdecomposed_characters 377
+DEFINE_LISP_SYMBOL (Qdecomposed_characters)
+#define iQdedicated 378
+DEFINE_LISP_SYMBOL (Qdedicated)
+#define iQdefalias_fset_function 379
+DEFINE_LISP_SYMBOL (Qdefalias_fset_function)
+#define iQdefault 380
+DEFINE_LISP_SYMBOL (Qdefault)
+#define iQdefault_directory 381
+DEFINE_LISP_SYMBOL (Qdefault_directory)
+#define iQdefun 382
+DEFINE_LISP_SYMBOL (Qdefun)
+#define iQdefvaralias 383
+DEFINE_LISP_SYMBOL (Qdefvaralias)
+#define iQdelayed_warnings_hook 384
+DEFINE_LISP_SYMBOL (Qdelayed_warnings_hook)
+#define iQdelete 385
+DEFINE_LISP_SYMBOL (Qdelete)
+#define iQdelete_all_mode_overlays 386
+DEFINE_LISP_SYMBOL (Qdelete_all_mode_overlays)
+#define iQdelete_before 387
+DEFINE_LISP_SYMBOL (Qdelete_before)
+#define iQdelete_by_moving_to_trash 388
+DEFINE_LISP_SYMBOL (Qdelete_by_moving_to_trash)
+#define iQdelete_char 389
+DEFINE_LISP_SYMBOL (Qdelete_char)
+#define iQdelete_directory 390
+DEFINE_LISP_SYMBOL (Qdelete_directory)
+#define iQdelete_file 391
+DEFINE_LISP_SYMBOL (Qdelete_file)
+#define iQdelete_file_internal 392
+DEFINE_LISP_SYMBOL (Qdelete_file_internal)
+#define iQdelete_frame 393
+DEFINE_LISP_SYMBOL (Qdelete_frame)
+#define iQdelete_frame_functions 394
+DEFINE_LISP_SYMBOL (Qdelete_frame_functions)
+#define iQdelete_terminal_functions 395
+DEFINE_LISP_SYMBOL (Qdelete_terminal_functions)
+#define iQdelete_window 396
+DEFINE_LISP_SYMBOL (Qdelete_window)
+#define iQdir_ok 397
+DEFINE_LISP_SYMBOL (Qdir_ok)
+#define iQdirect_call 398
+DEFINE_LISP_SYMBOL (Qdirect_call)
+#define iQdirect_callref 399
+DEFINE_LISP_SYMBOL (Qdirect_callref)
+#define iQdirectory_file_name 400
+DEFINE_LISP_SYMBOL (Qdirectory_file_name)
+#define iQdirectory_files 401
+DEFINE_LISP_SYMBOL (Qdirectory_files)
+#define iQdirectory_files_and_attributes 402
+DEFINE_LISP_SYMBOL (Qdirectory_files_and_attributes)
+#define iQdisable_eval 403
+DEFINE_LISP_SYMBOL (Qdisable_eval)
+#define iQdisabled 404
+DEFINE_LISP_SYMBOL (Qdisabled)
+#define iQdisplay 405
+DEFINE_LISP_SYMBOL (Qdisplay)
+#define iQdisplay_buffer 406
+DEFINE_LISP_SYMBOL (Qdisplay_buffer)
+#define iQdisplay_fill_column_indicator 407
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator)
+#define iQdisplay_fill_column_indicator_character 408
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_character)
+#define iQdisplay_fill_column_indicator_column 409
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_column)
+#define iQdisplay_line_numbers 410
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers)
+#define iQdisplay_line_numbers_disable 411
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_disable)
+#define iQdisplay_line_numbers_offset 412
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_offset)
+#define iQdisplay_line_numbers_widen 413
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_widen)
+#define iQdisplay_line_numbers_width 414
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_width)
+#define iQdisplay_monitors_changed_functions 415
+DEFINE_LISP_SYMBOL (Qdisplay_monitors_changed_functions)
+#define iQdisplay_table 416
+DEFINE_LISP_SYMBOL (Qdisplay_table)
+#define iQdisplay_type 417
+DEFINE_LISP_SYMBOL (Qdisplay_type)
+#define iQdo_after_load_evaluation 418
+DEFINE_LISP_SYMBOL (Qdo_after_load_evaluation)
+#define iQdomain_error 419
+DEFINE_LISP_SYMBOL (Qdomain_error)
+#define iQdos 420
+DEFINE_LISP_SYMBOL (Qdos)
+#define iQdots 421
+DEFINE_LISP_SYMBOL (Qdots)
+#define iQdouble_line 422
+DEFINE_LISP_SYMBOL (Qdouble_line)
+#define iQdown 423
+DEFINE_LISP_SYMBOL (Qdown)
+#define iQdrag_internal_border 424
+DEFINE_LISP_SYMBOL (Qdrag_internal_border)
+#define iQdrag_n_drop 425
+DEFINE_LISP_SYMBOL (Qdrag_n_drop)
+#define iQdrag_source 426
+DEFINE_LISP_SYMBOL (Qdrag_source)
+#define iQdrag_with_header_line 427
+DEFINE_LISP_SYMBOL (Qdrag_with_header_line)
+#define iQdrag_with_mode_line 428
+DEFINE_LISP_SYMBOL (Qdrag_with_mode_line)
+#define iQdrag_with_tab_line 429
+DEFINE_LISP_SYMBOL (Qdrag_with_tab_line)
+#define iQdragging 430
+DEFINE_LISP_SYMBOL (Qdragging)
+#define iQdropping 431
+DEFINE_LISP_SYMBOL (Qdropping)
+#define iQdump_emacs_portable__sort_predicate 432
+DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate)
+#define iQdump_emacs_portable__sort_predicate_copied 433
+DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate_copied)
+#define iQdump_file_name 434
+DEFINE_LISP_SYMBOL (Qdump_file_name)
+#define iQdumped_with_pdumper 435
+DEFINE_LISP_SYMBOL (Qdumped_with_pdumper)
+#define iQecho_area_clear_hook 436
+DEFINE_LISP_SYMBOL (Qecho_area_clear_hook)
+#define iQecho_keystrokes 437
+DEFINE_LISP_SYMBOL (Qecho_keystrokes)
+#define iQegid 438
+DEFINE_LISP_SYMBOL (Qegid)
+#define iQeight_bit 439
+DEFINE_LISP_SYMBOL (Qeight_bit)
+#define iQelt 440
+DEFINE_LISP_SYMBOL (Qelt)
+#define iQemacs 441
+DEFINE_LISP_SYMBOL (Qemacs)
+#define iQemacs_mule 442
+DEFINE_LISP_SYMBOL (Qemacs_mule)
+#define iQemoji 443
+DEFINE_LISP_SYMBOL (Qemoji)
+#define iQempty_box 444
+DEFINE_LISP_SYMBOL (Qempty_box)
+#define iQenable_recursive_minibuffers 445
+DEFINE_LISP_SYMBOL (Qenable_recursive_minibuffers)
+#define iQencode_time 446
+DEFINE_LISP_SYMBOL (Qencode_time)
+#define iQencoded 447
+DEFINE_LISP_SYMBOL (Qencoded)
+#define iQend_of_buffer 448
+DEFINE_LISP_SYMBOL (Qend_of_buffer)
+#define iQend_of_file 449
+DEFINE_LISP_SYMBOL (Qend_of_file)
+#define iQend_scroll 450
+DEFINE_LISP_SYMBOL (Qend_scroll)
+#define iQend_session 451
+DEFINE_LISP_SYMBOL (Qend_session)
+#define iQentry 452
+DEFINE_LISP_SYMBOL (Qentry)
+#define iQeq 453
+DEFINE_LISP_SYMBOL (Qeq)
+#define iQeql 454
+DEFINE_LISP_SYMBOL (Qeql)
+#define iQequal 455
+DEFINE_LISP_SYMBOL (Qequal)
+#define iQerror_conditions 456
+DEFINE_LISP_SYMBOL (Qerror_conditions)
+#define iQerror_message 457
+DEFINE_LISP_SYMBOL (Qerror_message)
+#define iQescape_glyph 458
+DEFINE_LISP_SYMBOL (Qescape_glyph)
+#define iQetime 459
+DEFINE_LISP_SYMBOL (Qetime)
+#define iQeuid 460
+DEFINE_LISP_SYMBOL (Qeuid)
+#define iQeval 461
+DEFINE_LISP_SYMBOL (Qeval)
+#define iQeval_buffer_list 462
+DEFINE_LISP_SYMBOL (Qeval_buffer_list)
+#define iQevaporate 463
+DEFINE_LISP_SYMBOL (Qevaporate)
+#define iQeven 464
+DEFINE_LISP_SYMBOL (Qeven)
+#define iQevent_kind 465
+DEFINE_LISP_SYMBOL (Qevent_kind)
+#define iQevent_symbol_element_mask 466
+DEFINE_LISP_SYMBOL (Qevent_symbol_element_mask)
+#define iQevent_symbol_elements 467
+DEFINE_LISP_SYMBOL (Qevent_symbol_elements)
+#define iQevictions 468
+DEFINE_LISP_SYMBOL (Qevictions)
+#define iQexcessive_lisp_nesting 469
+DEFINE_LISP_SYMBOL (Qexcessive_lisp_nesting)
+#define iQexcessive_variable_binding 470
+DEFINE_LISP_SYMBOL (Qexcessive_variable_binding)
+#define iQexcl 471
+DEFINE_LISP_SYMBOL (Qexcl)
+#define iQexit 472
+DEFINE_LISP_SYMBOL (Qexit)
+#define iQexpand_abbrev 473
+DEFINE_LISP_SYMBOL (Qexpand_abbrev)
+#define iQexpand_file_name 474
+DEFINE_LISP_SYMBOL (Qexpand_file_name)
+#define iQexplicit_name 475
+DEFINE_LISP_SYMBOL (Qexplicit_name)
+#define iQexternal_border_size 476
+DEFINE_LISP_SYMBOL (Qexternal_border_size)
+#define iQexternal_debugging_output 477
+DEFINE_LISP_SYMBOL (Qexternal_debugging_output)
+#define iQextra_bold 478
+DEFINE_LISP_SYMBOL (Qextra_bold)
+#define iQextra_light 479
+DEFINE_LISP_SYMBOL (Qextra_light)
+#define iQface 480
+DEFINE_LISP_SYMBOL (Qface)
+#define iQface_alias 481
+DEFINE_LISP_SYMBOL (Qface_alias)
+#define iQface_no_inherit 482
+DEFINE_LISP_SYMBOL (Qface_no_inherit)
+#define iQface_remapping_alist 483
+DEFINE_LISP_SYMBOL (Qface_remapping_alist)
+#define iQface_set_after_frame_default 484
+DEFINE_LISP_SYMBOL (Qface_set_after_frame_default)
+#define iQfailed 485
+DEFINE_LISP_SYMBOL (Qfailed)
+#define iQfboundp 486
+DEFINE_LISP_SYMBOL (Qfboundp)
+#define iQfeatures 487
+DEFINE_LISP_SYMBOL (Qfeatures)
+#define iQfetch_exception 488
+DEFINE_LISP_SYMBOL (Qfetch_exception)
+#define iQfield 489
+DEFINE_LISP_SYMBOL (Qfield)
+#define iQfile_accessible_directory_p 490
+DEFINE_LISP_SYMBOL (Qfile_accessible_directory_p)
+#define iQfile_acl 491
+DEFINE_LISP_SYMBOL (Qfile_acl)
+#define iQfile_already_exists 492
+DEFINE_LISP_SYMBOL (Qfile_already_exists)
+#define iQfile_attributes 493
+DEFINE_LISP_SYMBOL (Qfile_attributes)
+#define iQfile_attributes_lessp 494
+DEFINE_LISP_SYMBOL (Qfile_attributes_lessp)
+#define iQfile_date_error 495
+DEFINE_LISP_SYMBOL (Qfile_date_error)
+#define iQfile_directory_p 496
+DEFINE_LISP_SYMBOL (Qfile_directory_p)
+#define iQfile_error 497
+DEFINE_LISP_SYMBOL (Qfile_error)
+#define iQfile_executable_p 498
+DEFINE_LISP_SYMBOL (Qfile_executable_p)
+#define iQfile_exists_p 499
+DEFINE_LISP_SYMBOL (Qfile_exists_p)
+#define iQfile_locked_p 500
+DEFINE_LISP_SYMBOL (Qfile_locked_p)
+#define iQfile_missing 501
+DEFINE_LISP_SYMBOL (Qfile_missing)
+#define iQfile_modes 502
+DEFINE_LISP_SYMBOL (Qfile_modes)
+#define iQfile_name_all_completions 503
+DEFINE_LISP_SYMBOL (Qfile_name_all_completions)
+#define iQfile_name_as_directory 504
+DEFINE_LISP_SYMBOL (Qfile_name_as_directory)
+#define iQfile_name_case_insensitive_p 505
+DEFINE_LISP_SYMBOL (Qfile_name_case_insensitive_p)
+#define iQfile_name_completion 506
+DEFINE_LISP_SYMBOL (Qfile_name_completion)
+#define iQfile_name_directory 507
+DEFINE_LISP_SYMBOL (Qfile_name_directory)
+#define iQfile_name_handler_alist 508
+DEFINE_LISP_SYMBOL (Qfile_name_handler_alist)
+#define iQfile_name_history 509
+DEFINE_LISP_SYMBOL (Qfile_name_history)
+#define iQfile_name_nondirectory 510
+DEFINE_LISP_SYMBOL (Qfile_name_nondirectory)
+#define iQfile_newer_than_file_p 511
+DEFINE_LISP_SYMBOL (Qfile_newer_than_file_p)
+#define iQfile_notify 512
+DEFINE_LISP_SYMBOL (Qfile_notify)
+#define iQfile_notify_error 513
+DEFINE_LISP_SYMBOL (Qfile_notify_error)
+#define iQfile_offset 514
+DEFINE_LISP_SYMBOL (Qfile_offset)
+#define iQfile_readable_p 515
+DEFINE_LISP_SYMBOL (Qfile_readable_p)
+#define iQfile_regular_p 516
+DEFINE_LISP_SYMBOL (Qfile_regular_p)
+#define iQfile_selinux_context 517
+DEFINE_LISP_SYMBOL (Qfile_selinux_context)
+#define iQfile_symlink_p 518
+DEFINE_LISP_SYMBOL (Qfile_symlink_p)
+#define iQfile_system_info 519
+DEFINE_LISP_SYMBOL (Qfile_system_info)
+#define iQfile_writable_p 520
+DEFINE_LISP_SYMBOL (Qfile_writable_p)
+#define iQfilenamep 521
+DEFINE_LISP_SYMBOL (Qfilenamep)
+#define iQfill_column_indicator 522
+DEFINE_LISP_SYMBOL (Qfill_column_indicator)
+#define iQfinalizer 523
+DEFINE_LISP_SYMBOL (Qfinalizer)
+#define iQfind_file_literally_line_length 524
+DEFINE_LISP_SYMBOL (Qfind_file_literally_line_length)
+#define iQfirst_change_hook 525
+DEFINE_LISP_SYMBOL (Qfirst_change_hook)
+#define iQfixnum 526
+DEFINE_LISP_SYMBOL (Qfixnum)
+#define iQfixnump 527
+DEFINE_LISP_SYMBOL (Qfixnump)
+#define iQflat_button 528
+DEFINE_LISP_SYMBOL (Qflat_button)
+#define iQfloat 529
+DEFINE_LISP_SYMBOL (Qfloat)
+#define iQfloat_output_format 530
+DEFINE_LISP_SYMBOL (Qfloat_output_format)
+#define iQfloatp 531
+DEFINE_LISP_SYMBOL (Qfloatp)
+#define iQfloats 532
+DEFINE_LISP_SYMBOL (Qfloats)
+#define iQfloor 533
+DEFINE_LISP_SYMBOL (Qfloor)
+#define iQfocus_in 534
+DEFINE_LISP_SYMBOL (Qfocus_in)
+#define iQfocus_out 535
+DEFINE_LISP_SYMBOL (Qfocus_out)
+#define iQfont 536
+DEFINE_LISP_SYMBOL (Qfont)
+#define iQfont_backend 537
+DEFINE_LISP_SYMBOL (Qfont_backend)
+#define iQfont_driver_superseded_by 538
+DEFINE_LISP_SYMBOL (Qfont_driver_superseded_by)
+#define iQfont_entity 539
+DEFINE_LISP_SYMBOL (Qfont_entity)
+#define iQfont_extra_type 540
+DEFINE_LISP_SYMBOL (Qfont_extra_type)
+#define iQfont_lock_dont_widen 541
+DEFINE_LISP_SYMBOL (Qfont_lock_dont_widen)
+#define iQfont_lock_extra_managed_props 542
+DEFINE_LISP_SYMBOL (Qfont_lock_extra_managed_props)
+#define iQfont_lock_face 543
+DEFINE_LISP_SYMBOL (Qfont_lock_face)
+#define iQfont_lock_fontify_region 544
+DEFINE_LISP_SYMBOL (Qfont_lock_fontify_region)
+#define iQfont_object 545
+DEFINE_LISP_SYMBOL (Qfont_object)
+#define iQfont_spec 546
+DEFINE_LISP_SYMBOL (Qfont_spec)
+#define iQfontification_functions 547
+DEFINE_LISP_SYMBOL (Qfontification_functions)
+#define iQfontified 548
+DEFINE_LISP_SYMBOL (Qfontified)
+#define iQforeground_color 549
+DEFINE_LISP_SYMBOL (Qforeground_color)
+#define iQformat_annotate_function 550
+DEFINE_LISP_SYMBOL (Qformat_annotate_function)
+#define iQformat_decode 551
+DEFINE_LISP_SYMBOL (Qformat_decode)
+#define iQfraction 552
+DEFINE_LISP_SYMBOL (Qfraction)
+#define iQframe 553
+DEFINE_LISP_SYMBOL (Qframe)
+#define iQframe_edges 554
+DEFINE_LISP_SYMBOL (Qframe_edges)
+#define iQframe_live_p 555
+DEFINE_LISP_SYMBOL (Qframe_live_p)
+#define iQframe_monitor_attributes 556
+DEFINE_LISP_SYMBOL (Qframe_monitor_attributes)
+#define iQframe_set_background_mode 557
+DEFINE_LISP_SYMBOL (Qframe_set_background_mode)
+#define iQframe_windows_min_size 558
+DEFINE_LISP_SYMBOL (Qframe_windows_min_size)
+#define iQframep 559
+DEFINE_LISP_SYMBOL (Qframep)
+#define iQframes 560
+DEFINE_LISP_SYMBOL (Qframes)
+#define iQfringe 561
+DEFINE_LISP_SYMBOL (Qfringe)
+#define iQfrom__tty_menu_p 562
+DEFINE_LISP_SYMBOL (Qfrom__tty_menu_p)
+#define iQfront_sticky 563
+DEFINE_LISP_SYMBOL (Qfront_sticky)
+#define iQfullboth 564
+DEFINE_LISP_SYMBOL (Qfullboth)
+#define iQfullheight 565
+DEFINE_LISP_SYMBOL (Qfullheight)
+#define iQfullscreen 566
+DEFINE_LISP_SYMBOL (Qfullscreen)
+#define iQfullwidth 567
+DEFINE_LISP_SYMBOL (Qfullwidth)
+#define iQfuncall 568
+DEFINE_LISP_SYMBOL (Qfuncall)
+#define iQfuncall_interactively 569
+DEFINE_LISP_SYMBOL (Qfuncall_interactively)
+#define iQfunction 570
+DEFINE_LISP_SYMBOL (Qfunction)
+#define iQfunction_documentation 571
+DEFINE_LISP_SYMBOL (Qfunction_documentation)
+#define iQfunction_history 572
+DEFINE_LISP_SYMBOL (Qfunction_history)
+#define iQfunction_key 573
+DEFINE_LISP_SYMBOL (Qfunction_key)
+#define iQfunctionp 574
+DEFINE_LISP_SYMBOL (Qfunctionp)
+#define iQfundamental_mode 575
+DEFINE_LISP_SYMBOL (Qfundamental_mode)
+#define iQgc_cons_percentage 576
+DEFINE_LISP_SYMBOL (Qgc_cons_percentage)
+#define iQgc_cons_threshold 577
+DEFINE_LISP_SYMBOL (Qgc_cons_threshold)
+#define iQgccjit 578
+DEFINE_LISP_SYMBOL (Qgccjit)
+#define iQgeometry 579
+DEFINE_LISP_SYMBOL (Qgeometry)
+#define iQget_buffer_window_list 580
+DEFINE_LISP_SYMBOL (Qget_buffer_window_list)
+#define iQget_emacs_mule_file_char 581
+DEFINE_LISP_SYMBOL (Qget_emacs_mule_file_char)
+#define iQget_file_buffer 582
+DEFINE_LISP_SYMBOL (Qget_file_buffer)
+#define iQget_file_char 583
+DEFINE_LISP_SYMBOL (Qget_file_char)
+#define iQget_mru_window 584
+DEFINE_LISP_SYMBOL (Qget_mru_window)
+#define iQget_scratch_buffer_create 585
+DEFINE_LISP_SYMBOL (Qget_scratch_buffer_create)
+#define iQglobal_mark_ring 586
+DEFINE_LISP_SYMBOL (Qglobal_mark_ring)
+#define iQglobal_mark_ring_max 587
+DEFINE_LISP_SYMBOL (Qglobal_mark_ring_max)
+#define iQglyphless_char 588
+DEFINE_LISP_SYMBOL (Qglyphless_char)
+#define iQglyphless_char_display 589
+DEFINE_LISP_SYMBOL (Qglyphless_char_display)
+#define iQgnutls_anon 590
+DEFINE_LISP_SYMBOL (Qgnutls_anon)
+#define iQgnutls_code 591
+DEFINE_LISP_SYMBOL (Qgnutls_code)
+#define iQgnutls_e_again 592
+DEFINE_LISP_SYMBOL (Qgnutls_e_again)
+#define iQgnutls_e_interrupted 593
+DEFINE_LISP_SYMBOL (Qgnutls_e_interrupted)
+#define iQgnutls_e_invalid_session 594
+DEFINE_LISP_SYMBOL (Qgnutls_e_invalid_session)
+#define iQgnutls_e_not_ready_for_handshake 595
+DEFINE_LISP_SYMBOL (Qgnutls_e_not_ready_for_handshake)
+#define iQgnutls_pkcs_null_password 596
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_null_password)
+#define iQgnutls_pkcs_pbes1_des_md5 597
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes1_des_md5)
+#define iQgnutls_pkcs_pbes2_3des 598
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_3des)
+#define iQgnutls_pkcs_pbes2_aes_128 599
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_128)
+#define iQgnutls_pkcs_pbes2_aes_192 600
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_192)
+#define iQgnutls_pkcs_pbes2_aes_256 601
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_256)
+#define iQgnutls_pkcs_pbes2_des 602
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_des)
+#define iQgnutls_pkcs_pbes2_gost_cpa 603
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpa)
+#define iQgnutls_pkcs_pbes2_gost_cpb 604
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpb)
+#define iQgnutls_pkcs_pbes2_gost_cpc 605
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpc)
+#define iQgnutls_pkcs_pbes2_gost_cpd 606
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpd)
+#define iQgnutls_pkcs_pbes2_gost_tc26z 607
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_tc26z)
+#define iQgnutls_pkcs_pkcs12_3des 608
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_3des)
+#define iQgnutls_pkcs_pkcs12_arcfour 609
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_arcfour)
+#define iQgnutls_pkcs_pkcs12_rc2_40 610
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_rc2_40)
+#define iQgnutls_pkcs_plain 611
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_plain)
+#define iQgnutls_type_cipher 612
+DEFINE_LISP_SYMBOL (Qgnutls_type_cipher)
+#define iQgnutls_type_digest_algorithm 613
+DEFINE_LISP_SYMBOL (Qgnutls_type_digest_algorithm)
+#define iQgnutls_type_mac_algorithm 614
+DEFINE_LISP_SYMBOL (Qgnutls_type_mac_algorithm)
+#define iQgnutls_x509pki 615
+DEFINE_LISP_SYMBOL (Qgnutls_x509pki)
+#define iQgrave 616
+DEFINE_LISP_SYMBOL (Qgrave)
+#define iQgroup 617
+DEFINE_LISP_SYMBOL (Qgroup)
+#define iQgrow_only 618
+DEFINE_LISP_SYMBOL (Qgrow_only)
+#define iQgui_figure_window_size 619
+DEFINE_LISP_SYMBOL (Qgui_figure_window_size)
+#define iQgui_set_selection 620
+DEFINE_LISP_SYMBOL (Qgui_set_selection)
+#define iQhaiku 621
+DEFINE_LISP_SYMBOL (Qhaiku)
+#define iQhand 622
+DEFINE_LISP_SYMBOL (Qhand)
+#define iQhandle 623
+DEFINE_LISP_SYMBOL (Qhandle)
+#define iQhandle_select_window 624
+DEFINE_LISP_SYMBOL (Qhandle_select_window)
+#define iQhandle_shift_selection 625
+DEFINE_LISP_SYMBOL (Qhandle_shift_selection)
+#define iQhandle_switch_frame 626
+DEFINE_LISP_SYMBOL (Qhandle_switch_frame)
+#define iQhash_table 627
+DEFINE_LISP_SYMBOL (Qhash_table)
+#define iQhash_table_p 628
+DEFINE_LISP_SYMBOL (Qhash_table_p)
+#define iQhash_table_test 629
+DEFINE_LISP_SYMBOL (Qhash_table_test)
+#define iQhbar 630
+DEFINE_LISP_SYMBOL (Qhbar)
+#define iQheader_line 631
+DEFINE_LISP_SYMBOL (Qheader_line)
+#define iQheader_line_format 632
+DEFINE_LISP_SYMBOL (Qheader_line_format)
+#define iQheap 633
+DEFINE_LISP_SYMBOL (Qheap)
+#define iQheavy 634
+DEFINE_LISP_SYMBOL (Qheavy)
+#define iQheight 635
+DEFINE_LISP_SYMBOL (Qheight)
+#define iQheight_only 636
+DEFINE_LISP_SYMBOL (Qheight_only)
+#define iQhelp__append_keystrokes_help 637
+DEFINE_LISP_SYMBOL (Qhelp__append_keystrokes_help)
+#define iQhelp__describe_map_tree 638
+DEFINE_LISP_SYMBOL (Qhelp__describe_map_tree)
+#define iQhelp_echo 639
+DEFINE_LISP_SYMBOL (Qhelp_echo)
+#define iQhelp_echo_inhibit_substitution 640
+DEFINE_LISP_SYMBOL (Qhelp_echo_inhibit_substitution)
+#define iQhelp_form_show 641
+DEFINE_LISP_SYMBOL (Qhelp_form_show)
+#define iQhelp_key_binding 642
+DEFINE_LISP_SYMBOL (Qhelp_key_binding)
+#define iQhelper_sanitizer_assert 643
+DEFINE_LISP_SYMBOL (Qhelper_sanitizer_assert)
+#define iQhelper_save_restriction 644
+DEFINE_LISP_SYMBOL (Qhelper_save_restriction)
+#define iQhelper_unbind_n 645
+DEFINE_LISP_SYMBOL (Qhelper_unbind_n)
+#define iQhelper_unwind_protect 646
+DEFINE_LISP_SYMBOL (Qhelper_unwind_protect)
+#define iQhex_code 647
+DEFINE_LISP_SYMBOL (Qhex_code)
+#define iQhide 648
+DEFINE_LISP_SYMBOL (Qhide)
+#define iQhits 649
+DEFINE_LISP_SYMBOL (Qhits)
+#define iQhl_line_sticky_flag 650
+DEFINE_LISP_SYMBOL (Qhl_line_sticky_flag)
+#define iQhl_line_unhighlight 651
+DEFINE_LISP_SYMBOL (Qhl_line_unhighlight)
+#define iQhollow 652
+DEFINE_LISP_SYMBOL (Qhollow)
+#define iQhorizontal_handle 653
+DEFINE_LISP_SYMBOL (Qhorizontal_handle)
+#define iQhorizontal_scroll_bar 654
+DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bar)
+#define iQhorizontal_scroll_bars 655
+DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bars)
+#define iQhw 656
+DEFINE_LISP_SYMBOL (Qhw)
+#define iQicon 657
+DEFINE_LISP_SYMBOL (Qicon)
+#define iQicon_left 658
+DEFINE_LISP_SYMBOL (Qicon_left)
+#define iQicon_name 659
+DEFINE_LISP_SYMBOL (Qicon_name)
+#define iQicon_top 660
+DEFINE_LISP_SYMBOL (Qicon_top)
+#define iQicon_type 661
+DEFINE_LISP_SYMBOL (Qicon_type)
+#define iQiconify_frame 662
+DEFINE_LISP_SYMBOL (Qiconify_frame)
+#define iQiconify_top_level 663
+DEFINE_LISP_SYMBOL (Qiconify_top_level)
+#define iQidentity 664
+DEFINE_LISP_SYMBOL (Qidentity)
+#define iQif 665
+DEFINE_LISP_SYMBOL (Qif)
+#define iQif_regular 666
+DEFINE_LISP_SYMBOL (Qif_regular)
+#define iQignore 667
+DEFINE_LISP_SYMBOL (Qignore)
+#define iQignore_self_insert 668
+DEFINE_LISP_SYMBOL (Qignore_self_insert)
+#define iQignored 669
+DEFINE_LISP_SYMBOL (Qignored)
+#define iQimage 670
+DEFINE_LISP_SYMBOL (Qimage)
+#define iQinc_args 671
+DEFINE_LISP_SYMBOL (Qinc_args)
+#define iQinhibit_changing_match_data 672
+DEFINE_LISP_SYMBOL (Qinhibit_changing_match_data)
+#define iQinhibit_debugger 673
+DEFINE_LISP_SYMBOL (Qinhibit_debugger)
+#define iQinhibit_double_buffering 674
+DEFINE_LISP_SYMBOL (Qinhibit_double_buffering)
+#define iQinhibit_eval_during_redisplay 675
+DEFINE_LISP_SYMBOL (Qinhibit_eval_during_redisplay)
+#define iQinhibit_file_name_operation 676
+DEFINE_LISP_SYMBOL (Qinhibit_file_name_operation)
+#define iQinhibit_free_realized_faces 677
+DEFINE_LISP_SYMBOL (Qinhibit_free_realized_faces)
+#define iQinhibit_menubar_update 678
+DEFINE_LISP_SYMBOL (Qinhibit_menubar_update)
+#define iQinhibit_modification_hooks 679
+DEFINE_LISP_SYMBOL (Qinhibit_modification_hooks)
+#define iQinhibit_point_motion_hooks 680
+DEFINE_LISP_SYMBOL (Qinhibit_point_motion_hooks)
+#define iQinhibit_quit 681
+DEFINE_LISP_SYMBOL (Qinhibit_quit)
+#define iQinhibit_read_only 682
+DEFINE_LISP_SYMBOL (Qinhibit_read_only)
+#define iQinhibit_redisplay 683
+DEFINE_LISP_SYMBOL (Qinhibit_redisplay)
+#define iQinhibited_interaction 684
+DEFINE_LISP_SYMBOL (Qinhibited_interaction)
+#define iQinner_edges 685
+DEFINE_LISP_SYMBOL (Qinner_edges)
+#define iQinput_method_exit_on_first_char 686
+DEFINE_LISP_SYMBOL (Qinput_method_exit_on_first_char)
+#define iQinput_method_use_echo_area 687
+DEFINE_LISP_SYMBOL (Qinput_method_use_echo_area)
+#define iQinsdel 688
+DEFINE_LISP_SYMBOL (Qinsdel)
+#define iQinsert_behind_hooks 689
+DEFINE_LISP_SYMBOL (Qinsert_behind_hooks)
+#define iQinsert_file_contents 690
+DEFINE_LISP_SYMBOL (Qinsert_file_contents)
+#define iQinsert_in_front_hooks 691
+DEFINE_LISP_SYMBOL (Qinsert_in_front_hooks)
+#define iQinserted_chars 692
+DEFINE_LISP_SYMBOL (Qinserted_chars)
+#define iQinsufficient_source 693
+DEFINE_LISP_SYMBOL (Qinsufficient_source)
+#define iQintangible 694
+DEFINE_LISP_SYMBOL (Qintangible)
+#define iQinteger 695
+DEFINE_LISP_SYMBOL (Qinteger)
+#define iQinteger_or_marker_p 696
+DEFINE_LISP_SYMBOL (Qinteger_or_marker_p)
+#define iQintegerp 697
+DEFINE_LISP_SYMBOL (Qintegerp)
+#define iQinteractive 698
+DEFINE_LISP_SYMBOL (Qinteractive)
+#define iQinteractive_args 699
+DEFINE_LISP_SYMBOL (Qinteractive_args)
+#define iQinteractive_form 700
+DEFINE_LISP_SYMBOL (Qinteractive_form)
+#define iQinteractive_p 701
+DEFINE_LISP_SYMBOL (Qinteractive_p)
+#define iQinternal__syntax_propertize 702
+DEFINE_LISP_SYMBOL (Qinternal__syntax_propertize)
+#define iQinternal_auto_fill 703
+DEFINE_LISP_SYMBOL (Qinternal_auto_fill)
+#define iQinternal_border 704
+DEFINE_LISP_SYMBOL (Qinternal_border)
+#define iQinternal_border_width 705
+DEFINE_LISP_SYMBOL (Qinternal_border_width)
+#define iQinternal_default_interrupt_process 706
+DEFINE_LISP_SYMBOL (Qinternal_default_interrupt_process)
+#define iQinternal_default_process_filter 707
+DEFINE_LISP_SYMBOL (Qinternal_default_process_filter)
+#define iQinternal_default_process_sentinel 708
+DEFINE_LISP_SYMBOL (Qinternal_default_process_sentinel)
+#define iQinternal_default_signal_process 709
+DEFINE_LISP_SYMBOL (Qinternal_default_signal_process)
+#define iQinternal_echo_keystrokes_prefix 710
+DEFINE_LISP_SYMBOL (Qinternal_echo_keystrokes_prefix)
+#define iQinternal_when_entered_debugger 711
+DEFINE_LISP_SYMBOL (Qinternal_when_entered_debugger)
+#define iQinterpreted_function 712
+DEFINE_LISP_SYMBOL (Qinterpreted_function)
+#define iQinterrupt_process_functions 713
+DEFINE_LISP_SYMBOL (Qinterrupt_process_functions)
+#define iQinterrupted 714
+DEFINE_LISP_SYMBOL (Qinterrupted)
+#define iQintervals 715
+DEFINE_LISP_SYMBOL (Qintervals)
+#define iQinvalid_arity 716
+DEFINE_LISP_SYMBOL (Qinvalid_arity)
+#define iQinvalid_function 717
+DEFINE_LISP_SYMBOL (Qinvalid_function)
+#define iQinvalid_read_syntax 718
+DEFINE_LISP_SYMBOL (Qinvalid_read_syntax)
+#define iQinvalid_regexp 719
+DEFINE_LISP_SYMBOL (Qinvalid_regexp)
+#define iQinvalid_source 720
+DEFINE_LISP_SYMBOL (Qinvalid_source)
+#define iQinvisible 721
+DEFINE_LISP_SYMBOL (Qinvisible)
+#define iQipv4 722
+DEFINE_LISP_SYMBOL (Qipv4)
+#define iQipv6 723
+DEFINE_LISP_SYMBOL (Qipv6)
+#define iQiso10646_1 724
+DEFINE_LISP_SYMBOL (Qiso10646_1)
+#define iQiso8859_1 725
+DEFINE_LISP_SYMBOL (Qiso8859_1)
+#define iQiso_2022 726
+DEFINE_LISP_SYMBOL (Qiso_2022)
+#define iQiso_8859_1 727
+DEFINE_LISP_SYMBOL (Qiso_8859_1)
+#define iQitalic 728
+DEFINE_LISP_SYMBOL (Qitalic)
+#define iQiv_auto 729
+DEFINE_LISP_SYMBOL (Qiv_auto)
+#define iQja 730
+DEFINE_LISP_SYMBOL (Qja)
+#define iQjson_end_of_file 731
+DEFINE_LISP_SYMBOL (Qjson_end_of_file)
+#define iQjson_error 732
+DEFINE_LISP_SYMBOL (Qjson_error)
+#define iQjson_escape_sequence_error 733
+DEFINE_LISP_SYMBOL (Qjson_escape_sequence_error)
+#define iQjson_invalid_surrogate_error 734
+DEFINE_LISP_SYMBOL (Qjson_invalid_surrogate_error)
+#define iQjson_number_out_of_range 735
+DEFINE_LISP_SYMBOL (Qjson_number_out_of_range)
+#define iQjson_object_too_deep 736
+DEFINE_LISP_SYMBOL (Qjson_object_too_deep)
+#define iQjson_out_of_memory 737
+DEFINE_LISP_SYMBOL (Qjson_out_of_memory)
+#define iQjson_parse_error 738
+DEFINE_LISP_SYMBOL (Qjson_parse_error)
+#define iQjson_parse_string 739
+DEFINE_LISP_SYMBOL (Qjson_parse_string)
+#define iQjson_serialize 740
+DEFINE_LISP_SYMBOL (Qjson_serialize)
+#define iQjson_stream 741
+DEFINE_LISP_SYMBOL (Qjson_stream)
+#define iQjson_stream_p 742
+DEFINE_LISP_SYMBOL (Qjson_stream_p)
+#define iQjson_trailing_content 743
+DEFINE_LISP_SYMBOL (Qjson_trailing_content)
+#define iQjson_utf8_decode_error 744
+DEFINE_LISP_SYMBOL (Qjson_utf8_decode_error)
+#define iQjson_value_p 745
+DEFINE_LISP_SYMBOL (Qjson_value_p)
+#define iQjump 746
+DEFINE_LISP_SYMBOL (Qjump)
+#define iQkbd_macro_termination_hook 747
+DEFINE_LISP_SYMBOL (Qkbd_macro_termination_hook)
+#define iQkeep_ratio 748
+DEFINE_LISP_SYMBOL (Qkeep_ratio)
+#define iQkey 749
+DEFINE_LISP_SYMBOL (Qkey)
+#define iQkey_and_value 750
+DEFINE_LISP_SYMBOL (Qkey_and_value)
+#define iQkey_or_value 751
+DEFINE_LISP_SYMBOL (Qkey_or_value)
+#define iQkey_parse 752
+DEFINE_LISP_SYMBOL (Qkey_parse)
+#define iQkey_valid_p 753
+DEFINE_LISP_SYMBOL (Qkey_valid_p)
+#define iQkeymap 754
+DEFINE_LISP_SYMBOL (Qkeymap)
+#define iQkeymap_canonicalize 755
+DEFINE_LISP_SYMBOL (Qkeymap_canonicalize)
+#define iQkeymapp 756
+DEFINE_LISP_SYMBOL (Qkeymapp)
+#define iQkill_buffer__possibly_save 757
+DEFINE_LISP_SYMBOL (Qkill_buffer__possibly_save)
+#define iQkill_buffer_hook 758
+DEFINE_LISP_SYMBOL (Qkill_buffer_hook)
+#define iQkill_buffer_query_functions 759
+DEFINE_LISP_SYMBOL (Qkill_buffer_query_functions)
+#define iQkill_emacs 760
+DEFINE_LISP_SYMBOL (Qkill_emacs)
+#define iQkill_emacs_hook 761
+DEFINE_LISP_SYMBOL (Qkill_emacs_hook)
+#define iQkill_forward_chars 762
+DEFINE_LISP_SYMBOL (Qkill_forward_chars)
+#define iQko 763
+DEFINE_LISP_SYMBOL (Qko)
+#define iQlanguage_change 764
+DEFINE_LISP_SYMBOL (Qlanguage_change)
+#define iQlast_arrow_position 765
+DEFINE_LISP_SYMBOL (Qlast_arrow_position)
+#define iQlast_arrow_string 766
+DEFINE_LISP_SYMBOL (Qlast_arrow_string)
+#define iQlast_nonmenu_event 767
+DEFINE_LISP_SYMBOL (Qlast_nonmenu_event)
+#define iQlast_selected_window 768
+DEFINE_LISP_SYMBOL (Qlast_selected_window)
+#define iQleft 769
+DEFINE_LISP_SYMBOL (Qleft)
+#define iQleft_edge 770
+DEFINE_LISP_SYMBOL (Qleft_edge)
+#define iQleft_fringe 771
+DEFINE_LISP_SYMBOL (Qleft_fringe)
+#define iQleft_fringe_help 772
+DEFINE_LISP_SYMBOL (Qleft_fringe_help)
+#define iQleft_margin 773
+DEFINE_LISP_SYMBOL (Qleft_margin)
+#define iQleft_only 774
+DEFINE_LISP_SYMBOL (Qleft_only)
+#define iQleft_to_right 775
+DEFINE_LISP_SYMBOL (Qleft_to_right)
+#define iQleftmost 776
+DEFINE_LISP_SYMBOL (Qleftmost)
+#define iQlet 777
+DEFINE_LISP_SYMBOL (Qlet)
+#define iQletx 778
+DEFINE_LISP_SYMBOL (Qletx)
+#define iQlexical_binding 779
+DEFINE_LISP_SYMBOL (Qlexical_binding)
+#define iQlight 780
+DEFINE_LISP_SYMBOL (Qlight)
+#define iQline 781
+DEFINE_LISP_SYMBOL (Qline)
+#define iQline_height 782
+DEFINE_LISP_SYMBOL (Qline_height)
+#define iQline_number 783
+DEFINE_LISP_SYMBOL (Qline_number)
+#define iQline_number_current_line 784
+DEFINE_LISP_SYMBOL (Qline_number_current_line)
+#define iQline_number_major_tick 785
+DEFINE_LISP_SYMBOL (Qline_number_major_tick)
+#define iQline_number_minor_tick 786
+DEFINE_LISP_SYMBOL (Qline_number_minor_tick)
+#define iQline_prefix 787
+DEFINE_LISP_SYMBOL (Qline_prefix)
+#define iQline_spacing 788
+DEFINE_LISP_SYMBOL (Qline_spacing)
+#define iQlisp_directory 789
+DEFINE_LISP_SYMBOL (Qlisp_directory)
+#define iQlist 790
+DEFINE_LISP_SYMBOL (Qlist)
+#define iQlist_or_vector_p 791
+DEFINE_LISP_SYMBOL (Qlist_or_vector_p)
+#define iQlist_system_processes 792
+DEFINE_LISP_SYMBOL (Qlist_system_processes)
+#define iQlisten 793
+DEFINE_LISP_SYMBOL (Qlisten)
+#define iQlistp 794
+DEFINE_LISP_SYMBOL (Qlistp)
+#define iQlittle 795
+DEFINE_LISP_SYMBOL (Qlittle)
+#define iQload 796
+DEFINE_LISP_SYMBOL (Qload)
+#define iQload_file_name 797
+DEFINE_LISP_SYMBOL (Qload_file_name)
+#define iQload_force_doc_strings 798
+DEFINE_LISP_SYMBOL (Qload_force_doc_strings)
+#define iQload_in_progress 799
+DEFINE_LISP_SYMBOL (Qload_in_progress)
+#define iQload_time 800
+DEFINE_LISP_SYMBOL (Qload_time)
+#define iQlocal 801
+DEFINE_LISP_SYMBOL (Qlocal)
+#define iQlocal_map 802
+DEFINE_LISP_SYMBOL (Qlocal_map)
+#define iQlock_file 803
+DEFINE_LISP_SYMBOL (Qlock_file)
+#define iQlong 804
+DEFINE_LISP_SYMBOL (Qlong)
+#define iQlowercase 805
+DEFINE_LISP_SYMBOL (Qlowercase)
+#define iQlread_unescaped_character_literals 806
+DEFINE_LISP_SYMBOL (Qlread_unescaped_character_literals)
+#define iQm 807
+DEFINE_LISP_SYMBOL (Qm)
+#define iQmac 808
+DEFINE_LISP_SYMBOL (Qmac)
+#define iQmacro 809
+DEFINE_LISP_SYMBOL (Qmacro)
+#define iQmacroexp__dynvars 810
+DEFINE_LISP_SYMBOL (Qmacroexp__dynvars)
+#define iQmajflt 811
+DEFINE_LISP_SYMBOL (Qmajflt)
+#define iQmake_directory 812
+DEFINE_LISP_SYMBOL (Qmake_directory)
+#define iQmake_directory_internal 813
+DEFINE_LISP_SYMBOL (Qmake_directory_internal)
+#define iQmake_frame_visible 814
+DEFINE_LISP_SYMBOL (Qmake_frame_visible)
+#define iQmake_invisible 815
+DEFINE_LISP_SYMBOL (Qmake_invisible)
+#define iQmake_lock_file_name 816
+DEFINE_LISP_SYMBOL (Qmake_lock_file_name)
+#define iQmake_process 817
+DEFINE_LISP_SYMBOL (Qmake_process)
+#define iQmake_symbolic_link 818
+DEFINE_LISP_SYMBOL (Qmake_symbolic_link)
+#define iQmakunbound 819
+DEFINE_LISP_SYMBOL (Qmakunbound)
+#define iQmany 820
+DEFINE_LISP_SYMBOL (Qmany)
+#define iQmargin 821
+DEFINE_LISP_SYMBOL (Qmargin)
+#define iQmark_for_redisplay 822
+DEFINE_LISP_SYMBOL (Qmark_for_redisplay)
+#define iQmark_inactive 823
+DEFINE_LISP_SYMBOL (Qmark_inactive)
+#define iQmarker 824
+DEFINE_LISP_SYMBOL (Qmarker)
+#define iQmarkerp 825
+DEFINE_LISP_SYMBOL (Qmarkerp)
+#define iQmaximized 826
+DEFINE_LISP_SYMBOL (Qmaximized)
+#define iQmd5 827
+DEFINE_LISP_SYMBOL (Qmd5)
+#define iQmedium 828
+DEFINE_LISP_SYMBOL (Qmedium)
+#define iQmemory_info 829
+DEFINE_LISP_SYMBOL (Qmemory_info)
+#define iQmenu 830
+DEFINE_LISP_SYMBOL (Qmenu)
+#define iQmenu_bar 831
+DEFINE_LISP_SYMBOL (Qmenu_bar)
+#define iQmenu_bar_external 832
+DEFINE_LISP_SYMBOL (Qmenu_bar_external)
+#define iQmenu_bar_lines 833
+DEFINE_LISP_SYMBOL (Qmenu_bar_lines)
+#define iQmenu_bar_size 834
+DEFINE_LISP_SYMBOL (Qmenu_bar_size)
+#define iQmenu_bar_update_hook 835
+DEFINE_LISP_SYMBOL (Qmenu_bar_update_hook)
+#define iQmenu_enable 836
+DEFINE_LISP_SYMBOL (Qmenu_enable)
+#define iQmenu_item 837
+DEFINE_LISP_SYMBOL (Qmenu_item)
+#define iQmessage 838
+DEFINE_LISP_SYMBOL (Qmessage)
+#define iQmetadata 839
+DEFINE_LISP_SYMBOL (Qmetadata)
+#define iQmin_height 840
+DEFINE_LISP_SYMBOL (Qmin_height)
+#define iQmin_width 841
+DEFINE_LISP_SYMBOL (Qmin_width)
+#define iQminflt 842
+DEFINE_LISP_SYMBOL (Qminflt)
+#define iQminibuffer 843
+DEFINE_LISP_SYMBOL (Qminibuffer)
+#define iQminibuffer_completing_file_name 844
+DEFINE_LISP_SYMBOL (Qminibuffer_completing_file_name)
+#define iQminibuffer_completion_table 845
+DEFINE_LISP_SYMBOL (Qminibuffer_completion_table)
+#define iQminibuffer_default 846
+DEFINE_LISP_SYMBOL (Qminibuffer_default)
+#define iQminibuffer_exit 847
+DEFINE_LISP_SYMBOL (Qminibuffer_exit)
+#define iQminibuffer_exit_hook 848
+DEFINE_LISP_SYMBOL (Qminibuffer_exit_hook)
+#define iQminibuffer_follows_selected_frame 849
+DEFINE_LISP_SYMBOL (Qminibuffer_follows_selected_frame)
+#define iQminibuffer_history 850
+DEFINE_LISP_SYMBOL (Qminibuffer_history)
+#define iQminibuffer_inactive_mode 851
+DEFINE_LISP_SYMBOL (Qminibuffer_inactive_mode)
+#define iQminibuffer_mode 852
+DEFINE_LISP_SYMBOL (Qminibuffer_mode)
+#define iQminibuffer_prompt 853
+DEFINE_LISP_SYMBOL (Qminibuffer_prompt)
+#define iQminibuffer_quit 854
+DEFINE_LISP_SYMBOL (Qminibuffer_quit)
+#define iQminibuffer_setup_hook 855
+DEFINE_LISP_SYMBOL (Qminibuffer_setup_hook)
+#define iQminus 856
+DEFINE_LISP_SYMBOL (Qminus)
+#define iQmirroring 857
+DEFINE_LISP_SYMBOL (Qmirroring)
+#define iQmisses 858
+DEFINE_LISP_SYMBOL (Qmisses)
+#define iQmissing_module_init_function 859
+DEFINE_LISP_SYMBOL (Qmissing_module_init_function)
+#define iQmm_size 860
+DEFINE_LISP_SYMBOL (Qmm_size)
+#define iQmode_class 861
+DEFINE_LISP_SYMBOL (Qmode_class)
+#define iQmode_line 862
+DEFINE_LISP_SYMBOL (Qmode_line)
+#define iQmode_line_active 863
+DEFINE_LISP_SYMBOL (Qmode_line_active)
+#define iQmode_line_default_help_echo 864
+DEFINE_LISP_SYMBOL (Qmode_line_default_help_echo)
+#define iQmode_line_format 865
+DEFINE_LISP_SYMBOL (Qmode_line_format)
+#define iQmode_line_inactive 866
+DEFINE_LISP_SYMBOL (Qmode_line_inactive)
+#define iQmode_overlay 867
+DEFINE_LISP_SYMBOL (Qmode_overlay)
+#define iQmode_overlay_face_alist 868
+DEFINE_LISP_SYMBOL (Qmode_overlay_face_alist)
+#define iQmode_overlay_filter_buffer_substring_function 869
+DEFINE_LISP_SYMBOL (Qmode_overlay_filter_buffer_substring_function)
+#define iQmode_overlay_on_switch_to_buffer 870
+DEFINE_LISP_SYMBOL (Qmode_overlay_on_switch_to_buffer)
+#define iQmode_overlay_p 871
+DEFINE_LISP_SYMBOL (Qmode_overlay_p)
+#define iQmodeline 872
+DEFINE_LISP_SYMBOL (Qmodeline)
+#define iQmodification_hooks 873
+DEFINE_LISP_SYMBOL (Qmodification_hooks)
+#define iQmodifier_cache 874
+DEFINE_LISP_SYMBOL (Qmodifier_cache)
+#define iQmodule_function 875
+DEFINE_LISP_SYMBOL (Qmodule_function)
+#define iQmodule_function_p 876
+DEFINE_LISP_SYMBOL (Qmodule_function_p)
+#define iQmodule_init_failed 877
+DEFINE_LISP_SYMBOL (Qmodule_init_failed)
+#define iQmodule_load_failed 878
+DEFINE_LISP_SYMBOL (Qmodule_load_failed)
+#define iQmodule_open_failed 879
+DEFINE_LISP_SYMBOL (Qmodule_open_failed)
+#define iQmonths 880
+DEFINE_LISP_SYMBOL (Qmonths)
+#define iQmouse 881
+DEFINE_LISP_SYMBOL (Qmouse)
+#define iQmouse_click 882
+DEFINE_LISP_SYMBOL (Qmouse_click)
+#define iQmouse_color 883
+DEFINE_LISP_SYMBOL (Qmouse_color)
+#define iQmouse_face 884
+DEFINE_LISP_SYMBOL (Qmouse_face)
+#define iQmouse_fixup_help_message 885
+DEFINE_LISP_SYMBOL (Qmouse_fixup_help_message)
+#define iQmouse_leave_buffer_hook 886
+DEFINE_LISP_SYMBOL (Qmouse_leave_buffer_hook)
+#define iQmouse_movement 887
+DEFINE_LISP_SYMBOL (Qmouse_movement)
+#define iQmouse_wheel_frame 888
+DEFINE_LISP_SYMBOL (Qmouse_wheel_frame)
+#define iQmove_frame 889
+DEFINE_LISP_SYMBOL (Qmove_frame)
+#define iQmove_toolbar 890
+DEFINE_LISP_SYMBOL (Qmove_toolbar)
+#define iQmutex 891
+DEFINE_LISP_SYMBOL (Qmutex)
+#define iQmutexp 892
+DEFINE_LISP_SYMBOL (Qmutexp)
+#define iQname 893
+DEFINE_LISP_SYMBOL (Qname)
+#define iQnative_comp_compiler_options 894
+DEFINE_LISP_SYMBOL (Qnative_comp_compiler_options)
+#define iQnative_comp_debug 895
+DEFINE_LISP_SYMBOL (Qnative_comp_debug)
+#define iQnative_comp_driver_options 896
+DEFINE_LISP_SYMBOL (Qnative_comp_driver_options)
+#define iQnative_comp_function 897
+DEFINE_LISP_SYMBOL (Qnative_comp_function)
+#define iQnative_comp_speed 898
+DEFINE_LISP_SYMBOL (Qnative_comp_speed)
+#define iQnative_comp_unit 899
+DEFINE_LISP_SYMBOL (Qnative_comp_unit)
+#define iQnative_compiler 900
+DEFINE_LISP_SYMBOL (Qnative_compiler)
+#define iQnative_compiler_error 901
+DEFINE_LISP_SYMBOL (Qnative_compiler_error)
+#define iQnative_edges 902
+DEFINE_LISP_SYMBOL (Qnative_edges)
+#define iQnative_ice 903
+DEFINE_LISP_SYMBOL (Qnative_ice)
+#define iQnative_lisp_file_inconsistent 904
+DEFINE_LISP_SYMBOL (Qnative_lisp_file_inconsistent)
+#define iQnative_lisp_load_failed 905
+DEFINE_LISP_SYMBOL (Qnative_lisp_load_failed)
+#define iQnative_lisp_wrong_reloc 906
+DEFINE_LISP_SYMBOL (Qnative_lisp_wrong_reloc)
+#define iQnatnump 907
+DEFINE_LISP_SYMBOL (Qnatnump)
+#define iQnegate 908
+DEFINE_LISP_SYMBOL (Qnegate)
+#define iQnetwork 909
+DEFINE_LISP_SYMBOL (Qnetwork)
+#define iQnewline 910
+DEFINE_LISP_SYMBOL (Qnewline)
+#define iQnice 911
+DEFINE_LISP_SYMBOL (Qnice)
+#define iQno_accept_focus 912
+DEFINE_LISP_SYMBOL (Qno_accept_focus)
+#define iQno_catch 913
+DEFINE_LISP_SYMBOL (Qno_catch)
+#define iQno_conversion 914
+DEFINE_LISP_SYMBOL (Qno_conversion)
+#define iQno_focus_on_map 915
+DEFINE_LISP_SYMBOL (Qno_focus_on_map)
+#define iQno_other_frame 916
+DEFINE_LISP_SYMBOL (Qno_other_frame)
+#define iQno_other_window 917
+DEFINE_LISP_SYMBOL (Qno_other_window)
+#define iQno_record 918
+DEFINE_LISP_SYMBOL (Qno_record)
+#define iQno_special_glyphs 919
+DEFINE_LISP_SYMBOL (Qno_special_glyphs)
+#define iQnobreak_hyphen 920
+DEFINE_LISP_SYMBOL (Qnobreak_hyphen)
+#define iQnobreak_space 921
+DEFINE_LISP_SYMBOL (Qnobreak_space)
+#define iQnoelisp 922
+DEFINE_LISP_SYMBOL (Qnoelisp)
+#define iQnon_ascii 923
+DEFINE_LISP_SYMBOL (Qnon_ascii)
+#define iQnon_key_event 924
+DEFINE_LISP_SYMBOL (Qnon_key_event)
+#define iQnone 925
+DEFINE_LISP_SYMBOL (Qnone)
+#define iQnormal 926
+DEFINE_LISP_SYMBOL (Qnormal)
+#define iQnormal_top_level 927
+DEFINE_LISP_SYMBOL (Qnormal_top_level)
+#define iQns 928
+DEFINE_LISP_SYMBOL (Qns)
+#define iQns_appearance 929
+DEFINE_LISP_SYMBOL (Qns_appearance)
+#define iQns_parse_geometry 930
+DEFINE_LISP_SYMBOL (Qns_parse_geometry)
+#define iQns_transparent_titlebar 931
+DEFINE_LISP_SYMBOL (Qns_transparent_titlebar)
+#define iQnsm_verify_connection 932
+DEFINE_LISP_SYMBOL (Qnsm_verify_connection)
+#define iQnth 933
+DEFINE_LISP_SYMBOL (Qnth)
+#define iQnull 934
+DEFINE_LISP_SYMBOL (Qnull)
+#define iQnumber_or_marker_p 935
+DEFINE_LISP_SYMBOL (Qnumber_or_marker_p)
+#define iQnumberp 936
+DEFINE_LISP_SYMBOL (Qnumberp)
+#define iQnumeric 937
+DEFINE_LISP_SYMBOL (Qnumeric)
+#define iQobarray 938
+DEFINE_LISP_SYMBOL (Qobarray)
+#define iQobarray_cache 939
+DEFINE_LISP_SYMBOL (Qobarray_cache)
+#define iQobarrayp 940
+DEFINE_LISP_SYMBOL (Qobarrayp)
+#define iQobject 941
+DEFINE_LISP_SYMBOL (Qobject)
+#define iQoblique 942
+DEFINE_LISP_SYMBOL (Qoblique)
+#define iQoclosure_interactive_form 943
+DEFINE_LISP_SYMBOL (Qoclosure_interactive_form)
+#define iQodd 944
+DEFINE_LISP_SYMBOL (Qodd)
+#define iQonly 945
+DEFINE_LISP_SYMBOL (Qonly)
+#define iQopen 946
+DEFINE_LISP_SYMBOL (Qopen)
+#define iQopen_network_stream 947
+DEFINE_LISP_SYMBOL (Qopen_network_stream)
+#define iQopentype 948
+DEFINE_LISP_SYMBOL (Qopentype)
+#define iQoperations 949
+DEFINE_LISP_SYMBOL (Qoperations)
+#define iQouter_border_width 950
+DEFINE_LISP_SYMBOL (Qouter_border_width)
+#define iQouter_edges 951
+DEFINE_LISP_SYMBOL (Qouter_edges)
+#define iQouter_position 952
+DEFINE_LISP_SYMBOL (Qouter_position)
+#define iQouter_size 953
+DEFINE_LISP_SYMBOL (Qouter_size)
+#define iQouter_window_id 954
+DEFINE_LISP_SYMBOL (Qouter_window_id)
+#define iQoverflow_error 955
+DEFINE_LISP_SYMBOL (Qoverflow_error)
+#define iQoverlay 956
+DEFINE_LISP_SYMBOL (Qoverlay)
+#define iQoverlay_arrow_bitmap 957
+DEFINE_LISP_SYMBOL (Qoverlay_arrow_bitmap)
+#define iQoverlay_arrow_string 958
+DEFINE_LISP_SYMBOL (Qoverlay_arrow_string)
+#define iQoverlayp 959
+DEFINE_LISP_SYMBOL (Qoverlayp)
+#define iQoverride_redirect 960
+DEFINE_LISP_SYMBOL (Qoverride_redirect)
+#define iQoverriding_local_map 961
+DEFINE_LISP_SYMBOL (Qoverriding_local_map)
+#define iQoverriding_plist_environment 962
+DEFINE_LISP_SYMBOL (Qoverriding_plist_environment)
+#define iQoverriding_terminal_local_map 963
+DEFINE_LISP_SYMBOL (Qoverriding_terminal_local_map)
+#define iQoverwrite_mode 964
+DEFINE_LISP_SYMBOL (Qoverwrite_mode)
+#define iQoverwrite_mode_binary 965
+DEFINE_LISP_SYMBOL (Qoverwrite_mode_binary)
+#define iQp 966
+DEFINE_LISP_SYMBOL (Qp)
+#define iQpaper 967
+DEFINE_LISP_SYMBOL (Qpaper)
+#define iQparent_frame 968
+DEFINE_LISP_SYMBOL (Qparent_frame)
+#define iQparent_id 969
+DEFINE_LISP_SYMBOL (Qparent_id)
+#define iQpc 970
+DEFINE_LISP_SYMBOL (Qpc)
+#define iQpcpu 971
+DEFINE_LISP_SYMBOL (Qpcpu)
+#define iQpermanent_local 972
+DEFINE_LISP_SYMBOL (Qpermanent_local)
+#define iQpermanent_local_hook 973
+DEFINE_LISP_SYMBOL (Qpermanent_local_hook)
+#define iQpermission_denied 974
+DEFINE_LISP_SYMBOL (Qpermission_denied)
+#define iQpgrp 975
+DEFINE_LISP_SYMBOL (Qpgrp)
+#define iQpgtk 976
+DEFINE_LISP_SYMBOL (Qpgtk)
+#define iQphi 977
+DEFINE_LISP_SYMBOL (Qphi)
+#define iQpinch 978
+DEFINE_LISP_SYMBOL (Qpinch)
+#define iQpipe 979
+DEFINE_LISP_SYMBOL (Qpipe)
+#define iQpipe_process_p 980
+DEFINE_LISP_SYMBOL (Qpipe_process_p)
+#define iQplay_sound_functions 981
+DEFINE_LISP_SYMBOL (Qplay_sound_functions)
+#define iQplist 982
+DEFINE_LISP_SYMBOL (Qplist)
+#define iQplistp 983
+DEFINE_LISP_SYMBOL (Qplistp)
+#define iQplus 984
+DEFINE_LISP_SYMBOL (Qplus)
+#define iQpmem 985
+DEFINE_LISP_SYMBOL (Qpmem)
+#define iQpoint_entered 986
+DEFINE_LISP_SYMBOL (Qpoint_entered)
+#define iQpoint_left 987
+DEFINE_LISP_SYMBOL (Qpoint_left)
+#define iQpointer 988
+DEFINE_LISP_SYMBOL (Qpointer)
+#define iQpolling_period 989
+DEFINE_LISP_SYMBOL (Qpolling_period)
+#define iQpoly 990
+DEFINE_LISP_SYMBOL (Qpoly)
+#define iQpop_exception 991
+DEFINE_LISP_SYMBOL (Qpop_exception)
+#define iQposition 992
+DEFINE_LISP_SYMBOL (Qposition)
+#define iQpost_command_hook 993
+DEFINE_LISP_SYMBOL (Qpost_command_hook)
+#define iQpost_gc_hook 994
+DEFINE_LISP_SYMBOL (Qpost_gc_hook)
+#define iQpost_select_region_hook 995
+DEFINE_LISP_SYMBOL (Qpost_select_region_hook)
+#define iQpost_self_insert_hook 996
+DEFINE_LISP_SYMBOL (Qpost_self_insert_hook)
+#define iQppid 997
+DEFINE_LISP_SYMBOL (Qppid)
+#define iQpre_command_hook 998
+DEFINE_LISP_SYMBOL (Qpre_command_hook)
+#define iQpreedit_text 999
+DEFINE_LISP_SYMBOL (Qpreedit_text)
+#define iQpressed_button 1000
+DEFINE_LISP_SYMBOL (Qpressed_button)
+#define iQpri 1001
+DEFINE_LISP_SYMBOL (Qpri)
+#define iQprimitive_function 1002
+DEFINE_LISP_SYMBOL (Qprimitive_function)
+#define iQprint__unreadable_callback_buffer 1003
+DEFINE_LISP_SYMBOL (Qprint__unreadable_callback_buffer)
+#define iQprint_escape_multibyte 1004
+DEFINE_LISP_SYMBOL (Qprint_escape_multibyte)
+#define iQprint_escape_nonascii 1005
+DEFINE_LISP_SYMBOL (Qprint_escape_nonascii)
+#define iQprint_unreadable_function 1006
+DEFINE_LISP_SYMBOL (Qprint_unreadable_function)
+#define iQpriority 1007
+DEFINE_LISP_SYMBOL (Qpriority)
+#define iQprocess 1008
+DEFINE_LISP_SYMBOL (Qprocess)
+#define iQprocess_attributes 1009
+DEFINE_LISP_SYMBOL (Qprocess_attributes)
+#define iQprocessp 1010
+DEFINE_LISP_SYMBOL (Qprocessp)
+#define iQprogn 1011
+DEFINE_LISP_SYMBOL (Qprogn)
+#define iQpropertize 1012
+DEFINE_LISP_SYMBOL (Qpropertize)
+#define iQprotected_field 1013
+DEFINE_LISP_SYMBOL (Qprotected_field)
+#define iQprovide 1014
+DEFINE_LISP_SYMBOL (Qprovide)
+#define iQpty 1015
+DEFINE_LISP_SYMBOL (Qpty)
+#define iQpure 1016
+DEFINE_LISP_SYMBOL (Qpure)
+#define iQpurecopy 1017
+DEFINE_LISP_SYMBOL (Qpurecopy)
+#define iQpush_exception 1018
+DEFINE_LISP_SYMBOL (Qpush_exception)
+#define iQpush_window_buffer_onto_prev 1019
+DEFINE_LISP_SYMBOL (Qpush_window_buffer_onto_prev)
+#define iQquit 1020
+DEFINE_LISP_SYMBOL (Qquit)
+#define iQquit_restore 1021
+DEFINE_LISP_SYMBOL (Qquit_restore)
+#define iQquit_restore_prev 1022
+DEFINE_LISP_SYMBOL (Qquit_restore_prev)
+#define iQquote 1023
+DEFINE_LISP_SYMBOL (Qquote)
+#define iQraise 1024
+DEFINE_LISP_SYMBOL (Qraise)
+#define iQrange 1025
+DEFINE_LISP_SYMBOL (Qrange)
+#define iQrange_error 1026
+DEFINE_LISP_SYMBOL (Qrange_error)
+#define iQratio 1027
+DEFINE_LISP_SYMBOL (Qratio)
+#define iQraw_text 1028
+DEFINE_LISP_SYMBOL (Qraw_text)
+#define iQread 1029
+DEFINE_LISP_SYMBOL (Qread)
+#define iQread_char 1030
+DEFINE_LISP_SYMBOL (Qread_char)
+#define iQread_number 1031
+DEFINE_LISP_SYMBOL (Qread_number)
+#define iQread_only 1032
+DEFINE_LISP_SYMBOL (Qread_only)
+#define iQreal 1033
+DEFINE_LISP_SYMBOL (Qreal)
+#define iQreal_this_command 1034
+DEFINE_LISP_SYMBOL (Qreal_this_command)
+#define iQrear_nonsticky 1035
+DEFINE_LISP_SYMBOL (Qrear_nonsticky)
+#define iQrecenter 1036
+DEFINE_LISP_SYMBOL (Qrecenter)
+#define iQrecord 1037
+DEFINE_LISP_SYMBOL (Qrecord)
+#define iQrecord_unwind_current_buffer 1038
+DEFINE_LISP_SYMBOL (Qrecord_unwind_current_buffer)
+#define iQrecord_unwind_protect_excursion 1039
+DEFINE_LISP_SYMBOL (Qrecord_unwind_protect_excursion)
+#define iQrecord_window_buffer 1040
+DEFINE_LISP_SYMBOL (Qrecord_window_buffer)
+#define iQrecordp 1041
+DEFINE_LISP_SYMBOL (Qrecordp)
+#define iQrect 1042
+DEFINE_LISP_SYMBOL (Qrect)
+#define iQrecursion_error 1043
+DEFINE_LISP_SYMBOL (Qrecursion_error)
+#define iQredisplay_dont_pause 1044
+DEFINE_LISP_SYMBOL (Qredisplay_dont_pause)
+#define iQredisplay_internal_xC_functionx 1045
+DEFINE_LISP_SYMBOL (Qredisplay_internal_xC_functionx)
+#define iQrelative 1046
+DEFINE_LISP_SYMBOL (Qrelative)
+#define iQreleased_button 1047
+DEFINE_LISP_SYMBOL (Qreleased_button)
+#define iQremap 1048
+DEFINE_LISP_SYMBOL (Qremap)
+#define iQremote_file_error 1049
+DEFINE_LISP_SYMBOL (Qremote_file_error)
+#define iQrename_file 1050
+DEFINE_LISP_SYMBOL (Qrename_file)
+#define iQreplace_buffer_in_windows 1051
+DEFINE_LISP_SYMBOL (Qreplace_buffer_in_windows)
+#define iQrequire 1052
+DEFINE_LISP_SYMBOL (Qrequire)
+#define iQreset 1053
+DEFINE_LISP_SYMBOL (Qreset)
+#define iQreturn 1054
+DEFINE_LISP_SYMBOL (Qreturn)
+#define iQreuse 1055
+DEFINE_LISP_SYMBOL (Qreuse)
+#define iQright 1056
+DEFINE_LISP_SYMBOL (Qright)
+#define iQright_divider 1057
+DEFINE_LISP_SYMBOL (Qright_divider)
+#define iQright_divider_width 1058
+DEFINE_LISP_SYMBOL (Qright_divider_width)
+#define iQright_edge 1059
+DEFINE_LISP_SYMBOL (Qright_edge)
+#define iQright_fringe 1060
+DEFINE_LISP_SYMBOL (Qright_fringe)
+#define iQright_fringe_help 1061
+DEFINE_LISP_SYMBOL (Qright_fringe_help)
+#define iQright_margin 1062
+DEFINE_LISP_SYMBOL (Qright_margin)
+#define iQright_to_left 1063
+DEFINE_LISP_SYMBOL (Qright_to_left)
+#define iQrightmost 1064
+DEFINE_LISP_SYMBOL (Qrightmost)
+#define iQrisky_local_variable 1065
+DEFINE_LISP_SYMBOL (Qrisky_local_variable)
+#define iQrss 1066
+DEFINE_LISP_SYMBOL (Qrss)
+#define iQrun 1067
+DEFINE_LISP_SYMBOL (Qrun)
+#define iQrun_hook_query_error_with_timeout 1068
+DEFINE_LISP_SYMBOL (Qrun_hook_query_error_with_timeout)
+#define iQrun_hook_with_args 1069
+DEFINE_LISP_SYMBOL (Qrun_hook_with_args)
+#define iQsafe 1070
+DEFINE_LISP_SYMBOL (Qsafe)
+#define iQsave_excursion 1071
+DEFINE_LISP_SYMBOL (Qsave_excursion)
+#define iQsave_session 1072
+DEFINE_LISP_SYMBOL (Qsave_session)
+#define iQscale_factor 1073
+DEFINE_LISP_SYMBOL (Qscale_factor)
+#define iQscan_error 1074
+DEFINE_LISP_SYMBOL (Qscan_error)
+#define iQscratch 1075
+DEFINE_LISP_SYMBOL (Qscratch)
+#define iQscreen_gamma 1076
+DEFINE_LISP_SYMBOL (Qscreen_gamma)
+#define iQscroll 1077
+DEFINE_LISP_SYMBOL (Qscroll)
+#define iQscroll_bar 1078
+DEFINE_LISP_SYMBOL (Qscroll_bar)
+#define iQscroll_bar_background 1079
+DEFINE_LISP_SYMBOL (Qscroll_bar_background)
+#define iQscroll_bar_foreground 1080
+DEFINE_LISP_SYMBOL (Qscroll_bar_foreground)
+#define iQscroll_bar_height 1081
+DEFINE_LISP_SYMBOL (Qscroll_bar_height)
+#define iQscroll_bar_movement 1082
+DEFINE_LISP_SYMBOL (Qscroll_bar_movement)
+#define iQscroll_bar_width 1083
+DEFINE_LISP_SYMBOL (Qscroll_bar_width)
+#define iQscroll_command 1084
+DEFINE_LISP_SYMBOL (Qscroll_command)
+#define iQscroll_down 1085
+DEFINE_LISP_SYMBOL (Qscroll_down)
+#define iQscroll_up 1086
+DEFINE_LISP_SYMBOL (Qscroll_up)
+#define iQsearch_failed 1087
+DEFINE_LISP_SYMBOL (Qsearch_failed)
+#define iQselect_frame_set_input_focus 1088
+DEFINE_LISP_SYMBOL (Qselect_frame_set_input_focus)
+#define iQselect_window 1089
+DEFINE_LISP_SYMBOL (Qselect_window)
+#define iQselection_request 1090
+DEFINE_LISP_SYMBOL (Qselection_request)
+#define iQself_insert_command 1091
+DEFINE_LISP_SYMBOL (Qself_insert_command)
+#define iQsemi_bold 1092
+DEFINE_LISP_SYMBOL (Qsemi_bold)
+#define iQsemi_light 1093
+DEFINE_LISP_SYMBOL (Qsemi_light)
+#define iQseqpacket 1094
+DEFINE_LISP_SYMBOL (Qseqpacket)
+#define iQsequencep 1095
+DEFINE_LISP_SYMBOL (Qsequencep)
+#define iQserial 1096
+DEFINE_LISP_SYMBOL (Qserial)
+#define iQsess 1097
+DEFINE_LISP_SYMBOL (Qsess)
+#define iQset 1098
+DEFINE_LISP_SYMBOL (Qset)
+#define iQset_args_to_local 1099
+DEFINE_LISP_SYMBOL (Qset_args_to_local)
+#define iQset_default 1100
+DEFINE_LISP_SYMBOL (Qset_default)
+#define iQset_file_acl 1101
+DEFINE_LISP_SYMBOL (Qset_file_acl)
+#define iQset_file_modes 1102
+DEFINE_LISP_SYMBOL (Qset_file_modes)
+#define iQset_file_selinux_context 1103
+DEFINE_LISP_SYMBOL (Qset_file_selinux_context)
+#define iQset_file_times 1104
+DEFINE_LISP_SYMBOL (Qset_file_times)
+#define iQset_internal 1105
+DEFINE_LISP_SYMBOL (Qset_internal)
+#define iQset_par_to_local 1106
+DEFINE_LISP_SYMBOL (Qset_par_to_local)
+#define iQset_rest_args_to_local 1107
+DEFINE_LISP_SYMBOL (Qset_rest_args_to_local)
+#define iQset_visited_file_modtime 1108
+DEFINE_LISP_SYMBOL (Qset_visited_file_modtime)
+#define iQset_window_configuration 1109
+DEFINE_LISP_SYMBOL (Qset_window_configuration)
+#define iQsetcar 1110
+DEFINE_LISP_SYMBOL (Qsetcar)
+#define iQsetcdr 1111
+DEFINE_LISP_SYMBOL (Qsetcdr)
+#define iQsetimm 1112
+DEFINE_LISP_SYMBOL (Qsetimm)
+#define iQsetq 1113
+DEFINE_LISP_SYMBOL (Qsetq)
+#define iQsetting_constant 1114
+DEFINE_LISP_SYMBOL (Qsetting_constant)
+#define iQsha1 1115
+DEFINE_LISP_SYMBOL (Qsha1)
+#define iQsha224 1116
+DEFINE_LISP_SYMBOL (Qsha224)
+#define iQsha256 1117
+DEFINE_LISP_SYMBOL (Qsha256)
+#define iQsha384 1118
+DEFINE_LISP_SYMBOL (Qsha384)
+#define iQsha512 1119
+DEFINE_LISP_SYMBOL (Qsha512)
+#define iQshaded 1120
+DEFINE_LISP_SYMBOL (Qshaded)
+#define iQshift_jis 1121
+DEFINE_LISP_SYMBOL (Qshift_jis)
+#define iQside_effect_free 1122
+DEFINE_LISP_SYMBOL (Qside_effect_free)
+#define iQsignal 1123
+DEFINE_LISP_SYMBOL (Qsignal)
+#define iQsignal_process_functions 1124
+DEFINE_LISP_SYMBOL (Qsignal_process_functions)
+#define iQsingularity_error 1125
+DEFINE_LISP_SYMBOL (Qsingularity_error)
+#define iQsize 1126
+DEFINE_LISP_SYMBOL (Qsize)
+#define iQskip_taskbar 1127
+DEFINE_LISP_SYMBOL (Qskip_taskbar)
+#define iQslice 1128
+DEFINE_LISP_SYMBOL (Qslice)
+#define iQsound 1129
+DEFINE_LISP_SYMBOL (Qsound)
+#define iQsource 1130
+DEFINE_LISP_SYMBOL (Qsource)
+#define iQspace 1131
+DEFINE_LISP_SYMBOL (Qspace)
+#define iQspace_width 1132
+DEFINE_LISP_SYMBOL (Qspace_width)
+#define iQspecial_form 1133
+DEFINE_LISP_SYMBOL (Qspecial_form)
+#define iQspecial_lowercase 1134
+DEFINE_LISP_SYMBOL (Qspecial_lowercase)
+#define iQspecial_titlecase 1135
+DEFINE_LISP_SYMBOL (Qspecial_titlecase)
+#define iQspecial_uppercase 1136
+DEFINE_LISP_SYMBOL (Qspecial_uppercase)
+#define iQsqlite 1137
+DEFINE_LISP_SYMBOL (Qsqlite)
+#define iQstandard_input 1138
+DEFINE_LISP_SYMBOL (Qstandard_input)
+#define iQstandard_output 1139
+DEFINE_LISP_SYMBOL (Qstandard_output)
+#define iQstart 1140
+DEFINE_LISP_SYMBOL (Qstart)
+#define iQstart_process 1141
+DEFINE_LISP_SYMBOL (Qstart_process)
+#define iQstate 1142
+DEFINE_LISP_SYMBOL (Qstate)
+#define iQstderr 1143
+DEFINE_LISP_SYMBOL (Qstderr)
+#define iQstdin 1144
+DEFINE_LISP_SYMBOL (Qstdin)
+#define iQstdout 1145
+DEFINE_LISP_SYMBOL (Qstdout)
+#define iQsticky 1146
+DEFINE_LISP_SYMBOL (Qsticky)
+#define iQstime 1147
+DEFINE_LISP_SYMBOL (Qstime)
+#define iQstop 1148
+DEFINE_LISP_SYMBOL (Qstop)
+#define iQstraight 1149
+DEFINE_LISP_SYMBOL (Qstraight)
+#define iQstring 1150
+DEFINE_LISP_SYMBOL (Qstring)
+#define iQstring_bytes 1151
+DEFINE_LISP_SYMBOL (Qstring_bytes)
+#define iQstring_lessp 1152
+DEFINE_LISP_SYMBOL (Qstring_lessp)
+#define iQstringp 1153
+DEFINE_LISP_SYMBOL (Qstringp)
+#define iQstrings 1154
+DEFINE_LISP_SYMBOL (Qstrings)
+#define iQsub1 1155
+DEFINE_LISP_SYMBOL (Qsub1)
+#define iQsub_char_table 1156
+DEFINE_LISP_SYMBOL (Qsub_char_table)
+#define iQsubfeatures 1157
+DEFINE_LISP_SYMBOL (Qsubfeatures)
+#define iQsubr 1158
+DEFINE_LISP_SYMBOL (Qsubr)
+#define iQsubr_native_elisp 1159
+DEFINE_LISP_SYMBOL (Qsubr_native_elisp)
+#define iQsubrp 1160
+DEFINE_LISP_SYMBOL (Qsubrp)
+#define iQsubstitute_command_keys 1161
+DEFINE_LISP_SYMBOL (Qsubstitute_command_keys)
+#define iQsubstitute_env_in_file_name 1162
+DEFINE_LISP_SYMBOL (Qsubstitute_env_in_file_name)
+#define iQsubstitute_in_file_name 1163
+DEFINE_LISP_SYMBOL (Qsubstitute_in_file_name)
+#define iQsw 1164
+DEFINE_LISP_SYMBOL (Qsw)
+#define iQswitch_frame 1165
+DEFINE_LISP_SYMBOL (Qswitch_frame)
+#define iQsymbol 1166
+DEFINE_LISP_SYMBOL (Qsymbol)
+#define iQsymbolp 1167
+DEFINE_LISP_SYMBOL (Qsymbolp)
+#define iQsymbols 1168
+DEFINE_LISP_SYMBOL (Qsymbols)
+#define iQsyntax_ppss 1169
+DEFINE_LISP_SYMBOL (Qsyntax_ppss)
+#define iQsyntax_ppss_table 1170
+DEFINE_LISP_SYMBOL (Qsyntax_ppss_table)
+#define iQsyntax_table 1171
+DEFINE_LISP_SYMBOL (Qsyntax_table)
+#define iQsyntax_table_p 1172
+DEFINE_LISP_SYMBOL (Qsyntax_table_p)
+#define iQtab_bar 1173
+DEFINE_LISP_SYMBOL (Qtab_bar)
+#define iQtab_bar_lines 1174
+DEFINE_LISP_SYMBOL (Qtab_bar_lines)
+#define iQtab_bar_size 1175
+DEFINE_LISP_SYMBOL (Qtab_bar_size)
+#define iQtab_line 1176
+DEFINE_LISP_SYMBOL (Qtab_line)
+#define iQtab_line_format 1177
+DEFINE_LISP_SYMBOL (Qtab_line_format)
+#define iQtarget_idx 1178
+DEFINE_LISP_SYMBOL (Qtarget_idx)
+#define iQtemp_buffer_setup_hook 1179
+DEFINE_LISP_SYMBOL (Qtemp_buffer_setup_hook)
+#define iQtemp_buffer_show_hook 1180
+DEFINE_LISP_SYMBOL (Qtemp_buffer_show_hook)
+#define iQtemporary_goal_column 1181
+DEFINE_LISP_SYMBOL (Qtemporary_goal_column)
+#define iQterminal 1182
+DEFINE_LISP_SYMBOL (Qterminal)
+#define iQterminal_frame 1183
+DEFINE_LISP_SYMBOL (Qterminal_frame)
+#define iQterminal_live_p 1184
+DEFINE_LISP_SYMBOL (Qterminal_live_p)
+#define iQtest 1185
+DEFINE_LISP_SYMBOL (Qtest)
+#define iQtext 1186
+DEFINE_LISP_SYMBOL (Qtext)
+#define iQtext_image_horiz 1187
+DEFINE_LISP_SYMBOL (Qtext_image_horiz)
+#define iQtext_pixels 1188
+DEFINE_LISP_SYMBOL (Qtext_pixels)
+#define iQtext_read_only 1189
+DEFINE_LISP_SYMBOL (Qtext_read_only)
+#define iQthcount 1190
+DEFINE_LISP_SYMBOL (Qthcount)
+#define iQthin 1191
+DEFINE_LISP_SYMBOL (Qthin)
+#define iQthin_space 1192
+DEFINE_LISP_SYMBOL (Qthin_space)
+#define iQthread 1193
+DEFINE_LISP_SYMBOL (Qthread)
+#define iQthread_event 1194
+DEFINE_LISP_SYMBOL (Qthread_event)
+#define iQthreadp 1195
+DEFINE_LISP_SYMBOL (Qthreadp)
+#define iQtime 1196
+DEFINE_LISP_SYMBOL (Qtime)
+#define iQtimer_event_handler 1197
+DEFINE_LISP_SYMBOL (Qtimer_event_handler)
+#define iQtip_frame 1198
+DEFINE_LISP_SYMBOL (Qtip_frame)
+#define iQtitle 1199
+DEFINE_LISP_SYMBOL (Qtitle)
+#define iQtitle_bar_size 1200
+DEFINE_LISP_SYMBOL (Qtitle_bar_size)
+#define iQtitlecase 1201
+DEFINE_LISP_SYMBOL (Qtitlecase)
+#define iQtool_bar 1202
+DEFINE_LISP_SYMBOL (Qtool_bar)
+#define iQtool_bar_external 1203
+DEFINE_LISP_SYMBOL (Qtool_bar_external)
+#define iQtool_bar_lines 1204
+DEFINE_LISP_SYMBOL (Qtool_bar_lines)
+#define iQtool_bar_position 1205
+DEFINE_LISP_SYMBOL (Qtool_bar_position)
+#define iQtool_bar_size 1206
+DEFINE_LISP_SYMBOL (Qtool_bar_size)
+#define iQtooltip 1207
+DEFINE_LISP_SYMBOL (Qtooltip)
+#define iQtop 1208
+DEFINE_LISP_SYMBOL (Qtop)
+#define iQtop_edge 1209
+DEFINE_LISP_SYMBOL (Qtop_edge)
+#define iQtop_left_corner 1210
+DEFINE_LISP_SYMBOL (Qtop_left_corner)
+#define iQtop_level 1211
+DEFINE_LISP_SYMBOL (Qtop_level)
+#define iQtop_only 1212
+DEFINE_LISP_SYMBOL (Qtop_only)
+#define iQtop_right_corner 1213
+DEFINE_LISP_SYMBOL (Qtop_right_corner)
+#define iQtouch_end 1214
+DEFINE_LISP_SYMBOL (Qtouch_end)
+#define iQtouchscreen_begin 1215
+DEFINE_LISP_SYMBOL (Qtouchscreen_begin)
+#define iQtouchscreen_end 1216
+DEFINE_LISP_SYMBOL (Qtouchscreen_end)
+#define iQtouchscreen_update 1217
+DEFINE_LISP_SYMBOL (Qtouchscreen_update)
+#define iQtpgid 1218
+DEFINE_LISP_SYMBOL (Qtpgid)
+#define iQtrailing_whitespace 1219
+DEFINE_LISP_SYMBOL (Qtrailing_whitespace)
+#define iQtranslation_table 1220
+DEFINE_LISP_SYMBOL (Qtranslation_table)
+#define iQtranslation_table_id 1221
+DEFINE_LISP_SYMBOL (Qtranslation_table_id)
+#define iQtrapping_constant 1222
+DEFINE_LISP_SYMBOL (Qtrapping_constant)
+#define iQtree_sitter 1223
+DEFINE_LISP_SYMBOL (Qtree_sitter)
+#define iQtree_sitter_cursor 1224
+DEFINE_LISP_SYMBOL (Qtree_sitter_cursor)
+#define iQtree_sitter_node 1225
+DEFINE_LISP_SYMBOL (Qtree_sitter_node)
+#define iQttname 1226
+DEFINE_LISP_SYMBOL (Qttname)
+#define iQtty 1227
+DEFINE_LISP_SYMBOL (Qtty)
+#define iQtty_color_alist 1228
+DEFINE_LISP_SYMBOL (Qtty_color_alist)
+#define iQtty_color_by_index 1229
+DEFINE_LISP_SYMBOL (Qtty_color_by_index)
+#define iQtty_color_desc 1230
+DEFINE_LISP_SYMBOL (Qtty_color_desc)
+#define iQtty_color_mode 1231
+DEFINE_LISP_SYMBOL (Qtty_color_mode)
+#define iQtty_color_standard_values 1232
+DEFINE_LISP_SYMBOL (Qtty_color_standard_values)
+#define iQtty_menu_exit 1233
+DEFINE_LISP_SYMBOL (Qtty_menu_exit)
+#define iQtty_menu_ignore 1234
+DEFINE_LISP_SYMBOL (Qtty_menu_ignore)
+#define iQtty_menu_mouse_movement 1235
+DEFINE_LISP_SYMBOL (Qtty_menu_mouse_movement)
+#define iQtty_menu_navigation_map 1236
+DEFINE_LISP_SYMBOL (Qtty_menu_navigation_map)
+#define iQtty_menu_next_item 1237
+DEFINE_LISP_SYMBOL (Qtty_menu_next_item)
+#define iQtty_menu_next_menu 1238
+DEFINE_LISP_SYMBOL (Qtty_menu_next_menu)
+#define iQtty_menu_prev_item 1239
+DEFINE_LISP_SYMBOL (Qtty_menu_prev_item)
+#define iQtty_menu_prev_menu 1240
+DEFINE_LISP_SYMBOL (Qtty_menu_prev_menu)
+#define iQtty_menu_select 1241
+DEFINE_LISP_SYMBOL (Qtty_menu_select)
+#define iQtty_mode_reset_strings 1242
+DEFINE_LISP_SYMBOL (Qtty_mode_reset_strings)
+#define iQtty_mode_set_strings 1243
+DEFINE_LISP_SYMBOL (Qtty_mode_set_strings)
+#define iQtty_type 1244
+DEFINE_LISP_SYMBOL (Qtty_type)
+#define iQtype_mismatch 1245
+DEFINE_LISP_SYMBOL (Qtype_mismatch)
+#define iQultra_bold 1246
+DEFINE_LISP_SYMBOL (Qultra_bold)
+#define iQultra_heavy 1247
+DEFINE_LISP_SYMBOL (Qultra_heavy)
+#define iQultra_light 1248
+DEFINE_LISP_SYMBOL (Qultra_light)
+#define iQundecided 1249
+DEFINE_LISP_SYMBOL (Qundecided)
+#define iQundecorated 1250
+DEFINE_LISP_SYMBOL (Qundecorated)
+#define iQundefined 1251
+DEFINE_LISP_SYMBOL (Qundefined)
+#define iQunderflow_error 1252
+DEFINE_LISP_SYMBOL (Qunderflow_error)
+#define iQunderline_minimum_offset 1253
+DEFINE_LISP_SYMBOL (Qunderline_minimum_offset)
+#define iQundo 1254
+DEFINE_LISP_SYMBOL (Qundo)
+#define iQundo__seen_list 1255
+DEFINE_LISP_SYMBOL (Qundo__seen_list)
+#define iQundo_only 1256
+DEFINE_LISP_SYMBOL (Qundo_only)
+#define iQunevalled 1257
+DEFINE_LISP_SYMBOL (Qunevalled)
+#define iQunhandled_file_name_directory 1258
+DEFINE_LISP_SYMBOL (Qunhandled_file_name_directory)
+#define iQunicode 1259
+DEFINE_LISP_SYMBOL (Qunicode)
+#define iQunicode_bmp 1260
+DEFINE_LISP_SYMBOL (Qunicode_bmp)
+#define iQunicode_string_p 1261
+DEFINE_LISP_SYMBOL (Qunicode_string_p)
+#define iQunix 1262
+DEFINE_LISP_SYMBOL (Qunix)
+#define iQunlet 1263
+DEFINE_LISP_SYMBOL (Qunlet)
+#define iQunlock_file 1264
+DEFINE_LISP_SYMBOL (Qunlock_file)
+#define iQunreachable 1265
+DEFINE_LISP_SYMBOL (Qunreachable)
+#define iQunspecified 1266
+DEFINE_LISP_SYMBOL (Qunspecified)
+#define iQunsplittable 1267
+DEFINE_LISP_SYMBOL (Qunsplittable)
+#define iQup 1268
+DEFINE_LISP_SYMBOL (Qup)
+#define iQuppercase 1269
+DEFINE_LISP_SYMBOL (Quppercase)
+#define iQus_ascii 1270
+DEFINE_LISP_SYMBOL (Qus_ascii)
+#define iQuse_frame_synchronization 1271
+DEFINE_LISP_SYMBOL (Quse_frame_synchronization)
+#define iQuser 1272
+DEFINE_LISP_SYMBOL (Quser)
+#define iQuser_error 1273
+DEFINE_LISP_SYMBOL (Quser_error)
+#define iQuser_position 1274
+DEFINE_LISP_SYMBOL (Quser_position)
+#define iQuser_ptr 1275
+DEFINE_LISP_SYMBOL (Quser_ptr)
+#define iQuser_ptrp 1276
+DEFINE_LISP_SYMBOL (Quser_ptrp)
+#define iQuser_search_failed 1277
+DEFINE_LISP_SYMBOL (Quser_search_failed)
+#define iQuser_size 1278
+DEFINE_LISP_SYMBOL (Quser_size)
+#define iQutf_16 1279
+DEFINE_LISP_SYMBOL (Qutf_16)
+#define iQutf_16le 1280
+DEFINE_LISP_SYMBOL (Qutf_16le)
+#define iQutf_8 1281
+DEFINE_LISP_SYMBOL (Qutf_8)
+#define iQutf_8_emacs 1282
+DEFINE_LISP_SYMBOL (Qutf_8_emacs)
+#define iQutf_8_string_p 1283
+DEFINE_LISP_SYMBOL (Qutf_8_string_p)
+#define iQutf_8_unix 1284
+DEFINE_LISP_SYMBOL (Qutf_8_unix)
+#define iQutime 1285
+DEFINE_LISP_SYMBOL (Qutime)
+#define iQvalue 1286
+DEFINE_LISP_SYMBOL (Qvalue)
+#define iQvaluelt 1287
+DEFINE_LISP_SYMBOL (Qvaluelt)
+#define iQvariable_documentation 1288
+DEFINE_LISP_SYMBOL (Qvariable_documentation)
+#define iQvector 1289
+DEFINE_LISP_SYMBOL (Qvector)
+#define iQvector_or_char_table_p 1290
+DEFINE_LISP_SYMBOL (Qvector_or_char_table_p)
+#define iQvector_slots 1291
+DEFINE_LISP_SYMBOL (Qvector_slots)
+#define iQvectorp 1292
+DEFINE_LISP_SYMBOL (Qvectorp)
+#define iQvectors 1293
+DEFINE_LISP_SYMBOL (Qvectors)
+#define iQverify_visited_file_modtime 1294
+DEFINE_LISP_SYMBOL (Qverify_visited_file_modtime)
+#define iQvertical_border 1295
+DEFINE_LISP_SYMBOL (Qvertical_border)
+#define iQvertical_line 1296
+DEFINE_LISP_SYMBOL (Qvertical_line)
+#define iQvertical_scroll_bar 1297
+DEFINE_LISP_SYMBOL (Qvertical_scroll_bar)
+#define iQvertical_scroll_bars 1298
+DEFINE_LISP_SYMBOL (Qvertical_scroll_bars)
+#define iQvisibility 1299
+DEFINE_LISP_SYMBOL (Qvisibility)
+#define iQvisible 1300
+DEFINE_LISP_SYMBOL (Qvisible)
+#define iQvisual 1301
+DEFINE_LISP_SYMBOL (Qvisual)
+#define iQvoid_function 1302
+DEFINE_LISP_SYMBOL (Qvoid_function)
+#define iQvoid_variable 1303
+DEFINE_LISP_SYMBOL (Qvoid_variable)
+#define iQvsize 1304
+DEFINE_LISP_SYMBOL (Qvsize)
+#define iQw32 1305
+DEFINE_LISP_SYMBOL (Qw32)
+#define iQwait_for_wm 1306
+DEFINE_LISP_SYMBOL (Qwait_for_wm)
+#define iQwall 1307
+DEFINE_LISP_SYMBOL (Qwall)
+#define iQwatchers 1308
+DEFINE_LISP_SYMBOL (Qwatchers)
+#define iQwave 1309
+DEFINE_LISP_SYMBOL (Qwave)
+#define iQweakness 1310
+DEFINE_LISP_SYMBOL (Qweakness)
+#define iQwhen 1311
+DEFINE_LISP_SYMBOL (Qwhen)
+#define iQwholenump 1312
+DEFINE_LISP_SYMBOL (Qwholenump)
+#define iQwidget_type 1313
+DEFINE_LISP_SYMBOL (Qwidget_type)
+#define iQwidth 1314
+DEFINE_LISP_SYMBOL (Qwidth)
+#define iQwidth_only 1315
+DEFINE_LISP_SYMBOL (Qwidth_only)
+#define iQwindow 1316
+DEFINE_LISP_SYMBOL (Qwindow)
+#define iQwindow__pixel_to_total 1317
+DEFINE_LISP_SYMBOL (Qwindow__pixel_to_total)
+#define iQwindow__resize_mini_frame 1318
+DEFINE_LISP_SYMBOL (Qwindow__resize_mini_frame)
+#define iQwindow__resize_root_window 1319
+DEFINE_LISP_SYMBOL (Qwindow__resize_root_window)
+#define iQwindow__resize_root_window_vertically 1320
+DEFINE_LISP_SYMBOL (Qwindow__resize_root_window_vertically)
+#define iQwindow_border 1321
+DEFINE_LISP_SYMBOL (Qwindow_border)
+#define iQwindow_border_mode 1322
+DEFINE_LISP_SYMBOL (Qwindow_border_mode)
+#define iQwindow_buffer_change_functions 1323
+DEFINE_LISP_SYMBOL (Qwindow_buffer_change_functions)
+#define iQwindow_configuration 1324
+DEFINE_LISP_SYMBOL (Qwindow_configuration)
+#define iQwindow_configuration_change_hook 1325
+DEFINE_LISP_SYMBOL (Qwindow_configuration_change_hook)
+#define iQwindow_configuration_p 1326
+DEFINE_LISP_SYMBOL (Qwindow_configuration_p)
+#define iQwindow_deletable_p 1327
+DEFINE_LISP_SYMBOL (Qwindow_deletable_p)
+#define iQwindow_divider 1328
+DEFINE_LISP_SYMBOL (Qwindow_divider)
+#define iQwindow_divider_first_pixel 1329
+DEFINE_LISP_SYMBOL (Qwindow_divider_first_pixel)
+#define iQwindow_divider_last_pixel 1330
+DEFINE_LISP_SYMBOL (Qwindow_divider_last_pixel)
+#define iQwindow_edges 1331
+DEFINE_LISP_SYMBOL (Qwindow_edges)
+#define iQwindow_id 1332
+DEFINE_LISP_SYMBOL (Qwindow_id)
+#define iQwindow_live_p 1333
+DEFINE_LISP_SYMBOL (Qwindow_live_p)
+#define iQwindow_point_insertion_type 1334
+DEFINE_LISP_SYMBOL (Qwindow_point_insertion_type)
+#define iQwindow_scroll_functions 1335
+DEFINE_LISP_SYMBOL (Qwindow_scroll_functions)
+#define iQwindow_selection_change_functions 1336
+DEFINE_LISP_SYMBOL (Qwindow_selection_change_functions)
+#define iQwindow_size 1337
+DEFINE_LISP_SYMBOL (Qwindow_size)
+#define iQwindow_size_change_functions 1338
+DEFINE_LISP_SYMBOL (Qwindow_size_change_functions)
+#define iQwindow_state_change_functions 1339
+DEFINE_LISP_SYMBOL (Qwindow_state_change_functions)
+#define iQwindow_state_change_hook 1340
+DEFINE_LISP_SYMBOL (Qwindow_state_change_hook)
+#define iQwindow_valid_p 1341
+DEFINE_LISP_SYMBOL (Qwindow_valid_p)
+#define iQwindowp 1342
+DEFINE_LISP_SYMBOL (Qwindowp)
+#define iQworkarea 1343
+DEFINE_LISP_SYMBOL (Qworkarea)
+#define iQwrap_prefix 1344
+DEFINE_LISP_SYMBOL (Qwrap_prefix)
+#define iQwrite_region 1345
+DEFINE_LISP_SYMBOL (Qwrite_region)
+#define iQwrite_region_annotate_functions 1346
+DEFINE_LISP_SYMBOL (Qwrite_region_annotate_functions)
+#define iQwrong_length_argument 1347
+DEFINE_LISP_SYMBOL (Qwrong_length_argument)
+#define iQwrong_number_of_arguments 1348
+DEFINE_LISP_SYMBOL (Qwrong_number_of_arguments)
+#define iQwrong_register_subr_call 1349
+DEFINE_LISP_SYMBOL (Qwrong_register_subr_call)
+#define iQwrong_type_argument 1350
+DEFINE_LISP_SYMBOL (Qwrong_type_argument)
+#define iQx 1351
+DEFINE_LISP_SYMBOL (Qx)
+#define iQx_create_frame_1 1352
+DEFINE_LISP_SYMBOL (Qx_create_frame_1)
+#define iQx_create_frame_2 1353
+DEFINE_LISP_SYMBOL (Qx_create_frame_2)
+#define iQx_frame_parameter 1354
+DEFINE_LISP_SYMBOL (Qx_frame_parameter)
+#define iQx_pre_popup_menu_hook 1355
+DEFINE_LISP_SYMBOL (Qx_pre_popup_menu_hook)
+#define iQx_resource_name 1356
+DEFINE_LISP_SYMBOL (Qx_resource_name)
+#define iQx_set_menu_bar_lines 1357
+DEFINE_LISP_SYMBOL (Qx_set_menu_bar_lines)
+#define iQx_set_window_size_1 1358
+DEFINE_LISP_SYMBOL (Qx_set_window_size_1)
+#define iQxg_frame_set_char_size 1359
+DEFINE_LISP_SYMBOL (Qxg_frame_set_char_size)
+#define iQxterm__set_selection 1360
+DEFINE_LISP_SYMBOL (Qxterm__set_selection)
+#define iQxterm_select_active_regions 1361
+DEFINE_LISP_SYMBOL (Qxterm_select_active_regions)
+#define iQxwidget 1362
+DEFINE_LISP_SYMBOL (Qxwidget)
+#define iQxwidget_display_event 1363
+DEFINE_LISP_SYMBOL (Qxwidget_display_event)
+#define iQxwidget_event 1364
+DEFINE_LISP_SYMBOL (Qxwidget_event)
+#define iQxwidget_view 1365
+DEFINE_LISP_SYMBOL (Qxwidget_view)
+#define iQyes_or_no_p_history 1366
+DEFINE_LISP_SYMBOL (Qyes_or_no_p_history)
+#define iQz_group 1367
+DEFINE_LISP_SYMBOL (Qz_group)
+#define iQzero_width 1368
+DEFINE_LISP_SYMBOL (Qzero_width)
+EXFUN (Fabort_minibuffers, 0);
+_Noreturn EXFUN (Fabort_recursive_edit, 0) ATTRIBUTE_COLD;
+EXFUN (Fabs, 1);
+EXFUN (Faccept_process_output, 4);
+EXFUN (Faccess_file, 2);
+EXFUN (Faccessible_keymaps, 2);
+EXFUN (Facos, 1);
+EXFUN (Factive_minibuffer_window, 0);
+EXFUN (Fadd1, 1);
+EXFUN (Fadd_face_text_property, 5);
+EXFUN (Fadd_name_to_file, 3);
+EXFUN (Fadd_text_properties, 4);
+EXFUN (Fadd_variable_watcher, 2);
+EXFUN (Fall_completions, 4);
+EXFUN (Fall_threads, 0);
+EXFUN (Fand, UNEVALLED);
+EXFUN (Fappend, MANY);
+EXFUN (Fapply, MANY);
+EXFUN (Faref, 2);
+EXFUN (Farrayp, 1);
+EXFUN (Faset, 3);
+EXFUN (Fash, 2);
+EXFUN (Fasin, 1);
+EXFUN (Fassoc, 3);
+EXFUN (Fassoc_string, 3);
+EXFUN (Fassq, 2);
+EXFUN (Fatan, 2);
+EXFUN (Fatom, 1) ATTRIBUTE_CONST;
+EXFUN (Fautoload, 5);
+EXFUN (Fautoload_do_load, 3);
+EXFUN (Fbacktrace__locals, 2);
+EXFUN (Fbacktrace_debug, 3);
+EXFUN (Fbacktrace_eval, 3);
+EXFUN (Fbacktrace_frame_internal, 3);
+EXFUN (Fbacktrace_frames_from_thread, 1);
+EXFUN (Fbackward_char, 1);
+EXFUN (Fbackward_prefix_chars, 0);
+EXFUN (Fbarf_if_buffer_read_only, 1);
+EXFUN (Fbase64_decode_region, 4);
+EXFUN (Fbase64_decode_string, 3);
+EXFUN (Fbase64_encode_region, 3);
+EXFUN (Fbase64_encode_string, 2);
+EXFUN (Fbase64url_encode_region, 3);
+EXFUN (Fbase64url_encode_string, 2);
+EXFUN (Fbeginning_of_line, 1);
+EXFUN (Fbidi_find_overridden_directionality, 4);
+EXFUN (Fbidi_resolved_levels, 1);
+EXFUN (Fbitmap_spec_p, 1);
+EXFUN (Fbobp, 0);
+EXFUN (Fbolp, 0);
+EXFUN (Fbool_vector, MANY);
+EXFUN (Fbool_vector_count_consecutive, 3);
+EXFUN (Fbool_vector_count_population, 1);
+EXFUN (Fbool_vector_exclusive_or, 3);
+EXFUN (Fbool_vector_intersection, 3);
+EXFUN (Fbool_vector_not, 2);
+EXFUN (Fbool_vector_p, 1);
+EXFUN (Fbool_vector_set_difference, 3);
+EXFUN (Fbool_vector_subsetp, 2);
+EXFUN (Fbool_vector_union, 3);
+EXFUN (Fbottom_divider_width, 1);
+EXFUN (Fboundp, 1);
+EXFUN (Fbuffer_base_buffer, 1);
+EXFUN (Fbuffer_chars_modified_tick, 1);
+EXFUN (Fbuffer_enable_undo, 1);
+EXFUN (Fbuffer_file_name, 1);
+EXFUN (Fbuffer_hash, 1);
+EXFUN (Fbuffer_last_name, 1);
+EXFUN (Fbuffer_line_statistics, 1);
+EXFUN (Fbuffer_list, 1);
+EXFUN (Fbuffer_live_p, 1);
+EXFUN (Fbuffer_local_value, 2);
+EXFUN (Fbuffer_local_variables, 1);
+EXFUN (Fbuffer_modified_p, 1);
+EXFUN (Fbuffer_modified_tick, 1);
+EXFUN (Fbuffer_monospace_p, 1);
+EXFUN (Fbuffer_name, 1);
+EXFUN (Fbuffer_size, 1);
+EXFUN (Fbuffer_string, 0);
+EXFUN (Fbuffer_substring, 2);
+EXFUN (Fbuffer_substring_no_properties, 2);
+EXFUN (Fbuffer_swap_text, 1);
+EXFUN (Fbuffer_text_pixel_size, 4);
+EXFUN (Fbufferp, 1);
+EXFUN (Fbury_buffer_internal, 1);
+EXFUN (Fbyte_code, 3);
+EXFUN (Fbyte_code_function_p, 1);
+EXFUN (Fbyte_to_position, 1);
+EXFUN (Fbyte_to_string, 1);
+EXFUN (Fbyteorder, 0) ATTRIBUTE_CONST;
+EXFUN (Fcall_interactively, 3);
+EXFUN (Fcall_last_kbd_macro, 2);
+EXFUN (Fcall_process, MANY);
+EXFUN (Fcall_process_region, MANY);
+EXFUN (Fcancel_kbd_macro_events, 0);
+EXFUN (Fcapitalize, 1);
+EXFUN (Fcapitalize_region, 3);
+EXFUN (Fcapitalize_word, 1);
+EXFUN (Fcar, 1);
+EXFUN (Fcar_less_than_car, 2);
+EXFUN (Fcar_safe, 1);
+EXFUN (Fcase_table_p, 1);
+EXFUN (Fcatch, UNEVALLED);
+EXFUN (Fcategory_docstring, 2);
+EXFUN (Fcategory_set_mnemonics, 1);
+EXFUN (Fcategory_table, 0);
+EXFUN (Fcategory_table_p, 1);
+EXFUN (Fccl_execute, 2);
+EXFUN (Fccl_execute_on_string, 5);
+EXFUN (Fccl_program_p, 1);
+EXFUN (Fcdr, 1);
+EXFUN (Fcdr_safe, 1);
+EXFUN (Fceiling, 2);
+EXFUN (Fchar_after, 1);
+EXFUN (Fchar_before, 1);
+EXFUN (Fchar_category_set, 1);
+EXFUN (Fchar_charset, 2);
+EXFUN (Fchar_equal, 2);
+EXFUN (Fchar_or_string_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fchar_resolve_modifiers, 1);
+EXFUN (Fchar_syntax, 1);
+EXFUN (Fchar_table_extra_slot, 2);
+EXFUN (Fchar_table_p, 1);
+EXFUN (Fchar_table_parent, 1);
+EXFUN (Fchar_table_range, 2);
+EXFUN (Fchar_table_subtype, 1);
+EXFUN (Fchar_to_string, 1);
+EXFUN (Fchar_width, 1);
+EXFUN (Fcharacterp, 2) ATTRIBUTE_CONST;
+EXFUN (Fcharset_after, 1);
+EXFUN (Fcharset_id_internal, 1);
+EXFUN (Fcharset_plist, 1);
+EXFUN (Fcharset_priority_list, 1);
+EXFUN (Fcharsetp, 1);
+EXFUN (Fcheck_coding_system, 1);
+EXFUN (Fcheck_coding_systems_region, 3);
+EXFUN (Fcircular_list_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fcl_type_of, 1);
+EXFUN (Fclear_buffer_auto_save_failure, 0);
+EXFUN (Fclear_charset_maps, 0);
+EXFUN (Fclear_composition_cache, 0);
+EXFUN (Fclear_face_cache, 1);
+EXFUN (Fclear_font_cache, 0);
+EXFUN (Fclear_string, 1);
+EXFUN (Fclear_this_command_keys, 1);
+EXFUN (Fclose_font, 2);
+EXFUN (Fclosurep, 1);
+EXFUN (Fclrhash, 1);
+EXFUN (Fcoding_system_aliases, 1);
+EXFUN (Fcoding_system_base, 1);
+EXFUN (Fcoding_system_eol_type, 1);
+EXFUN (Fcoding_system_p, 1);
+EXFUN (Fcoding_system_plist, 1);
+EXFUN (Fcoding_system_priority_list, 1);
+EXFUN (Fcoding_system_put, 3);
+EXFUN (Fcolor_distance, 4);
+EXFUN (Fcolor_gray_p, 2);
+EXFUN (Fcolor_supported_p, 3);
+EXFUN (Fcolor_values_from_color_spec, 1);
+EXFUN (Fcommand_error_default_function, 3);
+EXFUN (Fcommand_modes, 1);
+EXFUN (Fcommand_remapping, 3);
+EXFUN (Fcommandp, 2);
+EXFUN (Fcomp__compile_ctxt_to_file0, 1);
+EXFUN (Fcomp__init_ctxt, 0);
+EXFUN (Fcomp__install_trampoline, 2);
+EXFUN (Fcomp__register_lambda, 7);
+EXFUN (Fcomp__register_subr, 7);
+EXFUN (Fcomp__release_ctxt, 0);
+EXFUN (Fcomp__subr_signature, 1);
+EXFUN (Fcomp_libgccjit_version, 0);
+EXFUN (Fcomp_native_compiler_options_effective_p, 0);
+EXFUN (Fcomp_native_driver_options_effective_p, 0);
+EXFUN (Fcompare_buffer_substrings, 6);
+EXFUN (Fcompare_strings, 7);
+EXFUN (Fcompleting_read, 8);
+EXFUN (Fcompose_region_internal, 4);
+EXFUN (Fcompose_string_internal, 5);
+EXFUN (Fcomposition_get_gstring, 4);
+EXFUN (Fcomposition_sort_rules, 1);
+EXFUN (Fcompute_motion, 7);
+EXFUN (Fconcat, MANY);
+EXFUN (Fcond, UNEVALLED);
+EXFUN (Fcondition_case, UNEVALLED);
+EXFUN (Fcondition_mutex, 1);
+EXFUN (Fcondition_name, 1);
+EXFUN (Fcondition_notify, 2);
+EXFUN (Fcondition_variable_p, 1);
+EXFUN (Fcondition_wait, 1);
+EXFUN (Fcons, 2);
+EXFUN (Fconsp, 1) ATTRIBUTE_CONST;
+EXFUN (Fconstrain_to_field, 5);
+EXFUN (Fcontinue_process, 2);
+EXFUN (Fcontrolling_tty_p, 1);
+EXFUN (Fcoordinates_in_window_p, 2);
+EXFUN (Fcopy_alist, 1);
+EXFUN (Fcopy_category_table, 1);
+EXFUN (Fcopy_file, 6);
+EXFUN (Fcopy_hash_table, 1);
+EXFUN (Fcopy_keymap, 1);
+EXFUN (Fcopy_marker, 2);
+EXFUN (Fcopy_sequence, 1);
+EXFUN (Fcopy_syntax_table, 1);
+EXFUN (Fcopysign, 2);
+EXFUN (Fcos, 1);
+EXFUN (Fcurrent_active_maps, 2);
+EXFUN (Fcurrent_bidi_paragraph_direction, 1);
+EXFUN (Fcurrent_buffer, 0);
+EXFUN (Fcurrent_case_table, 0);
+EXFUN (Fcurrent_column, 0);
+EXFUN (Fcurrent_cpu_time, 0);
+EXFUN (Fcurrent_global_map, 0);
+EXFUN (Fcurrent_idle_time, 0);
+EXFUN (Fcurrent_indentation, 1);
+EXFUN (Fcurrent_input_mode, 0);
+EXFUN (Fcurrent_local_map, 0);
+EXFUN (Fcurrent_message, 0);
+EXFUN (Fcurrent_minor_mode_maps, 0);
+EXFUN (Fcurrent_thread, 0);
+EXFUN (Fcurrent_time, 0);
+EXFUN (Fcurrent_time_string, 2);
+EXFUN (Fcurrent_time_zone, 2);
+EXFUN (Fcurrent_window_configuration, 1);
+EXFUN (Fdaemon_initialized, 0);
+EXFUN (Fdaemonp, 0);
+EXFUN (Fdebug_timer_check, 0);
+EXFUN (Fdeclare_equiv_charset, 4);
+EXFUN (Fdecode_big5_char, 1);
+EXFUN (Fdecode_char, 2);
+EXFUN (Fdecode_coding_region, 4);
+EXFUN (Fdecode_coding_string, 4);
+EXFUN (Fdecode_sjis_char, 1);
+EXFUN (Fdecode_time, 3);
+EXFUN (Fdefalias, 3);
+EXFUN (Fdefault_boundp, 1);
+EXFUN (Fdefault_file_modes, 0);
+EXFUN (Fdefault_toplevel_value, 1);
+EXFUN (Fdefault_value, 1);
+EXFUN (Fdefconst, UNEVALLED);
+EXFUN (Fdefconst_1, 3);
+EXFUN (Fdefine_category, 3);
+EXFUN (Fdefine_charset_alias, 2);
+EXFUN (Fdefine_charset_internal, MANY);
+EXFUN (Fdefine_coding_system_alias, 2);
+EXFUN (Fdefine_coding_system_internal, MANY);
+EXFUN (Fdefine_hash_table_test, 3);
+EXFUN (Fdefine_key, 4);
+EXFUN (Fdefvar, UNEVALLED);
+EXFUN (Fdefvar_1, 3);
+EXFUN (Fdefvaralias, 3);
+EXFUN (Fdelete, 2);
+EXFUN (Fdelete_all_overlays, 1);
+EXFUN (Fdelete_and_extract_region, 2);
+EXFUN (Fdelete_char, 2);
+EXFUN (Fdelete_directory_internal, 1);
+EXFUN (Fdelete_field, 1);
+EXFUN (Fdelete_file_internal, 1);
+EXFUN (Fdelete_frame, 2);
+EXFUN (Fdelete_other_windows_internal, 2);
+EXFUN (Fdelete_overlay, 1);
+EXFUN (Fdelete_overlays_in, 5);
+EXFUN (Fdelete_process, 1);
+EXFUN (Fdelete_region, 2);
+EXFUN (Fdelete_terminal, 2);
+EXFUN (Fdelete_window_internal, 1);
+EXFUN (Fdelq, 2);
+EXFUN (Fdescribe_buffer_bindings, 3);
+EXFUN (Fdescribe_vector, 2);
+EXFUN (Fdetect_coding_region, 3);
+EXFUN (Fdetect_coding_string, 2);
+EXFUN (Fding, 1);
+EXFUN (Fdirectory_file_name, 1);
+EXFUN (Fdirectory_files, 5);
+EXFUN (Fdirectory_files_and_attributes, 6);
+EXFUN (Fdirectory_name_p, 1);
+EXFUN (Fdiscard_input, 0);
+EXFUN (Fdisplay__line_is_continued_p, 0);
+EXFUN (Fdisplay__update_for_mouse_movement, 2);
+EXFUN (Fdisplay_supports_face_attributes_p, 2);
+EXFUN (Fdo_auto_save, 2);
+EXFUN (Fdocumentation, 2);
+EXFUN (Fdocumentation_property, 3);
+EXFUN (Fdocumentation_stringp, 1);
+EXFUN (Fdowncase, 1);
+EXFUN (Fdowncase_region, 3);
+EXFUN (Fdowncase_word, 1);
+EXFUN (Fdraw_string, 2);
+EXFUN (Fdump_colors, 0);
+EXFUN (Fdump_emacs_portable, 1);
+EXFUN (Fdump_emacs_portable__sort_predicate, 2);
+EXFUN (Fdump_emacs_portable__sort_predicate_copied, 2);
+EXFUN (Fdump_face, 1);
+EXFUN (Fdump_redisplay_history, 0);
+EXFUN (Felt, 2);
+EXFUN (Femacs_pid, 0);
+EXFUN (Fencode_big5_char, 1);
+EXFUN (Fencode_char, 2);
+EXFUN (Fencode_coding_region, 4);
+EXFUN (Fencode_coding_string, 4);
+EXFUN (Fencode_sjis_char, 1);
+EXFUN (Fencode_time, MANY);
+EXFUN (Fend_kbd_macro, 2);
+EXFUN (Fend_of_line, 1);
+EXFUN (Feobp, 0);
+EXFUN (Feolp, 0);
+EXFUN (Feq, 2) ATTRIBUTE_CONST;
+EXFUN (Feql, 2);
+EXFUN (Feqlsign, MANY);
+EXFUN (Fequal, 2);
+EXFUN (Fequal_including_properties, 2);
+EXFUN (Ferase_buffer, 0);
+EXFUN (Ferror_message_string, 1);
+EXFUN (Feval, 2);
+EXFUN (Feval_buffer, 5);
+EXFUN (Feval_region, 4);
+EXFUN (Fevent_convert_list, 1);
+EXFUN (Fevent_symbol_parse_modifiers, 1);
+EXFUN (Fexecute_kbd_macro, 3);
+_Noreturn EXFUN (Fexit_recursive_edit, 0) ATTRIBUTE_COLD;
+EXFUN (Fexp, 1);
+EXFUN (Fexpand_file_name, 2);
+EXFUN (Fexpt, 2);
+EXFUN (Fexternal_debugging_output, 1);
+EXFUN (Fface_attribute_relative_p, 2) ATTRIBUTE_CONST;
+EXFUN (Fface_attributes_as_vector, 1);
+EXFUN (Fface_cache_statistics, 2);
+EXFUN (Fface_font, 3);
+EXFUN (Ffboundp, 1);
+EXFUN (Ffceiling, 1);
+EXFUN (Ffeaturep, 2);
+EXFUN (Fffloor, 1);
+EXFUN (Ffield_beginning, 3);
+EXFUN (Ffield_end, 3);
+EXFUN (Ffield_string, 1);
+EXFUN (Ffield_string_no_properties, 1);
+EXFUN (Ffile_accessible_directory_p, 1);
+EXFUN (Ffile_acl, 1);
+EXFUN (Ffile_attributes, 2);
+EXFUN (Ffile_attributes_lessp, 2);
+EXFUN (Ffile_directory_p, 1);
+EXFUN (Ffile_executable_p, 1);
+EXFUN (Ffile_exists_p, 1);
+EXFUN (Ffile_locked_p, 1);
+EXFUN (Ffile_modes, 2);
+EXFUN (Ffile_name_absolute_p, 1);
+EXFUN (Ffile_name_all_completions, 2);
+EXFUN (Ffile_name_as_directory, 1);
+EXFUN (Ffile_name_case_insensitive_p, 1);
+EXFUN (Ffile_name_completion, 3);
+EXFUN (Ffile_name_concat, MANY);
+EXFUN (Ffile_name_directory, 1);
+EXFUN (Ffile_name_nondirectory, 1);
+EXFUN (Ffile_newer_than_file_p, 2);
+EXFUN (Ffile_readable_p, 1);
+EXFUN (Ffile_regular_p, 1);
+EXFUN (Ffile_selinux_context, 1);
+EXFUN (Ffile_symlink_p, 1);
+EXFUN (Ffile_system_info, 1);
+EXFUN (Ffile_writable_p, 1);
+EXFUN (Ffillarray, 2);
+EXFUN (Ffind_buffer, 2);
+EXFUN (Ffind_charset_region, 3);
+EXFUN (Ffind_charset_string, 2);
+EXFUN (Ffind_coding_systems_region_internal, 3);
+EXFUN (Ffind_composition_internal, 4);
+EXFUN (Ffind_file_long_lines_p, 1);
+EXFUN (Ffind_file_name_handler, 2);
+EXFUN (Ffind_font, 2);
+EXFUN (Ffind_operation_coding_system, MANY);
+EXFUN (Ffloat, 1);
+EXFUN (Ffloat_time, 1);
+EXFUN (Ffloatp, 1) ATTRIBUTE_CONST;
+EXFUN (Ffloor, 2);
+EXFUN (Fflush_standard_output, 0);
+EXFUN (Ffmakunbound, 1);
+EXFUN (Ffollowing_char, 0);
+EXFUN (Ffont_at, 3);
+EXFUN (Ffont_drive_otf, 6);
+EXFUN (Ffont_face_attributes, 2);
+EXFUN (Ffont_family_list, 1);
+EXFUN (Ffont_get, 2);
+EXFUN (Ffont_get_glyphs, 4);
+EXFUN (Ffont_has_char_p, 3);
+EXFUN (Ffont_info, 2);
+EXFUN (Ffont_match_p, 2);
+EXFUN (Ffont_otf_alternates, 3);
+EXFUN (Ffont_put, 3);
+EXFUN (Ffont_shape_gstring, 2);
+EXFUN (Ffont_spec, MANY);
+EXFUN (Ffont_variation_glyphs, 2);
+EXFUN (Ffont_xlfd_name, 3);
+EXFUN (Ffontp, 2);
+EXFUN (Fforce_mode_line_update, 1);
+EXFUN (Fforce_window_update, 1);
+EXFUN (Fformat, MANY);
+EXFUN (Fformat_message, MANY);
+EXFUN (Fformat_mode_line, 4);
+EXFUN (Fformat_network_address, 2);
+EXFUN (Fformat_time_string, 3);
+EXFUN (Fforward_char, 1);
+EXFUN (Fforward_comment, 1);
+EXFUN (Fforward_line, 1);
+EXFUN (Fforward_word, 1);
+EXFUN (Fframe__set_was_invisible, 2);
+EXFUN (Fframe_after_make_frame, 2);
+EXFUN (Fframe_ancestor_p, 2);
+EXFUN (Fframe_char_height, 1);
+EXFUN (Fframe_char_width, 1);
+EXFUN (Fframe_child_frame_border_width, 1);
+EXFUN (Fframe_face_hash_table, 1);
+EXFUN (Fframe_first_window, 1);
+EXFUN (Fframe_focus, 1);
+EXFUN (Fframe_font_cache, 1);
+EXFUN (Fframe_internal_border_width, 1);
+EXFUN (Fframe_list, 0);
+EXFUN (Fframe_live_p, 1);
+EXFUN (Fframe_native_height, 1);
+EXFUN (Fframe_native_width, 1);
+EXFUN (Fframe_old_selected_window, 1);
+EXFUN (Fframe_or_buffer_changed_p, 1);
+EXFUN (Fframe_parameter, 2);
+EXFUN (Fframe_parameters, 1);
+EXFUN (Fframe_parent, 1);
+EXFUN (Fframe_pointer_visible_p, 1);
+EXFUN (Fframe_position, 1);
+EXFUN (Fframe_root_window, 1);
+EXFUN (Fframe_scale_factor, 1);
+EXFUN (Fframe_selected_window, 1);
+EXFUN (Fframe_terminal, 1);
+EXFUN (Fframe_text_cols, 1);
+EXFUN (Fframe_text_height, 1);
+EXFUN (Fframe_text_lines, 1);
+EXFUN (Fframe_text_width, 1);
+EXFUN (Fframe_total_cols, 1);
+EXFUN (Fframe_total_lines, 1);
+EXFUN (Fframe_visible_p, 1);
+EXFUN (Fframe_window_state_change, 1);
+EXFUN (Fframe_windows_min_size, 4) ATTRIBUTE_CONST;
+EXFUN (Fframep, 1);
+EXFUN (Ffrexp, 1);
+EXFUN (Ffringe_width, 1);
+EXFUN (Ffround, 1);
+EXFUN (Ffset, 2);
+EXFUN (Ffset_local, 2);
+EXFUN (Fftruncate, 1);
+EXFUN (Ffunc_arity, 1);
+EXFUN (Ffuncall, MANY);
+EXFUN (Ffuncall_interactively, MANY);
+EXFUN (Ffuncall_with_delayed_message, 3);
+EXFUN (Ffunction, UNEVALLED);
+EXFUN (Ffunction_equal, 2);
+EXFUN (Ffunctionp, 1);
+EXFUN (Fgap_position, 0);
+EXFUN (Fgap_size, 0);
+EXFUN (Fgarbage_collect, 0);
+EXFUN (Fgarbage_collect_maybe, 1);
+EXFUN (Fgc_counts, 0);
+EXFUN (Fgenerate_new_buffer_name, 2);
+EXFUN (Fgeq, MANY);
+EXFUN (Fget, 2);
+EXFUN (Fget_buffer, 1);
+EXFUN (Fget_buffer_create, 2);
+EXFUN (Fget_buffer_process, 1);
+EXFUN (Fget_buffer_window, 2);
+EXFUN (Fget_byte, 2);
+EXFUN (Fget_char_property, 3);
+EXFUN (Fget_char_property_and_overlay, 3);
+EXFUN (Fget_display_property, 4);
+EXFUN (Fget_file_buffer, 1);
+EXFUN (Fget_internal_run_time, 0);
+EXFUN (Fget_load_suffixes, 0);
+EXFUN (Fget_pos_property, 3);
+EXFUN (Fget_process, 1);
+EXFUN (Fget_text_property, 3);
+EXFUN (Fget_truename_buffer, 1);
+EXFUN (Fget_unicode_property_internal, 2);
+EXFUN (Fget_unused_category, 1);
+EXFUN (Fget_unused_iso_final_char, 2);
+EXFUN (Fget_variable_watchers, 1);
+EXFUN (Fgetenv_internal, 2);
+EXFUN (Fgethash, 3);
+EXFUN (Fgnutls_asynchronous_parameters, 2);
+EXFUN (Fgnutls_available_p, 0);
+EXFUN (Fgnutls_boot, 4);
+EXFUN (Fgnutls_bye, 2);
+EXFUN (Fgnutls_ciphers, 0);
+EXFUN (Fgnutls_deinit, 1);
+EXFUN (Fgnutls_digests, 0);
+EXFUN (Fgnutls_error_fatalp, 1);
+EXFUN (Fgnutls_error_string, 1);
+EXFUN (Fgnutls_errorp, 1) ATTRIBUTE_CONST;
+EXFUN (Fgnutls_format_certificate, 1);
+EXFUN (Fgnutls_get_initstage, 1);
+EXFUN (Fgnutls_hash_digest, 2);
+EXFUN (Fgnutls_hash_mac, 3);
+EXFUN (Fgnutls_macs, 0);
+EXFUN (Fgnutls_peer_status, 1);
+EXFUN (Fgnutls_peer_status_warning_describe, 1);
+EXFUN (Fgnutls_symmetric_decrypt, 5);
+EXFUN (Fgnutls_symmetric_encrypt, 5);
+EXFUN (Fgoto_char, 1);
+EXFUN (Fgpm_mouse_start, 0);
+EXFUN (Fgpm_mouse_stop, 0);
+EXFUN (Fgroup_gid, 0);
+EXFUN (Fgroup_name, 1);
+EXFUN (Fgroup_real_gid, 0);
+EXFUN (Fgtr, MANY);
+EXFUN (Fhandle_switch_frame, 1);
+EXFUN (Fhandler__bind, MANY);
+EXFUN (Fhash_table_count, 1);
+EXFUN (Fhash_table_p, 1);
+EXFUN (Fhash_table_rehash_size, 1);
+EXFUN (Fhash_table_rehash_threshold, 1);
+EXFUN (Fhash_table_size, 1);
+EXFUN (Fhash_table_test, 1);
+EXFUN (Fhash_table_weakness, 1);
+EXFUN (Fhelp__describe_vector, 7);
+EXFUN (Ficonify_frame, 1);
+EXFUN (Fidentity, 1) ATTRIBUTE_CONST;
+EXFUN (Fif, UNEVALLED);
+EXFUN (Findent_to, 2);
+EXFUN (Findirect_function, 2);
+EXFUN (Findirect_variable, 1);
+EXFUN (Finnermost_minibuffer_p, 1);
+EXFUN (Finput_pending_p, 1);
+EXFUN (Finsert, MANY);
+EXFUN (Finsert_and_inherit, MANY);
+EXFUN (Finsert_and_inherit_before_markers, MANY);
+EXFUN (Finsert_before_markers, MANY);
+EXFUN (Finsert_buffer_substring, 3);
+EXFUN (Finsert_byte, 3);
+EXFUN (Finsert_char, 3);
+EXFUN (Finsert_file_contents, 5);
+EXFUN (Finteger_or_marker_p, 1);
+EXFUN (Fintegerp, 1) ATTRIBUTE_CONST;
+EXFUN (Finteractive, UNEVALLED) ATTRIBUTE_CONST;
+EXFUN (Finteractive_form, 1);
+EXFUN (Fintern, 2);
+EXFUN (Fintern_soft, 2);
+EXFUN (Finternal__define_uninitialized_variable, 2);
+EXFUN (Finternal__hash_table_buckets, 1);
+EXFUN (Finternal__hash_table_histogram, 1);
+EXFUN (Finternal__hash_table_index_size, 1);
+EXFUN (Finternal__obarray_buckets, 1);
+EXFUN (Finternal__set_buffer_modified_tick, 2);
+EXFUN (Finternal__syntax_invalidate_checkpoints, 1);
+EXFUN (Finternal_char_font, 2);
+EXFUN (Finternal_complete_buffer, 3);
+EXFUN (Finternal_copy_lisp_face, 4);
+EXFUN (Finternal_decode_string_utf_8, 7);
+EXFUN (Finternal_default_interrupt_process, 2);
+EXFUN (Finternal_default_process_filter, 2);
+EXFUN (Finternal_default_process_sentinel, 2);
+EXFUN (Finternal_default_signal_process, 3);
+EXFUN (Finternal_describe_syntax_value, 1);
+EXFUN (Finternal_encode_string_utf_8, 7);
+EXFUN (Finternal_face_x_get_resource, 3);
+EXFUN (Finternal_get_lisp_face_attribute, 3);
+EXFUN (Finternal_handle_focus_in, 1);
+EXFUN (Finternal_lisp_face_attribute_values, 1);
+EXFUN (Finternal_lisp_face_empty_p, 2);
+EXFUN (Finternal_lisp_face_equal_p, 3);
+EXFUN (Finternal_lisp_face_p, 2);
+EXFUN (Finternal_make_lisp_face, 2);
+EXFUN (Finternal_merge_in_global_face, 2);
+EXFUN (Finternal_set_alternative_font_family_alist, 1);
+EXFUN (Finternal_set_alternative_font_registry_alist, 1);
+EXFUN (Finternal_set_font_selection_order, 1);
+EXFUN (Finternal_set_lisp_face_attribute, 4);
+EXFUN (Finternal_set_lisp_face_attribute_from_resource, 4);
+EXFUN (Finternal_show_cursor, 2);
+EXFUN (Finternal_show_cursor_p, 1);
+EXFUN (Finternal_stack_stats, 0);
+EXFUN (Finternal_track_mouse, 1);
+EXFUN (Finterpreted_function_p, 1);
+EXFUN (Finterrupt_process, 2);
+EXFUN (Finvisible_p, 1);
+EXFUN (Finvocation_directory, 0);
+EXFUN (Finvocation_name, 0);
+EXFUN (Fisnan, 1);
+EXFUN (Fiso_charset, 3);
+EXFUN (Fjson_insert, MANY);
+EXFUN (Fjson_make_stream, MANY);
+EXFUN (Fjson_parse_buffer, MANY);
+EXFUN (Fjson_parse_string, MANY);
+EXFUN (Fjson_serialize, MANY);
+EXFUN (Fjson_stream_feed, 2);
+EXFUN (Fjson_stream_p, 1);
+EXFUN (Fkey_binding, 4);
+EXFUN (Fkey_description, 2);
+EXFUN (Fkeyboard_coding_system, 1);
+EXFUN (Fkeymap__get_keyelt, 2);
+EXFUN (Fkeymap_parent, 1);
+EXFUN (Fkeymap_prompt, 1);
+EXFUN (Fkeymapp, 1);
+EXFUN (Fkeywordp, 1);
+EXFUN (Fkill_all_local_variables, 1);
+EXFUN (Fkill_buffer, 1);
+_Noreturn EXFUN (Fkill_emacs, 2) ATTRIBUTE_COLD;
+EXFUN (Fkill_local_variable, 1);
+EXFUN (Fkill_process, 2);
+EXFUN (Flast_nonminibuf_frame, 0);
+EXFUN (Flcms2_available_p, 0);
+EXFUN (Flcms_cam02_ucs, 4);
+EXFUN (Flcms_cie_de2000, 5);
+EXFUN (Flcms_jab_to_jch, 3);
+EXFUN (Flcms_jch_to_jab, 3);
+EXFUN (Flcms_jch_to_xyz, 3);
+EXFUN (Flcms_temp_to_white_point, 1);
+EXFUN (Flcms_xyz_to_jch, 3);
+EXFUN (Fldexp, 2);
+EXFUN (Flength, 1);
+EXFUN (Flength_equal, 2);
+EXFUN (Flength_greater, 2);
+EXFUN (Flength_less, 2);
+EXFUN (Fleq, MANY);
+EXFUN (Flet, UNEVALLED);
+EXFUN (FletX, UNEVALLED);
+EXFUN (Flibxml_available_p, 0);
+EXFUN (Flibxml_parse_html_region, 4);
+EXFUN (Flibxml_parse_xml_region, 4);
+EXFUN (Fline_beginning_position, 1);
+EXFUN (Fline_end_position, 1);
+EXFUN (Fline_number_at_pos, 2);
+EXFUN (Fline_number_display_width, 1);
+EXFUN (Fline_pixel_height, 0);
+EXFUN (Flist, MANY);
+EXFUN (Flist_fonts, 4);
+EXFUN (Flist_system_processes, 0);
+EXFUN (Flistp, 1) ATTRIBUTE_CONST;
+EXFUN (Fload, 5);
+EXFUN (Fload_average, 1);
+EXFUN (Flocal_variable_if_set_p, 2);
+EXFUN (Flocal_variable_p, 2);
+EXFUN (Flocale_info, 1);
+EXFUN (Flocate_file_internal, 4);
+EXFUN (Flock_buffer, 1);
+EXFUN (Flock_file, 1);
+EXFUN (Flog, 2);
+EXFUN (Flogand, MANY);
+EXFUN (Flogb, 1);
+EXFUN (Flogcount, 1);
+EXFUN (Flogior, MANY);
+EXFUN (Flognot, 1);
+EXFUN (Flogxor, MANY);
+EXFUN (Flooking_at, 2);
+EXFUN (Flookup_image_map, 3);
+EXFUN (Flookup_key, 3);
+EXFUN (Flossage_size, 1);
+EXFUN (Flower_frame, 1);
+EXFUN (Flread__substitute_object_in_subtree, 3);
+EXFUN (Flss, MANY);
+EXFUN (Fmacroexpand, 2);
+EXFUN (Fmake_bool_vector, 2);
+EXFUN (Fmake_byte_code, MANY);
+EXFUN (Fmake_category_set, 1);
+EXFUN (Fmake_category_table, 0);
+EXFUN (Fmake_char, 5);
+EXFUN (Fmake_char_table, 2);
+EXFUN (Fmake_closure, MANY);
+EXFUN (Fmake_condition_variable, 2);
+EXFUN (Fmake_directory_internal, 1);
+EXFUN (Fmake_finalizer, 1);
+EXFUN (Fmake_frame_invisible, 2);
+EXFUN (Fmake_frame_visible, 1);
+EXFUN (Fmake_hash_table, MANY);
+EXFUN (Fmake_indirect_buffer, 4);
+EXFUN (Fmake_interpreted_closure, 5);
+EXFUN (Fmake_keymap, 1);
+EXFUN (Fmake_list, 2);
+EXFUN (Fmake_local_variable, 1);
+EXFUN (Fmake_marker, 0);
+EXFUN (Fmake_mode__overlay, 3);
+EXFUN (Fmake_mode_overlay__enter_buffer, 2);
+EXFUN (Fmake_mode_overlay__exit_buffer, 2);
+EXFUN (Fmake_mutex, 1);
+EXFUN (Fmake_network_process, MANY);
+EXFUN (Fmake_overlay, 7);
+EXFUN (Fmake_overlays, 4);
+EXFUN (Fmake_pipe_process, MANY);
+EXFUN (Fmake_process, MANY);
+EXFUN (Fmake_record, 3);
+EXFUN (Fmake_serial_process, MANY);
+EXFUN (Fmake_sparse_keymap, 1);
+EXFUN (Fmake_string, 3);
+EXFUN (Fmake_symbol, 1);
+EXFUN (Fmake_symbolic_link, 3);
+EXFUN (Fmake_temp_file_internal, 4);
+EXFUN (Fmake_temp_name, 1);
+EXFUN (Fmake_terminal_frame, 1);
+EXFUN (Fmake_thread, 3);
+EXFUN (Fmake_var_non_special, 1);
+EXFUN (Fmake_variable_buffer_local, 1);
+EXFUN (Fmake_vector, 2);
+EXFUN (Fmakunbound, 1);
+EXFUN (Fmalloc_info, 0);
+EXFUN (Fmalloc_trim, 1);
+EXFUN (Fmap_char_table, 2);
+EXFUN (Fmap_charset_chars, 5);
+EXFUN (Fmap_keymap, 3);
+EXFUN (Fmap_keymap_internal, 2);
+EXFUN (Fmapatoms, 2);
+EXFUN (Fmapbacktrace, 2);
+EXFUN (Fmapc, 2);
+EXFUN (Fmapcan, 2);
+EXFUN (Fmapcar, 2);
+EXFUN (Fmapconcat, 3);
+EXFUN (Fmaphash, 2);
+EXFUN (Fmark_marker, 0);
+EXFUN (Fmarker_buffer, 1);
+EXFUN (Fmarker_insertion_type, 1);
+EXFUN (Fmarker_last_position, 1);
+EXFUN (Fmarker_position, 1);
+EXFUN (Fmarkerp, 1);
+EXFUN (Fmatch_beginning, 1);
+EXFUN (Fmatch_data, 3);
+EXFUN (Fmatch_data__translate, 1);
+EXFUN (Fmatch_end, 1);
+EXFUN (Fmatching_paren, 1);
+EXFUN (Fmax, MANY);
+EXFUN (Fmax_char, 1) ATTRIBUTE_CONST;
+EXFUN (Fmd5, 5);
+EXFUN (Fmember, 2);
+EXFUN (Fmemory_full, 0);
+EXFUN (Fmemory_info, 0);
+EXFUN (Fmemory_use_counts, 0);
+EXFUN (Fmemq, 2);
+EXFUN (Fmemql, 2);
+EXFUN (Fmenu_bar_menu_at_x_y, 3);
+EXFUN (Fmerge_face_attribute, 3);
+EXFUN (Fmessage, MANY);
+EXFUN (Fmessage_box, MANY);
+EXFUN (Fmessage_or_box, MANY);
+EXFUN (Fmin, MANY);
+EXFUN (Fminibuffer_contents, 0);
+EXFUN (Fminibuffer_contents_no_properties, 0);
+EXFUN (Fminibuffer_depth, 0);
+EXFUN (Fminibuffer_innermost_command_loop_p, 1);
+EXFUN (Fminibuffer_prompt, 0);
+EXFUN (Fminibuffer_prompt_end, 0);
+EXFUN (Fminibuffer_selected_window, 0);
+EXFUN (Fminibuffer_window, 1);
+EXFUN (Fminibufferp, 2);
+EXFUN (Fminor_mode_key_binding, 2);
+EXFUN (Fminus, MANY);
+EXFUN (Fmod, 2);
+EXFUN (Fmode_overlay_indirect_p, 1);
+EXFUN (Fmodify_category_entry, 4);
+EXFUN (Fmodify_frame_parameters, 2);
+EXFUN (Fmodify_syntax_entry, 3);
+EXFUN (Fmodule_function_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fmodule_load, 1);
+EXFUN (Fmouse_pixel_position, 0);
+EXFUN (Fmouse_position, 0);
+EXFUN (Fmove_overlay, 4);
+EXFUN (Fmove_point_visually, 1);
+EXFUN (Fmove_to_column, 2);
+EXFUN (Fmove_to_window_line, 1);
+EXFUN (Fmultibyte_char_to_unibyte, 1);
+EXFUN (Fmultibyte_string_p, 1);
+EXFUN (Fmutex_lock, 1);
+EXFUN (Fmutex_name, 1);
+EXFUN (Fmutex_unlock, 1);
+EXFUN (Fmutexp, 1);
+EXFUN (Fnarrow_to_region, 2);
+EXFUN (Fnative__load, 1);
+EXFUN (Fnative_comp_available_p, 0);
+EXFUN (Fnative_comp_function_p, 1);
+EXFUN (Fnative_comp_unit_file, 1);
+EXFUN (Fnative_comp_unit_set_file, 2);
+EXFUN (Fnatnump, 1) ATTRIBUTE_CONST;
+EXFUN (Fnconc, MANY);
+EXFUN (Fneq, 2);
+EXFUN (Fnetwork_interface_info, 1);
+EXFUN (Fnetwork_interface_list, 2);
+EXFUN (Fnetwork_lookup_address_info, 3);
+EXFUN (Fnewline_cache_check, 1);
+EXFUN (Fnext_char_property_change, 2);
+EXFUN (Fnext_frame, 2);
+EXFUN (Fnext_overlay_change, 1);
+EXFUN (Fnext_property_change, 3);
+EXFUN (Fnext_read_file_uses_dialog_p, 0);
+EXFUN (Fnext_single_char_property_change, 4);
+EXFUN (Fnext_single_property_change, 4);
+EXFUN (Fnext_window, 3);
+EXFUN (Fngettext, 3);
+EXFUN (Fnlistp, 1) ATTRIBUTE_CONST;
+EXFUN (Fnreverse, 1);
+EXFUN (Fntake, 2);
+EXFUN (Fnth, 2);
+EXFUN (Fnthcdr, 2);
+EXFUN (Fnull, 1) ATTRIBUTE_CONST;
+EXFUN (Fnum_processors, 1);
+EXFUN (Fnumber_or_marker_p, 1);
+EXFUN (Fnumber_to_string, 1);
+EXFUN (Fnumberp, 1) ATTRIBUTE_CONST;
+EXFUN (Fobarray_clear, 1);
+EXFUN (Fobarray_make, 1);
+EXFUN (Fobarrayp, 1);
+EXFUN (Fobject_intervals, 1);
+EXFUN (Fold_selected_frame, 0);
+EXFUN (Fold_selected_window, 0);
+EXFUN (Fopen_dribble_file, 1);
+EXFUN (Fopen_font, 3);
+EXFUN (Fopen_termscript, 1);
+EXFUN (Foptimize_char_table, 2);
+EXFUN (For, UNEVALLED);
+EXFUN (Fother_buffer, 3);
+EXFUN (Fother_window_for_scrolling, 0);
+EXFUN (Foverlay_buffer, 1);
+EXFUN (Foverlay_end, 1);
+EXFUN (Foverlay_get, 2);
+EXFUN (Foverlay_lists, 0);
+EXFUN (Foverlay_on_enter, 1);
+EXFUN (Foverlay_on_exit, 1);
+EXFUN (Foverlay_properties, 1);
+EXFUN (Foverlay_put, 3);
+EXFUN (Foverlay_recenter, 1);
+EXFUN (Foverlay_start, 1);
+EXFUN (Foverlay_tree, 1);
+EXFUN (Foverlayp, 1);
+EXFUN (Foverlays_at, 2);
+EXFUN (Foverlays_in, 2);
+EXFUN (Fparse_partial_sexp, 6);
+EXFUN (Fpdumper_stats, 0);
+EXFUN (Fpdumping_output, 0);
+EXFUN (Fpdumping_p, 0);
+EXFUN (Fplay_sound_internal, 1);
+EXFUN (Fplist_get, 3);
+EXFUN (Fplist_member, 3);
+EXFUN (Fplist_put, 4);
+EXFUN (Fplus, MANY);
+EXFUN (Fpoint, 0);
+EXFUN (Fpoint_marker, 0);
+EXFUN (Fpoint_max, 0);
+EXFUN (Fpoint_max_marker, 0);
+EXFUN (Fpoint_min, 0);
+EXFUN (Fpoint_min_marker, 0);
+EXFUN (Fpos_bol, 1);
+EXFUN (Fpos_eol, 1);
+EXFUN (Fpos_visible_in_window_p, 3);
+EXFUN (Fposition_bytes, 1);
+EXFUN (Fposix_looking_at, 2);
+EXFUN (Fposix_search_backward, 4);
+EXFUN (Fposix_search_forward, 4);
+EXFUN (Fposix_string_match, 4);
+EXFUN (Fposn_at_point, 2);
+EXFUN (Fposn_at_x_y, 4);
+EXFUN (Fprefix_numeric_value, 1);
+EXFUN (Fprevious_char, 0);
+EXFUN (Fprevious_char_property_change, 2);
+EXFUN (Fprevious_frame, 2);
+EXFUN (Fprevious_overlay_change, 1);
+EXFUN (Fprevious_property_change, 3);
+EXFUN (Fprevious_single_char_property_change, 4);
+EXFUN (Fprevious_single_property_change, 4);
+EXFUN (Fprevious_window, 3);
+EXFUN (Fprin1, 3);
+EXFUN (Fprin1_to_string, 3);
+EXFUN (Fprinc, 2);
+EXFUN (Fprint, 2);
+EXFUN (Fprint_preprocess, 1);
+EXFUN (Fprocess__sigaction_child, 0);
+EXFUN (Fprocess_attributes, 1);
+EXFUN (Fprocess_buffer, 1);
+EXFUN (Fprocess_coding_system, 1);
+EXFUN (Fprocess_command, 1);
+EXFUN (Fprocess_contact, 3);
+EXFUN (Fprocess_datagram_address, 1);
+EXFUN (Fprocess_descriptors, 1);
+EXFUN (Fprocess_exit_status, 1);
+EXFUN (Fprocess_filter, 1);
+EXFUN (Fprocess_id, 1);
+EXFUN (Fprocess_inherit_coding_system_flag, 1);
+EXFUN (Fprocess_list, 0);
+EXFUN (Fprocess_mark, 1);
+EXFUN (Fprocess_name, 1);
+EXFUN (Fprocess_plist, 1);
+EXFUN (Fprocess_query_on_exit_flag, 1);
+EXFUN (Fprocess_running_child_p, 1);
+EXFUN (Fprocess_select, 1);
+EXFUN (Fprocess_send_eof, 1);
+EXFUN (Fprocess_send_jsonrpc, MANY);
+EXFUN (Fprocess_send_region, 3);
+EXFUN (Fprocess_send_string, 2);
+EXFUN (Fprocess_sentinel, 1);
+EXFUN (Fprocess_status, 1);
+EXFUN (Fprocess_thread, 1);
+EXFUN (Fprocess_tty_name, 2);
+EXFUN (Fprocess_type, 1);
+EXFUN (Fprocessp, 1);
+EXFUN (Fprofiler_cpu_log, 0);
+EXFUN (Fprofiler_cpu_running_p, 0);
+EXFUN (Fprofiler_cpu_start, 1);
+EXFUN (Fprofiler_cpu_stop, 0);
+EXFUN (Fprofiler_memory_log, 0);
+EXFUN (Fprofiler_memory_running_p, 0);
+EXFUN (Fprofiler_memory_start, 0);
+EXFUN (Fprofiler_memory_stop, 0);
+EXFUN (Fprog1, UNEVALLED);
+EXFUN (Fprogn, UNEVALLED);
+EXFUN (Fprogram_version, 0);
+EXFUN (Fproper_list_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fpropertize, MANY);
+EXFUN (Fprovide, 2);
+EXFUN (Fpurecopy_maybe, 1);
+EXFUN (Fpush_global_mark, 0);
+EXFUN (Fput, 3);
+EXFUN (Fput_text_property, 5);
+EXFUN (Fput_unicode_property_internal, 3);
+EXFUN (Fputhash, 3);
+EXFUN (Fquery_font, 1);
+EXFUN (Fquit_process, 2);
+EXFUN (Fquo, MANY);
+EXFUN (Fquote, UNEVALLED);
+EXFUN (Fraise_frame, 1);
+EXFUN (Frandom, 1);
+EXFUN (Frassoc, 2);
+EXFUN (Frassq, 2);
+EXFUN (Fre__describe_compiled, 2);
+EXFUN (Fre_search_backward, 4);
+EXFUN (Fre_search_forward, 4);
+EXFUN (Fread, 1);
+EXFUN (Fread_annotated, 1);
+EXFUN (Fread_buffer, 4);
+EXFUN (Fread_char, 3);
+EXFUN (Fread_char_exclusive, 3);
+EXFUN (Fread_coding_system, 2);
+EXFUN (Fread_command, 2);
+EXFUN (Fread_event, 3);
+EXFUN (Fread_from_minibuffer, 7);
+EXFUN (Fread_from_string, 3);
+EXFUN (Fread_function, 1);
+EXFUN (Fread_key_sequence, 5);
+EXFUN (Fread_key_sequence_vector, 5);
+EXFUN (Fread_non_nil_coding_system, 1);
+EXFUN (Fread_string, 5);
+EXFUN (Fread_variable, 2);
+EXFUN (Frecent_auto_save_p, 0);
+EXFUN (Frecent_keys, 1);
+EXFUN (Frecenter, 2);
+EXFUN (Freconsider_frame_fonts, 1);
+EXFUN (Frecord, MANY);
+EXFUN (Frecordp, 1);
+EXFUN (Frecursion_depth, 0);
+EXFUN (Frecursive_edit, 0);
+EXFUN (Fredirect_debugging_output, 2);
+EXFUN (Fredirect_frame_focus, 2);
+EXFUN (Fredisplay, 1);
+EXFUN (Fredisplay_statistics, 1);
+EXFUN (Fredraw_display, 0);
+EXFUN (Fredraw_frame, 1);
+EXFUN (Fregexp_cache_statistics, 1);
+EXFUN (Fregexp_quote, 1);
+EXFUN (Fregion_beginning, 0);
+EXFUN (Fregion_end, 0);
+EXFUN (Fregister_ccl_program, 2);
+EXFUN (Fregister_code_conversion_map, 2);
+EXFUN (Frem, 2);
+EXFUN (Fremhash, 2);
+EXFUN (Fremove_list_of_text_properties, 4);
+EXFUN (Fremove_text_properties, 4);
+EXFUN (Fremove_variable_watcher, 2);
+EXFUN (Frename_buffer, 2);
+EXFUN (Frename_file, 3);
+EXFUN (Freplace_buffer_contents, 3);
+EXFUN (Freplace_match, 5);
+EXFUN (Frequire, 3);
+EXFUN (Fresize_mini_window_internal, 1);
+EXFUN (Frestore_buffer_modified_p, 1);
+EXFUN (Fresume_tty, 1);
+EXFUN (Freverse, 1);
+EXFUN (Fright_divider_width, 1);
+EXFUN (Fround, 2);
+EXFUN (Frun_hook_with_args, MANY);
+EXFUN (Frun_hook_with_args_until_failure, MANY);
+EXFUN (Frun_hook_with_args_until_success, MANY);
+EXFUN (Frun_hook_wrapped, MANY);
+EXFUN (Frun_hooks, MANY);
+EXFUN (Frun_window_configuration_change_hook, 1);
+EXFUN (Frun_window_scroll_functions, 1);
+EXFUN (Fsafe_length, 1);
+EXFUN (Fsave_current_buffer, UNEVALLED);
+EXFUN (Fsave_excursion, UNEVALLED);
+EXFUN (Fsave_restriction, UNEVALLED);
+EXFUN (Fscan_lists, 3);
+EXFUN (Fscan_sexps, 2);
+EXFUN (Fscroll_bar_height, 1);
+EXFUN (Fscroll_bar_width, 1);
+EXFUN (Fscroll_down, 1);
+EXFUN (Fscroll_left, 2);
+EXFUN (Fscroll_right, 2);
+EXFUN (Fscroll_up, 1);
+EXFUN (Fsearch_backward, 4);
+EXFUN (Fsearch_forward, 4);
+EXFUN (Fsecure_hash, 5);
+EXFUN (Fsecure_hash_algorithms, 0);
+EXFUN (Fselect_frame, 2);
+EXFUN (Fselect_window, 2);
+EXFUN (Fselected_frame, 0);
+EXFUN (Fselected_window, 0);
+EXFUN (Fself_insert_command, 2);
+EXFUN (Fsend_string_to_terminal, 2);
+EXFUN (Fsequencep, 1);
+EXFUN (Fserial_process_configure, MANY);
+EXFUN (Fset, 2);
+EXFUN (Fset__this_command_keys, 1);
+EXFUN (Fset_binary_mode, 2);
+EXFUN (Fset_buffer, 1);
+EXFUN (Fset_buffer_auto_saved, 0);
+EXFUN (Fset_buffer_major_mode, 1);
+EXFUN (Fset_buffer_modified_p, 1);
+EXFUN (Fset_buffer_multibyte, 1);
+EXFUN (Fset_buffer_redisplay, 4);
+EXFUN (Fset_case_table, 1);
+EXFUN (Fset_category_table, 1);
+EXFUN (Fset_char_table_extra_slot, 3);
+EXFUN (Fset_char_table_parent, 2);
+EXFUN (Fset_char_table_range, 3);
+EXFUN (Fset_charset_plist, 2);
+EXFUN (Fset_charset_priority, MANY);
+EXFUN (Fset_coding_system_priority, MANY);
+EXFUN (Fset_default, 2);
+EXFUN (Fset_default_file_modes, 1);
+EXFUN (Fset_default_toplevel_value, 2);
+EXFUN (Fset_file_acl, 2);
+EXFUN (Fset_file_modes, 3);
+EXFUN (Fset_file_selinux_context, 2);
+EXFUN (Fset_file_times, 3);
+EXFUN (Fset_frame_height, 4);
+EXFUN (Fset_frame_position, 3);
+EXFUN (Fset_frame_selected_window, 3);
+EXFUN (Fset_frame_size, 4);
+EXFUN (Fset_frame_width, 4);
+EXFUN (Fset_frame_window_state_change, 2);
+EXFUN (Fset_input_interrupt_mode, 1);
+EXFUN (Fset_input_meta_mode, 2);
+EXFUN (Fset_input_mode, 4);
+EXFUN (Fset_keyboard_coding_system_internal, 2);
+EXFUN (Fset_keymap_parent, 2);
+EXFUN (Fset_marker, 3);
+EXFUN (Fset_marker_insertion_type, 2);
+EXFUN (Fset_match_data, 2);
+EXFUN (Fset_minibuffer_window, 1);
+EXFUN (Fset_mouse_pixel_position, 3);
+EXFUN (Fset_mouse_position, 3);
+EXFUN (Fset_network_process_option, 4);
+EXFUN (Fset_output_flow_control, 2);
+EXFUN (Fset_process_buffer, 2);
+EXFUN (Fset_process_coding_system, 3);
+EXFUN (Fset_process_datagram_address, 2);
+EXFUN (Fset_process_filter, 2);
+EXFUN (Fset_process_inherit_coding_system_flag, 2);
+EXFUN (Fset_process_jsonrpc, MANY);
+EXFUN (Fset_process_plist, 2);
+EXFUN (Fset_process_query_on_exit_flag, 2);
+EXFUN (Fset_process_sentinel, 2);
+EXFUN (Fset_process_thread, 2);
+EXFUN (Fset_process_window_size, 3);
+EXFUN (Fset_quit_char, 1);
+EXFUN (Fset_safe_terminal_coding_system_internal, 1);
+EXFUN (Fset_standard_case_table, 1);
+EXFUN (Fset_syntax_table, 1);
+EXFUN (Fset_terminal_coding_system_internal, 2);
+EXFUN (Fset_terminal_parameter, 3);
+EXFUN (Fset_text_properties, 4);
+EXFUN (Fset_time_zone_rule, 1);
+EXFUN (Fset_visited_file_modtime, 1);
+EXFUN (Fset_window_buffer, 3);
+EXFUN (Fset_window_combination_limit, 2);
+EXFUN (Fset_window_configuration, 3);
+EXFUN (Fset_window_cursor_type, 2);
+EXFUN (Fset_window_dedicated_p, 2);
+EXFUN (Fset_window_display_table, 2);
+EXFUN (Fset_window_fringes, 5);
+EXFUN (Fset_window_hscroll, 2);
+EXFUN (Fset_window_margins, 3);
+EXFUN (Fset_window_new_normal, 2);
+EXFUN (Fset_window_new_pixel, 3);
+EXFUN (Fset_window_new_total, 3);
+EXFUN (Fset_window_next_buffers, 2);
+EXFUN (Fset_window_parameter, 3);
+EXFUN (Fset_window_point, 2);
+EXFUN (Fset_window_prev_buffers, 2);
+EXFUN (Fset_window_scroll_bars, 6);
+EXFUN (Fset_window_start, 3);
+EXFUN (Fset_window_vscroll, 4);
+EXFUN (Fsetcar, 2);
+EXFUN (Fsetcdr, 2);
+EXFUN (Fsetplist, 2);
+EXFUN (Fsetq, UNEVALLED);
+EXFUN (Fshow_face_resources, 0);
+_Noreturn EXFUN (Fsignal, 2) ATTRIBUTE_COLD;
+EXFUN (Fsignal_names, 0);
+EXFUN (Fsignal_process, 3);
+EXFUN (Fsin, 1);
+EXFUN (Fsingle_key_description, 2);
+EXFUN (Fskip_chars_backward, 2);
+EXFUN (Fskip_chars_forward, 2);
+EXFUN (Fskip_syntax_backward, 2);
+EXFUN (Fskip_syntax_forward, 2);
+EXFUN (Fsleep_for, 2);
+EXFUN (Fsnarf_documentation, 1);
+EXFUN (Fsort, MANY);
+EXFUN (Fsort_charsets, 1);
+EXFUN (Fspecial_variable_p, 1);
+EXFUN (Fsplit_char, 1);
+EXFUN (Fsplit_window_internal, 4);
+EXFUN (Fsqrt, 1);
+EXFUN (Fstandard_case_table, 0);
+EXFUN (Fstandard_category_table, 0);
+EXFUN (Fstandard_syntax_table, 0);
+EXFUN (Fstart_kbd_macro, 2);
+EXFUN (Fstop_process, 2);
+EXFUN (Fstore_kbd_macro_event, 1);
+EXFUN (Fstring, MANY);
+EXFUN (Fstring_as_multibyte, 1);
+EXFUN (Fstring_as_unibyte, 1);
+EXFUN (Fstring_bytes, 1);
+EXFUN (Fstring_collate_equalp, 4);
+EXFUN (Fstring_collate_lessp, 4);
+EXFUN (Fstring_distance, 3);
+EXFUN (Fstring_equal, 2);
+EXFUN (Fstring_lessp, 2);
+EXFUN (Fstring_make_multibyte, 1);
+EXFUN (Fstring_make_unibyte, 1);
+EXFUN (Fstring_match, 4);
+EXFUN (Fstring_search, 3);
+EXFUN (Fstring_to_char, 1);
+EXFUN (Fstring_to_multibyte, 1);
+EXFUN (Fstring_to_number, 2);
+EXFUN (Fstring_to_syntax, 1);
+EXFUN (Fstring_to_unibyte, 1);
+EXFUN (Fstring_version_lessp, 2);
+EXFUN (Fstring_width, 3);
+EXFUN (Fstringp, 1) ATTRIBUTE_CONST;
+EXFUN (Fsub1, 1);
+EXFUN (Fsubr_arity, 1);
+EXFUN (Fsubr_documentation, 1);
+EXFUN (Fsubr_name, 1);
+EXFUN (Fsubr_native_comp_unit, 1);
+EXFUN (Fsubr_native_lambda_list, 1);
+EXFUN (Fsubr_type, 1);
+EXFUN (Fsubrp, 1);
+EXFUN (Fsubst_char_in_region, 5);
+EXFUN (Fsubstitute_in_file_name, 1);
+EXFUN (Fsubstring, 3);
+EXFUN (Fsubstring_no_properties, 3);
+EXFUN (Fsuspend_emacs, 1);
+EXFUN (Fsuspend_tty, 1);
+EXFUN (Fsxhash_eq, 1);
+EXFUN (Fsxhash_eql, 1);
+EXFUN (Fsxhash_equal, 1);
+EXFUN (Fsxhash_equal_including_properties, 1);
+EXFUN (Fsymbol_function, 1);
+EXFUN (Fsymbol_name, 1);
+EXFUN (Fsymbol_plist, 1);
+EXFUN (Fsymbol_value, 1);
+EXFUN (Fsymbolp, 1) ATTRIBUTE_CONST;
+EXFUN (Fsyntax_class_to_char, 1);
+EXFUN (Fsyntax_table, 0);
+EXFUN (Fsyntax_table_p, 1);
+EXFUN (Fsystem_groups, 0);
+EXFUN (Fsystem_name, 0);
+EXFUN (Fsystem_users, 0);
+EXFUN (Ftab_bar_height, 2);
+EXFUN (Ftake, 2);
+EXFUN (Ftan, 1);
+EXFUN (Fterminal_coding_system, 1);
+EXFUN (Fterminal_list, 0);
+EXFUN (Fterminal_live_p, 1);
+EXFUN (Fterminal_name, 1);
+EXFUN (Fterminal_parameter, 2);
+EXFUN (Fterminal_parameters, 1);
+EXFUN (Fterpri, 2);
+EXFUN (Ftest_completion, 3);
+EXFUN (Ftext_char_description, 1);
+EXFUN (Ftext_properties_at, 2);
+EXFUN (Ftext_property_any, 5);
+EXFUN (Ftext_property_not_all, 5);
+EXFUN (Ftext_quoting_style, 0);
+EXFUN (Fthis_command_keys, 0);
+EXFUN (Fthis_command_keys_vector, 0);
+EXFUN (Fthis_single_command_keys, 0);
+EXFUN (Fthis_single_command_raw_keys, 0);
+EXFUN (Fthread_blocker, 1);
+EXFUN (Fthread_join, 1);
+EXFUN (Fthread_last_error, 1);
+EXFUN (Fthread_live_p, 1);
+EXFUN (Fthread_name, 1);
+EXFUN (Fthread_signal, 3);
+EXFUN (Fthread_yield, 0);
+EXFUN (Fthreadp, 1);
+_Noreturn EXFUN (Fthrow, 2) ATTRIBUTE_COLD;
+EXFUN (Ftime_add, 2);
+EXFUN (Ftime_convert, 2);
+EXFUN (Ftime_equal_p, 2);
+EXFUN (Ftime_less_p, 2);
+EXFUN (Ftime_subtract, 2);
+EXFUN (Ftimes, MANY);
+EXFUN (Ftool_bar_height, 2);
+EXFUN (Ftool_bar_pixel_width, 1);
+_Noreturn EXFUN (Ftop_level, 0) ATTRIBUTE_COLD;
+EXFUN (Ftranslate_region_internal, 3);
+EXFUN (Ftranspose_regions, 5);
+EXFUN (Ftruncate, 2);
+EXFUN (Ftry_completion, 3);
+EXFUN (Ftty__output_buffer_size, 1);
+EXFUN (Ftty__set_output_buffer_size, 2);
+EXFUN (Ftty_display_color_cells, 1);
+EXFUN (Ftty_display_color_p, 1);
+EXFUN (Ftty_no_underline, 1);
+EXFUN (Ftty_suppress_bold_inverse_default_colors, 1);
+EXFUN (Ftty_top_frame, 1);
+EXFUN (Ftty_type, 1);
+EXFUN (Ftype_of, 1);
+EXFUN (Fundo_boundary, 0);
+EXFUN (Funencodable_char_position, 5);
+EXFUN (Funhandled_file_name_directory, 1);
+EXFUN (Funibyte_char_to_multibyte, 1);
+EXFUN (Funibyte_string, MANY);
+EXFUN (Funicode_property_table_internal, 1);
+EXFUN (Funify_charset, 3);
+EXFUN (Funintern, 2);
+EXFUN (Funix_sync, 0);
+EXFUN (Funlock_buffer, 0);
+EXFUN (Funlock_file, 1);
+EXFUN (Funwind_protect, UNEVALLED);
+EXFUN (Fupcase, 1);
+EXFUN (Fupcase_initials, 1);
+EXFUN (Fupcase_initials_region, 3);
+EXFUN (Fupcase_region, 3);
+EXFUN (Fupcase_word, 1);
+EXFUN (Fuse_global_map, 1);
+EXFUN (Fuse_local_map, 1);
+EXFUN (Fuser_full_name, 1);
+EXFUN (Fuser_login_name, 1);
+EXFUN (Fuser_ptrp, 1);
+EXFUN (Fuser_real_login_name, 0);
+EXFUN (Fuser_real_uid, 0);
+EXFUN (Fuser_uid, 0);
+EXFUN (Fvaluelt, 2);
+EXFUN (Fvariable_binding_locus, 1);
+EXFUN (Fvconcat, MANY);
+EXFUN (Fvector, MANY);
+EXFUN (Fvector_or_char_table_p, 1);
+EXFUN (Fvectorp, 1);
+EXFUN (Fverify_visited_file_modtime, 1);
+EXFUN (Fvertical_motion, 3);
+EXFUN (Fvisible_frame_list, 0);
+EXFUN (Fvisited_file_modtime, 0);
+EXFUN (Fwaiting_for_user_input_p, 0);
+EXFUN (Fwhere_is_internal, 5);
+EXFUN (Fwhile, UNEVALLED);
+EXFUN (Fwiden, 0);
+EXFUN (Fwidget_apply, MANY);
+EXFUN (Fwidget_get, 2);
+EXFUN (Fwidget_put, 3);
+EXFUN (Fwindow_at, 3);
+EXFUN (Fwindow_body_height, 2);
+EXFUN (Fwindow_body_width, 2);
+EXFUN (Fwindow_border__primitive, 1);
+EXFUN (Fwindow_bottom_divider_width, 1);
+EXFUN (Fwindow_buffer, 1);
+EXFUN (Fwindow_bump_use_time, 1);
+EXFUN (Fwindow_combination_limit, 1);
+EXFUN (Fwindow_configuration_equal_p, 2);
+EXFUN (Fwindow_configuration_frame, 1);
+EXFUN (Fwindow_configuration_p, 1);
+EXFUN (Fwindow_cursor_type, 1);
+EXFUN (Fwindow_dedicated_p, 1);
+EXFUN (Fwindow_discard_buffer, 3);
+EXFUN (Fwindow_display_table, 1);
+EXFUN (Fwindow_end, 2);
+EXFUN (Fwindow_frame, 1);
+EXFUN (Fwindow_fringes, 1);
+EXFUN (Fwindow_header_line_height, 1);
+EXFUN (Fwindow_hscroll, 1);
+EXFUN (Fwindow_left_child, 1);
+EXFUN (Fwindow_left_column, 1);
+EXFUN (Fwindow_line_height, 2);
+EXFUN (Fwindow_lines_pixel_dimensions, 6);
+EXFUN (Fwindow_list, 3);
+EXFUN (Fwindow_list_1, 3);
+EXFUN (Fwindow_live_p, 1);
+EXFUN (Fwindow_margins, 1);
+EXFUN (Fwindow_minibuffer_p, 1);
+EXFUN (Fwindow_mode_line_height, 1);
+EXFUN (Fwindow_new_normal, 1);
+EXFUN (Fwindow_new_pixel, 1);
+EXFUN (Fwindow_new_total, 1);
+EXFUN (Fwindow_next_buffers, 1);
+EXFUN (Fwindow_next_sibling, 1);
+EXFUN (Fwindow_normal_size, 2);
+EXFUN (Fwindow_old_body_pixel_height, 1);
+EXFUN (Fwindow_old_body_pixel_width, 1);
+EXFUN (Fwindow_old_buffer, 1);
+EXFUN (Fwindow_old_pixel_height, 1);
+EXFUN (Fwindow_old_pixel_width, 1);
+EXFUN (Fwindow_old_point, 1);
+EXFUN (Fwindow_parameter, 2);
+EXFUN (Fwindow_parameters, 1);
+EXFUN (Fwindow_parent, 1);
+EXFUN (Fwindow_pixel_height, 1);
+EXFUN (Fwindow_pixel_left, 1);
+EXFUN (Fwindow_pixel_top, 1);
+EXFUN (Fwindow_pixel_width, 1);
+EXFUN (Fwindow_point, 1);
+EXFUN (Fwindow_prev_buffers, 1);
+EXFUN (Fwindow_prev_sibling, 1);
+EXFUN (Fwindow_resize_apply, 2);
+EXFUN (Fwindow_resize_apply_total, 2);
+EXFUN (Fwindow_right_divider_width, 1);
+EXFUN (Fwindow_scroll_bar_height, 1);
+EXFUN (Fwindow_scroll_bar_width, 1);
+EXFUN (Fwindow_scroll_bars, 1);
+EXFUN (Fwindow_start, 1);
+EXFUN (Fwindow_system, 1);
+EXFUN (Fwindow_tab_line_height, 1);
+EXFUN (Fwindow_text_height, 2);
+EXFUN (Fwindow_text_pixel_size, 6);
+EXFUN (Fwindow_text_width, 2);
+EXFUN (Fwindow_top_child, 1);
+EXFUN (Fwindow_top_line, 1);
+EXFUN (Fwindow_total_height, 2);
+EXFUN (Fwindow_total_width, 2);
+EXFUN (Fwindow_use_time, 1);
+EXFUN (Fwindow_valid_p, 1);
+EXFUN (Fwindow_vscroll, 2);
+EXFUN (Fwindowp, 1);
+EXFUN (Fwrite_char, 2);
+EXFUN (Fwrite_region, 7);
+EXFUN (Fx_family_fonts, 2);
+EXFUN (Fx_focus_frame, 2);
+EXFUN (Fx_get_resource, 4);
+EXFUN (Fx_list_fonts, 5);
+EXFUN (Fx_load_color_file, 1);
+EXFUN (Fx_parse_geometry, 1);
+EXFUN (Fx_popup_dialog, 3);
+EXFUN (Fx_popup_menu, 2);
+EXFUN (Fyes_or_no_p, 1);
+EXFUN (Fzlib_available_p, 0);
+EXFUN (Fzlib_decompress_region, 3);
+#ifdef DEFINE_SYMBOLS
+static char const *const defsym_name[] = {
+	"nil",
+	"t",
+	"unbound",
+	"error",
+	"lambda",
+	"Automatic GC",
+	":adstyle",
+	":advertised-binding",
+	":align-to",
+	":antialias",
+	":array-type",
+	":ascii-compatible-p",
+	":avgwidth",
+	":background",
+	":bold",
+	":box",
+	":buffer",
+	":button",
+	":bytesize",
+	":category",
+	":cipher-aead-capable",
+	":cipher-blocksize",
+	":cipher-id",
+	":cipher-ivsize",
+	":cipher-keysize",
+	":cipher-tagsize",
+	":coding",
+	":color",
+	":combining-capability",
+	":command",
+	":complete-negotiation",
+	":connection-type",
+	":crlfiles",
+	":data",
+	":debug-on-exit",
+	":decode-translation-table",
+	":default-char",
+	":device",
+	":digest-algorithm-id",
+	":digest-algorithm-length",
+	":distant-foreground",
+	":documentation",
+	":dpi",
+	":enable",
+	":encode-translation-table",
+	":eval",
+	":extend",
+	":false",
+	":false-object",
+	":family",
+	":file",
+	":file-handler",
+	":filter",
+	":filtered",
+	":flags",
+	":flowcontrol",
+	":font",
+	":font-entity",
+	":fontset",
+	":foreground",
+	":foundry",
+	":height",
+	":help",
+	":host",
+	":hostname",
+	":ignore-defface",
+	":image",
+	":in-place",
+	":inherit",
+	":inverse-video",
+	":italic",
+	":key",
+	":key-sequence",
+	":keylist",
+	":keys",
+	":label",
+	":lang",
+	":lessp",
+	":line-width",
+	":local",
+	":log",
+	":loglevel",
+	":mac-algorithm-id",
+	":mac-algorithm-keysize",
+	":mac-algorithm-length",
+	":mac-algorithm-noncesize",
+	":map",
+	":min-prime-bits",
+	":mnemonic",
+	":name",
+	":noquery",
+	":nowait",
+	":null",
+	":null-object",
+	":object-type",
+	":otf",
+	":overline",
+	":parity",
+	":pass",
+	":plist",
+	":pointer",
+	":port",
+	":position",
+	":post-read-conversion",
+	":pre-write-conversion",
+	":priority",
+	":process",
+	":propertize",
+	":purecopy",
+	":radio",
+	":rcvbuf",
+	":rcvtimeo",
+	":registry",
+	":rehash-size",
+	":rehash-threshold",
+	":relative-height",
+	":relative-width",
+	":remote",
+	":reverse",
+	":rtl",
+	":scalable",
+	":script",
+	":sentinel",
+	":server",
+	":service",
+	":size",
+	":slant",
+	":sndbuf",
+	":sndtimeo",
+	":spacing",
+	":speed",
+	":stderr",
+	":stipple",
+	":stop",
+	":stopbits",
+	":strike-through",
+	":style",
+	":success",
+	":summary",
+	":tcpnodelay",
+	":test",
+	":tls-parameters",
+	":toggle",
+	":trustfiles",
+	":type",
+	":underline",
+	":use-external-socket",
+	":user-spec",
+	":verify-error",
+	":verify-flags",
+	":vert-only",
+	":visible",
+	":volume",
+	":weakness",
+	":weight",
+	":width",
+	":window",
+	"Discarded Samples",
+	"L2R",
+	"PRIMARY",
+	"R2L",
+	"--lambda-fixup",
+	"above",
+	"above-handle",
+	"above-suspended",
+	"access-file",
+	"activate-input-method",
+	"activate-menubar-hook",
+	"1+",
+	"add-hook",
+	"add-name-to-file",
+	"add-to-history",
+	"after-change-functions",
+	"after-delete-frame-functions",
+	"after-handle",
+	"after-insert-file-set-coding",
+	"after-pdump-load-hook",
+	"after-string",
+	"alist",
+	"all",
+	"alpha",
+	"alpha-background",
+	"&optional",
+	"&rest",
+	"apply",
+	"aref",
+	"args",
+	"args-out-of-range",
+	"arith-error",
+	"array",
+	"arrayp",
+	"arrow",
+	"ascii",
+	"ascii-0",
+	"ascii-character",
+	"aset",
+	"assq-delete-all",
+	"assume",
+	"auto-composed",
+	"auto-fill-chars",
+	"auto-hscroll-mode",
+	"auto-lower",
+	"auto-raise",
+	"auto-save-coding",
+	"autoload",
+	"autosaved",
+	"background-color",
+	"background-mode",
+	"`",
+	"bar",
+	"before-change-functions",
+	"before-handle",
+	"before-revert-hook",
+	"before-string",
+	"beginning-of-buffer",
+	"below",
+	"below-handle",
+	"bidi-class",
+	"big",
+	"big5",
+	"bignum",
+	"bitmap-spec-p",
+	"black",
+	"bold",
+	"book",
+	"bool-vector",
+	"bool-vector-p",
+	"boolean",
+	"booleanp",
+	"border",
+	"border-color",
+	"border-width",
+	"both",
+	"both-horiz",
+	"bottom",
+	"bottom-divider",
+	"bottom-divider-width",
+	"bottom-edge",
+	"bottom-left-corner",
+	"bottom-right-corner",
+	"boundary",
+	"bounds",
+	"box",
+	"bracket-type",
+	"buffer",
+	"buffer-access-fontify-functions",
+	"buffer-file-coding-system",
+	"buffer-list",
+	"buffer-list-update-hook",
+	"buffer-name-history",
+	"buffer-or-string-p",
+	"buffer-position",
+	"buffer-predicate",
+	"buffer-read-only",
+	"buffer-stale-function",
+	"bufferp",
+	"buffers",
+	"buried-buffer-list",
+	"byte-code-function",
+	"byte-code-function-p",
+	"byte-code-meter",
+	"c",
+	"call",
+	"call-process",
+	"call-process-region",
+	"callref",
+	"canonical-combining-class",
+	"car",
+	"car-less-than-car",
+	"case-fold-search",
+	"case-symbols-as-words",
+	"case-table",
+	"case-table-p",
+	"catcher",
+	"category",
+	"category-table",
+	"category-table-p",
+	"categoryp",
+	"categorysetp",
+	"ccl",
+	"ccl-program-idx",
+	"cclp",
+	"cdr",
+	"ceiling",
+	"center",
+	"change_frame_size",
+	"change-major-mode-hook",
+	"char-code-property-table",
+	"char-from-name",
+	"char-or-string-p",
+	"char-script-table",
+	"char-table",
+	"char-table-extra-slots",
+	"char-table-p",
+	"characterp",
+	"charset",
+	"charsetp",
+	"child-frame-border",
+	"child-frame-border-width",
+	"choice",
+	"circle",
+	"circular-list",
+	"clone-indirect-buffer-hook",
+	"clone-of",
+	"close-tab",
+	"closed",
+	"cmajflt",
+	"cminflt",
+	"code-conversion-map",
+	"code-conversion-map-id",
+	"codeset",
+	"coding",
+	"coding-system-define-form",
+	"coding-system-error",
+	"coding-system-history",
+	"coding-system-p",
+	"columns",
+	"comm",
+	",",
+	",@",
+	"command-debug-status",
+	"command-execute",
+	"command-modes",
+	"commandp",
+	"comment",
+	"comment-end-can-be-escaped",
+	"comp-libgccjit-reproducer",
+	"comp-maybe-gc-or-quit",
+	"comp-mvar",
+	"comp-sanitizer-error",
+	"comp-subr-trampoline-install",
+	"comp-trampoline-dir",
+	"completion-ignore-case",
+	"composition",
+	"cond-jump",
+	"cond-jump-narg-leq",
+	"condition-case",
+	"condition-variable",
+	"condition-variable-p",
+	"config-changed-event",
+	"configuration",
+	"connect",
+	"cons",
+	"conses",
+	"consp",
+	"copy-directory",
+	"copy-file",
+	"cstime",
+	"ctime",
+	"current",
+	"current-input-method",
+	"current-line",
+	"current-load-list",
+	"current-minibuffer-command",
+	"cursor",
+	"cursor-color",
+	"cursor-in-echo-area",
+	"cursor-type",
+	"curve",
+	"custom-variable-history",
+	"custom-variable-p",
+	"cutime",
+	"cycle-sort-function",
+	"cyclic-function-indirection",
+	"cyclic-variable-indirection",
+	"d",
+	"d-default",
+	"d-ephemeral",
+	"dashes",
+	"data",
+	"datagram",
+	"days",
+	"dbus-event",
+	"deactivate-mark",
+	"debug",
+	"debug-early",
+	"debugger",
+	"decomposed-characters",
+	"dedicated",
+	"defalias-fset-function",
+	"default",
+	"default-directory",
+	"defun",
+	"defvaralias",
+	"delayed-warnings-hook",
+	"delete",
+	"delete-all-mode-overlays",
+	"delete-before",
+	"delete-by-moving-to-trash",
+	"delete-char",
+	"delete-directory",
+	"delete-file",
+	"delete-file-internal",
+	"delete-frame",
+	"delete-frame-functions",
+	"delete-terminal-functions",
+	"delete-window",
+	"dir-ok",
+	"direct-call",
+	"direct-callref",
+	"directory-file-name",
+	"directory-files",
+	"directory-files-and-attributes",
+	"disable-eval",
+	"disabled",
+	"display",
+	"display-buffer",
+	"display-fill-column-indicator",
+	"display-fill-column-indicator-character",
+	"display-fill-column-indicator-column",
+	"display-line-numbers",
+	"display-line-numbers-disable",
+	"display-line-numbers-offset",
+	"display-line-numbers-widen",
+	"display-line-numbers-width",
+	"display-monitors-changed-functions",
+	"display-table",
+	"display-type",
+	"do-after-load-evaluation",
+	"domain-error",
+	"dos",
+	"dots",
+	"double-line",
+	"down",
+	"drag-internal-border",
+	"drag-n-drop",
+	"drag-source",
+	"drag-with-header-line",
+	"drag-with-mode-line",
+	"drag-with-tab-line",
+	"dragging",
+	"dropping",
+	"dump-emacs-portable--sort-predicate",
+	"dump-emacs-portable--sort-predicate-copied",
+	"pdump-file-name",
+	"dumped-with-pdumper",
+	"echo-area-clear-hook",
+	"echo-keystrokes",
+	"egid",
+	"eight-bit",
+	"elt",
+	"emacs",
+	"emacs-mule",
+	"emoji",
+	"empty-box",
+	"enable-recursive-minibuffers",
+	"encode-time",
+	"encoded",
+	"end-of-buffer",
+	"end-of-file",
+	"end-scroll",
+	"end-session",
+	"entry",
+	"eq",
+	"eql",
+	"equal",
+	"error-conditions",
+	"error-message",
+	"escape-glyph",
+	"etime",
+	"euid",
+	"eval",
+	"eval-buffer-list",
+	"evaporate",
+	"even",
+	"event-kind",
+	"event-symbol-element-mask",
+	"event-symbol-elements",
+	"evictions",
+	"excessive-lisp-nesting",
+	"excessive-variable-binding",
+	"excl",
+	"exit",
+	"expand-abbrev",
+	"expand-file-name",
+	"explicit-name",
+	"external-border-size",
+	"external-debugging-output",
+	"extra-bold",
+	"extra-light",
+	"face",
+	"face-alias",
+	"face-no-inherit",
+	"face-remapping-alist",
+	"face-set-after-frame-default",
+	"failed",
+	"fboundp",
+	"features",
+	"fetch-exception",
+	"field",
+	"file-accessible-directory-p",
+	"file-acl",
+	"file-already-exists",
+	"file-attributes",
+	"file-attributes-lessp",
+	"file-date-error",
+	"file-directory-p",
+	"file-error",
+	"file-executable-p",
+	"file-exists-p",
+	"file-locked-p",
+	"file-missing",
+	"file-modes",
+	"file-name-all-completions",
+	"file-name-as-directory",
+	"file-name-case-insensitive-p",
+	"file-name-completion",
+	"file-name-directory",
+	"file-name-handler-alist",
+	"file-name-history",
+	"file-name-nondirectory",
+	"file-newer-than-file-p",
+	"file-notify",
+	"file-notify-error",
+	"file-offset",
+	"file-readable-p",
+	"file-regular-p",
+	"file-selinux-context",
+	"file-symlink-p",
+	"file-system-info",
+	"file-writable-p",
+	"filenamep",
+	"fill-column-indicator",
+	"finalizer",
+	"find-file-literally-line-length",
+	"first-change-hook",
+	"fixnum",
+	"fixnump",
+	"flat-button",
+	"float",
+	"float-output-format",
+	"floatp",
+	"floats",
+	"floor",
+	"focus-in",
+	"focus-out",
+	"font",
+	"font-backend",
+	"font-driver-superseded-by",
+	"font-entity",
+	"font-extra-type",
+	"font-lock-dont-widen",
+	"font-lock-extra-managed-props",
+	"font-lock-face",
+	"font-lock-fontify-region",
+	"font-object",
+	"font-spec",
+	"fontification-functions",
+	"fontified",
+	"foreground-color",
+	"format-annotate-function",
+	"format-decode",
+	"fraction",
+	"frame",
+	"frame-edges",
+	"frame-live-p",
+	"frame-monitor-attributes",
+	"frame-set-background-mode",
+	"frame-windows-min-size",
+	"framep",
+	"frames",
+	"fringe",
+	"from--tty-menu-p",
+	"front-sticky",
+	"fullboth",
+	"fullheight",
+	"fullscreen",
+	"fullwidth",
+	"funcall",
+	"funcall-interactively",
+	"function",
+	"function-documentation",
+	"function-history",
+	"function-key",
+	"functionp",
+	"fundamental-mode",
+	"gc-cons-percentage",
+	"gc-cons-threshold",
+	"gccjit",
+	"geometry",
+	"get-buffer-window-list",
+	"get-emacs-mule-file-char",
+	"get-file-buffer",
+	"get-file-char",
+	"get-mru-window",
+	"get-scratch-buffer-create",
+	"global-mark-ring",
+	"global-mark-ring-max",
+	"glyphless-char",
+	"glyphless-char-display",
+	"gnutls-anon",
+	"gnutls-code",
+	"gnutls-e-again",
+	"gnutls-e-interrupted",
+	"gnutls-e-invalid-session",
+	"gnutls-e-not-ready-for-handshake",
+	"GNUTLS_PKCS_NULL_PASSWORD",
+	"GNUTLS_PKCS_PBES1_DES_MD5",
+	"GNUTLS_PKCS_PBES2_3DES",
+	"GNUTLS_PKCS_PBES2_AES_128",
+	"GNUTLS_PKCS_PBES2_AES_192",
+	"GNUTLS_PKCS_PBES2_AES_256",
+	"GNUTLS_PKCS_PBES2_DES",
+	"GNUTLS_PKCS_PBES2_GOST_CPA",
+	"GNUTLS_PKCS_PBES2_GOST_CPB",
+	"GNUTLS_PKCS_PBES2_GOST_CPC",
+	"GNUTLS_PKCS_PBES2_GOST_CPD",
+	"GNUTLS_PKCS_PBES2_GOST_TC26Z",
+	"GNUTLS_PKCS_PKCS12_3DES",
+	"GNUTLS_PKCS_PKCS12_ARCFOUR",
+	"GNUTLS_PKCS_PKCS12_RC2_40",
+	"GNUTLS_PKCS_PLAIN",
+	"gnutls-symmetric-cipher",
+	"gnutls-digest-algorithm",
+	"gnutls-mac-algorithm",
+	"gnutls-x509pki",
+	"grave",
+	"group",
+	"grow-only",
+	"gui_figure_window_size",
+	"gui-set-selection",
+	"haiku",
+	"hand",
+	"handle",
+	"handle-select-window",
+	"handle-shift-selection",
+	"handle-switch-frame",
+	"hash-table",
+	"hash-table-p",
+	"hash-table-test",
+	"hbar",
+	"header-line",
+	"header-line-format",
+	"heap",
+	"heavy",
+	"height",
+	"height-only",
+	"help--append-keystrokes-help",
+	"help--describe-map-tree",
+	"help-echo",
+	"help-echo-inhibit-substitution",
+	"help-form-show",
+	"help-key-binding",
+	"helper_sanitizer_assert",
+	"helper_save_restriction",
+	"helper_unbind_n",
+	"helper_unwind_protect",
+	"hex-code",
+	"hide",
+	"hits",
+	"hl-line-sticky-flag",
+	"hl-line-unhighlight",
+	"hollow",
+	"horizontal-handle",
+	"horizontal-scroll-bar",
+	"horizontal-scroll-bars",
+	"hw",
+	"icon",
+	"icon-left",
+	"icon-name",
+	"icon-top",
+	"icon-type",
+	"iconify-frame",
+	"iconify-top-level",
+	"identity",
+	"if",
+	"if-regular",
+	"ignore",
+	"ignore-self-insert",
+	"ignored",
+	"image",
+	"inc-args",
+	"inhibit-changing-match-data",
+	"inhibit-debugger",
+	"inhibit-double-buffering",
+	"inhibit-eval-during-redisplay",
+	"inhibit-file-name-operation",
+	"inhibit-free-realized-faces",
+	"inhibit-menubar-update",
+	"inhibit-modification-hooks",
+	"inhibit-point-motion-hooks",
+	"inhibit-quit",
+	"inhibit-read-only",
+	"inhibit-redisplay",
+	"inhibited-interaction",
+	"inner-edges",
+	"input-method-exit-on-first-char",
+	"input-method-use-echo-area",
+	"insdel",
+	"insert-behind-hooks",
+	"insert-file-contents",
+	"insert-in-front-hooks",
+	"inserted-chars",
+	"insufficient-source",
+	"intangible",
+	"integer",
+	"integer-or-marker-p",
+	"integerp",
+	"interactive",
+	"interactive-args",
+	"interactive-form",
+	"interactive-p",
+	"internal--syntax-propertize",
+	"internal-auto-fill",
+	"internal-border",
+	"internal-border-width",
+	"internal-default-interrupt-process",
+	"internal-default-process-filter",
+	"internal-default-process-sentinel",
+	"internal-default-signal-process",
+	"internal-echo-keystrokes-prefix",
+	"internal-when-entered-debugger",
+	"interpreted-function",
+	"interrupt-process-functions",
+	"interrupted",
+	"intervals",
+	"invalid-arity",
+	"invalid-function",
+	"invalid-read-syntax",
+	"invalid-regexp",
+	"invalid-source",
+	"invisible",
+	"ipv4",
+	"ipv6",
+	"iso10646-1",
+	"iso8859-1",
+	"iso-2022",
+	"iso-8859-1",
+	"italic",
+	"iv-auto",
+	"ja",
+	"json-end-of-file",
+	"json-error",
+	"json-escape-sequence-error",
+	"json-invalid-surrogate-error",
+	"json-number-out-of-range-error",
+	"json-object-too-deep",
+	"json-out-of-memory",
+	"json-parse-error",
+	"json-parse-string",
+	"json-serialize",
+	"json-stream",
+	"json-stream-p",
+	"json-trailing-content",
+	"json-utf8-decode-error",
+	"json-value-p",
+	"jump",
+	"kbd-macro-termination-hook",
+	"keep-ratio",
+	"key",
+	"key-and-value",
+	"key-or-value",
+	"key-parse",
+	"key-valid-p",
+	"keymap",
+	"keymap-canonicalize",
+	"keymapp",
+	"kill-buffer--possibly-save",
+	"kill-buffer-hook",
+	"kill-buffer-query-functions",
+	"kill-emacs",
+	"kill-emacs-hook",
+	"kill-forward-chars",
+	"ko",
+	"language-change",
+	"last-arrow-position",
+	"last-arrow-string",
+	"last-nonmenu-event",
+	"last-selected-window",
+	"left",
+	"left-edge",
+	"left-fringe",
+	"left-fringe-help",
+	"left-margin",
+	"left-only",
+	"left-to-right",
+	"leftmost",
+	"let",
+	"let*",
+	"lexical-binding",
+	"light",
+	"line",
+	"line-height",
+	"line-number",
+	"line-number-current-line",
+	"line-number-major-tick",
+	"line-number-minor-tick",
+	"line-prefix",
+	"line-spacing",
+	"lisp-directory",
+	"list",
+	"list-or-vector-p",
+	"list-system-processes",
+	"listen",
+	"listp",
+	"little",
+	"load",
+	"load-file-name",
+	"load-force-doc-strings",
+	"load-in-progress",
+	"load-time",
+	"local",
+	"local-map",
+	"lock-file",
+	"long",
+	"lowercase",
+	"lread--unescaped-character-literals",
+	"m",
+	"mac",
+	"macro",
+	"macroexp--dynvars",
+	"majflt",
+	"make-directory",
+	"make-directory-internal",
+	"make-frame-visible",
+	"make-invisible",
+	"make-lock-file-name",
+	"make-process",
+	"make-symbolic-link",
+	"makunbound",
+	"many",
+	"margin",
+	"mark-for-redisplay",
+	"mark-inactive",
+	"marker",
+	"markerp",
+	"maximized",
+	"md5",
+	"medium",
+	"memory-info",
+	"menu",
+	"menu-bar",
+	"menu-bar-external",
+	"menu-bar-lines",
+	"menu-bar-size",
+	"menu-bar-update-hook",
+	"menu-enable",
+	"menu-item",
+	"message",
+	"metadata",
+	"min-height",
+	"min-width",
+	"minflt",
+	"minibuffer",
+	"minibuffer-completing-file-name",
+	"minibuffer-completion-table",
+	"minibuffer-default",
+	"minibuffer-exit",
+	"minibuffer-exit-hook",
+	"minibuffer-follows-selected-frame",
+	"minibuffer-history",
+	"minibuffer-inactive-mode",
+	"minibuffer-mode",
+	"minibuffer-prompt",
+	"minibuffer-quit",
+	"minibuffer-setup-hook",
+	"-",
+	"mirroring",
+	"misses",
+	"missing-module-init-function",
+	"mm-size",
+	"mode-class",
+	"mode-line",
+	"mode-line-active",
+	"mode-line-default-help-echo",
+	"mode-line-format",
+	"mode-line-inactive",
+	"mode-overlay",
+	"mode-overlay-face-alist",
+	"mode-overlay-filter-buffer-substring-function",
+	"mode-overlay-on-switch-to-buffer",
+	"mode-overlay-p",
+	"modeline",
+	"modification-hooks",
+	"modifier-cache",
+	"module-function",
+	"module-function-p",
+	"module-init-failed",
+	"module-load-failed",
+	"module-open-failed",
+	"months",
+	"mouse",
+	"mouse-click",
+	"mouse-color",
+	"mouse-face",
+	"mouse-fixup-help-message",
+	"mouse-leave-buffer-hook",
+	"mouse-movement",
+	"mouse-wheel-frame",
+	"move-frame",
+	"move-toolbar",
+	"mutex",
+	"mutexp",
+	"name",
+	"native-comp-compiler-options",
+	"native-comp-debug",
+	"native-comp-driver-options",
+	"native-comp-function",
+	"native-comp-speed",
+	"native-comp-unit",
+	"native-compiler",
+	"native-compiler-error",
+	"native-edges",
+	"native-ice",
+	"native-lisp-file-inconsistent",
+	"native-lisp-load-failed",
+	"native-lisp-wrong-reloc",
+	"natnump",
+	"negate",
+	"network",
+	"newline",
+	"nice",
+	"no-accept-focus",
+	"no-catch",
+	"no-conversion",
+	"no-focus-on-map",
+	"no-other-frame",
+	"no-other-window",
+	"no-record",
+	"no-special-glyphs",
+	"nobreak-hyphen",
+	"nobreak-space",
+	"noelisp",
+	"non-ascii",
+	"non-key-event",
+	"none",
+	"normal",
+	"normal-top-level",
+	"ns",
+	"ns-appearance",
+	"ns-parse-geometry",
+	"ns-transparent-titlebar",
+	"nsm-verify-connection",
+	"nth",
+	"null",
+	"number-or-marker-p",
+	"numberp",
+	"numeric",
+	"obarray",
+	"obarray-cache",
+	"obarrayp",
+	"object",
+	"oblique",
+	"oclosure-interactive-form",
+	"odd",
+	"only",
+	"open",
+	"open-network-stream",
+	"opentype",
+	"operations",
+	"outer-border-width",
+	"outer-edges",
+	"outer-position",
+	"outer-size",
+	"outer-window-id",
+	"overflow-error",
+	"overlay",
+	"overlay-arrow-bitmap",
+	"overlay-arrow-string",
+	"overlayp",
+	"override-redirect",
+	"overriding-local-map",
+	"overriding-plist-environment",
+	"overriding-terminal-local-map",
+	"overwrite-mode",
+	"overwrite-mode-binary",
+	"p",
+	"paper",
+	"parent-frame",
+	"parent-id",
+	"pc",
+	"pcpu",
+	"permanent-local",
+	"permanent-local-hook",
+	"permission-denied",
+	"pgrp",
+	"pgtk",
+	"phi",
+	"pinch",
+	"pipe",
+	"pipe-process-p",
+	"play-sound-functions",
+	"plist",
+	"plistp",
+	"+",
+	"pmem",
+	"point-entered",
+	"point-left",
+	"pointer",
+	"polling-period",
+	"poly",
+	"pop-exception",
+	"position",
+	"post-command-hook",
+	"post-gc-hook",
+	"post-select-region-hook",
+	"post-self-insert-hook",
+	"ppid",
+	"pre-command-hook",
+	"preedit-text",
+	"pressed-button",
+	"pri",
+	"primitive-function",
+	"print--unreadable-callback-buffer",
+	"print-escape-multibyte",
+	"print-escape-nonascii",
+	"print-unreadable-function",
+	"priority",
+	"process",
+	"process-attributes",
+	"processp",
+	"progn",
+	"propertize",
+	"protected-field",
+	"provide",
+	"pty",
+	"pure",
+	"purecopy",
+	"push-exception",
+	"push-window-buffer-onto-prev",
+	"quit",
+	"quit-restore",
+	"quit-restore-prev",
+	"quote",
+	"raise",
+	"range",
+	"range-error",
+	"ratio",
+	"raw-text",
+	"read",
+	"read-char",
+	"read-number",
+	"read-only",
+	"real",
+	"real-this-command",
+	"rear-nonsticky",
+	"recenter",
+	"record",
+	"record_unwind_current_buffer",
+	"record_unwind_protect_excursion",
+	"record-window-buffer",
+	"recordp",
+	"rect",
+	"recursion-error",
+	"redisplay-dont-pause",
+	"redisplay_internal (C function)",
+	"relative",
+	"released-button",
+	"remap",
+	"remote-file-error",
+	"rename-file",
+	"replace-buffer-in-windows",
+	"require",
+	"reset",
+	"return",
+	"reuse",
+	"right",
+	"right-divider",
+	"right-divider-width",
+	"right-edge",
+	"right-fringe",
+	"right-fringe-help",
+	"right-margin",
+	"right-to-left",
+	"rightmost",
+	"risky-local-variable",
+	"rss",
+	"run",
+	"run-hook-query-error-with-timeout",
+	"run-hook-with-args",
+	"safe",
+	"save-excursion",
+	"save-session",
+	"scale-factor",
+	"scan-error",
+	"scratch",
+	"screen-gamma",
+	"scroll",
+	"scroll-bar",
+	"scroll-bar-background",
+	"scroll-bar-foreground",
+	"scroll-bar-height",
+	"scroll-bar-movement",
+	"scroll-bar-width",
+	"scroll-command",
+	"scroll-down",
+	"scroll-up",
+	"search-failed",
+	"select-frame-set-input-focus",
+	"select-window",
+	"selection-request",
+	"self-insert-command",
+	"semi-bold",
+	"semi-light",
+	"seqpacket",
+	"sequencep",
+	"serial",
+	"sess",
+	"set",
+	"set-args-to-local",
+	"set-default",
+	"set-file-acl",
+	"set-file-modes",
+	"set-file-selinux-context",
+	"set-file-times",
+	"set_internal",
+	"set-par-to-local",
+	"set-rest-args-to-local",
+	"set-visited-file-modtime",
+	"set_window_configuration",
+	"setcar",
+	"setcdr",
+	"setimm",
+	"setq",
+	"setting-constant",
+	"sha1",
+	"sha224",
+	"sha256",
+	"sha384",
+	"sha512",
+	"shaded",
+	"shift-jis",
+	"side-effect-free",
+	"signal",
+	"signal-process-functions",
+	"singularity-error",
+	"size",
+	"skip-taskbar",
+	"slice",
+	"sound",
+	"source",
+	"space",
+	"space-width",
+	"special-form",
+	"special-lowercase",
+	"special-titlecase",
+	"special-uppercase",
+	"sqlite",
+	"standard-input",
+	"standard-output",
+	"start",
+	"start-process",
+	"state",
+	"stderr",
+	"stdin",
+	"stdout",
+	"sticky",
+	"stime",
+	"stop",
+	"straight",
+	"string",
+	"string-bytes",
+	"string-lessp",
+	"stringp",
+	"strings",
+	"1-",
+	"sub-char-table",
+	"subfeatures",
+	"subr",
+	"subr-native-elisp",
+	"subrp",
+	"substitute-command-keys",
+	"substitute-env-in-file-name",
+	"substitute-in-file-name",
+	"sw",
+	"switch-frame",
+	"symbol",
+	"symbolp",
+	"symbols",
+	"syntax-ppss",
+	"syntax-ppss-table",
+	"syntax-table",
+	"syntax-table-p",
+	"tab-bar",
+	"tab-bar-lines",
+	"tab-bar-size",
+	"tab-line",
+	"tab-line-format",
+	"target-idx",
+	"temp-buffer-setup-hook",
+	"temp-buffer-show-hook",
+	"temporary-goal-column",
+	"terminal",
+	"terminal_frame",
+	"terminal-live-p",
+	"test",
+	"text",
+	"text-image-horiz",
+	"text-pixels",
+	"text-read-only",
+	"thcount",
+	"thin",
+	"thin-space",
+	"thread",
+	"thread-event",
+	"threadp",
+	"time",
+	"timer-event-handler",
+	"tip_frame",
+	"title",
+	"title-bar-size",
+	"titlecase",
+	"tool-bar",
+	"tool-bar-external",
+	"tool-bar-lines",
+	"tool-bar-position",
+	"tool-bar-size",
+	"tooltip",
+	"top",
+	"top-edge",
+	"top-left-corner",
+	"top-level",
+	"top-only",
+	"top-right-corner",
+	"touch-end",
+	"touchscreen-begin",
+	"touchscreen-end",
+	"touchscreen-update",
+	"tpgid",
+	"trailing-whitespace",
+	"translation-table",
+	"translation-table-id",
+	"trapping-constant",
+	"tree-sitter",
+	"tree-sitter-cursor",
+	"tree-sitter-node",
+	"ttname",
+	"tty",
+	"tty-color-alist",
+	"tty-color-by-index",
+	"tty-color-desc",
+	"tty-color-mode",
+	"tty-color-standard-values",
+	"tty-menu-exit",
+	"tty-menu-ignore",
+	"tty-menu-mouse-movement",
+	"tty-menu-navigation-map",
+	"tty-menu-next-item",
+	"tty-menu-next-menu",
+	"tty-menu-prev-item",
+	"tty-menu-prev-menu",
+	"tty-menu-select",
+	"tty-mode-reset-strings",
+	"tty-mode-set-strings",
+	"tty-type",
+	"type-mismatch",
+	"ultra-bold",
+	"ultra-heavy",
+	"ultra-light",
+	"undecided",
+	"undecorated",
+	"undefined",
+	"underflow-error",
+	"underline-minimum-offset",
+	"undo",
+	"undo--seen-list",
+	"undo-only",
+	"unevalled",
+	"unhandled-file-name-directory",
+	"unicode",
+	"unicode-bmp",
+	"unicode-string-p",
+	"unix",
+	"unlet",
+	"unlock-file",
+	"unreachable",
+	"unspecified",
+	"unsplittable",
+	"up",
+	"uppercase",
+	"us-ascii",
+	"use-frame-synchronization",
+	"user",
+	"user-error",
+	"user-position",
+	"user-ptr",
+	"user-ptrp",
+	"user-search-failed",
+	"user-size",
+	"utf-16",
+	"utf-16le",
+	"utf-8",
+	"utf-8-emacs",
+	"utf-8-string-p",
+	"utf-8-unix",
+	"utime",
+	"value",
+	"value<",
+	"variable-documentation",
+	"vector",
+	"vector-or-char-table-p",
+	"vector-slots",
+	"vectorp",
+	"vectors",
+	"verify-visited-file-modtime",
+	"vertical-border",
+	"vertical-line",
+	"vertical-scroll-bar",
+	"vertical-scroll-bars",
+	"visibility",
+	"visible",
+	"visual",
+	"void-function",
+	"void-variable",
+	"vsize",
+	"w32",
+	"wait-for-wm",
+	"wall",
+	"watchers",
+	"wave",
+	"weakness",
+	"when",
+	"wholenump",
+	"widget-type",
+	"width",
+	"width-only",
+	"window",
+	"window--pixel-to-total",
+	"window--resize-mini-frame",
+	"window--resize-root-window",
+	"window--resize-root-window-vertically",
+	"window-border",
+	"window-border-mode",
+	"window-buffer-change-functions",
+	"window-configuration",
+	"window-configuration-change-hook",
+	"window-configuration-p",
+	"window-deletable-p",
+	"window-divider",
+	"window-divider-first-pixel",
+	"window-divider-last-pixel",
+	"window-edges",
+	"window-id",
+	"window-live-p",
+	"window-point-insertion-type",
+	"window-scroll-functions",
+	"window-selection-change-functions",
+	"window-size",
+	"window-size-change-functions",
+	"window-state-change-functions",
+	"window-state-change-hook",
+	"window-valid-p",
+	"windowp",
+	"workarea",
+	"wrap-prefix",
+	"write-region",
+	"write-region-annotate-functions",
+	"wrong-length-argument",
+	"wrong-number-of-arguments",
+	"wrong-register-subr-call",
+	"wrong-type-argument",
+	"x",
+	"x_create_frame_1",
+	"x_create_frame_2",
+	"x-frame-parameter",
+	"x-pre-popup-menu-hook",
+	"x-resource-name",
+	"x_set_menu_bar_lines",
+	"x_set_window_size_1",
+	"xg_frame_set_char_size",
+	"xterm--set-selection",
+	"xterm-select-active-regions",
+	"xwidget",
+	"xwidget-display-event",
+	"xwidget-event",
+	"xwidget-view",
+	"yes-or-no-p-history",
+	"z-group",
+	"zero-width",
+};
+#endif
+#define Qnil builtin_lisp_symbol (0)
+#if DEFINE_NON_NIL_Q_SYMBOL_MACROS
+# define Qt builtin_lisp_symbol (1)
+# define Qunbound builtin_lisp_symbol (2)
+# define Qerror builtin_lisp_symbol (3)
+# define Qlambda builtin_lisp_symbol (4)
+# define QAutomatic_GC builtin_lisp_symbol (5)
+# define QCadstyle builtin_lisp_symbol (6)
+# define QCadvertised_binding builtin_lisp_symbol (7)
+# define QCalign_to builtin_lisp_symbol (8)
+# define QCantialias builtin_lisp_symbol (9)
+# define QCarray_type builtin_lisp_symbol (10)
+# define QCascii_compatible_p builtin_lisp_symbol (11)
+# define QCavgwidth builtin_lisp_symbol (12)
+# define QCbackground builtin_lisp_symbol (13)
+# define QCbold builtin_lisp_symbol (14)
+# define QCbox builtin_lisp_symbol (15)
+# define QCbuffer builtin_lisp_symbol (16)
+# define QCbutton builtin_lisp_symbol (17)
+# define QCbytesize builtin_lisp_symbol (18)
+# define QCcategory builtin_lisp_symbol (19)
+# define QCcipher_aead_capable builtin_lisp_symbol (20)
+# define QCcipher_blocksize builtin_lisp_symbol (21)
+# define QCcipher_id builtin_lisp_symbol (22)
+# define QCcipher_ivsize builtin_lisp_symbol (23)
+# define QCcipher_keysize builtin_lisp_symbol (24)
+# define QCcipher_tagsize builtin_lisp_symbol (25)
+# define QCcoding builtin_lisp_symbol (26)
+# define QCcolor builtin_lisp_symbol (27)
+# define QCcombining_capability builtin_lisp_symbol (28)
+# define QCcommand builtin_lisp_symbol (29)
+# define QCcomplete_negotiation builtin_lisp_symbol (30)
+# define QCconnection_type builtin_lisp_symbol (31)
+# define QCcrlfiles builtin_lisp_symbol (32)
+# define QCdata builtin_lisp_symbol (33)
+# define QCdebug_on_exit builtin_lisp_symbol (34)
+# define QCdecode_translation_table builtin_lisp_symbol (35)
+# define QCdefault_char builtin_lisp_symbol (36)
+# define QCdevice builtin_lisp_symbol (37)
+# define QCdigest_algorithm_id builtin_lisp_symbol (38)
+# define QCdigest_algorithm_length builtin_lisp_symbol (39)
+# define QCdistant_foreground builtin_lisp_symbol (40)
+# define QCdocumentation builtin_lisp_symbol (41)
+# define QCdpi builtin_lisp_symbol (42)
+# define QCenable builtin_lisp_symbol (43)
+# define QCencode_translation_table builtin_lisp_symbol (44)
+# define QCeval builtin_lisp_symbol (45)
+# define QCextend builtin_lisp_symbol (46)
+# define QCfalse builtin_lisp_symbol (47)
+# define QCfalse_object builtin_lisp_symbol (48)
+# define QCfamily builtin_lisp_symbol (49)
+# define QCfile builtin_lisp_symbol (50)
+# define QCfile_handler builtin_lisp_symbol (51)
+# define QCfilter builtin_lisp_symbol (52)
+# define QCfiltered builtin_lisp_symbol (53)
+# define QCflags builtin_lisp_symbol (54)
+# define QCflowcontrol builtin_lisp_symbol (55)
+# define QCfont builtin_lisp_symbol (56)
+# define QCfont_entity builtin_lisp_symbol (57)
+# define QCfontset builtin_lisp_symbol (58)
+# define QCforeground builtin_lisp_symbol (59)
+# define QCfoundry builtin_lisp_symbol (60)
+# define QCheight builtin_lisp_symbol (61)
+# define QChelp builtin_lisp_symbol (62)
+# define QChost builtin_lisp_symbol (63)
+# define QChostname builtin_lisp_symbol (64)
+# define QCignore_defface builtin_lisp_symbol (65)
+# define QCimage builtin_lisp_symbol (66)
+# define QCin_place builtin_lisp_symbol (67)
+# define QCinherit builtin_lisp_symbol (68)
+# define QCinverse_video builtin_lisp_symbol (69)
+# define QCitalic builtin_lisp_symbol (70)
+# define QCkey builtin_lisp_symbol (71)
+# define QCkey_sequence builtin_lisp_symbol (72)
+# define QCkeylist builtin_lisp_symbol (73)
+# define QCkeys builtin_lisp_symbol (74)
+# define QClabel builtin_lisp_symbol (75)
+# define QClang builtin_lisp_symbol (76)
+# define QClessp builtin_lisp_symbol (77)
+# define QCline_width builtin_lisp_symbol (78)
+# define QClocal builtin_lisp_symbol (79)
+# define QClog builtin_lisp_symbol (80)
+# define QCloglevel builtin_lisp_symbol (81)
+# define QCmac_algorithm_id builtin_lisp_symbol (82)
+# define QCmac_algorithm_keysize builtin_lisp_symbol (83)
+# define QCmac_algorithm_length builtin_lisp_symbol (84)
+# define QCmac_algorithm_noncesize builtin_lisp_symbol (85)
+# define QCmap builtin_lisp_symbol (86)
+# define QCmin_prime_bits builtin_lisp_symbol (87)
+# define QCmnemonic builtin_lisp_symbol (88)
+# define QCname builtin_lisp_symbol (89)
+# define QCnoquery builtin_lisp_symbol (90)
+# define QCnowait builtin_lisp_symbol (91)
+# define QCnull builtin_lisp_symbol (92)
+# define QCnull_object builtin_lisp_symbol (93)
+# define QCobject_type builtin_lisp_symbol (94)
+# define QCotf builtin_lisp_symbol (95)
+# define QCoverline builtin_lisp_symbol (96)
+# define QCparity builtin_lisp_symbol (97)
+# define QCpass builtin_lisp_symbol (98)
+# define QCplist builtin_lisp_symbol (99)
+# define QCpointer builtin_lisp_symbol (100)
+# define QCport builtin_lisp_symbol (101)
+# define QCposition builtin_lisp_symbol (102)
+# define QCpost_read_conversion builtin_lisp_symbol (103)
+# define QCpre_write_conversion builtin_lisp_symbol (104)
+# define QCpriority builtin_lisp_symbol (105)
+# define QCprocess builtin_lisp_symbol (106)
+# define QCpropertize builtin_lisp_symbol (107)
+# define QCpurecopy builtin_lisp_symbol (108)
+# define QCradio builtin_lisp_symbol (109)
+# define QCrcvbuf builtin_lisp_symbol (110)
+# define QCrcvtimeo builtin_lisp_symbol (111)
+# define QCregistry builtin_lisp_symbol (112)
+# define QCrehash_size builtin_lisp_symbol (113)
+# define QCrehash_threshold builtin_lisp_symbol (114)
+# define QCrelative_height builtin_lisp_symbol (115)
+# define QCrelative_width builtin_lisp_symbol (116)
+# define QCremote builtin_lisp_symbol (117)
+# define QCreverse builtin_lisp_symbol (118)
+# define QCrtl builtin_lisp_symbol (119)
+# define QCscalable builtin_lisp_symbol (120)
+# define QCscript builtin_lisp_symbol (121)
+# define QCsentinel builtin_lisp_symbol (122)
+# define QCserver builtin_lisp_symbol (123)
+# define QCservice builtin_lisp_symbol (124)
+# define QCsize builtin_lisp_symbol (125)
+# define QCslant builtin_lisp_symbol (126)
+# define QCsndbuf builtin_lisp_symbol (127)
+# define QCsndtimeo builtin_lisp_symbol (128)
+# define QCspacing builtin_lisp_symbol (129)
+# define QCspeed builtin_lisp_symbol (130)
+# define QCstderr builtin_lisp_symbol (131)
+# define QCstipple builtin_lisp_symbol (132)
+# define QCstop builtin_lisp_symbol (133)
+# define QCstopbits builtin_lisp_symbol (134)
+# define QCstrike_through builtin_lisp_symbol (135)
+# define QCstyle builtin_lisp_symbol (136)
+# define QCsuccess builtin_lisp_symbol (137)
+# define QCsummary builtin_lisp_symbol (138)
+# define QCtcpnodelay builtin_lisp_symbol (139)
+# define QCtest builtin_lisp_symbol (140)
+# define QCtls_parameters builtin_lisp_symbol (141)
+# define QCtoggle builtin_lisp_symbol (142)
+# define QCtrustfiles builtin_lisp_symbol (143)
+# define QCtype builtin_lisp_symbol (144)
+# define QCunderline builtin_lisp_symbol (145)
+# define QCuse_external_socket builtin_lisp_symbol (146)
+# define QCuser_spec builtin_lisp_symbol (147)
+# define QCverify_error builtin_lisp_symbol (148)
+# define QCverify_flags builtin_lisp_symbol (149)
+# define QCvert_only builtin_lisp_symbol (150)
+# define QCvisible builtin_lisp_symbol (151)
+# define QCvolume builtin_lisp_symbol (152)
+# define QCweakness builtin_lisp_symbol (153)
+# define QCweight builtin_lisp_symbol (154)
+# define QCwidth builtin_lisp_symbol (155)
+# define QCwindow builtin_lisp_symbol (156)
+# define QDiscarded_Samples builtin_lisp_symbol (157)
+# define QL2R builtin_lisp_symbol (158)
+# define QPRIMARY builtin_lisp_symbol (159)
+# define QR2L builtin_lisp_symbol (160)
+# define Q__lambda_fixup builtin_lisp_symbol (161)
+# define Qabove builtin_lisp_symbol (162)
+# define Qabove_handle builtin_lisp_symbol (163)
+# define Qabove_suspended builtin_lisp_symbol (164)
+# define Qaccess_file builtin_lisp_symbol (165)
+# define Qactivate_input_method builtin_lisp_symbol (166)
+# define Qactivate_menubar_hook builtin_lisp_symbol (167)
+# define Qadd1 builtin_lisp_symbol (168)
+# define Qadd_hook builtin_lisp_symbol (169)
+# define Qadd_name_to_file builtin_lisp_symbol (170)
+# define Qadd_to_history builtin_lisp_symbol (171)
+# define Qafter_change_functions builtin_lisp_symbol (172)
+# define Qafter_delete_frame_functions builtin_lisp_symbol (173)
+# define Qafter_handle builtin_lisp_symbol (174)
+# define Qafter_insert_file_set_coding builtin_lisp_symbol (175)
+# define Qafter_pdump_load_hook builtin_lisp_symbol (176)
+# define Qafter_string builtin_lisp_symbol (177)
+# define Qalist builtin_lisp_symbol (178)
+# define Qall builtin_lisp_symbol (179)
+# define Qalpha builtin_lisp_symbol (180)
+# define Qalpha_background builtin_lisp_symbol (181)
+# define Qand_optional builtin_lisp_symbol (182)
+# define Qand_rest builtin_lisp_symbol (183)
+# define Qapply builtin_lisp_symbol (184)
+# define Qaref builtin_lisp_symbol (185)
+# define Qargs builtin_lisp_symbol (186)
+# define Qargs_out_of_range builtin_lisp_symbol (187)
+# define Qarith_error builtin_lisp_symbol (188)
+# define Qarray builtin_lisp_symbol (189)
+# define Qarrayp builtin_lisp_symbol (190)
+# define Qarrow builtin_lisp_symbol (191)
+# define Qascii builtin_lisp_symbol (192)
+# define Qascii_0 builtin_lisp_symbol (193)
+# define Qascii_character builtin_lisp_symbol (194)
+# define Qaset builtin_lisp_symbol (195)
+# define Qassq_delete_all builtin_lisp_symbol (196)
+# define Qassume builtin_lisp_symbol (197)
+# define Qauto_composed builtin_lisp_symbol (198)
+# define Qauto_fill_chars builtin_lisp_symbol (199)
+# define Qauto_hscroll_mode builtin_lisp_symbol (200)
+# define Qauto_lower builtin_lisp_symbol (201)
+# define Qauto_raise builtin_lisp_symbol (202)
+# define Qauto_save_coding builtin_lisp_symbol (203)
+# define Qautoload builtin_lisp_symbol (204)
+# define Qautosaved builtin_lisp_symbol (205)
+# define Qbackground_color builtin_lisp_symbol (206)
+# define Qbackground_mode builtin_lisp_symbol (207)
+# define Qbackquote builtin_lisp_symbol (208)
+# define Qbar builtin_lisp_symbol (209)
+# define Qbefore_change_functions builtin_lisp_symbol (210)
+# define Qbefore_handle builtin_lisp_symbol (211)
+# define Qbefore_revert_hook builtin_lisp_symbol (212)
+# define Qbefore_string builtin_lisp_symbol (213)
+# define Qbeginning_of_buffer builtin_lisp_symbol (214)
+# define Qbelow builtin_lisp_symbol (215)
+# define Qbelow_handle builtin_lisp_symbol (216)
+# define Qbidi_class builtin_lisp_symbol (217)
+# define Qbig builtin_lisp_symbol (218)
+# define Qbig5 builtin_lisp_symbol (219)
+# define Qbignum builtin_lisp_symbol (220)
+# define Qbitmap_spec_p builtin_lisp_symbol (221)
+# define Qblack builtin_lisp_symbol (222)
+# define Qbold builtin_lisp_symbol (223)
+# define Qbook builtin_lisp_symbol (224)
+# define Qbool_vector builtin_lisp_symbol (225)
+# define Qbool_vector_p builtin_lisp_symbol (226)
+# define Qboolean builtin_lisp_symbol (227)
+# define Qbooleanp builtin_lisp_symbol (228)
+# define Qborder builtin_lisp_symbol (229)
+# define Qborder_color builtin_lisp_symbol (230)
+# define Qborder_width builtin_lisp_symbol (231)
+# define Qboth builtin_lisp_symbol (232)
+# define Qboth_horiz builtin_lisp_symbol (233)
+# define Qbottom builtin_lisp_symbol (234)
+# define Qbottom_divider builtin_lisp_symbol (235)
+# define Qbottom_divider_width builtin_lisp_symbol (236)
+# define Qbottom_edge builtin_lisp_symbol (237)
+# define Qbottom_left_corner builtin_lisp_symbol (238)
+# define Qbottom_right_corner builtin_lisp_symbol (239)
+# define Qboundary builtin_lisp_symbol (240)
+# define Qbounds builtin_lisp_symbol (241)
+# define Qbox builtin_lisp_symbol (242)
+# define Qbracket_type builtin_lisp_symbol (243)
+# define Qbuffer builtin_lisp_symbol (244)
+# define Qbuffer_access_fontify_functions builtin_lisp_symbol (245)
+# define Qbuffer_file_coding_system builtin_lisp_symbol (246)
+# define Qbuffer_list builtin_lisp_symbol (247)
+# define Qbuffer_list_update_hook builtin_lisp_symbol (248)
+# define Qbuffer_name_history builtin_lisp_symbol (249)
+# define Qbuffer_or_string_p builtin_lisp_symbol (250)
+# define Qbuffer_position builtin_lisp_symbol (251)
+# define Qbuffer_predicate builtin_lisp_symbol (252)
+# define Qbuffer_read_only builtin_lisp_symbol (253)
+# define Qbuffer_stale_function builtin_lisp_symbol (254)
+# define Qbufferp builtin_lisp_symbol (255)
+# define Qbuffers builtin_lisp_symbol (256)
+# define Qburied_buffer_list builtin_lisp_symbol (257)
+# define Qbyte_code_function builtin_lisp_symbol (258)
+# define Qbyte_code_function_p builtin_lisp_symbol (259)
+# define Qbyte_code_meter builtin_lisp_symbol (260)
+# define Qc builtin_lisp_symbol (261)
+# define Qcall builtin_lisp_symbol (262)
+# define Qcall_process builtin_lisp_symbol (263)
+# define Qcall_process_region builtin_lisp_symbol (264)
+# define Qcallref builtin_lisp_symbol (265)
+# define Qcanonical_combining_class builtin_lisp_symbol (266)
+# define Qcar builtin_lisp_symbol (267)
+# define Qcar_less_than_car builtin_lisp_symbol (268)
+# define Qcase_fold_search builtin_lisp_symbol (269)
+# define Qcase_symbols_as_words builtin_lisp_symbol (270)
+# define Qcase_table builtin_lisp_symbol (271)
+# define Qcase_table_p builtin_lisp_symbol (272)
+# define Qcatcher builtin_lisp_symbol (273)
+# define Qcategory builtin_lisp_symbol (274)
+# define Qcategory_table builtin_lisp_symbol (275)
+# define Qcategory_table_p builtin_lisp_symbol (276)
+# define Qcategoryp builtin_lisp_symbol (277)
+# define Qcategorysetp builtin_lisp_symbol (278)
+# define Qccl builtin_lisp_symbol (279)
+# define Qccl_program_idx builtin_lisp_symbol (280)
+# define Qcclp builtin_lisp_symbol (281)
+# define Qcdr builtin_lisp_symbol (282)
+# define Qceiling builtin_lisp_symbol (283)
+# define Qcenter builtin_lisp_symbol (284)
+# define Qchange_frame_size builtin_lisp_symbol (285)
+# define Qchange_major_mode_hook builtin_lisp_symbol (286)
+# define Qchar_code_property_table builtin_lisp_symbol (287)
+# define Qchar_from_name builtin_lisp_symbol (288)
+# define Qchar_or_string_p builtin_lisp_symbol (289)
+# define Qchar_script_table builtin_lisp_symbol (290)
+# define Qchar_table builtin_lisp_symbol (291)
+# define Qchar_table_extra_slots builtin_lisp_symbol (292)
+# define Qchar_table_p builtin_lisp_symbol (293)
+# define Qcharacterp builtin_lisp_symbol (294)
+# define Qcharset builtin_lisp_symbol (295)
+# define Qcharsetp builtin_lisp_symbol (296)
+# define Qchild_frame_border builtin_lisp_symbol (297)
+# define Qchild_frame_border_width builtin_lisp_symbol (298)
+# define Qchoice builtin_lisp_symbol (299)
+# define Qcircle builtin_lisp_symbol (300)
+# define Qcircular_list builtin_lisp_symbol (301)
+# define Qclone_indirect_buffer_hook builtin_lisp_symbol (302)
+# define Qclone_of builtin_lisp_symbol (303)
+# define Qclose_tab builtin_lisp_symbol (304)
+# define Qclosed builtin_lisp_symbol (305)
+# define Qcmajflt builtin_lisp_symbol (306)
+# define Qcminflt builtin_lisp_symbol (307)
+# define Qcode_conversion_map builtin_lisp_symbol (308)
+# define Qcode_conversion_map_id builtin_lisp_symbol (309)
+# define Qcodeset builtin_lisp_symbol (310)
+# define Qcoding builtin_lisp_symbol (311)
+# define Qcoding_system_define_form builtin_lisp_symbol (312)
+# define Qcoding_system_error builtin_lisp_symbol (313)
+# define Qcoding_system_history builtin_lisp_symbol (314)
+# define Qcoding_system_p builtin_lisp_symbol (315)
+# define Qcolumns builtin_lisp_symbol (316)
+# define Qcomm builtin_lisp_symbol (317)
+# define Qcomma builtin_lisp_symbol (318)
+# define Qcomma_at builtin_lisp_symbol (319)
+# define Qcommand_debug_status builtin_lisp_symbol (320)
+# define Qcommand_execute builtin_lisp_symbol (321)
+# define Qcommand_modes builtin_lisp_symbol (322)
+# define Qcommandp builtin_lisp_symbol (323)
+# define Qcomment builtin_lisp_symbol (324)
+# define Qcomment_end_can_be_escaped builtin_lisp_symbol (325)
+# define Qcomp_libgccjit_reproducer builtin_lisp_symbol (326)
+# define Qcomp_maybe_gc_or_quit builtin_lisp_symbol (327)
+# define Qcomp_mvar builtin_lisp_symbol (328)
+# define Qcomp_sanitizer_error builtin_lisp_symbol (329)
+# define Qcomp_subr_trampoline_install builtin_lisp_symbol (330)
+# define Qcomp_trampoline_dir builtin_lisp_symbol (331)
+# define Qcompletion_ignore_case builtin_lisp_symbol (332)
+# define Qcomposition builtin_lisp_symbol (333)
+# define Qcond_jump builtin_lisp_symbol (334)
+# define Qcond_jump_narg_leq builtin_lisp_symbol (335)
+# define Qcondition_case builtin_lisp_symbol (336)
+# define Qcondition_variable builtin_lisp_symbol (337)
+# define Qcondition_variable_p builtin_lisp_symbol (338)
+# define Qconfig_changed_event builtin_lisp_symbol (339)
+# define Qconfiguration builtin_lisp_symbol (340)
+# define Qconnect builtin_lisp_symbol (341)
+# define Qcons builtin_lisp_symbol (342)
+# define Qconses builtin_lisp_symbol (343)
+# define Qconsp builtin_lisp_symbol (344)
+# define Qcopy_directory builtin_lisp_symbol (345)
+# define Qcopy_file builtin_lisp_symbol (346)
+# define Qcstime builtin_lisp_symbol (347)
+# define Qctime builtin_lisp_symbol (348)
+# define Qcurrent builtin_lisp_symbol (349)
+# define Qcurrent_input_method builtin_lisp_symbol (350)
+# define Qcurrent_line builtin_lisp_symbol (351)
+# define Qcurrent_load_list builtin_lisp_symbol (352)
+# define Qcurrent_minibuffer_command builtin_lisp_symbol (353)
+# define Qcursor builtin_lisp_symbol (354)
+# define Qcursor_color builtin_lisp_symbol (355)
+# define Qcursor_in_echo_area builtin_lisp_symbol (356)
+# define Qcursor_type builtin_lisp_symbol (357)
+# define Qcurve builtin_lisp_symbol (358)
+# define Qcustom_variable_history builtin_lisp_symbol (359)
+# define Qcustom_variable_p builtin_lisp_symbol (360)
+# define Qcutime builtin_lisp_symbol (361)
+# define Qcycle_sort_function builtin_lisp_symbol (362)
+# define Qcyclic_function_indirection builtin_lisp_symbol (363)
+# define Qcyclic_variable_indirection builtin_lisp_symbol (364)
+# define Qd builtin_lisp_symbol (365)
+# define Qd_default builtin_lisp_symbol (366)
+# define Qd_ephemeral builtin_lisp_symbol (367)
+# define Qdashes builtin_lisp_symbol (368)
+# define Qdata builtin_lisp_symbol (369)
+# define Qdatagram builtin_lisp_symbol (370)
+# define Qdays builtin_lisp_symbol (371)
+# define Qdbus_event builtin_lisp_symbol (372)
+# define Qdeactivate_mark builtin_lisp_symbol (373)
+# define Qdebug builtin_lisp_symbol (374)
+# define Qdebug_early builtin_lisp_symbol (375)
+# define Qdebugger builtin_lisp_symbol (376)
+# define Qdecomposed_characters builtin_lisp_symbol (377)
+# define Qdedicated builtin_lisp_symbol (378)
+# define Qdefalias_fset_function builtin_lisp_symbol (379)
+# define Qdefault builtin_lisp_symbol (380)
+# define Qdefault_directory builtin_lisp_symbol (381)
+# define Qdefun builtin_lisp_symbol (382)
+# define Qdefvaralias builtin_lisp_symbol (383)
+# define Qdelayed_warnings_hook builtin_lisp_symbol (384)
+# define Qdelete builtin_lisp_symbol (385)
+# define Qdelete_all_mode_overlays builtin_lisp_symbol (386)
+# define Qdelete_before builtin_lisp_symbol (387)
+# define Qdelete_by_moving_to_trash builtin_lisp_symbol (388)
+# define Qdelete_char builtin_lisp_symbol (389)
+# define Qdelete_directory builtin_lisp_symbol (390)
+# define Qdelete_file builtin_lisp_symbol (391)
+# define Qdelete_file_internal builtin_lisp_symbol (392)
+# define Qdelete_frame builtin_lisp_symbol (393)
+# define Qdelete_frame_functions builtin_lisp_symbol (394)
+# define Qdelete_terminal_functions builtin_lisp_symbol (395)
+# define Qdelete_window builtin_lisp_symbol (396)
+# define Qdir_ok builtin_lisp_symbol (397)
+# define Qdirect_call builtin_lisp_symbol (398)
+# define Qdirect_callref builtin_lisp_symbol (399)
+# define Qdirectory_file_name builtin_lisp_symbol (400)
+# define Qdirectory_files builtin_lisp_symbol (401)
+# define Qdirectory_files_and_attributes builtin_lisp_symbol (402)
+# define Qdisable_eval builtin_lisp_symbol (403)
+# define Qdisabled builtin_lisp_symbol (404)
+# define Qdisplay builtin_lisp_symbol (405)
+# define Qdisplay_buffer builtin_lisp_symbol (406)
+# define Qdisplay_fill_column_indicator builtin_lisp_symbol (407)
+# define Qdisplay_fill_column_indicator_character builtin_lisp_symbol (408)
+# define Qdisplay_fill_column_indicator_column builtin_lisp_symbol (409)
+# define Qdisplay_line_numbers builtin_lisp_symbol (410)
+# define Qdisplay_line_numbers_disable builtin_lisp_symbol (411)
+# define Qdisplay_line_numbers_offset builtin_lisp_symbol (412)
+# define Qdisplay_line_numbers_widen builtin_lisp_symbol (413)
+# define Qdisplay_line_numbers_width builtin_lisp_symbol (414)
+# define Qdisplay_monitors_changed_functions builtin_lisp_symbol (415)
+# define Qdisplay_table builtin_lisp_symbol (416)
+# define Qdisplay_type builtin_lisp_symbol (417)
+# define Qdo_after_load_evaluation builtin_lisp_symbol (418)
+# define Qdomain_error builtin_lisp_symbol (419)
+# define Qdos builtin_lisp_symbol (420)
+# define Qdots builtin_lisp_symbol (421)
+# define Qdouble_line builtin_lisp_symbol (422)
+# define Qdown builtin_lisp_symbol (423)
+# define Qdrag_internal_border builtin_lisp_symbol (424)
+# define Qdrag_n_drop builtin_lisp_symbol (425)
+# define Qdrag_source builtin_lisp_symbol (426)
+# define Qdrag_with_header_line builtin_lisp_symbol (427)
+# define Qdrag_with_mode_line builtin_lisp_symbol (428)
+# define Qdrag_with_tab_line builtin_lisp_symbol (429)
+# define Qdragging builtin_lisp_symbol (430)
+# define Qdropping builtin_lisp_symbol (431)
+# define Qdump_emacs_portable__sort_predicate builtin_lisp_symbol (432)
+# define Qdump_emacs_portable__sort_predicate_copied builtin_lisp_symbol (433)
+# define Qdump_file_name builtin_lisp_symbol (434)
+# define Qdumped_with_pdumper builtin_lisp_symbol (435)
+# define Qecho_area_clear_hook builtin_lisp_symbol (436)
+# define Qecho_keystrokes builtin_lisp_symbol (437)
+# define Qegid builtin_lisp_symbol (438)
+# define Qeight_bit builtin_lisp_symbol (439)
+# define Qelt builtin_lisp_symbol (440)
+# define Qemacs builtin_lisp_symbol (441)
+# define Qemacs_mule builtin_lisp_symbol (442)
+# define Qemoji builtin_lisp_symbol (443)
+# define Qempty_box builtin_lisp_symbol (444)
+# define Qenable_recursive_minibuffers builtin_lisp_symbol (445)
+# define Qencode_time builtin_lisp_symbol (446)
+# define Qencoded builtin_lisp_symbol (447)
+# define Qend_of_buffer builtin_lisp_symbol (448)
+# define Qend_of_file builtin_lisp_symbol (449)
+# define Qend_scroll builtin_lisp_symbol (450)
+# define Qend_session builtin_lisp_symbol (451)
+# define Qentry builtin_lisp_symbol (452)
+# define Qeq builtin_lisp_symbol (453)
+# define Qeql builtin_lisp_symbol (454)
+# define Qequal builtin_lisp_symbol (455)
+# define Qerror_conditions builtin_lisp_symbol (456)
+# define Qerror_message builtin_lisp_symbol (457)
+# define Qescape_glyph builtin_lisp_symbol (458)
+# define Qetime builtin_lisp_symbol (459)
+# define Qeuid builtin_lisp_symbol (460)
+# define Qeval builtin_lisp_symbol (461)
+# define Qeval_buffer_list builtin_lisp_symbol (462)
+# define Qevaporate builtin_lisp_symbol (463)
+# define Qeven builtin_lisp_symbol (464)
+# define Qevent_kind builtin_lisp_symbol (465)
+# define Qevent_symbol_element_mask builtin_lisp_symbol (466)
+# define Qevent_symbol_elements builtin_lisp_symbol (467)
+# define Qevictions builtin_lisp_symbol (468)
+# define Qexcessive_lisp_nesting builtin_lisp_symbol (469)
+# define Qexcessive_variable_binding builtin_lisp_symbol (470)
+# define Qexcl builtin_lisp_symbol (471)
+# define Qexit builtin_lisp_symbol (472)
+# define Qexpand_abbrev builtin_lisp_symbol (473)
+# define Qexpand_file_name builtin_lisp_symbol (474)
+# define Qexplicit_name builtin_lisp_symbol (475)
+# define Qexternal_border_size builtin_lisp_symbol (476)
+# define Qexternal_debugging_output builtin_lisp_symbol (477)
+# define Qextra_bold builtin_lisp_symbol (478)
+# define Qextra_light builtin_lisp_symbol (479)
+# define Qface builtin_lisp_symbol (480)
+# define Qface_alias builtin_lisp_symbol (481)
+# define Qface_no_inherit builtin_lisp_symbol (482)
+# define Qface_remapping_alist builtin_lisp_symbol (483)
+# define Qface_set_after_frame_default builtin_lisp_symbol (484)
+# define Qfailed builtin_lisp_symbol (485)
+# define Qfboundp builtin_lisp_symbol (486)
+# define Qfeatures builtin_lisp_symbol (487)
+# define Qfetch_exception builtin_lisp_symbol (488)
+# define Qfield builtin_lisp_symbol (489)
+# define Qfile_accessible_directory_p builtin_lisp_symbol (490)
+# define Qfile_acl builtin_lisp_symbol (491)
+# define Qfile_already_exists builtin_lisp_symbol (492)
+# define Qfile_attributes builtin_lisp_symbol (493)
+# define Qfile_attributes_lessp builtin_lisp_symbol (494)
+# define Qfile_date_error builtin_lisp_symbol (495)
+# define Qfile_directory_p builtin_lisp_symbol (496)
+# define Qfile_error builtin_lisp_symbol (497)
+# define Qfile_executable_p builtin_lisp_symbol (498)
+# define Qfile_exists_p builtin_lisp_symbol (499)
+# define Qfile_locked_p builtin_lisp_symbol (500)
+# define Qfile_missing builtin_lisp_symbol (501)
+# define Qfile_modes builtin_lisp_symbol (502)
+# define Qfile_name_all_completions builtin_lisp_symbol (503)
+# define Qfile_name_as_directory builtin_lisp_symbol (504)
+# define Qfile_name_case_insensitive_p builtin_lisp_symbol (505)
+# define Qfile_name_completion builtin_lisp_symbol (506)
+# define Qfile_name_directory builtin_lisp_symbol (507)
+# define Qfile_name_handler_alist builtin_lisp_symbol (508)
+# define Qfile_name_history builtin_lisp_symbol (509)
+# define Qfile_name_nondirectory builtin_lisp_symbol (510)
+# define Qfile_newer_than_file_p builtin_lisp_symbol (511)
+# define Qfile_notify builtin_lisp_symbol (512)
+# define Qfile_notify_error builtin_lisp_symbol (513)
+# define Qfile_offset builtin_lisp_symbol (514)
+# define Qfile_readable_p builtin_lisp_symbol (515)
+# define Qfile_regular_p builtin_lisp_symbol (516)
+# define Qfile_selinux_context builtin_lisp_symbol (517)
+# define Qfile_symlink_p builtin_lisp_symbol (518)
+# define Qfile_system_info builtin_lisp_symbol (519)
+# define Qfile_writable_p builtin_lisp_symbol (520)
+# define Qfilenamep builtin_lisp_symbol (521)
+# define Qfill_column_indicator builtin_lisp_symbol (522)
+# define Qfinalizer builtin_lisp_symbol (523)
+# define Qfind_file_literally_line_length builtin_lisp_symbol (524)
+# define Qfirst_change_hook builtin_lisp_symbol (525)
+# define Qfixnum builtin_lisp_symbol (526)
+# define Qfixnump builtin_lisp_symbol (527)
+# define Qflat_button builtin_lisp_symbol (528)
+# define Qfloat builtin_lisp_symbol (529)
+# define Qfloat_output_format builtin_lisp_symbol (530)
+# define Qfloatp builtin_lisp_symbol (531)
+# define Qfloats builtin_lisp_symbol (532)
+# define Qfloor builtin_lisp_symbol (533)
+# define Qfocus_in builtin_lisp_symbol (534)
+# define Qfocus_out builtin_lisp_symbol (535)
+# define Qfont builtin_lisp_symbol (536)
+# define Qfont_backend builtin_lisp_symbol (537)
+# define Qfont_driver_superseded_by builtin_lisp_symbol (538)
+# define Qfont_entity builtin_lisp_symbol (539)
+# define Qfont_extra_type builtin_lisp_symbol (540)
+# define Qfont_lock_dont_widen builtin_lisp_symbol (541)
+# define Qfont_lock_extra_managed_props builtin_lisp_symbol (542)
+# define Qfont_lock_face builtin_lisp_symbol (543)
+# define Qfont_lock_fontify_region builtin_lisp_symbol (544)
+# define Qfont_object builtin_lisp_symbol (545)
+# define Qfont_spec builtin_lisp_symbol (546)
+# define Qfontification_functions builtin_lisp_symbol (547)
+# define Qfontified builtin_lisp_symbol (548)
+# define Qforeground_color builtin_lisp_symbol (549)
+# define Qformat_annotate_function builtin_lisp_symbol (550)
+# define Qformat_decode builtin_lisp_symbol (551)
+# define Qfraction builtin_lisp_symbol (552)
+# define Qframe builtin_lisp_symbol (553)
+# define Qframe_edges builtin_lisp_symbol (554)
+# define Qframe_live_p builtin_lisp_symbol (555)
+# define Qframe_monitor_attributes builtin_lisp_symbol (556)
+# define Qframe_set_background_mode builtin_lisp_symbol (557)
+# define Qframe_windows_min_size builtin_lisp_symbol (558)
+# define Qframep builtin_lisp_symbol (559)
+# define Qframes builtin_lisp_symbol (560)
+# define Qfringe builtin_lisp_symbol (561)
+# define Qfrom__tty_menu_p builtin_lisp_symbol (562)
+# define Qfront_sticky builtin_lisp_symbol (563)
+# define Qfullboth builtin_lisp_symbol (564)
+# define Qfullheight builtin_lisp_symbol (565)
+# define Qfullscreen builtin_lisp_symbol (566)
+# define Qfullwidth builtin_lisp_symbol (567)
+# define Qfuncall builtin_lisp_symbol (568)
+# define Qfuncall_interactively builtin_lisp_symbol (569)
+# define Qfunction builtin_lisp_symbol (570)
+# define Qfunction_documentation builtin_lisp_symbol (571)
+# define Qfunction_history builtin_lisp_symbol (572)
+# define Qfunction_key builtin_lisp_symbol (573)
+# define Qfunctionp builtin_lisp_symbol (574)
+# define Qfundamental_mode builtin_lisp_symbol (575)
+# define Qgc_cons_percentage builtin_lisp_symbol (576)
+# define Qgc_cons_threshold builtin_lisp_symbol (577)
+# define Qgccjit builtin_lisp_symbol (578)
+# define Qgeometry builtin_lisp_symbol (579)
+# define Qget_buffer_window_list builtin_lisp_symbol (580)
+# define Qget_emacs_mule_file_char builtin_lisp_symbol (581)
+# define Qget_file_buffer builtin_lisp_symbol (582)
+# define Qget_file_char builtin_lisp_symbol (583)
+# define Qget_mru_window builtin_lisp_symbol (584)
+# define Qget_scratch_buffer_create builtin_lisp_symbol (585)
+# define Qglobal_mark_ring builtin_lisp_symbol (586)
+# define Qglobal_mark_ring_max builtin_lisp_symbol (587)
+# define Qglyphless_char builtin_lisp_symbol (588)
+# define Qglyphless_char_display builtin_lisp_symbol (589)
+# define Qgnutls_anon builtin_lisp_symbol (590)
+# define Qgnutls_code builtin_lisp_symbol (591)
+# define Qgnutls_e_again builtin_lisp_symbol (592)
+# define Qgnutls_e_interrupted builtin_lisp_symbol (593)
+# define Qgnutls_e_invalid_session builtin_lisp_symbol (594)
+# define Qgnutls_e_not_ready_for_handshake builtin_lisp_symbol (595)
+# define Qgnutls_pkcs_null_password builtin_lisp_symbol (596)
+# define Qgnutls_pkcs_pbes1_des_md5 builtin_lisp_symbol (597)
+# define Qgnutls_pkcs_pbes2_3des builtin_lisp_symbol (598)
+# define Qgnutls_pkcs_pbes2_aes_128 builtin_lisp_symbol (599)
+# define Qgnutls_pkcs_pbes2_aes_192 builtin_lisp_symbol (600)
+# define Qgnutls_pkcs_pbes2_aes_256 builtin_lisp_symbol (601)
+# define Qgnutls_pkcs_pbes2_des builtin_lisp_symbol (602)
+# define Qgnutls_pkcs_pbes2_gost_cpa builtin_lisp_symbol (603)
+# define Qgnutls_pkcs_pbes2_gost_cpb builtin_lisp_symbol (604)
+# define Qgnutls_pkcs_pbes2_gost_cpc builtin_lisp_symbol (605)
+# define Qgnutls_pkcs_pbes2_gost_cpd builtin_lisp_symbol (606)
+# define Qgnutls_pkcs_pbes2_gost_tc26z builtin_lisp_symbol (607)
+# define Qgnutls_pkcs_pkcs12_3des builtin_lisp_symbol (608)
+# define Qgnutls_pkcs_pkcs12_arcfour builtin_lisp_symbol (609)
+# define Qgnutls_pkcs_pkcs12_rc2_40 builtin_lisp_symbol (610)
+# define Qgnutls_pkcs_plain builtin_lisp_symbol (611)
+# define Qgnutls_type_cipher builtin_lisp_symbol (612)
+# define Qgnutls_type_digest_algorithm builtin_lisp_symbol (613)
+# define Qgnutls_type_mac_algorithm builtin_lisp_symbol (614)
+# define Qgnutls_x509pki builtin_lisp_symbol (615)
+# define Qgrave builtin_lisp_symbol (616)
+# define Qgroup builtin_lisp_symbol (617)
+# define Qgrow_only builtin_lisp_symbol (618)
+# define Qgui_figure_window_size builtin_lisp_symbol (619)
+# define Qgui_set_selection builtin_lisp_symbol (620)
+# define Qhaiku builtin_lisp_symbol (621)
+# define Qhand builtin_lisp_symbol (622)
+# define Qhandle builtin_lisp_symbol (623)
+# define Qhandle_select_window builtin_lisp_symbol (624)
+# define Qhandle_shift_selection builtin_lisp_symbol (625)
+# define Qhandle_switch_frame builtin_lisp_symbol (626)
+# define Qhash_table builtin_lisp_symbol (627)
+# define Qhash_table_p builtin_lisp_symbol (628)
+# define Qhash_table_test builtin_lisp_symbol (629)
+# define Qhbar builtin_lisp_symbol (630)
+# define Qheader_line builtin_lisp_symbol (631)
+# define Qheader_line_format builtin_lisp_symbol (632)
+# define Qheap builtin_lisp_symbol (633)
+# define Qheavy builtin_lisp_symbol (634)
+# define Qheight builtin_lisp_symbol (635)
+# define Qheight_only builtin_lisp_symbol (636)
+# define Qhelp__append_keystrokes_help builtin_lisp_symbol (637)
+# define Qhelp__describe_map_tree builtin_lisp_symbol (638)
+# define Qhelp_echo builtin_lisp_symbol (639)
+# define Qhelp_echo_inhibit_substitution builtin_lisp_symbol (640)
+# define Qhelp_form_show builtin_lisp_symbol (641)
+# define Qhelp_key_binding builtin_lisp_symbol (642)
+# define Qhelper_sanitizer_assert builtin_lisp_symbol (643)
+# define Qhelper_save_restriction builtin_lisp_symbol (644)
+# define Qhelper_unbind_n builtin_lisp_symbol (645)
+# define Qhelper_unwind_protect builtin_lisp_symbol (646)
+# define Qhex_code builtin_lisp_symbol (647)
+# define Qhide builtin_lisp_symbol (648)
+# define Qhits builtin_lisp_symbol (649)
+# define Qhl_line_sticky_flag builtin_lisp_symbol (650)
+# define Qhl_line_unhighlight builtin_lisp_symbol (651)
+# define Qhollow builtin_lisp_symbol (652)
+# define Qhorizontal_handle builtin_lisp_symbol (653)
+# define Qhorizontal_scroll_bar builtin_lisp_symbol (654)
+# define Qhorizontal_scroll_bars builtin_lisp_symbol (655)
+# define Qhw builtin_lisp_symbol (656)
+# define Qicon builtin_lisp_symbol (657)
+# define Qicon_left builtin_lisp_symbol (658)
+# define Qicon_name builtin_lisp_symbol (659)
+# define Qicon_top builtin_lisp_symbol (660)
+# define Qicon_type builtin_lisp_symbol (661)
+# define Qiconify_frame builtin_lisp_symbol (662)
+# define Qiconify_top_level builtin_lisp_symbol (663)
+# define Qidentity builtin_lisp_symbol (664)
+# define Qif builtin_lisp_symbol (665)
+# define Qif_regular builtin_lisp_symbol (666)
+# define Qignore builtin_lisp_symbol (667)
+# define Qignore_self_insert builtin_lisp_symbol (668)
+# define Qignored builtin_lisp_symbol (669)
+# define Qimage builtin_lisp_symbol (670)
+# define Qinc_args builtin_lisp_symbol (671)
+# define Qinhibit_changing_match_data builtin_lisp_symbol (672)
+# define Qinhibit_debugger builtin_lisp_symbol (673)
+# define Qinhibit_double_buffering builtin_lisp_symbol (674)
+# define Qinhibit_eval_during_redisplay builtin_lisp_symbol (675)
+# define Qinhibit_file_name_operation builtin_lisp_symbol (676)
+# define Qinhibit_free_realized_faces builtin_lisp_symbol (677)
+# define Qinhibit_menubar_update builtin_lisp_symbol (678)
+# define Qinhibit_modification_hooks builtin_lisp_symbol (679)
+# define Qinhibit_point_motion_hooks builtin_lisp_symbol (680)
+# define Qinhibit_quit builtin_lisp_symbol (681)
+# define Qinhibit_read_only builtin_lisp_symbol (682)
+# define Qinhibit_redisplay builtin_lisp_symbol (683)
+# define Qinhibited_interaction builtin_lisp_symbol (684)
+# define Qinner_edges builtin_lisp_symbol (685)
+# define Qinput_method_exit_on_first_char builtin_lisp_symbol (686)
+# define Qinput_method_use_echo_area builtin_lisp_symbol (687)
+# define Qinsdel builtin_lisp_symbol (688)
+# define Qinsert_behind_hooks builtin_lisp_symbol (689)
+# define Qinsert_file_contents builtin_lisp_symbol (690)
+# define Qinsert_in_front_hooks builtin_lisp_symbol (691)
+# define Qinserted_chars builtin_lisp_symbol (692)
+# define Qinsufficient_source builtin_lisp_symbol (693)
+# define Qintangible builtin_lisp_symbol (694)
+# define Qinteger builtin_lisp_symbol (695)
+# define Qinteger_or_marker_p builtin_lisp_symbol (696)
+# define Qintegerp builtin_lisp_symbol (697)
+# define Qinteractive builtin_lisp_symbol (698)
+# define Qinteractive_args builtin_lisp_symbol (699)
+# define Qinteractive_form builtin_lisp_symbol (700)
+# define Qinteractive_p builtin_lisp_symbol (701)
+# define Qinternal__syntax_propertize builtin_lisp_symbol (702)
+# define Qinternal_auto_fill builtin_lisp_symbol (703)
+# define Qinternal_border builtin_lisp_symbol (704)
+# define Qinternal_border_width builtin_lisp_symbol (705)
+# define Qinternal_default_interrupt_process builtin_lisp_symbol (706)
+# define Qinternal_default_process_filter builtin_lisp_symbol (707)
+# define Qinternal_default_process_sentinel builtin_lisp_symbol (708)
+# define Qinternal_default_signal_process builtin_lisp_symbol (709)
+# define Qinternal_echo_keystrokes_prefix builtin_lisp_symbol (710)
+# define Qinternal_when_entered_debugger builtin_lisp_symbol (711)
+# define Qinterpreted_function builtin_lisp_symbol (712)
+# define Qinterrupt_process_functions builtin_lisp_symbol (713)
+# define Qinterrupted builtin_lisp_symbol (714)
+# define Qintervals builtin_lisp_symbol (715)
+# define Qinvalid_arity builtin_lisp_symbol (716)
+# define Qinvalid_function builtin_lisp_symbol (717)
+# define Qinvalid_read_syntax builtin_lisp_symbol (718)
+# define Qinvalid_regexp builtin_lisp_symbol (719)
+# define Qinvalid_source builtin_lisp_symbol (720)
+# define Qinvisible builtin_lisp_symbol (721)
+# define Qipv4 builtin_lisp_symbol (722)
+# define Qipv6 builtin_lisp_symbol (723)
+# define Qiso10646_1 builtin_lisp_symbol (724)
+# define Qiso8859_1 builtin_lisp_symbol (725)
+# define Qiso_2022 builtin_lisp_symbol (726)
+# define Qiso_8859_1 builtin_lisp_symbol (727)
+# define Qitalic builtin_lisp_symbol (728)
+# define Qiv_auto builtin_lisp_symbol (729)
+# define Qja builtin_lisp_symbol (730)
+# define Qjson_end_of_file builtin_lisp_symbol (731)
+# define Qjson_error builtin_lisp_symbol (732)
+# define Qjson_escape_sequence_error builtin_lisp_symbol (733)
+# define Qjson_invalid_surrogate_error builtin_lisp_symbol (734)
+# define Qjson_number_out_of_range builtin_lisp_symbol (735)
+# define Qjson_object_too_deep builtin_lisp_symbol (736)
+# define Qjson_out_of_memory builtin_lisp_symbol (737)
+# define Qjson_parse_error builtin_lisp_symbol (738)
+# define Qjson_parse_string builtin_lisp_symbol (739)
+# define Qjson_serialize builtin_lisp_symbol (740)
+# define Qjson_stream builtin_lisp_symbol (741)
+# define Qjson_stream_p builtin_lisp_symbol (742)
+# define Qjson_trailing_content builtin_lisp_symbol (743)
+# define Qjson_utf8_decode_error builtin_lisp_symbol (744)
+# define Qjson_value_p builtin_lisp_symbol (745)
+# define Qjump builtin_lisp_symbol (746)
+# define Qkbd_macro_termination_hook builtin_lisp_symbol (747)
+# define Qkeep_ratio builtin_lisp_symbol (748)
+# define Qkey builtin_lisp_symbol (749)
+# define Qkey_and_value builtin_lisp_symbol (750)
+# define Qkey_or_value builtin_lisp_symbol (751)
+# define Qkey_parse builtin_lisp_symbol (752)
+# define Qkey_valid_p builtin_lisp_symbol (753)
+# define Qkeymap builtin_lisp_symbol (754)
+# define Qkeymap_canonicalize builtin_lisp_symbol (755)
+# define Qkeymapp builtin_lisp_symbol (756)
+# define Qkill_buffer__possibly_save builtin_lisp_symbol (757)
+# define Qkill_buffer_hook builtin_lisp_symbol (758)
+# define Qkill_buffer_query_functions builtin_lisp_symbol (759)
+# define Qkill_emacs builtin_lisp_symbol (760)
+# define Qkill_emacs_hook builtin_lisp_symbol (761)
+# define Qkill_forward_chars builtin_lisp_symbol (762)
+# define Qko builtin_lisp_symbol (763)
+# define Qlanguage_change builtin_lisp_symbol (764)
+# define Qlast_arrow_position builtin_lisp_symbol (765)
+# define Qlast_arrow_string builtin_lisp_symbol (766)
+# define Qlast_nonmenu_event builtin_lisp_symbol (767)
+# define Qlast_selected_window builtin_lisp_symbol (768)
+# define Qleft builtin_lisp_symbol (769)
+# define Qleft_edge builtin_lisp_symbol (770)
+# define Qleft_fringe builtin_lisp_symbol (771)
+# define Qleft_fringe_help builtin_lisp_symbol (772)
+# define Qleft_margin builtin_lisp_symbol (773)
+# define Qleft_only builtin_lisp_symbol (774)
+# define Qleft_to_right builtin_lisp_symbol (775)
+# define Qleftmost builtin_lisp_symbol (776)
+# define Qlet builtin_lisp_symbol (777)
+# define Qletx builtin_lisp_symbol (778)
+# define Qlexical_binding builtin_lisp_symbol (779)
+# define Qlight builtin_lisp_symbol (780)
+# define Qline builtin_lisp_symbol (781)
+# define Qline_height builtin_lisp_symbol (782)
+# define Qline_number builtin_lisp_symbol (783)
+# define Qline_number_current_line builtin_lisp_symbol (784)
+# define Qline_number_major_tick builtin_lisp_symbol (785)
+# define Qline_number_minor_tick builtin_lisp_symbol (786)
+# define Qline_prefix builtin_lisp_symbol (787)
+# define Qline_spacing builtin_lisp_symbol (788)
+# define Qlisp_directory builtin_lisp_symbol (789)
+# define Qlist builtin_lisp_symbol (790)
+# define Qlist_or_vector_p builtin_lisp_symbol (791)
+# define Qlist_system_processes builtin_lisp_symbol (792)
+# define Qlisten builtin_lisp_symbol (793)
+# define Qlistp builtin_lisp_symbol (794)
+# define Qlittle builtin_lisp_symbol (795)
+# define Qload builtin_lisp_symbol (796)
+# define Qload_file_name builtin_lisp_symbol (797)
+# define Qload_force_doc_strings builtin_lisp_symbol (798)
+# define Qload_in_progress builtin_lisp_symbol (799)
+# define Qload_time builtin_lisp_symbol (800)
+# define Qlocal builtin_lisp_symbol (801)
+# define Qlocal_map builtin_lisp_symbol (802)
+# define Qlock_file builtin_lisp_symbol (803)
+# define Qlong builtin_lisp_symbol (804)
+# define Qlowercase builtin_lisp_symbol (805)
+# define Qlread_unescaped_character_literals builtin_lisp_symbol (806)
+# define Qm builtin_lisp_symbol (807)
+# define Qmac builtin_lisp_symbol (808)
+# define Qmacro builtin_lisp_symbol (809)
+# define Qmacroexp__dynvars builtin_lisp_symbol (810)
+# define Qmajflt builtin_lisp_symbol (811)
+# define Qmake_directory builtin_lisp_symbol (812)
+# define Qmake_directory_internal builtin_lisp_symbol (813)
+# define Qmake_frame_visible builtin_lisp_symbol (814)
+# define Qmake_invisible builtin_lisp_symbol (815)
+# define Qmake_lock_file_name builtin_lisp_symbol (816)
+# define Qmake_process builtin_lisp_symbol (817)
+# define Qmake_symbolic_link builtin_lisp_symbol (818)
+# define Qmakunbound builtin_lisp_symbol (819)
+# define Qmany builtin_lisp_symbol (820)
+# define Qmargin builtin_lisp_symbol (821)
+# define Qmark_for_redisplay builtin_lisp_symbol (822)
+# define Qmark_inactive builtin_lisp_symbol (823)
+# define Qmarker builtin_lisp_symbol (824)
+# define Qmarkerp builtin_lisp_symbol (825)
+# define Qmaximized builtin_lisp_symbol (826)
+# define Qmd5 builtin_lisp_symbol (827)
+# define Qmedium builtin_lisp_symbol (828)
+# define Qmemory_info builtin_lisp_symbol (829)
+# define Qmenu builtin_lisp_symbol (830)
+# define Qmenu_bar builtin_lisp_symbol (831)
+# define Qmenu_bar_external builtin_lisp_symbol (832)
+# define Qmenu_bar_lines builtin_lisp_symbol (833)
+# define Qmenu_bar_size builtin_lisp_symbol (834)
+# define Qmenu_bar_update_hook builtin_lisp_symbol (835)
+# define Qmenu_enable builtin_lisp_symbol (836)
+# define Qmenu_item builtin_lisp_symbol (837)
+# define Qmessage builtin_lisp_symbol (838)
+# define Qmetadata builtin_lisp_symbol (839)
+# define Qmin_height builtin_lisp_symbol (840)
+# define Qmin_width builtin_lisp_symbol (841)
+# define Qminflt builtin_lisp_symbol (842)
+# define Qminibuffer builtin_lisp_symbol (843)
+# define Qminibuffer_completing_file_name builtin_lisp_symbol (844)
+# define Qminibuffer_completion_table builtin_lisp_symbol (845)
+# define Qminibuffer_default builtin_lisp_symbol (846)
+# define Qminibuffer_exit builtin_lisp_symbol (847)
+# define Qminibuffer_exit_hook builtin_lisp_symbol (848)
+# define Qminibuffer_follows_selected_frame builtin_lisp_symbol (849)
+# define Qminibuffer_history builtin_lisp_symbol (850)
+# define Qminibuffer_inactive_mode builtin_lisp_symbol (851)
+# define Qminibuffer_mode builtin_lisp_symbol (852)
+# define Qminibuffer_prompt builtin_lisp_symbol (853)
+# define Qminibuffer_quit builtin_lisp_symbol (854)
+# define Qminibuffer_setup_hook builtin_lisp_symbol (855)
+# define Qminus builtin_lisp_symbol (856)
+# define Qmirroring builtin_lisp_symbol (857)
+# define Qmisses builtin_lisp_symbol (858)
+# define Qmissing_module_init_function builtin_lisp_symbol (859)
+# define Qmm_size builtin_lisp_symbol (860)
+# define Qmode_class builtin_lisp_symbol (861)
+# define Qmode_line builtin_lisp_symbol (862)
+# define Qmode_line_active builtin_lisp_symbol (863)
+# define Qmode_line_default_help_echo builtin_lisp_symbol (864)
+# define Qmode_line_format builtin_lisp_symbol (865)
+# define Qmode_line_inactive builtin_lisp_symbol (866)
+# define Qmode_overlay builtin_lisp_symbol (867)
+# define Qmode_overlay_face_alist builtin_lisp_symbol (868)
+# define Qmode_overlay_filter_buffer_substring_function builtin_lisp_symbol (869)
+# define Qmode_overlay_on_switch_to_buffer builtin_lisp_symbol (870)
+# define Qmode_overlay_p builtin_lisp_symbol (871)
+# define Qmodeline builtin_lisp_symbol (872)
+# define Qmodification_hooks builtin_lisp_symbol (873)
+# define Qmodifier_cache builtin_lisp_symbol (874)
+# define Qmodule_function builtin_lisp_symbol (875)
+# define Qmodule_function_p builtin_lisp_symbol (876)
+# define Qmodule_init_failed builtin_lisp_symbol (877)
+# define Qmodule_load_failed builtin_lisp_symbol (878)
+# define Qmodule_open_failed builtin_lisp_symbol (879)
+# define Qmonths builtin_lisp_symbol (880)
+# define Qmouse builtin_lisp_symbol (881)
+# define Qmouse_click builtin_lisp_symbol (882)
+# define Qmouse_color builtin_lisp_symbol (883)
+# define Qmouse_face builtin_lisp_symbol (884)
+# define Qmouse_fixup_help_message builtin_lisp_symbol (885)
+# define Qmouse_leave_buffer_hook builtin_lisp_symbol (886)
+# define Qmouse_movement builtin_lisp_symbol (887)
+# define Qmouse_wheel_frame builtin_lisp_symbol (888)
+# define Qmove_frame builtin_lisp_symbol (889)
+# define Qmove_toolbar builtin_lisp_symbol (890)
+# define Qmutex builtin_lisp_symbol (891)
+# define Qmutexp builtin_lisp_symbol (892)
+# define Qname builtin_lisp_symbol (893)
+# define Qnative_comp_compiler_options builtin_lisp_symbol (894)
+# define Qnative_comp_debug builtin_lisp_symbol (895)
+# define Qnative_comp_driver_options builtin_lisp_symbol (896)
+# define Qnative_comp_function builtin_lisp_symbol (897)
+# define Qnative_comp_speed builtin_lisp_symbol (898)
+# define Qnative_comp_unit builtin_lisp_symbol (899)
+# define Qnative_compiler builtin_lisp_symbol (900)
+# define Qnative_compiler_error builtin_lisp_symbol (901)
+# define Qnative_edges builtin_lisp_symbol (902)
+# define Qnative_ice builtin_lisp_symbol (903)
+# define Qnative_lisp_file_inconsistent builtin_lisp_symbol (904)
+# define Qnative_lisp_load_failed builtin_lisp_symbol (905)
+# define Qnative_lisp_wrong_reloc builtin_lisp_symbol (906)
+# define Qnatnump builtin_lisp_symbol (907)
+# define Qnegate builtin_lisp_symbol (908)
+# define Qnetwork builtin_lisp_symbol (909)
+# define Qnewline builtin_lisp_symbol (910)
+# define Qnice builtin_lisp_symbol (911)
+# define Qno_accept_focus builtin_lisp_symbol (912)
+# define Qno_catch builtin_lisp_symbol (913)
+# define Qno_conversion builtin_lisp_symbol (914)
+# define Qno_focus_on_map builtin_lisp_symbol (915)
+# define Qno_other_frame builtin_lisp_symbol (916)
+# define Qno_other_window builtin_lisp_symbol (917)
+# define Qno_record builtin_lisp_symbol (918)
+# define Qno_special_glyphs builtin_lisp_symbol (919)
+# define Qnobreak_hyphen builtin_lisp_symbol (920)
+# define Qnobreak_space builtin_lisp_symbol (921)
+# define Qnoelisp builtin_lisp_symbol (922)
+# define Qnon_ascii builtin_lisp_symbol (923)
+# define Qnon_key_event builtin_lisp_symbol (924)
+# define Qnone builtin_lisp_symbol (925)
+# define Qnormal builtin_lisp_symbol (926)
+# define Qnormal_top_level builtin_lisp_symbol (927)
+# define Qns builtin_lisp_symbol (928)
+# define Qns_appearance builtin_lisp_symbol (929)
+# define Qns_parse_geometry builtin_lisp_symbol (930)
+# define Qns_transparent_titlebar builtin_lisp_symbol (931)
+# define Qnsm_verify_connection builtin_lisp_symbol (932)
+# define Qnth builtin_lisp_symbol (933)
+# define Qnull builtin_lisp_symbol (934)
+# define Qnumber_or_marker_p builtin_lisp_symbol (935)
+# define Qnumberp builtin_lisp_symbol (936)
+# define Qnumeric builtin_lisp_symbol (937)
+# define Qobarray builtin_lisp_symbol (938)
+# define Qobarray_cache builtin_lisp_symbol (939)
+# define Qobarrayp builtin_lisp_symbol (940)
+# define Qobject builtin_lisp_symbol (941)
+# define Qoblique builtin_lisp_symbol (942)
+# define Qoclosure_interactive_form builtin_lisp_symbol (943)
+# define Qodd builtin_lisp_symbol (944)
+# define Qonly builtin_lisp_symbol (945)
+# define Qopen builtin_lisp_symbol (946)
+# define Qopen_network_stream builtin_lisp_symbol (947)
+# define Qopentype builtin_lisp_symbol (948)
+# define Qoperations builtin_lisp_symbol (949)
+# define Qouter_border_width builtin_lisp_symbol (950)
+# define Qouter_edges builtin_lisp_symbol (951)
+# define Qouter_position builtin_lisp_symbol (952)
+# define Qouter_size builtin_lisp_symbol (953)
+# define Qouter_window_id builtin_lisp_symbol (954)
+# define Qoverflow_error builtin_lisp_symbol (955)
+# define Qoverlay builtin_lisp_symbol (956)
+# define Qoverlay_arrow_bitmap builtin_lisp_symbol (957)
+# define Qoverlay_arrow_string builtin_lisp_symbol (958)
+# define Qoverlayp builtin_lisp_symbol (959)
+# define Qoverride_redirect builtin_lisp_symbol (960)
+# define Qoverriding_local_map builtin_lisp_symbol (961)
+# define Qoverriding_plist_environment builtin_lisp_symbol (962)
+# define Qoverriding_terminal_local_map builtin_lisp_symbol (963)
+# define Qoverwrite_mode builtin_lisp_symbol (964)
+# define Qoverwrite_mode_binary builtin_lisp_symbol (965)
+# define Qp builtin_lisp_symbol (966)
+# define Qpaper builtin_lisp_symbol (967)
+# define Qparent_frame builtin_lisp_symbol (968)
+# define Qparent_id builtin_lisp_symbol (969)
+# define Qpc builtin_lisp_symbol (970)
+# define Qpcpu builtin_lisp_symbol (971)
+# define Qpermanent_local builtin_lisp_symbol (972)
+# define Qpermanent_local_hook builtin_lisp_symbol (973)
+# define Qpermission_denied builtin_lisp_symbol (974)
+# define Qpgrp builtin_lisp_symbol (975)
+# define Qpgtk builtin_lisp_symbol (976)
+# define Qphi builtin_lisp_symbol (977)
+# define Qpinch builtin_lisp_symbol (978)
+# define Qpipe builtin_lisp_symbol (979)
+# define Qpipe_process_p builtin_lisp_symbol (980)
+# define Qplay_sound_functions builtin_lisp_symbol (981)
+# define Qplist builtin_lisp_symbol (982)
+# define Qplistp builtin_lisp_symbol (983)
+# define Qplus builtin_lisp_symbol (984)
+# define Qpmem builtin_lisp_symbol (985)
+# define Qpoint_entered builtin_lisp_symbol (986)
+# define Qpoint_left builtin_lisp_symbol (987)
+# define Qpointer builtin_lisp_symbol (988)
+# define Qpolling_period builtin_lisp_symbol (989)
+# define Qpoly builtin_lisp_symbol (990)
+# define Qpop_exception builtin_lisp_symbol (991)
+# define Qposition builtin_lisp_symbol (992)
+# define Qpost_command_hook builtin_lisp_symbol (993)
+# define Qpost_gc_hook builtin_lisp_symbol (994)
+# define Qpost_select_region_hook builtin_lisp_symbol (995)
+# define Qpost_self_insert_hook builtin_lisp_symbol (996)
+# define Qppid builtin_lisp_symbol (997)
+# define Qpre_command_hook builtin_lisp_symbol (998)
+# define Qpreedit_text builtin_lisp_symbol (999)
+# define Qpressed_button builtin_lisp_symbol (1000)
+# define Qpri builtin_lisp_symbol (1001)
+# define Qprimitive_function builtin_lisp_symbol (1002)
+# define Qprint__unreadable_callback_buffer builtin_lisp_symbol (1003)
+# define Qprint_escape_multibyte builtin_lisp_symbol (1004)
+# define Qprint_escape_nonascii builtin_lisp_symbol (1005)
+# define Qprint_unreadable_function builtin_lisp_symbol (1006)
+# define Qpriority builtin_lisp_symbol (1007)
+# define Qprocess builtin_lisp_symbol (1008)
+# define Qprocess_attributes builtin_lisp_symbol (1009)
+# define Qprocessp builtin_lisp_symbol (1010)
+# define Qprogn builtin_lisp_symbol (1011)
+# define Qpropertize builtin_lisp_symbol (1012)
+# define Qprotected_field builtin_lisp_symbol (1013)
+# define Qprovide builtin_lisp_symbol (1014)
+# define Qpty builtin_lisp_symbol (1015)
+# define Qpure builtin_lisp_symbol (1016)
+# define Qpurecopy builtin_lisp_symbol (1017)
+# define Qpush_exception builtin_lisp_symbol (1018)
+# define Qpush_window_buffer_onto_prev builtin_lisp_symbol (1019)
+# define Qquit builtin_lisp_symbol (1020)
+# define Qquit_restore builtin_lisp_symbol (1021)
+# define Qquit_restore_prev builtin_lisp_symbol (1022)
+# define Qquote builtin_lisp_symbol (1023)
+# define Qraise builtin_lisp_symbol (1024)
+# define Qrange builtin_lisp_symbol (1025)
+# define Qrange_error builtin_lisp_symbol (1026)
+# define Qratio builtin_lisp_symbol (1027)
+# define Qraw_text builtin_lisp_symbol (1028)
+# define Qread builtin_lisp_symbol (1029)
+# define Qread_char builtin_lisp_symbol (1030)
+# define Qread_number builtin_lisp_symbol (1031)
+# define Qread_only builtin_lisp_symbol (1032)
+# define Qreal builtin_lisp_symbol (1033)
+# define Qreal_this_command builtin_lisp_symbol (1034)
+# define Qrear_nonsticky builtin_lisp_symbol (1035)
+# define Qrecenter builtin_lisp_symbol (1036)
+# define Qrecord builtin_lisp_symbol (1037)
+# define Qrecord_unwind_current_buffer builtin_lisp_symbol (1038)
+# define Qrecord_unwind_protect_excursion builtin_lisp_symbol (1039)
+# define Qrecord_window_buffer builtin_lisp_symbol (1040)
+# define Qrecordp builtin_lisp_symbol (1041)
+# define Qrect builtin_lisp_symbol (1042)
+# define Qrecursion_error builtin_lisp_symbol (1043)
+# define Qredisplay_dont_pause builtin_lisp_symbol (1044)
+# define Qredisplay_internal_xC_functionx builtin_lisp_symbol (1045)
+# define Qrelative builtin_lisp_symbol (1046)
+# define Qreleased_button builtin_lisp_symbol (1047)
+# define Qremap builtin_lisp_symbol (1048)
+# define Qremote_file_error builtin_lisp_symbol (1049)
+# define Qrename_file builtin_lisp_symbol (1050)
+# define Qreplace_buffer_in_windows builtin_lisp_symbol (1051)
+# define Qrequire builtin_lisp_symbol (1052)
+# define Qreset builtin_lisp_symbol (1053)
+# define Qreturn builtin_lisp_symbol (1054)
+# define Qreuse builtin_lisp_symbol (1055)
+# define Qright builtin_lisp_symbol (1056)
+# define Qright_divider builtin_lisp_symbol (1057)
+# define Qright_divider_width builtin_lisp_symbol (1058)
+# define Qright_edge builtin_lisp_symbol (1059)
+# define Qright_fringe builtin_lisp_symbol (1060)
+# define Qright_fringe_help builtin_lisp_symbol (1061)
+# define Qright_margin builtin_lisp_symbol (1062)
+# define Qright_to_left builtin_lisp_symbol (1063)
+# define Qrightmost builtin_lisp_symbol (1064)
+# define Qrisky_local_variable builtin_lisp_symbol (1065)
+# define Qrss builtin_lisp_symbol (1066)
+# define Qrun builtin_lisp_symbol (1067)
+# define Qrun_hook_query_error_with_timeout builtin_lisp_symbol (1068)
+# define Qrun_hook_with_args builtin_lisp_symbol (1069)
+# define Qsafe builtin_lisp_symbol (1070)
+# define Qsave_excursion builtin_lisp_symbol (1071)
+# define Qsave_session builtin_lisp_symbol (1072)
+# define Qscale_factor builtin_lisp_symbol (1073)
+# define Qscan_error builtin_lisp_symbol (1074)
+# define Qscratch builtin_lisp_symbol (1075)
+# define Qscreen_gamma builtin_lisp_symbol (1076)
+# define Qscroll builtin_lisp_symbol (1077)
+# define Qscroll_bar builtin_lisp_symbol (1078)
+# define Qscroll_bar_background builtin_lisp_symbol (1079)
+# define Qscroll_bar_foreground builtin_lisp_symbol (1080)
+# define Qscroll_bar_height builtin_lisp_symbol (1081)
+# define Qscroll_bar_movement builtin_lisp_symbol (1082)
+# define Qscroll_bar_width builtin_lisp_symbol (1083)
+# define Qscroll_command builtin_lisp_symbol (1084)
+# define Qscroll_down builtin_lisp_symbol (1085)
+# define Qscroll_up builtin_lisp_symbol (1086)
+# define Qsearch_failed builtin_lisp_symbol (1087)
+# define Qselect_frame_set_input_focus builtin_lisp_symbol (1088)
+# define Qselect_window builtin_lisp_symbol (1089)
+# define Qselection_request builtin_lisp_symbol (1090)
+# define Qself_insert_command builtin_lisp_symbol (1091)
+# define Qsemi_bold builtin_lisp_symbol (1092)
+# define Qsemi_light builtin_lisp_symbol (1093)
+# define Qseqpacket builtin_lisp_symbol (1094)
+# define Qsequencep builtin_lisp_symbol (1095)
+# define Qserial builtin_lisp_symbol (1096)
+# define Qsess builtin_lisp_symbol (1097)
+# define Qset builtin_lisp_symbol (1098)
+# define Qset_args_to_local builtin_lisp_symbol (1099)
+# define Qset_default builtin_lisp_symbol (1100)
+# define Qset_file_acl builtin_lisp_symbol (1101)
+# define Qset_file_modes builtin_lisp_symbol (1102)
+# define Qset_file_selinux_context builtin_lisp_symbol (1103)
+# define Qset_file_times builtin_lisp_symbol (1104)
+# define Qset_internal builtin_lisp_symbol (1105)
+# define Qset_par_to_local builtin_lisp_symbol (1106)
+# define Qset_rest_args_to_local builtin_lisp_symbol (1107)
+# define Qset_visited_file_modtime builtin_lisp_symbol (1108)
+# define Qset_window_configuration builtin_lisp_symbol (1109)
+# define Qsetcar builtin_lisp_symbol (1110)
+# define Qsetcdr builtin_lisp_symbol (1111)
+# define Qsetimm builtin_lisp_symbol (1112)
+# define Qsetq builtin_lisp_symbol (1113)
+# define Qsetting_constant builtin_lisp_symbol (1114)
+# define Qsha1 builtin_lisp_symbol (1115)
+# define Qsha224 builtin_lisp_symbol (1116)
+# define Qsha256 builtin_lisp_symbol (1117)
+# define Qsha384 builtin_lisp_symbol (1118)
+# define Qsha512 builtin_lisp_symbol (1119)
+# define Qshaded builtin_lisp_symbol (1120)
+# define Qshift_jis builtin_lisp_symbol (1121)
+# define Qside_effect_free builtin_lisp_symbol (1122)
+# define Qsignal builtin_lisp_symbol (1123)
+# define Qsignal_process_functions builtin_lisp_symbol (1124)
+# define Qsingularity_error builtin_lisp_symbol (1125)
+# define Qsize builtin_lisp_symbol (1126)
+# define Qskip_taskbar builtin_lisp_symbol (1127)
+# define Qslice builtin_lisp_symbol (1128)
+# define Qsound builtin_lisp_symbol (1129)
+# define Qsource builtin_lisp_symbol (1130)
+# define Qspace builtin_lisp_symbol (1131)
+# define Qspace_width builtin_lisp_symbol (1132)
+# define Qspecial_form builtin_lisp_symbol (1133)
+# define Qspecial_lowercase builtin_lisp_symbol (1134)
+# define Qspecial_titlecase builtin_lisp_symbol (1135)
+# define Qspecial_uppercase builtin_lisp_symbol (1136)
+# define Qsqlite builtin_lisp_symbol (1137)
+# define Qstandard_input builtin_lisp_symbol (1138)
+# define Qstandard_output builtin_lisp_symbol (1139)
+# define Qstart builtin_lisp_symbol (1140)
+# define Qstart_process builtin_lisp_symbol (1141)
+# define Qstate builtin_lisp_symbol (1142)
+# define Qstderr builtin_lisp_symbol (1143)
+# define Qstdin builtin_lisp_symbol (1144)
+# define Qstdout builtin_lisp_symbol (1145)
+# define Qsticky builtin_lisp_symbol (1146)
+# define Qstime builtin_lisp_symbol (1147)
+# define Qstop builtin_lisp_symbol (1148)
+# define Qstraight builtin_lisp_symbol (1149)
+# define Qstring builtin_lisp_symbol (1150)
+# define Qstring_bytes builtin_lisp_symbol (1151)
+# define Qstring_lessp builtin_lisp_symbol (1152)
+# define Qstringp builtin_lisp_symbol (1153)
+# define Qstrings builtin_lisp_symbol (1154)
+# define Qsub1 builtin_lisp_symbol (1155)
+# define Qsub_char_table builtin_lisp_symbol (1156)
+# define Qsubfeatures builtin_lisp_symbol (1157)
+# define Qsubr builtin_lisp_symbol (1158)
+# define Qsubr_native_elisp builtin_lisp_symbol (1159)
+# define Qsubrp builtin_lisp_symbol (1160)
+# define Qsubstitute_command_keys builtin_lisp_symbol (1161)
+# define Qsubstitute_env_in_file_name builtin_lisp_symbol (1162)
+# define Qsubstitute_in_file_name builtin_lisp_symbol (1163)
+# define Qsw builtin_lisp_symbol (1164)
+# define Qswitch_frame builtin_lisp_symbol (1165)
+# define Qsymbol builtin_lisp_symbol (1166)
+# define Qsymbolp builtin_lisp_symbol (1167)
+# define Qsymbols builtin_lisp_symbol (1168)
+# define Qsyntax_ppss builtin_lisp_symbol (1169)
+# define Qsyntax_ppss_table builtin_lisp_symbol (1170)
+# define Qsyntax_table builtin_lisp_symbol (1171)
+# define Qsyntax_table_p builtin_lisp_symbol (1172)
+# define Qtab_bar builtin_lisp_symbol (1173)
+# define Qtab_bar_lines builtin_lisp_symbol (1174)
+# define Qtab_bar_size builtin_lisp_symbol (1175)
+# define Qtab_line builtin_lisp_symbol (1176)
+# define Qtab_line_format builtin_lisp_symbol (1177)
+# define Qtarget_idx builtin_lisp_symbol (1178)
+# define Qtemp_buffer_setup_hook builtin_lisp_symbol (1179)
+# define Qtemp_buffer_show_hook builtin_lisp_symbol (1180)
+# define Qtemporary_goal_column builtin_lisp_symbol (1181)
+# define Qterminal builtin_lisp_symbol (1182)
+# define Qterminal_frame builtin_lisp_symbol (1183)
+# define Qterminal_live_p builtin_lisp_symbol (1184)
+# define Qtest builtin_lisp_symbol (1185)
+# define Qtext builtin_lisp_symbol (1186)
+# define Qtext_image_horiz builtin_lisp_symbol (1187)
+# define Qtext_pixels builtin_lisp_symbol (1188)
+# define Qtext_read_only builtin_lisp_symbol (1189)
+# define Qthcount builtin_lisp_symbol (1190)
+# define Qthin builtin_lisp_symbol (1191)
+# define Qthin_space builtin_lisp_symbol (1192)
+# define Qthread builtin_lisp_symbol (1193)
+# define Qthread_event builtin_lisp_symbol (1194)
+# define Qthreadp builtin_lisp_symbol (1195)
+# define Qtime builtin_lisp_symbol (1196)
+# define Qtimer_event_handler builtin_lisp_symbol (1197)
+# define Qtip_frame builtin_lisp_symbol (1198)
+# define Qtitle builtin_lisp_symbol (1199)
+# define Qtitle_bar_size builtin_lisp_symbol (1200)
+# define Qtitlecase builtin_lisp_symbol (1201)
+# define Qtool_bar builtin_lisp_symbol (1202)
+# define Qtool_bar_external builtin_lisp_symbol (1203)
+# define Qtool_bar_lines builtin_lisp_symbol (1204)
+# define Qtool_bar_position builtin_lisp_symbol (1205)
+# define Qtool_bar_size builtin_lisp_symbol (1206)
+# define Qtooltip builtin_lisp_symbol (1207)
+# define Qtop builtin_lisp_symbol (1208)
+# define Qtop_edge builtin_lisp_symbol (1209)
+# define Qtop_left_corner builtin_lisp_symbol (1210)
+# define Qtop_level builtin_lisp_symbol (1211)
+# define Qtop_only builtin_lisp_symbol (1212)
+# define Qtop_right_corner builtin_lisp_symbol (1213)
+# define Qtouch_end builtin_lisp_symbol (1214)
+# define Qtouchscreen_begin builtin_lisp_symbol (1215)
+# define Qtouchscreen_end builtin_lisp_symbol (1216)
+# define Qtouchscreen_update builtin_lisp_symbol (1217)
+# define Qtpgid builtin_lisp_symbol (1218)
+# define Qtrailing_whitespace builtin_lisp_symbol (1219)
+# define Qtranslation_table builtin_lisp_symbol (1220)
+# define Qtranslation_table_id builtin_lisp_symbol (1221)
+# define Qtrapping_constant builtin_lisp_symbol (1222)
+# define Qtree_sitter builtin_lisp_symbol (1223)
+# define Qtree_sitter_cursor builtin_lisp_symbol (1224)
+# define Qtree_sitter_node builtin_lisp_symbol (1225)
+# define Qttname builtin_lisp_symbol (1226)
+# define Qtty builtin_lisp_symbol (1227)
+# define Qtty_color_alist builtin_lisp_symbol (1228)
+# define Qtty_color_by_index builtin_lisp_symbol (1229)
+# define Qtty_color_desc builtin_lisp_symbol (1230)
+# define Qtty_color_mode builtin_lisp_symbol (1231)
+# define Qtty_color_standard_values builtin_lisp_symbol (1232)
+# define Qtty_menu_exit builtin_lisp_symbol (1233)
+# define Qtty_menu_ignore builtin_lisp_symbol (1234)
+# define Qtty_menu_mouse_movement builtin_lisp_symbol (1235)
+# define Qtty_menu_navigation_map builtin_lisp_symbol (1236)
+# define Qtty_menu_next_item builtin_lisp_symbol (1237)
+# define Qtty_menu_next_menu builtin_lisp_symbol (1238)
+# define Qtty_menu_prev_item builtin_lisp_symbol (1239)
+# define Qtty_menu_prev_menu builtin_lisp_symbol (1240)
+# define Qtty_menu_select builtin_lisp_symbol (1241)
+# define Qtty_mode_reset_strings builtin_lisp_symbol (1242)
+# define Qtty_mode_set_strings builtin_lisp_symbol (1243)
+# define Qtty_type builtin_lisp_symbol (1244)
+# define Qtype_mismatch builtin_lisp_symbol (1245)
+# define Qultra_bold builtin_lisp_symbol (1246)
+# define Qultra_heavy builtin_lisp_symbol (1247)
+# define Qultra_light builtin_lisp_symbol (1248)
+# define Qundecided builtin_lisp_symbol (1249)
+# define Qundecorated builtin_lisp_symbol (1250)
+# define Qundefined builtin_lisp_symbol (1251)
+# define Qunderflow_error builtin_lisp_symbol (1252)
+# define Qunderline_minimum_offset builtin_lisp_symbol (1253)
+# define Qundo builtin_lisp_symbol (1254)
+# define Qundo__seen_list builtin_lisp_symbol (1255)
+# define Qundo_only builtin_lisp_symbol (1256)
+# define Qunevalled builtin_lisp_symbol (1257)
+# define Qunhandled_file_name_directory builtin_lisp_symbol (1258)
+# define Qunicode builtin_lisp_symbol (1259)
+# define Qunicode_bmp builtin_lisp_symbol (1260)
+# define Qunicode_string_p builtin_lisp_symbol (1261)
+# define Qunix builtin_lisp_symbol (1262)
+# define Qunlet builtin_lisp_symbol (1263)
+# define Qunlock_file builtin_lisp_symbol (1264)
+# define Qunreachable builtin_lisp_symbol (1265)
+# define Qunspecified builtin_lisp_symbol (1266)
+# define Qunsplittable builtin_lisp_symbol (1267)
+# define Qup builtin_lisp_symbol (1268)
+# define Quppercase builtin_lisp_symbol (1269)
+# define Qus_ascii builtin_lisp_symbol (1270)
+# define Quse_frame_synchronization builtin_lisp_symbol (1271)
+# define Quser builtin_lisp_symbol (1272)
+# define Quser_error builtin_lisp_symbol (1273)
+# define Quser_position builtin_lisp_symbol (1274)
+# define Quser_ptr builtin_lisp_symbol (1275)
+# define Quser_ptrp builtin_lisp_symbol (1276)
+# define Quser_search_failed builtin_lisp_symbol (1277)
+# define Quser_size builtin_lisp_symbol (1278)
+# define Qutf_16 builtin_lisp_symbol (1279)
+# define Qutf_16le builtin_lisp_symbol (1280)
+# define Qutf_8 builtin_lisp_symbol (1281)
+# define Qutf_8_emacs builtin_lisp_symbol (1282)
+# define Qutf_8_string_p builtin_lisp_symbol (1283)
+# define Qutf_8_unix builtin_lisp_symbol (1284)
+# define Qutime builtin_lisp_symbol (1285)
+# define Qvalue builtin_lisp_symbol (1286)
+# define Qvaluelt builtin_lisp_symbol (1287)
+# define Qvariable_documentation builtin_lisp_symbol (1288)
+# define Qvector builtin_lisp_symbol (1289)
+# define Qvector_or_char_table_p builtin_lisp_symbol (1290)
+# define Qvector_slots builtin_lisp_symbol (1291)
+# define Qvectorp builtin_lisp_symbol (1292)
+# define Qvectors builtin_lisp_symbol (1293)
+# define Qverify_visited_file_modtime builtin_lisp_symbol (1294)
+# define Qvertical_border builtin_lisp_symbol (1295)
+# define Qvertical_line builtin_lisp_symbol (1296)
+# define Qvertical_scroll_bar builtin_lisp_symbol (1297)
+# define Qvertical_scroll_bars builtin_lisp_symbol (1298)
+# define Qvisibility builtin_lisp_symbol (1299)
+# define Qvisible builtin_lisp_symbol (1300)
+# define Qvisual builtin_lisp_symbol (1301)
+# define Qvoid_function builtin_lisp_symbol (1302)
+# define Qvoid_variable builtin_lisp_symbol (1303)
+# define Qvsize builtin_lisp_symbol (1304)
+# define Qw32 builtin_lisp_symbol (1305)
+# define Qwait_for_wm builtin_lisp_symbol (1306)
+# define Qwall builtin_lisp_symbol (1307)
+# define Qwatchers builtin_lisp_symbol (1308)
+# define Qwave builtin_lisp_symbol (1309)
+# define Qweakness builtin_lisp_symbol (1310)
+# define Qwhen builtin_lisp_symbol (1311)
+# define Qwholenump builtin_lisp_symbol (1312)
+# define Qwidget_type builtin_lisp_symbol (1313)
+# define Qwidth builtin_lisp_symbol (1314)
+# define Qwidth_only builtin_lisp_symbol (1315)
+# define Qwindow builtin_lisp_symbol (1316)
+# define Qwindow__pixel_to_total builtin_lisp_symbol (1317)
+# define Qwindow__resize_mini_frame builtin_lisp_symbol (1318)
+# define Qwindow__resize_root_window builtin_lisp_symbol (1319)
+# define Qwindow__resize_root_window_vertically builtin_lisp_symbol (1320)
+# define Qwindow_border builtin_lisp_symbol (1321)
+# define Qwindow_border_mode builtin_lisp_symbol (1322)
+# define Qwindow_buffer_change_functions builtin_lisp_symbol (1323)
+# define Qwindow_configuration builtin_lisp_symbol (1324)
+# define Qwindow_configuration_change_hook builtin_lisp_symbol (1325)
+# define Qwindow_configuration_p builtin_lisp_symbol (1326)
+# define Qwindow_deletable_p builtin_lisp_symbol (1327)
+# define Qwindow_divider builtin_lisp_symbol (1328)
+# define Qwindow_divider_first_pixel builtin_lisp_symbol (1329)
+# define Qwindow_divider_last_pixel builtin_lisp_symbol (1330)
+# define Qwindow_edges builtin_lisp_symbol (1331)
+# define Qwindow_id builtin_lisp_symbol (1332)
+# define Qwindow_live_p builtin_lisp_symbol (1333)
+# define Qwindow_point_insertion_type builtin_lisp_symbol (1334)
+# define Qwindow_scroll_functions builtin_lisp_symbol (1335)
+# define Qwindow_selection_change_functions builtin_lisp_symbol (1336)
+# define Qwindow_size builtin_lisp_symbol (1337)
+# define Qwindow_size_change_functions builtin_lisp_symbol (1338)
+# define Qwindow_state_change_functions builtin_lisp_symbol (1339)
+# define Qwindow_state_change_hook builtin_lisp_symbol (1340)
+# define Qwindow_valid_p builtin_lisp_symbol (1341)
+# define Qwindowp builtin_lisp_symbol (1342)
+# define Qworkarea builtin_lisp_symbol (1343)
+# define Qwrap_prefix builtin_lisp_symbol (1344)
+# define Qwrite_region builtin_lisp_symbol (1345)
+# define Qwrite_region_annotate_functions builtin_lisp_symbol (1346)
+# define Qwrong_length_argument builtin_lisp_symbol (1347)
+# define Qwrong_number_of_arguments builtin_lisp_symbol (1348)
+# define Qwrong_register_subr_call builtin_lisp_symbol (1349)
+# define Qwrong_type_argument builtin_lisp_symbol (1350)
+# define Qx builtin_lisp_symbol (1351)
+# define Qx_create_frame_1 builtin_lisp_symbol (1352)
+# define Qx_create_frame_2 builtin_lisp_symbol (1353)
+# define Qx_frame_parameter builtin_lisp_symbol (1354)
+# define Qx_pre_popup_menu_hook builtin_lisp_symbol (1355)
+# define Qx_resource_name builtin_lisp_symbol (1356)
+# define Qx_set_menu_bar_lines builtin_lisp_symbol (1357)
+# define Qx_set_window_size_1 builtin_lisp_symbol (1358)
+# define Qxg_frame_set_char_size builtin_lisp_symbol (1359)
+# define Qxterm__set_selection builtin_lisp_symbol (1360)
+# define Qxterm_select_active_regions builtin_lisp_symbol (1361)
+# define Qxwidget builtin_lisp_symbol (1362)
+# define Qxwidget_display_event builtin_lisp_symbol (1363)
+# define Qxwidget_event builtin_lisp_symbol (1364)
+# define Qxwidget_view builtin_lisp_symbol (1365)
+# define Qyes_or_no_p_history builtin_lisp_symbol (1366)
+# define Qz_group builtin_lisp_symbol (1367)
+# define Qzero_width builtin_lisp_symbol (1368)
+#endif
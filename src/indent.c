@@ -2245,8 +2245,12 @@ line (if such column exists on that line, that is).  If the line is
 	}
       else
 	{
-	  /* Scan from start of line containing PT.  */
-	  reseat_preceding_line_start (&it);
+	  /* Scan from start of line containing PT, or from the start of
+	     its screen line if that is known.  */
+	  if (disp_string_at_start_p)
+	    reseat_preceding_line_start (&it);
+	  else
+	    reseat_preceding_sline_start (&it);
 	  it.current_x = it.hpos = 0;
 	}
 
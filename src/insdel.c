@@ -1924,6 +1924,12 @@ prepare_modify_buffer (ptrdiff_t start, ptrdiff_t end,
 
       signal_before_change (start, end, preserve_ptr);
       Fset (Qdeactivate_mark, Qt);
+
+      /* A change to text properties may change the syntax of the
+	 text, which syntax-ppss-invalidate-cache in before-change-functions
+	 accounts for; drop the parse states after it likewise.  */
+      if (!invalidate_caches)
+	invalidate_syntax_checkpoints (current_buffer, start);
     }
   if (invalidate_caches)
     invalidate_buffer_caches (current_buffer, start, end);
@@ -1982,6 +1988,11 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->line_index)
+    invalidate_line_index (buf->line_index,
+			   start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->syntax_checkpoints)
+    invalidate_syntax_checkpoints (buf, start);
 }
 
 /* These macros work with an argument named `preserve_ptr'
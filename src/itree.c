@@ -19,6 +19,7 @@ Copyright (C) 2017-2024 Free Software Foundation, Inc.
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
 
 #include "itree.h"
 
@@ -325,15 +326,44 @@ itree_update_limit (struct itree_node *node)
   node->limit = itree_newlimit (node);
 }
 
+/* Every change of a tree, including applying offsets, is bracketed
+   by itree_begin_change and itree_end_change.  They make the tree's
+   EPOCH odd during the outermost change, and even again, but
+   different, after it.  itree_snapshot asserts that no change is in
+   progress, and the tests use EPOCH to check that reading a tree with
+   itree_snapshot does not change it.  Nothing between the two may exit
+   nonlocally, as by running out of memory, since that would leave the
+   tree marked as changing for good.  */
+
+static void
+itree_begin_change (struct itree_tree *tree)
+{
+  if (tree->changing++ == 0)
+    {
+      eassert (!(tree->epoch & 1));
+      tree->epoch++;
+    }
+}
+
+static void
+itree_end_change (struct itree_tree *tree)
+{
+  eassert (tree->changing > 0);
+  if (--tree->changing == 0)
+    tree->epoch++;
+}
+
 /* Apply NODE's offset to its begin, end and limit values and
    propagate it to its children.
 
-   Does nothing, if NODE is clean, i.e. NODE.otick = tree.otick .
+   Does nothing, if NODE is clean, i.e. NODE.otick = TREE.otick .
 */
 
 static void
-itree_inherit_offset (uintmax_t otick, struct itree_node *node)
+itree_inherit_offset (struct itree_tree *tree, struct itree_node *node)
 {
+  uintmax_t otick = tree->otick;
+
   eassert (node->parent == NULL || node->parent->otick >= node->otick);
   if (node->otick == otick)
     {
@@ -347,6 +377,7 @@ itree_inherit_offset (uintmax_t otick, struct itree_node *node)
 
   if (node->offset)
     {
+      itree_begin_change (tree);
       node->begin += node->offset;
       node->end   += node->offset;
       node->limit += node->offset;
@@ -355,6 +386,7 @@ itree_inherit_offset (uintmax_t otick, struct itree_node *node)
       if (node->right != NULL)
 	node->right->offset += node->offset;
       node->offset = 0;
+      itree_end_change (tree);
     }
   if (node->parent == NULL || node->parent->otick == otick)
     node->otick = otick;
@@ -393,7 +425,7 @@ itree_validate (struct itree_tree *tree, struct itree_node *node)
   if (node != tree->root)
     itree_validate (tree, node->parent);
 
-  itree_inherit_offset (tree->otick, node);
+  itree_inherit_offset (tree, node);
   return node;
 }
 
@@ -447,18 +479,38 @@ itree_node_end (struct itree_tree *tree,
 itree_create (void)
 {
   struct itree_tree *tree = xmalloc (sizeof (*tree));
+  tree->root = NULL;
+  tree->epoch = 0;
+  tree->changing = 0;
   itree_clear (tree);
   return tree;
 }
 
-/* Reset the tree TREE to its empty state.  */
+/* Detach the nodes of the subtree NODE from each other.  */
+
+static void
+itree_detach (struct itree_node *node)
+{
+  while (node != NULL)
+    {
+      struct itree_node *right = node->right;
+      itree_detach (node->left);
+      node->parent = node->left = node->right = NULL;
+      node = right;
+    }
+}
+
+/* Reset the tree TREE to its empty state, detaching its nodes.  */
 
 void
 itree_clear (struct itree_tree *tree)
 {
+  itree_begin_change (tree);
+  itree_detach (tree->root);
   tree->root = NULL;
   tree->otick = 1;
   tree->size = 0;
+  itree_end_change (tree);
 }
 
 #ifdef ITREE_TESTING
@@ -467,6 +519,9 @@ itree_clear (struct itree_tree *tree)
 static void
 itree_init (struct itree_tree *tree)
 {
+  tree->root = NULL;
+  tree->epoch = 0;
+  tree->changing = 0;
   itree_clear (tree);
 }
 #endif
@@ -497,8 +552,8 @@ itree_rotate_left (struct itree_tree *tree,
 
   struct itree_node *right = node->right;
 
-  itree_inherit_offset (tree->otick, node);
-  itree_inherit_offset (tree->otick, right);
+  itree_inherit_offset (tree, node);
+  itree_inherit_offset (tree, right);
 
   /* Turn right's left subtree into node's right subtree.  */
   node->right = right->left;
@@ -540,8 +595,8 @@ itree_rotate_right (struct itree_tree *tree,
 
   struct itree_node *left = node->left;
 
-  itree_inherit_offset (tree->otick, node);
-  itree_inherit_offset (tree->otick, left);
+  itree_inherit_offset (tree, node);
+  itree_inherit_offset (tree, left);
 
   node->left = left->right;
   if (left->right != NULL)
@@ -664,12 +719,13 @@ itree_insert_node (struct itree_tree *tree, struct itree_node *node)
   /* It's the responsibility of the caller to set `otick` on the node,
      to "confirm" that the begin/end fields are up to date.  */
   eassert (node->otick == otick);
+  itree_begin_change (tree);
 
   /* Find the insertion point, accumulate node's offset and update
      ancestors limit values.  */
   while (child != NULL)
     {
-      itree_inherit_offset (otick, child);
+      itree_inherit_offset (tree, child);
       parent = child;
       eassert (child->offset == 0);
       child->limit = max (child->limit, node->end);
@@ -704,6 +760,7 @@ itree_insert_node (struct itree_tree *tree, struct itree_node *node)
       eassert (check_tree (tree, false)); /* FIXME: Too expensive.  */
       itree_insert_fix (tree, node);
     }
+  itree_end_change (tree);
 }
 
 void
@@ -724,6 +781,7 @@ itree_node_set_region (struct itree_tree *tree,
 		       ptrdiff_t begin, ptrdiff_t end)
 {
   itree_validate (tree, node);
+  itree_begin_change (tree);
   if (begin != node->begin)
     {
       itree_remove (tree, node);
@@ -737,6 +795,7 @@ itree_node_set_region (struct itree_tree *tree,
       eassert (node != NULL);
       itree_propagate_limit (node);
     }
+  itree_end_change (tree);
 }
 
 /* Return true, if NODE is a member of TREE. */
@@ -763,11 +822,11 @@ itree_limit_is_stable (struct itree_node *node)
 }
 
 static struct itree_node*
-itree_subtree_min (uintmax_t otick, struct itree_node *node)
+itree_subtree_min (struct itree_tree *tree, struct itree_node *node)
 {
   if (node == NULL)
     return node;
-  while ((itree_inherit_offset (otick, node),
+  while ((itree_inherit_offset (tree, node),
 	  node->left != NULL))
     node = node->left;
   return node;
@@ -941,15 +1000,16 @@ itree_remove (struct itree_tree *tree, struct itree_node *node)
 {
   eassert (itree_contains (tree, node));
   eassert (check_tree (tree, true)); /* FIXME: Too expensive.  */
+  itree_begin_change (tree);
 
   /* Find `splice`, the leaf node to splice out of the tree.  When
      `node` has at most one child this is `node` itself.  Otherwise,
      it is the in order successor of `node`.  */
-  itree_inherit_offset (tree->otick, node);
+  itree_inherit_offset (tree, node);
   struct itree_node *splice
     = (node->left == NULL || node->right == NULL)
 	? node
-	: itree_subtree_min (tree->otick, node->right);
+	: itree_subtree_min (tree, node->right);
 
   /* Find `subtree`, the only child of `splice` (may be NULL).  Note:
      `subtree` will not be modified other than changing its parent to
@@ -999,6 +1059,7 @@ itree_remove (struct itree_tree *tree, struct itree_node *node)
   node->red = false;
   node->right = node->left = node->parent = NULL;
   node->limit = 0;
+  itree_end_change (tree);
 
   /* Must be clean (all offsets applied).  Also, some callers rely on
      node's otick being the tree's otick.  */
@@ -1008,6 +1069,184 @@ itree_remove (struct itree_tree *tree, struct itree_node *node)
   return node;
 }
 
+
+/* +=======================================================================+
+ * | Bulk Insert/Remove
+ * +=======================================================================+ */
+
+/* Inserting or removing many nodes one at a time rebalances the tree
+   for each of them.  When there are enough of them, it is cheaper to
+   collect the nodes of the tree in order, merge or drop the nodes in
+   question, and build a balanced tree from the result in one go.  */
+
+/* Return true if adding or removing N nodes of TREE is better done by
+   rebuilding it.  Rebuilding visits every node once, but costs
+   several times less per node than inserting or removing one, which
+   descends and rebalances the tree.  */
+
+static bool
+itree_rebuild_p (struct itree_tree *tree, ptrdiff_t n)
+{
+  return n * itree_max_height (tree) >= 4 * tree->size;
+}
+
+/* Store the nodes of the subtree NODE in NODES from *I on, in order,
+   applying OFFSET, the offset of the ancestors of NODE, to them, so
+   that they are clean for OTICK.  */
+
+static void
+itree_flatten (struct itree_node *node, ptrdiff_t offset, uintmax_t otick,
+	       struct itree_node **nodes, ptrdiff_t *i)
+{
+  for (; node != NULL; node = node->right)
+    {
+      offset += node->offset;
+      node->begin += offset;
+      node->end += offset;
+      node->offset = 0;
+      node->otick = otick;
+      itree_flatten (node->left, offset, otick, nodes, i);
+      nodes[(*i)++] = node;
+    }
+}
+
+/* Return a balanced subtree of the N clean NODES, sorted by BEGIN.
+   The nodes at depth RED_DEPTH are red, and the others are black.  */
+
+static struct itree_node *
+itree_build (struct itree_node **nodes, ptrdiff_t n, int depth,
+	     int red_depth)
+{
+  if (n == 0)
+    return NULL;
+
+  ptrdiff_t mid = n / 2;
+  struct itree_node *node = nodes[mid];
+
+  node->left = itree_build (nodes, mid, depth + 1, red_depth);
+  node->right = itree_build (nodes + mid + 1, n - mid - 1, depth + 1,
+			     red_depth);
+  node->parent = NULL;
+  if (node->left != NULL)
+    node->left->parent = node;
+  if (node->right != NULL)
+    node->right->parent = node;
+  node->red = depth == red_depth;
+  node->offset = 0;
+  node->limit = itree_newlimit (node);
+  return node;
+}
+
+/* Make TREE the tree of the N clean NODES, sorted by BEGIN.
+
+   Splitting the nodes in halves makes the depths of the leaves differ
+   by at most one, so making only the nodes of the deepest level red
+   satisfies the Red-Black invariants.  */
+
+static void
+itree_rebuild (struct itree_tree *tree, struct itree_node **nodes,
+	       ptrdiff_t n)
+{
+  int red_depth = 0;
+  for (ptrdiff_t m = n; m > 1; m >>= 1)
+    red_depth++;
+
+  tree->root = itree_build (nodes, n, 0, red_depth);
+  if (tree->root != NULL)
+    tree->root->red = false;
+  tree->size = n;
+  eassert (check_tree (tree, true)); /* FIXME: Too expensive.  */
+}
+
+static int
+itree_compare_begin (const void *a, const void *b)
+{
+  ptrdiff_t x = (*(struct itree_node *const *) a)->begin;
+  ptrdiff_t y = (*(struct itree_node *const *) b)->begin;
+  return (x > y) - (x < y);
+}
+
+/* Insert the N NODES into TREE.  Their BEGIN and END must be set, as
+   itree_insert sets them, and NODES is sorted in place.  */
+
+void
+itree_insert_nodes (struct itree_tree *tree, struct itree_node **nodes,
+		    ptrdiff_t n)
+{
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      eassert (nodes[i]->begin <= nodes[i]->end);
+      eassert (nodes[i]->left == NULL && nodes[i]->right == NULL
+	       && nodes[i]->parent == NULL);
+      nodes[i]->otick = tree->otick;
+    }
+
+  if (!itree_rebuild_p (tree, n))
+    {
+      for (ptrdiff_t i = 0; i < n; i++)
+	itree_insert_node (tree, nodes[i]);
+      return;
+    }
+
+  qsort (nodes, n, sizeof *nodes, itree_compare_begin);
+
+  /* Merge the nodes of the tree and NODES, from the end.  */
+  ptrdiff_t size = 0, total = tree->size + n;
+  struct itree_node **all = xmalloc (total * sizeof *all);
+  itree_begin_change (tree);
+  itree_flatten (tree->root, 0, tree->otick, all, &size);
+  eassert (size == tree->size);
+  for (ptrdiff_t i = size, j = n, k = total; j > 0; )
+    all[--k] = (i > 0 && all[i - 1]->begin > nodes[j - 1]->begin
+		? all[--i] : nodes[--j]);
+
+  itree_rebuild (tree, all, total);
+  itree_end_change (tree);
+  xfree (all);
+}
+
+/* Remove the N distinct NODES from TREE, which contains them all.  */
+
+void
+itree_remove_nodes (struct itree_tree *tree, struct itree_node **nodes,
+		    ptrdiff_t n)
+{
+  if (!itree_rebuild_p (tree, n))
+    {
+      for (ptrdiff_t i = 0; i < n; i++)
+	itree_remove (tree, nodes[i]);
+      return;
+    }
+
+  ptrdiff_t size = 0;
+  struct itree_node **all = xmalloc (tree->size * sizeof *all);
+  itree_begin_change (tree);
+  itree_flatten (tree->root, 0, tree->otick, all, &size);
+  eassert (size == tree->size);
+
+  /* itree_rebuild recomputes the LIMIT of the remaining nodes, so it
+     can tell the nodes to remove apart in the meantime.  */
+  for (ptrdiff_t i = 0; i < n; i++)
+    nodes[i]->limit = PTRDIFF_MIN;
+  ptrdiff_t k = 0;
+  for (ptrdiff_t i = 0; i < size; i++)
+    if (all[i]->limit != PTRDIFF_MIN)
+      all[k++] = all[i];
+  eassert (k == size - n);
+
+  itree_rebuild (tree, all, k);
+  xfree (all);
+
+  /* Clear fields related to the tree, as itree_remove does.  */
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      nodes[i]->red = false;
+      nodes[i]->right = nodes[i]->left = nodes[i]->parent = NULL;
+      nodes[i]->limit = 0;
+    }
+  itree_end_change (tree);
+}
+
 
 /* +=======================================================================+
  * | Insert/Delete Gaps
@@ -1049,6 +1288,13 @@ itree_insert_gap (struct itree_tree *tree,
 	    itree_stack_push (saved, node);
 	}
     }
+
+  /* The walk below never needs more than this stack, so nothing
+     allocates while the tree changes.  */
+  struct itree_stack *stack
+    = itree_stack_create (itree_max_height (tree) + 1);
+
+  itree_begin_change (tree);
   for (size_t i = 0; i < saved->length; ++i)
     itree_remove (tree, saved->nodes[i]);
 
@@ -1056,13 +1302,11 @@ itree_insert_gap (struct itree_tree *tree,
      narrow AND shift some subtree at the same time.  */
   if (tree->root != NULL)
     {
-      const int size = itree_max_height (tree) + 1;
-      struct itree_stack *stack = itree_stack_create (size);
       itree_stack_push (stack, tree->root);
       while ((node = itree_stack_pop (stack)))
 	{
 	  /* Process in pre-order. */
-	  itree_inherit_offset (tree->otick, node);
+	  itree_inherit_offset (tree, node);
 	  if (pos > node->limit)
 	    continue;
 	  if (node->right != NULL)
@@ -1091,7 +1335,6 @@ itree_insert_gap (struct itree_tree *tree,
 	      itree_propagate_limit (node);
 	    }
 	}
-      itree_stack_destroy (stack);
     }
 
   /* Reinsert nodes starting at POS having front-advance.  */
@@ -1107,6 +1350,8 @@ itree_insert_gap (struct itree_tree *tree,
       itree_insert_node (tree, node);
     }
 
+  itree_end_change (tree);
+  itree_stack_destroy (stack);
   itree_stack_destroy (saved);
 }
 
@@ -1128,10 +1373,12 @@ itree_delete_gap (struct itree_tree *tree,
   struct itree_stack *stack = itree_stack_create (size);
   struct itree_node *node;
 
+  /* As in itree_insert_gap, STACK is deep enough for the walk.  */
+  itree_begin_change (tree);
   itree_stack_push (stack, tree->root);
   while ((node = itree_stack_pop (stack)))
     {
-      itree_inherit_offset (tree->otick, node);
+      itree_inherit_offset (tree, node);
       if (pos > node->limit)
 	continue;
       if (node->right != NULL)
@@ -1157,11 +1404,90 @@ itree_delete_gap (struct itree_tree *tree,
 	  itree_propagate_limit (node);
 	}
     }
+  itree_end_change (tree);
   itree_stack_destroy (stack);
 }
 
 
 
+/* +=======================================================================+
+ * | Snapshots
+ * +=======================================================================+ */
+
+/* The iterator applies the offsets of the nodes it visits, and so
+   changes the tree.  itree_snapshot only reads it, adding up the
+   offsets on its way down.  This does not make it safe to call without
+   the global lock: the caller still needs the tree and the data of the
+   intervals it returns to stay alive, which only the lock guarantees.  */
+
+/* The deepest a tree can be, see itree_max_height.  */
+enum { ITREE_SNAPSHOT_DEPTH = 2 * sizeof (intmax_t) * CHAR_BIT };
+
+/* Read the intervals of TREE that intersect [BEGIN, END), in the sense
+   of itree_node_intersects, in ascending order into VEC, stopping
+   after LEN of them.  Return the number read; if it is LEN, there may
+   be more.  Otherwise, if NEXT is non-null, store in *NEXT the least
+   BEGIN of the intervals that begin at or after END, or after END if
+   BEGIN = END, or PTRDIFF_MAX if there are none.  */
+
+ptrdiff_t
+itree_snapshot (struct itree_tree *tree, ptrdiff_t begin, ptrdiff_t end,
+		struct itree_interval *vec, ptrdiff_t len, ptrdiff_t *next)
+{
+  struct
+  {
+    struct itree_node *node;
+    ptrdiff_t offset;		/* The sum of the offsets down to NODE.  */
+  } stack[ITREE_SNAPSHOT_DEPTH];
+
+  if (next)
+    *next = PTRDIFF_MAX;
+  if (tree == NULL)
+    return 0;
+  eassert (tree->changing == 0);
+
+  ptrdiff_t n = 0, sp = 0, offset = 0;
+  struct itree_node *node = tree->root;
+
+  for (;;)
+    {
+      for (; node != NULL; node = node->left)
+	{
+	  offset += node->offset;
+	  if (node->limit + offset < begin)
+	    break;
+	  eassert (sp < ITREE_SNAPSHOT_DEPTH);
+	  stack[sp].node = node;
+	  stack[sp++].offset = offset;
+	}
+      if (sp == 0)
+	return n;
+
+      node = stack[--sp].node;
+      offset = stack[sp].offset;
+      ptrdiff_t nbegin = node->begin + offset;
+      ptrdiff_t nend = node->end + offset;
+      if (nbegin > end || (nbegin == end && begin < end))
+	{
+	  if (next)
+	    *next = nbegin;
+	  return n;
+	}
+      if (n == len)
+	return n;
+      if ((begin < nend && nbegin < end)
+	  || (nbegin == nend && begin == nbegin))
+	{
+	  vec[n].begin = nbegin;
+	  vec[n].end = nend;
+	  vec[n].data = node->data;
+	  n++;
+	}
+      node = node->right;
+    }
+}
+
+
 /* +=======================================================================+
  * | Iterator
  * +=======================================================================+ */
@@ -1220,9 +1546,9 @@ itree_iter_next_in_subtree (struct itree_node *node,
       else
         {
           node = next;
-          itree_inherit_offset (iter->otick, node);
+          itree_inherit_offset (iter->tree, node);
           while ((next = node->left)
-                 && (itree_inherit_offset (iter->otick, next),
+                 && (itree_inherit_offset (iter->tree, next),
                      iter->begin <= next->limit))
             node = next;
         }
@@ -1233,7 +1559,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
     case ITREE_DESCENDING:
       next = node->left;
       if (!next
-          || (itree_inherit_offset (iter->otick, next),
+          || (itree_inherit_offset (iter->tree, next),
               next->limit < iter->begin))
         {
           while ((next = node->parent)
@@ -1249,7 +1575,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
           while (node->begin <= iter->end
                  && (next = node->right))
             {
-              itree_inherit_offset (iter->otick, next),
+              itree_inherit_offset (iter->tree, next),
 		node = next;
             }
         }
@@ -1258,13 +1584,13 @@ itree_iter_next_in_subtree (struct itree_node *node,
     case ITREE_PRE_ORDER:
       next = node->left;
       if (next
-          && (itree_inherit_offset (iter->otick, next),
+          && (itree_inherit_offset (iter->tree, next),
               !(next->limit < iter->begin)))
         return next;
       next = node->right;
       if (node->begin <= iter->end && next)
         {
-          itree_inherit_offset (iter->otick, next);
+          itree_inherit_offset (iter->tree, next);
           return next;
         }
       while ((next = node->parent))
@@ -1278,7 +1604,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
               next = node->right;
               if (node->begin <= iter->end && next)
                 {
-                  itree_inherit_offset (iter->otick, next);
+                  itree_inherit_offset (iter->tree, next);
                   return next;
                 }
             }
@@ -1295,13 +1621,13 @@ itree_iter_next_in_subtree (struct itree_node *node,
       if (!(node->begin <= iter->end && next))
         return node;
       node = next;
-      itree_inherit_offset (iter->otick, node);
+      itree_inherit_offset (iter->tree, node);
       while (((next = node->left)
-              && (itree_inherit_offset (iter->otick, next),
+              && (itree_inherit_offset (iter->tree, next),
                   iter->begin <= next->limit))
              || (node->begin <= iter->end
                  && (next = node->right)
-                 && (itree_inherit_offset (iter->otick, next), true)))
+                 && (itree_inherit_offset (iter->tree, next), true)))
         node = next;
       return node;
       break;
@@ -1322,7 +1648,7 @@ itree_iterator_first_node (struct itree_tree *tree,
       dummy.left = NULL;
       dummy.parent = NULL;
       dummy.right = NULL;
-      itree_inherit_offset (iter->otick, node);
+      itree_inherit_offset (iter->tree, node);
       switch (iter->order)
         {
         case ITREE_ASCENDING:
@@ -1365,7 +1691,7 @@ itree_iterator_start (struct itree_iterator *iter,
   eassert (iter);
   iter->begin = begin;
   iter->end = end;
-  iter->otick = tree->otick;
+  iter->tree = tree;
   iter->order = order;
   /* As the NODE field is always "one ahead" of the current iteration,
      `delete_all_overlays' can modify the current node without fear of
@@ -101,6 +101,16 @@ #define ITREE_H
   struct itree_node *root;
   uintmax_t otick;              /* offset tick, compared with node's otick. */
   intmax_t size;                /* Number of nodes in the tree. */
+  uintmax_t epoch;              /* Odd while the tree changes.  */
+  int changing;                 /* Depth of nested changes.  */
+};
+
+/* An interval of a tree as seen by itree_snapshot.  */
+struct itree_interval
+{
+  ptrdiff_t begin;
+  ptrdiff_t end;
+  Lisp_Object data;
 };
 
 enum itree_order
@@ -130,8 +140,14 @@ itree_empty_p (struct itree_tree *tree)
 			  ptrdiff_t, ptrdiff_t);
 extern struct itree_node *itree_remove (struct itree_tree *,
 					struct itree_node *);
+extern void itree_insert_nodes (struct itree_tree *, struct itree_node **,
+				ptrdiff_t);
+extern void itree_remove_nodes (struct itree_tree *, struct itree_node **,
+				ptrdiff_t);
 extern void itree_insert_gap (struct itree_tree *, ptrdiff_t, ptrdiff_t, bool);
 extern void itree_delete_gap (struct itree_tree *, ptrdiff_t, ptrdiff_t);
+extern ptrdiff_t itree_snapshot (struct itree_tree *, ptrdiff_t, ptrdiff_t,
+				 struct itree_interval *, ptrdiff_t, ptrdiff_t *);
 
 /* Iteration functions.  Almost all code should use ITREE_FOREACH
    instead.  */
@@ -150,7 +166,7 @@ itree_empty_p (struct itree_tree *tree)
     struct itree_node *node;
     ptrdiff_t begin;
     ptrdiff_t end;
-    uintmax_t otick;    /* A copy of the tree's `otick`.  */
+    struct itree_tree *tree;
     enum itree_order order;
   };
 
@@ -22,6 +22,7 @@ Copyright (C) 2017-2024 Free Software Foundation, Inc.
 #include <errno.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <fcntl.h>
 #include <math.h>
@@ -30,6 +31,7 @@ Copyright (C) 2017-2024 Free Software Foundation, Inc.
 #include "buffer.h"
 #include "coding.h"
 #include "process.h"
+#include "json.h"
 
 enum json_object_type
   {
@@ -320,11 +322,54 @@ string_not_unicode (Lisp_Object obj)
   0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, /* e0-ff */
 };
 
+/* Bytes of the input to json_plain_length, loaded into a word so
+   that all of them are tested at once.  */
+typedef uint64_t json_word_t;
+
+#define JSON_WORD_LSBS UINT64_C (0x0101010101010101)
+#define JSON_WORD_MSBS UINT64_C (0x8080808080808080)
+
+/* Return a word with bit 7 of the lowest byte of W that is not a
+   json_plain_char set, possibly along with bit 7 of higher bytes.
+   Return 0 if there is no such byte.  */
+static inline json_word_t
+json_word_special (json_word_t w)
+{
+  json_word_t quote = w ^ (JSON_WORD_LSBS * '"');
+  json_word_t backslash = w ^ (JSON_WORD_LSBS * '\\');
+  return ((((w - JSON_WORD_LSBS * 0x20) & ~w)
+	   | ((quote - JSON_WORD_LSBS) & ~quote)
+	   | ((backslash - JSON_WORD_LSBS) & ~backslash)
+	   | w)
+	  & JSON_WORD_MSBS);
+}
+
+/* Return the number of json_plain_char bytes at the start of
+   [P, END), testing a word of them at a time.  */
+static ptrdiff_t
+json_plain_length (const unsigned char *p, const unsigned char *end)
+{
+  const unsigned char *start = p;
+  while (end - p >= sizeof (json_word_t))
+    {
+      json_word_t w;
+      memcpy (&w, p, sizeof w);
+#ifdef WORDS_BIGENDIAN
+      w = bswap_64 (w);
+#endif
+      json_word_t special = json_word_special (w);
+      if (special)
+	return p - start + stdc_trailing_zeros (special) / CHAR_BIT;
+      p += sizeof w;
+    }
+  while (p < end && json_plain_char[*p])
+    p++;
+  return p - start;
+}
+
 static void
 json_out_string (json_out_t *jo, Lisp_Object str, int skip)
 {
-  /* FIXME: this code is slow, make faster! */
-
   static const char hexchar[16] = "0123456789ABCDEF";
   ptrdiff_t len = SBYTES (str);
   json_make_room (jo, len + 2);
@@ -334,13 +379,14 @@ json_out_string (json_out_t *jo, Lisp_Object str, int skip)
   p += skip;
   while (p < end)
     {
+      ptrdiff_t plain = json_plain_length (p, end);
+      json_out_str (jo, (const char *) p, plain);
+      p += plain;
+      if (p == end)
+	break;
+
       unsigned char c = *p;
-      if (json_plain_char[c])
-	{
-	  json_out_byte (jo, c);
-	  p++;
-	}
-      else if (c > 0x7f)
+      if (c > 0x7f)
 	{
 	  if (STRING_MULTIBYTE (str))
 	    {
@@ -560,9 +606,11 @@ json_out_something (json_out_t *jo, Lisp_Object obj)
     wrong_type_argument (Qjson_value_p, obj);
 }
 
+/* Serialize OBJECT into JO, configured by the NARGS keyword arguments
+   ARGS.  Leave RESERVE bytes free at the start of the buffer.  */
 static void
 json_serialize (json_out_t *jo, Lisp_Object object,
-		ptrdiff_t nargs, Lisp_Object *args)
+		ptrdiff_t nargs, Lisp_Object *args, ptrdiff_t reserve)
 {
   jo->maxdepth = 50;
   jo->size = 0;
@@ -582,9 +630,37 @@ json_serialize (json_out_t *jo, Lisp_Object object,
   if (!NILP (Vfloat_output_format))
     specbind (Qfloat_output_format, Qnil);
 
+  json_make_room (jo, reserve);
+  jo->size = reserve;
   json_out_something (jo, object);
 }
 
+/* Serialize OBJECT as `json-serialize' does with the NARGS keyword
+   arguments ARGS, preceded by a JSON-RPC Content-Length header.
+   Return the message, and store its length in *NBYTES.  The message
+   is freed when the current binding context is unwound.  */
+const char *
+json_serialize_message (Lisp_Object object, ptrdiff_t nargs,
+			Lisp_Object *args, ptrdiff_t *nbytes)
+{
+  static char const header_format[] = "Content-Length: %"pD"d\r\n\r\n";
+  char header[sizeof header_format + INT_STRLEN_BOUND (ptrdiff_t)];
+  enum { RESERVE = sizeof header };
+
+  json_out_t *jo = xmalloc (sizeof *jo);
+  record_unwind_protect_ptr (xfree, jo);
+  json_serialize (jo, object, nargs, args, RESERVE);
+
+  /* Write the header just before the body, which is then sent along
+     with it from the same buffer.  */
+  ptrdiff_t body_bytes = jo->size - RESERVE;
+  int header_bytes = sprintf (header, header_format, body_bytes);
+  char *message = jo->buf + RESERVE - header_bytes;
+  memcpy (message, header, header_bytes);
+  *nbytes = header_bytes + body_bytes;
+  return message;
+}
+
 DEFUN ("json-serialize", Fjson_serialize, Sjson_serialize, 1, MANY,
        NULL,
        doc: /* Return the JSON representation of OBJECT as a unibyte string.
@@ -619,7 +695,7 @@ DEFUN ("json-serialize", Fjson_serialize, Sjson_serialize, 1, MANY,
 {
   specpdl_ref count = SPECPDL_INDEX ();
   json_out_t jo;
-  json_serialize (&jo, args[0], nargs - 1, args + 1);
+  json_serialize (&jo, args[0], nargs - 1, args + 1, 0);
   return unbind_to (count, make_unibyte_string (jo.buf, jo.size));
 }
 
@@ -636,7 +712,7 @@ DEFUN ("json-insert", Fjson_insert, Sjson_insert, 1, MANY,
 {
   specpdl_ref count = SPECPDL_INDEX ();
   json_out_t jo;
-  json_serialize (&jo, args[0], nargs - 1, args + 1);
+  json_serialize (&jo, args[0], nargs - 1, args + 1, 0);
 
   prepare_modify_buffer (PT, PT, NULL, true);
   move_gap (PT, PT_BYTE);
@@ -811,37 +887,53 @@ json_byte_workspace_reset (struct json_parser *parser)
   parser->byte_workspace_current = parser->byte_workspace;
 }
 
+static NO_INLINE void
+json_byte_workspace_grow (struct json_parser *parser)
+{
+  size_t new_size;
+  if (ckd_mul (&new_size, parser->byte_workspace_end - parser->byte_workspace, 2))
+    json_signal_error (parser, Qoverflow_error);
+  if (parser->byte_workspace == parser->internal_byte_workspace)
+    {
+      const size_t extant_size = (parser->byte_workspace_current -
+				  parser->internal_byte_workspace);
+      /* +1 string terminator */
+      parser->byte_workspace = xmalloc (new_size + 1);
+      memcpy (parser->byte_workspace, parser->internal_byte_workspace, extant_size);
+      parser->byte_workspace_current = parser->byte_workspace + extant_size;
+    }
+  else
+    {
+      const size_t extant_size = (parser->byte_workspace_current -
+				  parser->byte_workspace);
+      /* +1 string terminator */
+      parser->byte_workspace = xrealloc (parser->byte_workspace, new_size + 1);
+      parser->byte_workspace_current = parser->byte_workspace + extant_size;
+    }
+  parser->byte_workspace_end = parser->byte_workspace + new_size;
+}
+
 INLINE void
 json_byte_workspace_put (struct json_parser *parser, const unsigned char value)
 {
   if (parser->byte_workspace_current >= parser->byte_workspace_end)
-    {
-      size_t new_size;
-      if (ckd_mul (&new_size, parser->byte_workspace_end - parser->byte_workspace, 2))
-	json_signal_error (parser, Qoverflow_error);
-      if (parser->byte_workspace == parser->internal_byte_workspace)
-	{
-	  const size_t extant_size = (parser->byte_workspace_current -
-				      parser->internal_byte_workspace);
-	  /* +1 string terminator */
-	  parser->byte_workspace = xmalloc (new_size + 1);
-	  memcpy (parser->byte_workspace, parser->internal_byte_workspace, extant_size);
-	  parser->byte_workspace_current = parser->byte_workspace + extant_size;
-	}
-      else
-	{
-	  const size_t extant_size = (parser->byte_workspace_current -
-				      parser->byte_workspace);
-	  /* +1 string terminator */
-	  parser->byte_workspace = xrealloc (parser->byte_workspace, new_size + 1);
-	  parser->byte_workspace_current = parser->byte_workspace + extant_size;
-	}
-      parser->byte_workspace_end = parser->byte_workspace + new_size;
-    }
+    json_byte_workspace_grow (parser);
   *parser->byte_workspace_current++ = value;
   *parser->byte_workspace_current = '\0'; /* string terminator */
 }
 
+/* Append the NBYTES bytes at BYTES to the byte workspace.  */
+static void
+json_byte_workspace_put_bytes (struct json_parser *parser,
+			       const unsigned char *bytes, ptrdiff_t nbytes)
+{
+  while (parser->byte_workspace_end - parser->byte_workspace_current < nbytes)
+    json_byte_workspace_grow (parser);
+  memcpy (parser->byte_workspace_current, bytes, nbytes);
+  parser->byte_workspace_current += nbytes;
+  *parser->byte_workspace_current = '\0'; /* string terminator */
+}
+
 static bool
 json_input_at_eof (struct json_parser *parser)
 {
@@ -999,29 +1091,14 @@ json_parse_string (struct json_parser *parser, bool intern, bool leading_colon)
   ptrdiff_t chars_delta = 0;	/* nbytes - nchars */
   for (;;)
     {
-      /* This if is only here for a possible speedup.  If there are 4
-	 bytes available, and all of them are single_uninteresting,
-	 then we can just copy these 4 bytes to output */
-      if (parser->input_end - parser->input_current >= 4)
+      /* Copy a run of plain characters at once.  */
+      ptrdiff_t plain = json_plain_length (parser->input_current,
+					   parser->input_end);
+      if (plain > 0)
 	{
-	  int c0 = parser->input_current[0];
-	  int c1 = parser->input_current[1];
-	  int c2 = parser->input_current[2];
-	  int c3 = parser->input_current[3];
-	  bool v0 = json_plain_char[c0];
-	  bool v1 = json_plain_char[c1];
-	  bool v2 = json_plain_char[c2];
-	  bool v3 = json_plain_char[c3];
-	  if (v0 && v1 && v2 && v3)
-	    {
-	      json_byte_workspace_put (parser, c0);
-	      json_byte_workspace_put (parser, c1);
-	      json_byte_workspace_put (parser, c2);
-	      json_byte_workspace_put (parser, c3);
-	      parser->input_current += 4;
-	      parser->current_column += 4;
-	      continue;
-	    }
+	  json_byte_workspace_put_bytes (parser, parser->input_current, plain);
+	  parser->input_current += plain;
+	  parser->current_column += plain;
 	}
 
       int c = json_input_get (parser);
@@ -1750,6 +1827,244 @@ DEFUN ("json-parse-buffer", Fjson_parse_buffer, Sjson_parse_buffer,
   return unbind_to (count, result);
 }
 
+/* Return true if C can continue a number or literal at top level.  */
+static bool
+json_is_scalar_char (int c)
+{
+  return json_is_token_char (c) || c == '.' || c == '+';
+}
+
+/* Parse the complete value in [BEG, END) of the input of STREAM and
+   queue it.  */
+static void
+json_stream_parse_value (struct Lisp_JSON_Stream *stream,
+			 ptrdiff_t beg, ptrdiff_t end)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  struct json_configuration conf
+    = { stream->object_type, stream->array_type,
+	stream->null_object, stream->false_object };
+
+  struct json_parser p;
+  json_parser_init (&p, conf, stream->buf + beg, stream->buf + end,
+		    NULL, NULL);
+  record_unwind_protect_ptr (json_parser_done, &p);
+  Lisp_Object value = json_parse (&p);
+
+  if (json_skip_whitespace_if_possible (&p) >= 0)
+    json_signal_error (&p, Qjson_trailing_content);
+
+  stream->values = Fcons (value, stream->values);
+  unbind_to (count, Qnil);
+}
+
+/* Scan the input of STREAM not scanned yet, parsing each top-level
+   value as soon as its end is found.  The scan only tracks strings
+   and nesting; the parser proper checks the syntax.  The state of
+   STREAM is brought up to date before parsing, so a value that does
+   not parse is dropped and scanning can resume after it.  */
+static void
+json_stream_scan (struct Lisp_JSON_Stream *stream)
+{
+  const unsigned char *buf = stream->buf;
+  ptrdiff_t i = stream->scanned;
+  while (i < stream->end)
+    {
+      int c = buf[i];
+      ptrdiff_t value_end = -1;
+
+      if (stream->in_string)
+	{
+	  if (stream->escaped)
+	    stream->escaped = false;
+	  else if (c == '\\')
+	    stream->escaped = true;
+	  else if (c == '"')
+	    {
+	      stream->in_string = false;
+	      if (stream->depth == 0)
+		value_end = i + 1;
+	    }
+	  i++;
+	}
+      else if (stream->in_scalar)
+	{
+	  /* The byte after a number or literal ends it; scan that
+	     byte again as the start of what follows.  */
+	  if (json_is_scalar_char (c))
+	    i++;
+	  else
+	    {
+	      stream->in_scalar = false;
+	      value_end = i;
+	    }
+	}
+      else if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+	{
+	  i++;
+	  if (stream->value_start < 0)
+	    stream->start = i;
+	}
+      else
+	{
+	  if (stream->value_start < 0)
+	    stream->value_start = i;
+	  switch (c)
+	    {
+	    case '"':
+	      stream->in_string = true;
+	      break;
+	    case '[': case '{':
+	      stream->depth++;
+	      break;
+	    case ']': case '}':
+	      /* A stray closing bracket at top level is a value of its
+		 own, which fails to parse.  */
+	      if (stream->depth > 0)
+		stream->depth--;
+	      if (stream->depth == 0)
+		value_end = i + 1;
+	      break;
+	    default:
+	      if (stream->depth == 0)
+		stream->in_scalar = true;
+	      break;
+	    }
+	  i++;
+	}
+
+      if (value_end >= 0)
+	{
+	  ptrdiff_t beg = stream->value_start;
+	  stream->value_start = -1;
+	  stream->start = stream->scanned = i;
+	  json_stream_parse_value (stream, beg, value_end);
+	}
+    }
+  stream->scanned = i;
+}
+
+/* Append the NBYTES bytes at DATA to the input of STREAM, and parse
+   the values this completes.  */
+void
+json_stream_append (struct Lisp_JSON_Stream *stream,
+		    const unsigned char *data, ptrdiff_t nbytes)
+{
+  if (stream->start == stream->end)
+    stream->start = stream->scanned = stream->end = 0;
+
+  if (stream->size - stream->end < nbytes)
+    {
+      /* Reclaim the space of values already parsed before growing,
+	 which keeps the buffer no larger than about twice the
+	 largest value.  */
+      ptrdiff_t shift = stream->start;
+      if (shift > 0)
+	{
+	  memmove (stream->buf, stream->buf + shift,
+		   stream->end - shift);
+	  stream->start = 0;
+	  stream->scanned -= shift;
+	  stream->end -= shift;
+	  if (stream->value_start >= 0)
+	    stream->value_start -= shift;
+	}
+      if (stream->size - stream->end < nbytes)
+	stream->buf = xpalloc (stream->buf, &stream->size,
+			       nbytes - (stream->size - stream->end), -1, 1);
+    }
+
+  if (nbytes > 0)
+    {
+      memcpy (stream->buf + stream->end, data, nbytes);
+      stream->end += nbytes;
+    }
+  json_stream_scan (stream);
+}
+
+/* Discard the input of STREAM not yet parsed.  */
+void
+json_stream_reset (struct Lisp_JSON_Stream *stream)
+{
+  stream->start = stream->scanned = stream->end = 0;
+  stream->value_start = -1;
+  stream->depth = 0;
+  stream->in_string = stream->escaped = stream->in_scalar = false;
+}
+
+/* Return the values parsed by STREAM since the last call, in order,
+   and forget them.  */
+Lisp_Object
+json_stream_take_values (struct Lisp_JSON_Stream *stream)
+{
+  Lisp_Object values = Fnreverse (stream->values);
+  stream->values = Qnil;
+  return values;
+}
+
+DEFUN ("json-make-stream", Fjson_make_stream, Sjson_make_stream,
+       0, MANY, NULL,
+       doc: /* Return a new stream for parsing JSON input in pieces.
+Hand input to the stream with `json-stream-feed'.
+
+The arguments ARGS are a list of keyword/argument pairs, with the same
+meaning as for `json-parse-string'.
+usage: (json-make-stream &rest ARGS) */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  struct json_configuration conf
+    = { json_object_hashtable, json_array_array, QCnull, QCfalse };
+  json_parse_args (nargs, args, &conf, true);
+
+  struct Lisp_JSON_Stream *stream
+    = ALLOCATE_PSEUDOVECTOR (struct Lisp_JSON_Stream, false_object,
+			     PVEC_JSON_STREAM);
+  stream->values = Qnil;
+  stream->null_object = conf.null_object;
+  stream->false_object = conf.false_object;
+  stream->object_type = conf.object_type;
+  stream->array_type = conf.array_type;
+  stream->buf = NULL;
+  stream->size = 0;
+  json_stream_reset (stream);
+
+  Lisp_Object obj;
+  XSETPSEUDOVECTOR (obj, stream, PVEC_JSON_STREAM);
+  return obj;
+}
+
+DEFUN ("json-stream-p", Fjson_stream_p, Sjson_stream_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is a JSON stream.  */)
+  (Lisp_Object object)
+{
+  return JSON_STREAM_P (object) ? Qt : Qnil;
+}
+
+DEFUN ("json-stream-feed", Fjson_stream_feed, Sjson_stream_feed, 2, 2, 0,
+       doc: /* Add STRING to the input of JSON STREAM.
+Return a list of the top-level JSON values completed by STRING, in
+the order they appear in the input.
+
+A value may be split across any number of calls.  Its bytes are kept
+in STREAM until the value is complete, and are examined only once
+before it is parsed, so feeding a large value in many small pieces
+costs no rescanning.  A top-level number, `true', `false' or `null'
+is complete only when the byte following it arrives.
+
+If a completed value is not valid JSON, signal an error as
+`json-parse-string' does.  The invalid value is discarded, values
+completed before it are returned by the next call, and input after
+it stays in STREAM.  Call this function with an empty STRING to
+resume parsing that input.  */)
+  (Lisp_Object stream, Lisp_Object string)
+{
+  CHECK_JSON_STREAM (stream);
+  CHECK_STRING (string);
+  struct Lisp_JSON_Stream *s = XJSON_STREAM (stream);
+  json_stream_append (s, SDATA (string), SBYTES (string));
+  return json_stream_take_values (s);
+}
+
 void
 syms_of_json (void)
 {
@@ -1809,4 +2124,9 @@ syms_of_json (void)
   defsubr (&Sjson_insert);
   defsubr (&Sjson_parse_string);
   defsubr (&Sjson_parse_buffer);
+
+  DEFSYM (Qjson_stream_p, "json-stream-p");
+  defsubr (&Sjson_make_stream);
+  defsubr (&Sjson_stream_p);
+  defsubr (&Sjson_stream_feed);
 }
@@ -0,0 +1,96 @@
+/* Header file for incremental JSON parsing.
+
+Copyright (C) 2024 Free Software Foundation, Inc.
+
+This file is NOT part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+#ifndef EMACS_JSON_H
+#define EMACS_JSON_H
+
+#include "lisp.h"
+
+INLINE_HEADER_BEGIN
+
+/* A JSON stream accumulates input handed to it in arbitrary chunks
+   and parses each top-level value as soon as its last byte arrives.
+   Input is scanned only once to find where values end, so feeding a
+   large value piecemeal costs no rescans.  */
+
+struct Lisp_JSON_Stream
+{
+  union vectorlike_header header;
+
+  /* Parsed values not yet handed out, most recent first.  */
+  Lisp_Object values;
+
+  /* Objects representing JSON null and false.  */
+  Lisp_Object null_object;
+  Lisp_Object false_object;
+
+  /* Representation of objects and arrays, an enum json_object_type
+     and enum json_array_type.  */
+  int object_type;
+  int array_type;
+
+  /* Pending input is [BUF + START, BUF + END), of which bytes below
+     BUF + SCANNED have been scanned.  BUF has SIZE bytes.  */
+  unsigned char *buf;
+  ptrdiff_t size;
+  ptrdiff_t start;
+  ptrdiff_t scanned;
+  ptrdiff_t end;
+
+  /* State of the scan: the offset in BUF where the value being
+     scanned begins or -1 between values, the number of arrays and
+     objects open, and whether the scan is inside a string, right
+     after a backslash in one, or inside a top-level number or
+     literal.  */
+  ptrdiff_t value_start;
+  ptrdiff_t depth;
+  bool_bf in_string : 1;
+  bool_bf escaped : 1;
+  bool_bf in_scalar : 1;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+JSON_STREAM_P (Lisp_Object x)
+{
+  return PSEUDOVECTORP (x, PVEC_JSON_STREAM);
+}
+
+INLINE struct Lisp_JSON_Stream *
+XJSON_STREAM (Lisp_Object a)
+{
+  eassert (JSON_STREAM_P (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_JSON_Stream);
+}
+
+INLINE void
+CHECK_JSON_STREAM (Lisp_Object x)
+{
+  CHECK_TYPE (JSON_STREAM_P (x), Qjson_stream_p, x);
+}
+
+extern void json_stream_append (struct Lisp_JSON_Stream *,
+				const unsigned char *, ptrdiff_t);
+extern Lisp_Object json_stream_take_values (struct Lisp_JSON_Stream *);
+extern void json_stream_reset (struct Lisp_JSON_Stream *);
+extern const char *json_serialize_message (Lisp_Object, ptrdiff_t,
+					   Lisp_Object *, ptrdiff_t *);
+
+INLINE_HEADER_END
+
+#endif /* EMACS_JSON_H */
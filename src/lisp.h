@@ -934,6 +934,7 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_TREE_SITTER,
   PVEC_TREE_SITTER_NODE,
   PVEC_TREE_SITTER_CURSOR,
+  PVEC_JSON_STREAM,
 
   /* These must be last, for sx_hash.  */
   PVEC_CLOSURE,
@@ -2285,43 +2286,68 @@ #define DOOBARRAY(oa, it)					\
    (hash) indices.  It's signed and a subtype of ptrdiff_t.  */
 typedef int32_t hash_idx_t;
 
+/* Control byte values of hash table index slots.  Slots in use
+   instead hold a tag in the range 0..0x7f.  */
+enum
+  {
+    HASH_CTRL_EMPTY = 0x80,	/* Slot never used since last rebuild.  */
+    HASH_CTRL_DELETED = 0xfe,	/* Slot vacated; probing continues.  */
+  };
+
+/* Hash table index slots come in groups of HASH_GROUP_WIDTH, whose
+   control bytes are examined at once when probing.  */
+enum { HASH_GROUP_BITS = 3, HASH_GROUP_WIDTH = 1 << HASH_GROUP_BITS };
+
+struct hash_index_group
+{
+  /* Control bytes: HASH_CTRL_EMPTY, HASH_CTRL_DELETED, or the tag of
+     the entry the slot points to.  */
+  unsigned char ctrl[HASH_GROUP_WIDTH];
+
+  /* Entry numbers, meaningful only in slots with a tag.  */
+  hash_idx_t entry[HASH_GROUP_WIDTH];
+};
+
 struct Lisp_Hash_Table
 {
   union vectorlike_header header;
 
   /* Hash table internal structure:
 
-     Lisp key         index                  table
-         |            vector
-         | hash fn                  hash    key   value  next
-         v             +--+       +------+-------+------+----+
-     hash value        |-1|       | C351 |  cow  | moo  | -1 |<-
-         |             +--+       +------+-------+------+----+  |
-          ------------>| -------->| 07A8 |  cat  | meow | -1 |  |
-            range      +--+       +------+-------+------+----+  |
-          reduction    |-1|     ->| 91D2 |  dog  | woof |   ----
-                       +--+    |  +------+-------+------+----+
-                       | ------   |  ?   |unbound|  ?   | -1 |<-
-                       +--+       +------+-------+------+----+  |
-                       | -------->| F6B0 | duck  |quack | -1 |  |
-                       +--+       +------+-------+------+----+  |
-                       |-1|     ->|  ?   |unbound|  ?   |   ----
-                       +--+    |  +------+-------+------+----+
-                       :  :    |  :      :       :     :    :
-                               |
-                           next_free
-
-     The table is physically split into three vectors (hash, next,
-     key_and_value) which may or may not be beneficial.  */
-
-  /* Bucket vector.  An entry of -1 indicates no item is present,
-     and a nonnegative entry is the index of the first item in
-     a collision chain.
-     This vector is 2**index_bits entries long.
-     If index_bits is 0 (and table_size is 0), then this is the
-     constant read-only vector {-1}, shared between all instances.
+     Lisp key
+         |
+         | hash fn        index group
+         v               +----+----+----+----+--  --+---+---+---+---+--  --+
+     hash value -------->| 2B | 80 | 13 | FE |  ..  | 1 | ? | 0 | ? |  ..  |
+         |   range       +----+----+----+----+--  --+---+---+---+---+--  --+
+         |   reduction        control bytes            |  entries  |
+          -> tag 13                                    |           |
+                                  table                |           |
+                     hash    key   value  next         |           |
+                   +------+-------+------+----+        |           |
+                 0 | 91D2 |  dog  | woof |  ? |<-------|-----------
+                   +------+-------+------+----+        |
+                 1 | 07A8 |  cat  | meow |  ? |<-------
+                   +------+-------+------+----+
+                 2 |  ?   |unbound|  ?   | -1 |<- next_free
+                   +------+-------+------+----+
+                   :      :       :      :    :
+
+     The index is open-addressed.  Each slot has a control byte that
+     is either HASH_CTRL_EMPTY, HASH_CTRL_DELETED or a 7-bit tag
+     derived from the hash code of the entry the slot points to.
+     Probing tests all control bytes of a group at once, so that the
+     key and hash of an entry are touched only when its tag matches,
+     and a lookup usually costs one cache miss in the index.  Entries
+     stay packed in the hash, key_and_value and next vectors, which
+     keeps `maphash' and DOHASH ordering independent of the index.  */
+
+  /* Index vector, in groups of HASH_GROUP_WIDTH slots.
+     This vector is 2**index_bits slots long.
+     If table_size is 0, then this is the constant read-only group of
+     empty slots, shared between all instances.
      Otherwise it is heap-allocated.  */
-  hash_idx_t *index;
+  struct hash_index_group *index;
 
   /* Vector of hash codes.  Unused entries have undefined values.
      This vector is table_size entries long.  */
@@ -2337,10 +2363,9 @@ #define DOOBARRAY(oa, it)					\
   /* The comparison and hash functions.  */
   const struct hash_table_test *test;
 
-  /* Vector used to chain entries.  If entry I is free, next[I] is the
-     entry number of the next free item.  If entry I is non-free,
-     next[I] is the index of the next entry in the collision chain,
-     or -1 if there is no such entry.
+  /* Free list of entries.  If entry I is free, next[I] is the entry
+     number of the next free item, or -1 if there is no such entry.
+     Values for entries in use are undefined.
      This vector is table_size entries long.  */
   hash_idx_t *next;
 
@@ -2350,6 +2375,10 @@ #define DOOBARRAY(oa, it)					\
   /* Index of first free entry in free list, or -1 if none.  */
   hash_idx_t next_free;
 
+  /* Number of empty index slots that can still be claimed before
+     deleted slots must be reclaimed by rebuilding the index.  */
+  hash_idx_t growth_left;
+
   hash_idx_t table_size;   /* Size of the next and hash vectors.  */
 
   unsigned char index_bits;	/* log2 (size of the index vector).  */
@@ -3861,6 +3890,10 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 /* Defined in syntax.c.  */
 extern void init_syntax_once (void);
 extern void syms_of_syntax (void);
+struct syntax_checkpoints;
+extern void invalidate_syntax_checkpoints (struct buffer *, ptrdiff_t);
+extern void free_syntax_checkpoints (struct syntax_checkpoints *);
+extern void mark_syntax_checkpoints (struct syntax_checkpoints *);
 
 /* Defined in fns.c.  */
 enum { NEXT_ALMOST_PRIME_LIMIT = 11 };
@@ -4019,6 +4052,7 @@ static_assert (FLT_RADIX == 2 || FLT_RADIX == 16);
 extern void truncate_echo_area (ptrdiff_t);
 extern void redisplay (void);
 extern ptrdiff_t count_lines (ptrdiff_t start_byte, ptrdiff_t end_byte);
+extern void clear_sline_caches (void);
 
 void set_frame_cursor_types (struct frame *, Lisp_Object);
 extern void syms_of_xdisp (void);
@@ -4525,6 +4559,7 @@ XMODULE_FUNCTION (Lisp_Object o)
 
 /* Defined in search.c.  */
 extern void compact_regexp_cache (void);
+extern void mark_regexp_cache (void);
 extern void update_search_regs (ptrdiff_t oldstart,
                                 ptrdiff_t oldend, ptrdiff_t newend);
 extern void record_unwind_save_match_data (void);
@@ -4549,6 +4584,18 @@ fast_string_match_ignore_case (Lisp_Object regexp, Lisp_Object string)
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
 extern ptrdiff_t find_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
 			       ptrdiff_t, ptrdiff_t *, ptrdiff_t *, bool);
+/* Bytes of text whose newlines skip_newlines_forward and
+   skip_newlines_backward count at once.  */
+enum { NEWLINE_BLOCK = 256 };
+extern ptrdiff_t skip_newlines_forward (const unsigned char *, ptrdiff_t,
+					ptrdiff_t *);
+extern ptrdiff_t skip_newlines_backward (const unsigned char *, ptrdiff_t,
+					 ptrdiff_t *);
+struct line_index;
+extern bool line_index_scan (ptrdiff_t, ptrdiff_t, ptrdiff_t,
+			     ptrdiff_t *, ptrdiff_t *);
+extern void invalidate_line_index (struct line_index *, ptrdiff_t, ptrdiff_t);
+extern void free_line_index (struct line_index *);
 extern void scan_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
 			  ptrdiff_t, bool);
 extern ptrdiff_t scan_newline_from_point (ptrdiff_t, ptrdiff_t *, ptrdiff_t *);
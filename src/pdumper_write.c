@@ -2036,6 +2036,7 @@ hash_table_freeze (struct Lisp_Hash_Table *h)
   h->index = NULL;
   h->table_size = 0;
   h->index_bits = 0;
+  h->growth_left = 0;
   h->frozen_test = hash_table_std_test (h->test);
   h->test = NULL;
 }
@@ -2066,7 +2067,7 @@ dump_hash_table_contents (struct dump_context *ctx, struct Lisp_Hash_Table *h)
 static dump_off
 dump_hash_table (struct dump_context *ctx, Lisp_Object object)
 {
-#if CHECK_STRUCTS && !defined HASH_Lisp_Hash_Table_0360833954
+#if CHECK_STRUCTS && !defined HASH_Lisp_Hash_Table_C396905E99
 # error "Lisp_Hash_Table changed. See CHECK_STRUCTS comment in config.h."
 #endif
   const struct Lisp_Hash_Table *hash_in = XHASH_TABLE (object);
@@ -2234,6 +2235,8 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->line_index = NULL;
+  out->syntax_checkpoints = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -2437,6 +2440,7 @@ dump_vectorlike (struct dump_context *ctx,
     case PVEC_TREE_SITTER:
     case PVEC_TREE_SITTER_NODE:
     case PVEC_TREE_SITTER_CURSOR:
+    case PVEC_JSON_STREAM:
       break;
     }
   char msg[60];
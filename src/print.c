@@ -55,6 +55,8 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include <sqlite.h>
 #endif
 
+#include "json.h"
+
 struct terminal;
 
 /* Avoid actual stack overflow in print.  */
@@ -1988,6 +1990,15 @@ print_vectorlike_unreadable (Lisp_Object obj, Lisp_Object printcharfun,
       }
 #endif
       break;
+    case PVEC_JSON_STREAM:
+      {
+	struct Lisp_JSON_Stream *stream = XJSON_STREAM (obj);
+	print_c_string ("#<json-stream pending ", printcharfun);
+	int len = sprintf (buf, "%"pD"d", stream->end - stream->start);
+	strout (buf, len, len, printcharfun);
+	printchar ('>', printcharfun);
+      }
+      break;
     case PVEC_OBARRAY:
       {
 	struct Lisp_Obarray *o = XOBARRAY (obj);
@@ -97,6 +97,7 @@ #define HAVE_LOCAL_SOCKETS
 #include "buffer.h"
 #include "coding.h"
 #include "process.h"
+#include "json.h"
 #include "frame.h"
 #include "termopts.h"
 #include "keyboard.h"
@@ -353,6 +354,11 @@ pset_thread (struct Lisp_Process *p, Lisp_Object val)
 {
   p->thread = val;
 }
+static void
+pset_jsonrpc (struct Lisp_Process *p, Lisp_Object val)
+{
+  p->jsonrpc = val;
+}
 
 static void
 pset_name (struct Lisp_Process *p, Lisp_Object val)
@@ -718,7 +724,7 @@ allocate_pty (char pty_name[PTY_NAME_SIZE])
 static struct Lisp_Process *
 allocate_process (void)
 {
-  return ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Process, thread,
+  return ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Process, jsonrpc,
 				       PVEC_PROCESS);
 }
 
@@ -1225,6 +1231,37 @@ DEFUN ("process-filter", Fprocess_filter, Sprocess_filter,
   return XPROCESS (process)->filter;
 }
 
+DEFUN ("set-process-jsonrpc", Fset_process_jsonrpc, Sset_process_jsonrpc,
+       2, MANY, 0,
+       doc: /* Set whether output of PROCESS is read as JSON-RPC messages.
+If FLAG is non-nil, the output of PROCESS is taken to be a sequence of
+messages framed as in the Language Server Protocol: header lines, one
+of them a Content-Length field, then an empty line, then a JSON body
+of that many bytes.  Each body is parsed as by `json-parse-string',
+with the keyword/argument pairs ARGS, and the filter function of
+PROCESS is called with the process and the parsed message in place of
+a string of output.  The coding system for decoding output of PROCESS
+is not used.  An error parsing a body is reported like an error in
+the filter, and the next message is read normally.
+
+If FLAG is nil, pass output of PROCESS to its filter as text again.
+
+Use `process-send-jsonrpc' to send messages framed the same way.
+usage: (set-process-jsonrpc PROCESS FLAG &rest ARGS)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  Lisp_Object process = args[0];
+  CHECK_PROCESS (process);
+  struct Lisp_Process *p = XPROCESS (process);
+  pset_jsonrpc (p, (NILP (args[1]) ? Qnil
+		    : Fjson_make_stream (nargs - 2, args + 2)));
+  p->jsonrpc_body_left = 0;
+  p->jsonrpc_content_length = -1;
+  p->jsonrpc_line_length = 0;
+  p->jsonrpc_skip_line = false;
+  return Qnil;
+}
+
 DEFUN ("set-process-sentinel", Fset_process_sentinel, Sset_process_sentinel,
        2, 2, 0,
        doc: /* Give PROCESS the sentinel SENTINEL; nil for default.
@@ -5601,6 +5638,109 @@ read_process_output_error_handler (Lisp_Object error_val, ptrdiff_t, Lisp_Object
   return error_handler_common ();
 }
 
+/* Feed ARGS[2] bytes at the address in ARGS[1] to the JSON stream
+   ARGS[0], and if ARGS[3] is non-nil, take the message completed.  */
+
+static Lisp_Object
+read_process_output_jsonrpc_feed (ptrdiff_t nargs, Lisp_Object *args)
+{
+  struct Lisp_JSON_Stream *stream = XJSON_STREAM (args[0]);
+  json_stream_append (stream, xmint_pointer (args[1]), XFIXNUM (args[2]));
+  if (NILP (args[3]))
+    return Qnil;
+
+  /* A newline completes a body that is a bare number or literal.  */
+  json_stream_append (stream, (const unsigned char *) "\n", 1);
+  return json_stream_take_values (stream);
+}
+
+/* Frame the NBYTES bytes at BUF read from PROC as JSON-RPC messages,
+   each some header lines, one of which gives the Content-Length of
+   the JSON body following the empty line that ends them.  Call the
+   filter of PROC with each message as it is parsed.  The state of
+   the framing is kept in PROC between calls.  */
+
+static void
+read_process_output_jsonrpc (Lisp_Object proc, const unsigned char *buf,
+			     ptrdiff_t nbytes)
+{
+  static char const field[] = "content-length:";
+  struct Lisp_Process *p = XPROCESS (proc);
+  const unsigned char *end = buf + nbytes;
+
+  while (buf < end && JSON_STREAM_P (p->jsonrpc))
+    {
+      if (p->jsonrpc_body_left > 0)
+	{
+	  ptrdiff_t n = min (end - buf, p->jsonrpc_body_left);
+	  p->jsonrpc_body_left -= n;
+	  Lisp_Object args[4] = { p->jsonrpc, make_mint_ptr ((void *) buf),
+				  make_fixnum (n),
+				  p->jsonrpc_body_left == 0 ? Qt : Qnil };
+	  buf += n;
+	  Lisp_Object messages
+	    = internal_condition_case_n (read_process_output_jsonrpc_feed,
+					 4, args,
+					 (!NILP (Vdebug_on_error)
+					  ? Qerror : Qnil),
+					 read_process_output_error_handler);
+	  for (; CONSP (messages); messages = XCDR (messages))
+	    {
+	      Lisp_Object call[3] = { p->filter, proc, XCAR (messages) };
+	      internal_condition_case_n (read_process_output_call, 3, call,
+					 (!NILP (Vdebug_on_error)
+					  ? Qerror : Qnil),
+					 read_process_output_error_handler);
+	    }
+	  continue;
+	}
+
+      int c = *buf++;
+      if (c == '\n')
+	{
+	  /* An empty line ends the headers, but blank lines before
+	     any Content-Length are tolerated.  */
+	  if (p->jsonrpc_line_length == 0 && p->jsonrpc_content_length >= 0)
+	    {
+	      p->jsonrpc_body_left = p->jsonrpc_content_length;
+	      p->jsonrpc_content_length = -1;
+	      json_stream_reset (XJSON_STREAM (p->jsonrpc));
+	    }
+	  p->jsonrpc_line_length = 0;
+	  p->jsonrpc_skip_line = false;
+	}
+      else if (c != '\r')
+	{
+	  ptrdiff_t i = p->jsonrpc_line_length++;
+	  if (p->jsonrpc_skip_line)
+	    ;
+	  else if (i < sizeof field - 1)
+	    {
+	      if (c_tolower (c) != field[i])
+		p->jsonrpc_skip_line = true;
+	      else if (i == sizeof field - 2)
+		p->jsonrpc_content_length = 0;
+	    }
+	  else if ('0' <= c && c <= '9')
+	    {
+	      if (ckd_mul (&p->jsonrpc_content_length,
+			   p->jsonrpc_content_length, 10)
+		  || ckd_add (&p->jsonrpc_content_length,
+			      p->jsonrpc_content_length, c - '0'))
+		{
+		  p->jsonrpc_content_length = -1;
+		  p->jsonrpc_skip_line = true;
+		}
+	    }
+	  else if (c != ' ' && c != '\t')
+	    {
+	      p->jsonrpc_content_length = -1;
+	      p->jsonrpc_skip_line = true;
+	    }
+	}
+    }
+}
+
 /* Read pending output from the process channel.  Return number of
    decoded characters read, or -1 upon error.
 
@@ -5687,6 +5827,12 @@ read_process_output (Lisp_Object proc)
   specbind (Qinhibit_quit, Qt);
   specbind (Qlast_nonmenu_event, Qt);
 
+  if (JSON_STREAM_P (p->jsonrpc))
+    {
+      read_process_output_jsonrpc (proc, (unsigned char *) chars, nbytes);
+      goto done;
+    }
+
   decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
   Vlast_coding_system_used = CODING_ID_NAME (coding->id);
   if (coding->carryover_bytes > 0)
@@ -6126,6 +6272,26 @@ DEFUN ("process-send-string", Fprocess_send_string, Sprocess_send_string,
   return Qnil;
 }
 
+DEFUN ("process-send-jsonrpc", Fprocess_send_jsonrpc, Sprocess_send_jsonrpc,
+       2, MANY, 0,
+       doc: /* Send PROCESS the JSON representation of OBJECT as a message.
+The message is a Content-Length header followed by OBJECT serialized
+as by `json-serialize' with the keyword/argument pairs ARGS.  It is
+written from the buffer it is serialized into, bypassing the coding
+system for encoding input to PROCESS, so it is not converted to a
+string first.  PROCESS is as for `process-send-string'.
+usage: (process-send-jsonrpc PROCESS OBJECT &rest ARGS)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  Lisp_Object proc = get_process (args[0]);
+  ptrdiff_t nbytes;
+  const char *message = json_serialize_message (args[1], nargs - 2, args + 2,
+						&nbytes);
+  send_process (proc, message, nbytes, Qnil);
+  return unbind_to (count, Qnil);
+}
+
 /* Return the foreground process group for the tty/pty that
    the process P uses.  */
 static pid_t
@@ -7765,6 +7931,7 @@ syms_of_process (void)
   defsubr (&Sprocess_mark);
   defsubr (&Sset_process_filter);
   defsubr (&Sprocess_filter);
+  defsubr (&Sset_process_jsonrpc);
   defsubr (&Sset_process_sentinel);
   defsubr (&Sprocess_sentinel);
   defsubr (&Sset_process_thread);
@@ -7794,6 +7961,7 @@ syms_of_process (void)
   defsubr (&Saccept_process_output);
   defsubr (&Sprocess_send_region);
   defsubr (&Sprocess_send_string);
+  defsubr (&Sprocess_send_jsonrpc);
   defsubr (&Sinternal_default_interrupt_process);
   defsubr (&Sinterrupt_process);
   defsubr (&Skill_process);
@@ -119,6 +119,10 @@ #define EMACS_PROCESS_H
     /* The thread a process is linked to, or nil for any thread.  */
     Lisp_Object thread;
 
+    /* JSON stream parsing the bodies of JSON-RPC messages read from
+       this process, or nil if output is passed on as text.  */
+    Lisp_Object jsonrpc;
+
     /* Process ID.  A positive value is a child process ID.
        Zero is for pseudo-processes such as network or serial connections,
        or for processes that have not been fully created yet.
@@ -140,6 +144,13 @@ #define EMACS_PROCESS_H
     EMACS_INT update_tick;
     /* Size of carryover in decoding.  */
     int decoding_carryover;
+    /* JSON-RPC framing of output: bytes of the message body still to
+       read, or 0 while reading headers; the value of the
+       Content-Length header of the next body, or -1 if none has been
+       read; and the length so far of the header line being read.  */
+    ptrdiff_t jsonrpc_body_left;
+    ptrdiff_t jsonrpc_content_length;
+    ptrdiff_t jsonrpc_line_length;
     /* Hysteresis to try to read process output in larger blocks.
        On some systems, e.g. GNU/Linux, Emacs is seen as
        an interactive app also when reading process output, meaning
@@ -176,6 +187,8 @@ #define EMACS_PROCESS_H
     bool_bf is_server : 1;
     /* Whether to skip in wait_reading_process_output().  */
     bool_bf thread_managed : 1;
+    /* Whether the header line being read is not a Content-Length.  */
+    bool_bf jsonrpc_skip_line : 1;
     int raw_status;
     /* The length of the socket backlog. */
     int backlog;
@@ -27,6 +27,7 @@
 
 #include "regex-emacs.h"
 
+#include <flexmember.h>
 #include <stdlib.h>
 
 #include "character.h"
@@ -191,7 +192,22 @@ #define BYTEWIDTH 8 /* In bits.  */
 				     re_char *string2, ptrdiff_t size2,
 				     ptrdiff_t pos,
 				     struct re_registers *regs,
-				     ptrdiff_t stop);
+				     ptrdiff_t stop, bool limited);
+static struct re_dfa *re_dfa_get (struct re_pattern_buffer *);
+static void re_dfa_free (struct re_dfa *);
+static ptrdiff_t re_dfa_search (struct re_pattern_buffer *, struct re_dfa *,
+				re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+				ptrdiff_t, ptrdiff_t, ptrdiff_t, bool);
+static ptrdiff_t re_dfa_prescan (struct re_pattern_buffer *, struct re_dfa *,
+				 re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+				 ptrdiff_t *, ptrdiff_t, ptrdiff_t);
+static ptrdiff_t re_dfa_match (struct re_pattern_buffer *, struct re_dfa *,
+			       re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+			       ptrdiff_t, struct re_registers *, ptrdiff_t);
+static struct re_literal *re_literal_get (struct re_pattern_buffer *);
+static ptrdiff_t re_literal_skip (struct re_literal *, bool,
+				  re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+				  ptrdiff_t, ptrdiff_t, ptrdiff_t *);
 
 /* These are the command codes that appear in compiled regular
    expressions.  Some opcodes are followed by argument bytes.  A
@@ -864,6 +880,39 @@ print_double_string (re_char *where, re_char *string1, ptrdiff_t size1,
    're_match_2' returns information about at least this many registers
    the first time a 'regs' structure is passed.  */
 enum { RE_NREGS = 30 };
+
+/* Make sure REGS, which is to receive the registers of a match of
+   BUFP, has room for NUM_REGS of them, allocating it as
+   BUFP->regs_allocated says.  */
+static void
+re_alloc_registers (struct re_pattern_buffer *bufp, struct re_registers *regs,
+		    ptrdiff_t num_regs)
+{
+  /* Have the register data arrays been allocated?	*/
+  if (bufp->regs_allocated == REGS_UNALLOCATED)
+    { /* No.  So allocate them with malloc.  */
+      ptrdiff_t n = max (RE_NREGS, num_regs);
+      regs->start = xnmalloc (n, sizeof *regs->start);
+      regs->end = xnmalloc (n, sizeof *regs->end);
+      regs->num_regs = n;
+      bufp->regs_allocated = REGS_REALLOCATE;
+    }
+  else if (bufp->regs_allocated == REGS_REALLOCATE)
+    { /* Yes.  If we need more elements than were already
+	 allocated, reallocate them.  If we need fewer, just
+	 leave it alone.  */
+      ptrdiff_t n = regs->num_regs;
+      if (n < num_regs)
+	{
+	  n = max (n + (n >> 1), num_regs);
+	  regs->start = xnrealloc (regs->start, n, sizeof *regs->start);
+	  regs->end = xnrealloc (regs->end, n, sizeof *regs->end);
+	  regs->num_regs = n;
+	}
+    }
+  else
+    eassert (bufp->regs_allocated == REGS_FIXED);
+}
 
 /* The searching and matching functions allocate memory for the
    failure stack and registers.  Otherwise searching and matching
@@ -1790,6 +1839,13 @@ regex_compile (re_char *pattern, ptrdiff_t size,
   /* Initialize the pattern buffer.  */
   bufp->fastmap_accurate = false;
   bufp->used_syntax = false;
+  re_dfa_free (bufp->dfa);
+  bufp->dfa = NULL;
+  bufp->dfa_analyzed = false;
+  bufp->dfa_eager = false;
+  xfree (bufp->literal);
+  bufp->literal = NULL;
+  bufp->literal_analyzed = false;
 
   /* Set 'used' to zero, so that if we return an error, the pattern
      printer (for debugging) will think there's no pattern.  We reset it
@@ -3364,6 +3420,20 @@ re_set_registers (struct re_pattern_buffer *bufp, struct re_registers *regs,
       regs->start = regs->end = 0;
     }
 }
+
+/* Free the memory that BUFP owns, other than its fastmap.  */
+
+void
+re_free_pattern (struct re_pattern_buffer *bufp)
+{
+  xfree (bufp->buffer);
+  bufp->buffer = NULL;
+  bufp->allocated = 0;
+  re_dfa_free (bufp->dfa);
+  bufp->dfa = NULL;
+  xfree (bufp->literal);
+  bufp->literal = NULL;
+}
 
 /* Searching routines.  */
 
@@ -3446,7 +3516,7 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
      don't keep searching past point.  */
   if (bufp->used > 0 && (re_opcode_t) bufp->buffer[0] == at_dot && range > 0)
     {
-      range = PT_BYTE - BEGV_BYTE - startpos;
+      range = min (range, PT_BYTE - BEGV_BYTE - startpos);
       if (range < 0)
 	return -1;
     }
@@ -3460,9 +3530,39 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, startpos);
 
+  /* If backtracking this pattern has been seen to get out of hand,
+     consult its DFA before backtracking.  */
+  struct re_dfa *dfa = re_dfa_get (bufp);
+  bool use_dfa = dfa && bufp->dfa_eager;
+  if (use_dfa && range > 0)
+    {
+      range = re_dfa_prescan (bufp, dfa, string1, size1, string2, size2,
+			      &startpos, range, stop);
+      if (range < 0)
+	return -1;
+    }
+
+  struct re_literal *literal = range > 0 ? re_literal_get (bufp) : NULL;
+  ptrdiff_t literal_pos = -1;
+
   /* Loop through the string, looking for a place to start matching.  */
   for (;;)
     {
+      /* Skip to where a match could contain the required literal, if
+	 it is not already known to occur after STARTPOS.  */
+      if (literal && range > 0 && startpos > literal_pos)
+	{
+	  ptrdiff_t pos = re_literal_skip (literal, multibyte,
+					   string1, size1, string2, size2,
+					   startpos, stop, &literal_pos);
+	  if (pos < 0)
+	    return -1;
+	  range -= pos - startpos;
+	  if (range < 0)
+	    return -1;
+	  startpos = pos;
+	}
+
       /* If the pattern is anchored,
 	 skip quickly past places we cannot match.
 	 Don't bother to treat startpos == 0 specially
@@ -3575,8 +3675,29 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	  && !bufp->can_be_null)
 	return -1;
 
-      val = re_match_2_internal (bufp, string1, size1, string2, size2,
-				 startpos, regs, stop);
+      if (use_dfa)
+	val = re_dfa_match (bufp, dfa, string1, size1, string2, size2,
+			    startpos, regs, stop);
+      else
+	{
+	  val = re_match_2_internal (bufp, string1, size1, string2, size2,
+				     startpos, regs, stop, dfa != NULL);
+	  if (val == -3)
+	    {
+	      /* Backtracking gave up.  Let the DFA take over.  */
+	      bufp->dfa_eager = use_dfa = true;
+	      if (range > 0)
+		{
+		  range = re_dfa_prescan (bufp, dfa, string1, size1,
+					  string2, size2, &startpos, range,
+					  stop);
+		  if (range < 0)
+		    return -1;
+		}
+	      val = re_dfa_match (bufp, dfa, string1, size1, string2, size2,
+				  startpos, regs, stop);
+	    }
+	}
 
       if (val >= 0)
 	return startpos;
@@ -4052,9 +4173,20 @@ re_match_2 (struct re_pattern_buffer *bufp,
 
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, pos);
 
+  struct re_dfa *dfa = re_dfa_get (bufp);
+  if (dfa && bufp->dfa_eager)
+    return re_dfa_match (bufp, dfa, (re_char *) string1, size1,
+			 (re_char *) string2, size2, pos, regs, stop);
+
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
 				(re_char *) string2, size2,
-				pos, regs, stop);
+				pos, regs, stop, dfa != NULL);
+  if (result == -3)
+    {
+      bufp->dfa_eager = true;
+      result = re_dfa_match (bufp, dfa, (re_char *) string1, size1,
+			     (re_char *) string2, size2, pos, regs, stop);
+    }
   return result;
 }
 
@@ -4065,195 +4197,2227 @@ unwind_re_match (void *ptr)
   b->text->inhibit_shrinking = 0;
 }
 
-/* This is a separate function so that we can force an alloca cleanup
-   afterwards.  */
-static ptrdiff_t
-re_match_2_internal (struct re_pattern_buffer *bufp,
-		     re_char *string1, ptrdiff_t size1,
-		     re_char *string2, ptrdiff_t size2,
-		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
-{
-  eassume (0 <= size1);
-  eassume (0 <= size2);
-  eassume (0 <= pos && pos <= stop && stop <= size1 + size2);
-
-  /* General temporaries.  */
-  int mcnt;
-
-  /* Just past the end of the corresponding string.  */
-  re_char *end1, *end2;
-
-  /* Pointers into string1 and string2, just past the last characters in
-     each to consider matching.  */
-  re_char *end_match_1, *end_match_2;
-
-  /* Where we are in the data, and the end of the current string.  */
-  re_char *d, *dend;
+/* Lazy DFA.
+
+   Most patterns have no back references, so whether they match can
+   be decided by running all their alternatives in step over the
+   text, which takes time linear in the length of the text.  The sets
+   of pattern positions that arise doing so are cached as the states
+   of a DFA, built lazily as the text demands, so that most characters
+   cost one table lookup.
+
+   The DFA does not tell where groups start and end.  Most patterns
+   backtrack little, so the backtracking matcher runs first; but once
+   it has backtracked RE_DFA_BACKTRACK_LIMIT times in one match, the
+   DFA takes over for the pattern, and re_search_2 and re_match_2
+   call the backtracker only where the DFA has found that a match
+   exists, confined to the text the match can span.  Should that
+   still backtrack too much, the registers are computed in a single
+   pass over the match (see "Submatches" below).  A forward search
+   finds where the first match starts in a single pass too, so that
+   it takes time linear in the length of the text whether it matches
+   or not.  A backward search still tries a match at each position in
+   turn, each of which takes linear time.
+
+   A pattern position is the offset of an instruction that consumes a
+   character or tests the context (like wordbeg), the offset of a
+   character inside an exactn, or BUFP->used for the end of the
+   pattern.  Context tests are resolved once the character after the
+   position is known; what they need to know about the one before it
+   is kept in the flags of the state.  */
+
+/* Flags describing the character before a text position (in the
+   flags of a state) or the one after it (in CFLAGS).  */
+enum
+  {
+    /* There is no such character.  */
+    RE_DFA_EDGE = 1,
+    RE_DFA_NEWLINE = 2,
+    /* The character has word syntax.  */
+    RE_DFA_WORD = 4,
+    /* The character has word or symbol syntax.  */
+    RE_DFA_SYMBOL = 8,
+    RE_DFA_CHAR_FLAGS = RE_DFA_NEWLINE | RE_DFA_WORD | RE_DFA_SYMBOL,
+
+    /* In a state: matches may also start at the next position.  */
+    RE_DFA_INJECT = 16,
+
+    /* In CFLAGS: WORD_BOUNDARY_P holds between the two characters.  */
+    RE_DFA_BREAK = 16,
+    /* In CFLAGS: the character is at STOP, so it may be looked at
+       but not matched.  */
+    RE_DFA_LIMIT = 32,
+    /* In CFLAGS: where the syntax class of the character starts.  */
+    RE_DFA_SYNTAX_SHIFT = 6
+  };
 
-  /* Used sometimes to remember where we were before starting matching
-     an operator so that we can go back in case of failure.  This "atomic"
-     behavior of matching opcodes is indispensable to the correctness
-     of the on_failure_keep_string_jump optimization.  */
-  re_char *dfail;
+/* How many times re_match_2_internal may backtrack before the DFA
+   takes over.  */
+enum { RE_DFA_BACKTRACK_LIMIT = 10000 };
 
-  /* Where we are in the pattern, and the end of the pattern.  */
-  re_char *p = bufp->buffer;
-  re_char *pend = p + bufp->used;
+/* Beyond this many states, the DFA starts over.  */
+enum { RE_DFA_MAX_STATES = 512 };
 
-  /* We use this to map every character in the string.	*/
-  Lisp_Object translate = bufp->translate;
+/* Size of the hash table of states; a power of two.  */
+enum { RE_DFA_TABLE_SIZE = 2 * RE_DFA_MAX_STATES };
 
-  /* True if BUFP is setup from a multibyte regex.  */
-  bool multibyte = RE_MULTIBYTE_P (bufp);
+struct re_dfa_transition
+{
+  /* Zero if not computed yet; otherwise twice the index of the next
+     state plus 2, plus 1 if a match ends before the character.  */
+  int next;
 
-  /* True if STRING1/STRING2 are multibyte.  */
-  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  /* CFLAGS of the character NEXT was computed for.  */
+  unsigned short cflags;
+};
 
-  /* Failure point stack.  Each place that can handle a failure further
-     down the line pushes a failure point on this stack.  It consists of
-     regstart, and regend for all registers corresponding to
-     the subexpressions we're currently inside, plus the number of such
-     registers, and, finally, two char *'s.  The first char * is where
-     to resume scanning the pattern; the second one is where to resume
-     scanning the strings.  */
-  fail_stack_type fail_stack;
-#ifdef DEBUG_COMPILES_ARGUMENTS
-  ptrdiff_t nfailure_points_pushed = 0, nfailure_points_popped = 0;
-#endif
+struct re_dfa_state
+{
+  /* The positions are DFA->positions[POSITIONS ... POSITIONS + N).  */
+  ptrdiff_t positions;
+  int n;
 
-  /* We fill all the registers internally, independent of what we
-     return, for use in backreferences.  The number here includes
-     an element for register zero.  */
-  ptrdiff_t num_regs = bufp->re_nsub + 1;
-  eassume (0 < num_regs);
+  /* RE_DFA_EDGE, etc.  */
+  int flags;
 
-  /* Information on the contents of registers. These are pointers into
-     the input strings; they record just what was matched (on this
-     attempt) by a subexpression part of the pattern, that is, the
-     regnum-th regstart pointer points to where in the pattern we began
-     matching and the regnum-th regend points to right after where we
-     stopped matching the regnum-th subexpression.  */
-  re_char **regstart UNINIT, **regend UNINIT;
+  /* Hash of the positions and flags.  */
+  unsigned int hash;
 
-  /* The following record the register info as found in the above
-     variables when we find a match better than any we've seen before.
-     This happens as we backtrack through the failure points, which in
-     turn happens only if we have not yet matched the entire string. */
-  bool best_regs_set = false;
-  re_char **best_regstart UNINIT, **best_regend UNINIT;
+  /* True if no match is under way, so that the state is just where
+     new matches start.  */
+  bool idle;
 
-  /* Logically, this is 'best_regend[0]'.  But we don't want to have to
-     allocate space for that if we're not allocating space for anything
-     else (see below).  Also, we never need info about register 0 for
-     any of the other register vectors, and it seems rather a kludge to
-     treat 'best_regend' differently from the rest.  So we keep track of
-     the end of the best match so far in a separate variable.  We
-     initialize this to NULL so that when we backtrack the first time
-     and need to test it, it's not garbage.  */
-  re_char *match_end = NULL;
+  /* Transitions across ASCII characters.  */
+  struct re_dfa_transition next[128];
+};
 
-  /* Final return value of the function.  */
-  ptrdiff_t retval = -1;        /* Presumes failure to match for now.  */
+struct re_dfa
+{
+  /* Number of possible positions, i.e., the length of the pattern
+     plus 1.  */
+  int size;
+
+  /* For the offset of a character inside an exactn, the offset of
+     the instruction after the exactn; otherwise zero.  */
+  int *exact_end;
+
+  /* Whether an instruction starts at an offset.  */
+  bool *insn;
+
+  /* The positions of the initial state.  */
+  int *start;
+  int nstart;
+
+  /* Whether the pattern looks at syntax, at the syntax class of
+     characters, and at WORD_BOUNDARY_P.  */
+  bool_bf need_syntax : 1;
+  bool_bf need_class : 1;
+  bool_bf need_break : 1;
+
+  /* The value of RE_TARGET_MULTIBYTE_P the states were built for.  */
+  bool_bf target_multibyte : 1;
+
+  /* Whether the pattern was compiled for the longest match, and so
+     does not end in succeed.  */
+  bool_bf longest : 1;
+
+  struct re_dfa_state *states;
+  int nstates;
+  ptrdiff_t states_alloc;
+
+  /* The positions of all states.  */
+  int *positions;
+  ptrdiff_t npositions, positions_alloc;
+
+  /* Hash table of states; each entry is zero or a state index plus 1.  */
+  int table[RE_DFA_TABLE_SIZE];
+
+  /* Incremented whenever the states are discarded.  */
+  unsigned int epoch;
+
+  /* For each value of the flags, the initial state plus 1 or zero, as
+     of INITIAL_EPOCH.  */
+  int initial[2 * RE_DFA_INJECT];
+  unsigned int initial_epoch;
+
+  /* Scratch space, each with room for all positions: the positions
+     left to visit, those that consume the next character, and those
+     of the next state; and when each position was last visited.  */
+  int *stack, *consumers, *work;
+  int nstack, nconsumers;
+  unsigned int *mark;
+  unsigned int generation;
+};
 
-#ifdef DEBUG_COMPILES_ARGUMENTS
-  /* Counts the total number of registers pushed.  */
-  ptrdiff_t num_regs_pushed = 0;
-#endif
+/* Return the length of the instruction at P.  */
+static int
+re_dfa_insn_length (re_char *p)
+{
+  switch (*p)
+    {
+    case exactn:
+      return 2 + p[1];
 
-  DEBUG_PRINT ("\nEntering re_match_2.\n");
+    case charset:
+    case charset_not:
+      return skip_one_char (p) - p;
 
-  REGEX_USE_SAFE_ALLOCA;
+    case start_memory:
+    case stop_memory:
+    case duplicate:
+    case syntaxspec:
+    case notsyntaxspec:
+    case categoryspec:
+    case notcategoryspec:
+      return 2;
 
-  INIT_FAIL_STACK ();
+    case jump:
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      return 3;
 
-  specpdl_ref count = SPECPDL_INDEX ();
+    case succeed_n:
+    case jump_n:
+    case set_number_at:
+      return 5;
 
-  /* Prevent shrinking and relocation of buffer text if GC happens
-     while we are inside this function.  The calls to
-     UPDATE_SYNTAX_TABLE_* macros can call Lisp (via
-     `internal--syntax-propertize`); these calls are careful to defend against
-     buffer modifications, but even with no modifications, the buffer text may
-     be relocated during GC by `compact_buffer` which would invalidate
-     our C pointers to buffer text.  */
-  if (!current_buffer->text->inhibit_shrinking)
-    {
-      record_unwind_protect_ptr (unwind_re_match, current_buffer);
-      current_buffer->text->inhibit_shrinking = 1;
+    default:
+      return 1;
     }
+}
 
-  /* Do not bother to initialize all the register variables if there are
-     no groups in the pattern, as it takes a fair amount of time.  If
-     there are groups, we include space for register 0 (the whole
-     pattern) in REGSTART[0], even though we never use it, to avoid
-     the undefined behavior of subtracting 1 from REGSTART.  */
-  ptrdiff_t re_nsub = num_regs - 1;
-  if (0 < re_nsub)
+/* Start a new round of visiting positions in DFA.  */
+static void
+re_dfa_next_generation (struct re_dfa *dfa)
+{
+  if (++dfa->generation == 0)
     {
-      regstart = SAFE_ALLOCA ((re_nsub * 4 + 1) * sizeof *regstart);
-      regend = regstart + num_regs;
-      best_regstart = regend + re_nsub;
-      best_regend = best_regstart + re_nsub;
-
-      /* Initialize subexpression text positions to unset, to mark ones
-	 that no start_memory/stop_memory has been seen for.  */
-      for (re_char **apos = regstart + 1; apos < best_regstart + 1; apos++)
-	*apos = NULL;
+      memset (dfa->mark, 0, dfa->size * sizeof *dfa->mark);
+      dfa->generation = 1;
     }
+  dfa->nstack = 0;
+}
 
-  /* We move 'string1' into 'string2' if the latter's empty -- but not if
-     'string1' is null.  */
-  if (size2 == 0 && string1 != NULL)
+/* Arrange for DFA to visit position PC, unless it already has in this
+   round.  */
+static void
+re_dfa_push (struct re_dfa *dfa, int pc)
+{
+  if (dfa->mark[pc] != dfa->generation)
     {
-      string2 = string1;
-      size2 = size1;
-      string1 = 0;
-      size1 = 0;
+      dfa->mark[pc] = dfa->generation;
+      dfa->stack[dfa->nstack++] = pc;
     }
-  end1 = string1 + size1;
-  end2 = string2 + size2;
+}
 
-  /* P scans through the pattern as D scans through the data.
-     DEND is the end of the input string that D points within.
-     Advance D into the following input string whenever necessary, but
-     this happens before fetching; therefore, at the beginning of the
-     loop, D can be pointing at the end of a string, but it cannot
-     equal STRING2.  */
-  if (pos >= size1)
+/* Return where the jump at PC in the pattern of BUFP goes.  */
+static int
+re_dfa_jump_target (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		    int pc)
+{
+  re_char *pattern = bufp->buffer;
+  int target = pc + 3 + extract_number (pattern + pc + 1);
+
+  /* on_failure_jump_smart may have turned its loop into
+     "on_failure_keep_string_jump exit; loop: body; jump loop; exit:",
+     which leaves the loop only when the body fails to match.  It did
+     so only because the body and what follows cannot both match, so
+     offering the exit on every iteration is equivalent.  */
+  if (3 <= target && dfa->insn[target - 3]
+      && pattern[target - 3] == on_failure_keep_string_jump
+      && target + extract_number (pattern + target - 2) == pc + 3)
+    target -= 3;
+  return target;
+}
+
+/* Return true if the context test OP succeeds between a character
+   described by FLAGS and one described by CFLAGS.  */
+static bool
+re_dfa_context_ok (re_opcode_t op, int flags, int cflags)
+{
+  switch (op)
     {
-      /* Only match within string2.  */
-      d = string2 + pos - size1;
-      dend = end_match_2 = string2 + stop - size1;
-      end_match_1 = end1;	/* Just to give it a value.  */
+    case begline:
+      return flags & (RE_DFA_EDGE | RE_DFA_NEWLINE);
+
+    case endline:
+      return cflags & (RE_DFA_EDGE | RE_DFA_NEWLINE);
+
+    case begbuf:
+      return flags & RE_DFA_EDGE;
+
+    case endbuf:
+      return cflags & RE_DFA_EDGE;
+
+    case wordbound:
+    case notwordbound:
+      {
+	bool bound = ((flags | cflags) & RE_DFA_EDGE
+		      || !(flags & RE_DFA_WORD) != !(cflags & RE_DFA_WORD)
+		      || cflags & RE_DFA_BREAK);
+	return bound == (op == wordbound);
+      }
+
+    case wordbeg:
+      return (!(cflags & (RE_DFA_EDGE | RE_DFA_LIMIT))
+	      && cflags & RE_DFA_WORD
+	      && (flags & RE_DFA_EDGE || !(flags & RE_DFA_WORD)
+		  || cflags & RE_DFA_BREAK));
+
+    case wordend:
+      return (!(flags & RE_DFA_EDGE) && flags & RE_DFA_WORD
+	      && (cflags & RE_DFA_EDGE || !(cflags & RE_DFA_WORD)
+		  || cflags & RE_DFA_BREAK));
+
+    case symbeg:
+      return (!(cflags & (RE_DFA_EDGE | RE_DFA_LIMIT))
+	      && cflags & RE_DFA_SYMBOL
+	      && (flags & RE_DFA_EDGE || !(flags & RE_DFA_SYMBOL)));
+
+    case symend:
+      return (!(flags & RE_DFA_EDGE) && flags & RE_DFA_SYMBOL
+	      && (cflags & RE_DFA_EDGE || !(cflags & RE_DFA_SYMBOL)));
+
+    default:
+      abort ();
     }
-  else
+}
+
+/* Visit the positions on the stack of DFA and those they lead to
+   without consuming a character, appending to OUT (whose length is
+   *NOUT) the positions that do consume one.  If LITE, stop at context
+   tests and the end of the pattern and append them too.  Otherwise,
+   pass the context tests that succeed between a character described
+   by FLAGS and one described by CFLAGS.  Return true if the end of
+   the pattern was reached other than in the LITE case.  */
+static bool
+re_dfa_close (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+	      int *out, int *nout, bool lite, int flags, int cflags)
+{
+  re_char *pattern = bufp->buffer;
+  int accept = bufp->used;
+  bool matched = false;
+  int n = *nout;
+
+  while (dfa->nstack > 0)
     {
-      if (stop < size1)
+      int pc = dfa->stack[--dfa->nstack];
+
+      if (pc == accept || dfa->exact_end[pc])
 	{
-	  /* Only match within string1.  */
-	  end_match_1 = string1 + stop;
-	  /* BEWARE!
-	     When we reach end_match_1, PREFETCH normally switches to string2.
-	     But in the present case, this means that just doing a PREFETCH
-	     makes us jump from 'stop' to 'gap' within the string.
-	     What we really want here is for the search to stop as
-	     soon as we hit end_match_1.  That's why we set end_match_2
-	     to end_match_1 (since PREFETCH fails as soon as we hit
-	     end_match_2).  */
-	  end_match_2 = end_match_1;
-	}
-      else
-	{ /* It's important to use this code when STOP == SIZE so that
-	     moving D from end1 to string2 will not prevent the D == DEND
-	     check from catching the end of string.  */
-	  end_match_1 = end1;
-	  end_match_2 = string2 + stop - size1;
+	  if (pc != accept || lite)
+	    out[n++] = pc;
+	  else
+	    matched = true;
+	  continue;
 	}
-      d = string1 + pos;
-      dend = end_match_1;
-    }
 
-  DEBUG_PRINT ("The compiled pattern is:\n");
-  DEBUG_PRINT_COMPILED_PATTERN (bufp, p, pend);
+      switch (pattern[pc])
+	{
+	case no_op:
+	  re_dfa_push (dfa, pc + 1);
+	  break;
+
+	case succeed:
+	  re_dfa_push (dfa, accept);
+	  break;
+
+	case exactn:
+	  re_dfa_push (dfa, pc + 2);
+	  break;
+
+	case anychar:
+	case charset:
+	case charset_not:
+	case syntaxspec:
+	case notsyntaxspec:
+	  out[n++] = pc;
+	  break;
+
+	case start_memory:
+	case stop_memory:
+	  re_dfa_push (dfa, pc + 2);
+	  break;
+
+	case jump:
+	  re_dfa_push (dfa, re_dfa_jump_target (bufp, dfa, pc));
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_loop:
+	case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  re_dfa_push (dfa, pc + 3);
+	  re_dfa_push (dfa, pc + 3 + extract_number (pattern + pc + 1));
+	  break;
+
+	case begline:
+	case endline:
+	case begbuf:
+	case endbuf:
+	case wordbeg:
+	case wordend:
+	case wordbound:
+	case notwordbound:
+	case symbeg:
+	case symend:
+	  if (lite)
+	    out[n++] = pc;
+	  else if (re_dfa_context_ok (pattern[pc], flags, cflags))
+	    re_dfa_push (dfa, pc + 1);
+	  break;
+
+	default:
+	  abort ();
+	}
+    }
+
+  *nout = n;
+  return matched;
+}
+
+/* Return the position after the one at PC in the pattern of BUFP if
+   that position consumes the character at D, described by CFLAGS;
+   otherwise return -1.  This mirrors re_match_2_internal.  */
+static int
+re_dfa_consume (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		int pc, re_char *d, int cflags)
+{
+  Lisp_Object translate = bufp->translate;
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  re_char *p = bufp->buffer + pc;
+  int exact_end = dfa->exact_end[pc];
+
+  if (exact_end)
+    {
+      int pat_charlen, pat_ch, buf_ch;
+
+      if (target_multibyte)
+	{
+	  if (multibyte)
+	    pat_ch = string_char_and_length (p, &pat_charlen);
+	  else
+	    {
+	      pat_ch = RE_CHAR_TO_MULTIBYTE (*p);
+	      pat_charlen = 1;
+	    }
+	  buf_ch = TRANSLATE (STRING_CHAR (d));
+	}
+      else
+	{
+	  if (multibyte)
+	    {
+	      pat_ch = string_char_and_length (p, &pat_charlen);
+	      pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
+	    }
+	  else
+	    {
+	      pat_ch = *p;
+	      pat_charlen = 1;
+	    }
+	  buf_ch = RE_CHAR_TO_MULTIBYTE (*d);
+	  if (!CHAR_BYTE8_P (buf_ch))
+	    {
+	      buf_ch = TRANSLATE (buf_ch);
+	      buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
+	      if (buf_ch < 0)
+		buf_ch = *d;
+	    }
+	  else
+	    buf_ch = *d;
+	}
+      return buf_ch != pat_ch ? -1 : min (pc + pat_charlen, exact_end);
+    }
+
+  switch (*p)
+    {
+    case anychar:
+      {
+	int len;
+	int c = RE_STRING_CHAR_AND_LENGTH (d, len, target_multibyte);
+	return TRANSLATE (c) == '\n' ? -1 : pc + 1;
+      }
+
+    case charset:
+    case charset_not:
+      {
+	bool unibyte_char = false;
+	int len;
+	int corig = RE_STRING_CHAR_AND_LENGTH (d, len, target_multibyte);
+	int c = corig;
+	if (target_multibyte)
+	  {
+	    int c1;
+
+	    c = TRANSLATE (c);
+	    c1 = RE_CHAR_TO_UNIBYTE (c);
+	    if (c1 >= 0)
+	      {
+		unibyte_char = true;
+		c = c1;
+	      }
+	  }
+	else
+	  {
+	    int c1 = RE_CHAR_TO_MULTIBYTE (c);
+
+	    if (!CHAR_BYTE8_P (c1))
+	      {
+		c1 = TRANSLATE (c1);
+		c1 = RE_CHAR_TO_UNIBYTE (c1);
+		if (c1 >= 0)
+		  {
+		    unibyte_char = true;
+		    c = c1;
+		  }
+	      }
+	    else
+	      unibyte_char = true;
+	  }
+	return (execute_charset (&p, c, corig, unibyte_char, translate)
+		? p - bufp->buffer : -1);
+      }
+
+    case syntaxspec:
+    case notsyntaxspec:
+      {
+	bool not = *p == notsyntaxspec;
+	int syntax = cflags >> RE_DFA_SYNTAX_SHIFT;
+	return (syntax != p[1]) ^ not ? -1 : pc + 2;
+      }
+
+    default:
+      abort ();
+    }
+}
+
+/* Discard all states of DFA.  */
+static void
+re_dfa_flush (struct re_dfa *dfa)
+{
+  dfa->nstates = 0;
+  dfa->npositions = 0;
+  memset (dfa->table, 0, sizeof dfa->table);
+  dfa->epoch++;
+}
+
+static int
+re_dfa_compare_positions (void const *a, void const *b)
+{
+  int x = *(int const *) a, y = *(int const *) b;
+  return (x > y) - (x < y);
+}
+
+/* Return the index of the state of DFA with the N POSITIONS (which
+   this sorts) and FLAGS, adding it if need be.  */
+static int
+re_dfa_intern (struct re_dfa *dfa, int *positions, int n, int flags)
+{
+  qsort (positions, n, sizeof *positions, re_dfa_compare_positions);
+
+  unsigned int hash = flags;
+  for (int i = 0; i < n; i++)
+    hash = (hash ^ positions[i]) * 0x9e3779b1u;
+
+  int mask = RE_DFA_TABLE_SIZE - 1;
+  int i = hash & mask;
+  for (; dfa->table[i]; i = (i + 1) & mask)
+    {
+      struct re_dfa_state *state = &dfa->states[dfa->table[i] - 1];
+      if (state->hash == hash && state->flags == flags && state->n == n
+	  && !memcmp (dfa->positions + state->positions, positions,
+		      n * sizeof *positions))
+	return dfa->table[i] - 1;
+    }
+
+  if (dfa->nstates == RE_DFA_MAX_STATES)
+    {
+      re_dfa_flush (dfa);
+      i = hash & mask;
+    }
+  if (dfa->nstates == dfa->states_alloc)
+    dfa->states = xpalloc (dfa->states, &dfa->states_alloc, 1,
+			   RE_DFA_MAX_STATES, sizeof *dfa->states);
+  if (dfa->positions_alloc - dfa->npositions < n)
+    dfa->positions = xpalloc (dfa->positions, &dfa->positions_alloc,
+			      n - (dfa->positions_alloc - dfa->npositions),
+			      -1, sizeof *dfa->positions);
+
+  int index = dfa->nstates++;
+  struct re_dfa_state *state = &dfa->states[index];
+  state->positions = dfa->npositions;
+  state->n = n;
+  state->flags = flags;
+  state->hash = hash;
+  state->idle = (flags & RE_DFA_INJECT && n == dfa->nstart
+		 && !memcmp (dfa->start, positions, n * sizeof *positions));
+  memset (state->next, 0, sizeof state->next);
+  memcpy (dfa->positions + dfa->npositions, positions, n * sizeof *positions);
+  dfa->npositions += n;
+  dfa->table[i] = index + 1;
+  return index;
+}
+
+/* Return the state of DFA like state S but with flags FLAGS.  */
+static int
+re_dfa_with_flags (struct re_dfa *dfa, int s, int flags)
+{
+  struct re_dfa_state *state = &dfa->states[s];
+  int n = state->n;
+  memcpy (dfa->work, dfa->positions + state->positions,
+	  n * sizeof *dfa->work);
+  return re_dfa_intern (dfa, dfa->work, n, flags);
+}
+
+/* Collect in DFA->consumers the positions that state S of DFA leads
+   to before a character described by CFLAGS, and return true if a
+   match ends there.  */
+static bool
+re_dfa_expand (struct re_pattern_buffer *bufp, struct re_dfa *dfa, int s,
+	       int cflags)
+{
+  struct re_dfa_state *state = &dfa->states[s];
+  re_dfa_next_generation (dfa);
+  for (int i = 0; i < state->n; i++)
+    re_dfa_push (dfa, dfa->positions[state->positions + i]);
+  dfa->nconsumers = 0;
+  return re_dfa_close (bufp, dfa, dfa->consumers, &dfa->nconsumers,
+		       false, state->flags, cflags);
+}
+
+/* Return the transition of DFA out of state S across the character
+   at D, described by CFLAGS, encoded as in struct re_dfa_transition.  */
+static int
+re_dfa_step (struct re_pattern_buffer *bufp, struct re_dfa *dfa, int s,
+	     re_char *d, int cflags)
+{
+  bool matched = re_dfa_expand (bufp, dfa, s, cflags);
+  int flags = dfa->states[s].flags;
+
+  re_dfa_next_generation (dfa);
+  for (int i = 0; i < dfa->nconsumers; i++)
+    {
+      int next = re_dfa_consume (bufp, dfa, dfa->consumers[i], d, cflags);
+      if (0 <= next)
+	re_dfa_push (dfa, next);
+    }
+  if (flags & RE_DFA_INJECT)
+    for (int i = 0; i < dfa->nstart; i++)
+      re_dfa_push (dfa, dfa->start[i]);
+
+  int n = 0;
+  re_dfa_close (bufp, dfa, dfa->work, &n, true, 0, 0);
+  int next = re_dfa_intern (dfa, dfa->work, n,
+			    (cflags & RE_DFA_CHAR_FLAGS)
+			    | (flags & RE_DFA_INJECT));
+  return 2 * next + 2 + matched;
+}
+
+/* Return a DFA for BUFP, or NULL if BUFP has nothing a DFA could
+   help with or cannot be run on one.  */
+static struct re_dfa *
+re_dfa_create (struct re_pattern_buffer *bufp)
+{
+  re_char *pattern = bufp->buffer;
+  ptrdiff_t used = bufp->used;
+  bool loops = false, syntax = false, classes = false, breaks = false;
+
+  if (INT_MAX / 2 < used)
+    return NULL;
+
+  for (ptrdiff_t i = 0; i < used; i += re_dfa_insn_length (pattern + i))
+    switch (pattern[i])
+      {
+      case duplicate:
+      case succeed_n:
+      case jump_n:
+      case set_number_at:
+      case at_dot:
+      case categoryspec:
+      case notcategoryspec:
+	return NULL;
+
+      case on_failure_jump:
+      case on_failure_keep_string_jump:
+      case on_failure_jump_loop:
+      case on_failure_jump_nastyloop:
+      case on_failure_jump_smart:
+	loops = true;
+	break;
+
+      case wordbeg:
+      case wordend:
+      case wordbound:
+      case notwordbound:
+	breaks = true;
+	FALLTHROUGH;
+      case symbeg:
+      case symend:
+	syntax = true;
+	break;
+
+      case syntaxspec:
+      case notsyntaxspec:
+	syntax = classes = true;
+	break;
+      }
+
+  /* Without loops, the backtracker takes time bounded by the size of
+     the pattern.  */
+  if (!loops)
+    return NULL;
+
+  struct re_dfa *dfa = xzalloc (sizeof *dfa);
+  int size = used + 1;
+  dfa->size = size;
+  dfa->exact_end = xzalloc (size * sizeof *dfa->exact_end);
+  dfa->insn = xzalloc (size * sizeof *dfa->insn);
+  dfa->stack = xnmalloc (size, sizeof *dfa->stack);
+  dfa->consumers = xnmalloc (size, sizeof *dfa->consumers);
+  dfa->work = xnmalloc (size, sizeof *dfa->work);
+  dfa->mark = xzalloc (size * sizeof *dfa->mark);
+  dfa->need_syntax = syntax;
+  dfa->need_class = classes;
+  dfa->need_break = breaks;
+  dfa->target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  int last = -1;
+  for (int i = 0; i < used; i += re_dfa_insn_length (pattern + i))
+    {
+      dfa->insn[i] = true;
+      if (pattern[i] == exactn)
+	for (int j = i + 2; j < i + 2 + pattern[i + 1]; j++)
+	  dfa->exact_end[j] = i + 2 + pattern[i + 1];
+      last = i;
+    }
+  dfa->longest = last < 0 || pattern[last] != succeed;
+
+  re_dfa_next_generation (dfa);
+  re_dfa_push (dfa, 0);
+  re_dfa_close (bufp, dfa, dfa->work, &dfa->nstart, true, 0, 0);
+  qsort (dfa->work, dfa->nstart, sizeof *dfa->work,
+	 re_dfa_compare_positions);
+  dfa->start = xnmalloc (dfa->nstart, sizeof *dfa->start);
+  memcpy (dfa->start, dfa->work, dfa->nstart * sizeof *dfa->start);
+  return dfa;
+}
+
+static void
+re_dfa_free (struct re_dfa *dfa)
+{
+  if (dfa)
+    {
+      xfree (dfa->exact_end);
+      xfree (dfa->insn);
+      xfree (dfa->start);
+      xfree (dfa->states);
+      xfree (dfa->positions);
+      xfree (dfa->stack);
+      xfree (dfa->consumers);
+      xfree (dfa->work);
+      xfree (dfa->mark);
+      xfree (dfa);
+    }
+}
+
+/* Return the DFA of BUFP, creating it if need be, or NULL if BUFP
+   does without.  */
+static struct re_dfa *
+re_dfa_get (struct re_pattern_buffer *bufp)
+{
+  if (!bufp->dfa_analyzed)
+    {
+      bufp->dfa = re_dfa_create (bufp);
+      bufp->dfa_analyzed = true;
+    }
+
+  struct re_dfa *dfa = bufp->dfa;
+  if (dfa && dfa->target_multibyte != RE_TARGET_MULTIBYTE_P (bufp))
+    {
+      re_dfa_flush (dfa);
+      dfa->target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+    }
+  return dfa;
+}
+
+/* Return the RE_DFA_CHAR_FLAGS and CFLAGS bits of DFA for character C
+   at CHARPOS, which follows a character PREV_C described by FLAGS.  */
+static int
+re_dfa_char_flags (struct re_dfa *dfa, int c, ptrdiff_t charpos,
+		   int prev_c, int flags)
+{
+  int cflags = c == '\n' ? RE_DFA_NEWLINE : 0;
+
+  if (dfa->need_syntax)
+    {
+      UPDATE_SYNTAX_TABLE (charpos);
+      enum syntaxcode syntax = SYNTAX (c);
+      if (syntax == Sword)
+	cflags |= RE_DFA_WORD | RE_DFA_SYMBOL;
+      else if (syntax == Ssymbol)
+	cflags |= RE_DFA_SYMBOL;
+      if (dfa->need_class)
+	cflags |= syntax << RE_DFA_SYNTAX_SHIFT;
+      if (dfa->need_break && flags & cflags & RE_DFA_WORD
+	  && WORD_BOUNDARY_P (prev_c, c))
+	cflags |= RE_DFA_BREAK;
+    }
+  return cflags;
+}
+
+/* Return the initial state of DFA with FLAGS.  */
+static int
+re_dfa_initial (struct re_dfa *dfa, int flags)
+{
+  if (dfa->initial_epoch == dfa->epoch && dfa->initial[flags])
+    return dfa->initial[flags] - 1;
+
+  if (dfa->initial_epoch != dfa->epoch)
+    {
+      memset (dfa->initial, 0, sizeof dfa->initial);
+      dfa->initial_epoch = dfa->epoch;
+    }
+  memcpy (dfa->work, dfa->start, dfa->nstart * sizeof *dfa->work);
+  int s = re_dfa_intern (dfa, dfa->work, dfa->nstart, flags);
+  if (dfa->initial_epoch == dfa->epoch)
+    dfa->initial[flags] = s + 1;
+  return s;
+}
+
+/* Return the first character boundary from POS through LAST in the
+   virtual concatenation of STRING1 and STRING2 where the character is
+   in the fastmap of BUFP, or LAST + 1 if there is none.  */
+static ptrdiff_t
+re_dfa_skip (struct re_pattern_buffer *bufp,
+	     re_char *string1, ptrdiff_t size1, re_char *string2,
+	     ptrdiff_t pos, ptrdiff_t last)
+{
+  char *fastmap = bufp->fastmap;
+  Lisp_Object translate = bufp->translate;
+  bool multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  while (pos <= last)
+    {
+      re_char *d = pos < size1 ? string1 + pos : string2 + (pos - size1);
+      int len = 1, c;
+      if (multibyte)
+	{
+	  c = TRANSLATE (string_char_and_length (d, &len));
+	  if (fastmap[CHAR_LEADING_CODE (c)])
+	    break;
+	}
+      else
+	{
+	  c = *d;
+	  int ch = RE_CHAR_TO_MULTIBYTE (c);
+	  int translated = TRANSLATE (ch);
+	  if (translated != ch
+	      && (ch = RE_CHAR_TO_UNIBYTE (translated)) >= 0)
+	    c = ch;
+	  if (fastmap[c])
+	    break;
+	}
+      pos += len;
+    }
+  return pos;
+}
+
+/* Use DFA, the DFA of BUFP, to look for a match in the virtual
+   concatenation of STRING1 and STRING2 that starts at a character
+   boundary from POS through LAST and ends by STOP.  Return where the
+   first such match to end ends, or if LONGEST where the last one to
+   end ends, or -1 if there is none.  */
+static ptrdiff_t
+re_dfa_search (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+	       re_char *string1, ptrdiff_t size1,
+	       re_char *string2, ptrdiff_t size2,
+	       ptrdiff_t pos, ptrdiff_t last, ptrdiff_t stop, bool longest)
+{
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  ptrdiff_t total = size1 + size2;
+  ptrdiff_t result = -1;
+  unsigned short quit_count = 0;
+  int prev_c = 0, flags;
+
+  /* Unless syntax properties matter, the flags of an ASCII character
+     depend only on the character; remember them here.  */
+  bool props = dfa->need_syntax && parse_sexp_lookup_properties;
+  int ascii_cflags[128];
+  memset (ascii_cflags, -1, sizeof ascii_cflags);
+  ptrdiff_t charpos = props ? RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos) : 0;
+  /* How CHARPOS advances across a character of LEN bytes.  */
+  bool charpos_by_bytes = !(STRINGP (gl_state.object)
+			    || BUFFERP (gl_state.object)
+			    || NILP (gl_state.object));
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  /* Syntax lookups can run Lisp; see re_match_2_internal.  */
+  if (props && !current_buffer->text->inhibit_shrinking)
+    {
+      record_unwind_protect_ptr (unwind_re_match, current_buffer);
+      current_buffer->text->inhibit_shrinking = 1;
+    }
+
+#define RE_DFA_ADDR(pos) \
+  ((pos) < size1 ? string1 + (pos) : string2 + ((pos) - size1))
+
+  if (pos == 0 || total == 0)
+    flags = RE_DFA_EDGE;
+  else
+    {
+      re_char *d = RE_DFA_ADDR (pos);
+      GET_CHAR_BEFORE_2 (prev_c, d, string1, string1 + size1,
+			 string2, string2 + size2);
+      flags = (re_dfa_char_flags (dfa, prev_c, charpos - 1, 0, 0)
+	       & RE_DFA_CHAR_FLAGS);
+    }
+  if (pos < last)
+    flags |= RE_DFA_INJECT;
+
+  int s = re_dfa_initial (dfa, flags);
+  /* Whether the fastmap can tell where matches start.  */
+  bool skip = bufp->fastmap && !bufp->can_be_null;
+
+  for (;;)
+    {
+      /* While no match is under way, skip to where one can start.  */
+      if (dfa->states[s].idle && skip && pos < total)
+	{
+	  ptrdiff_t next = re_dfa_skip (bufp, string1, size1, string2,
+					pos, min (last, total - 1));
+	  if (last < next)
+	    break;
+	  if (pos < next)
+	    {
+	      pos = next;
+	      re_char *d = RE_DFA_ADDR (pos);
+	      GET_CHAR_BEFORE_2 (prev_c, d, string1, string1 + size1,
+				 string2, string2 + size2);
+	      if (props)
+		charpos = RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos);
+	      flags = (re_dfa_char_flags (dfa, prev_c, charpos - 1, 0, 0)
+		       & RE_DFA_CHAR_FLAGS);
+	      s = re_dfa_initial (dfa, flags | RE_DFA_INJECT);
+	    }
+	}
+
+      re_char *d = pos < total ? RE_DFA_ADDR (pos) : NULL;
+      int c = 0, len = 0, cflags = RE_DFA_EDGE;
+      if (d)
+	{
+	  GET_CHAR_AFTER (c, d, len);
+	  if (c < 128 && !props
+	      && !(dfa->need_break && !SINGLE_BYTE_CHAR_P (prev_c)))
+	    {
+	      cflags = ascii_cflags[c];
+	      if (cflags < 0)
+		cflags = ascii_cflags[c] = re_dfa_char_flags (dfa, c, 0, 0, 0);
+	    }
+	  else
+	    cflags = re_dfa_char_flags (dfa, c, charpos, prev_c,
+					dfa->states[s].flags);
+	}
+
+      if (stop <= pos)
+	{
+	  if (re_dfa_expand (bufp, dfa, s, d ? cflags | RE_DFA_LIMIT : cflags))
+	    result = pos;
+	  break;
+	}
+
+      /* Stop letting matches start once past LAST.  */
+      if (dfa->states[s].flags & RE_DFA_INJECT && last < pos + len)
+	s = re_dfa_with_flags (dfa, s,
+			       dfa->states[s].flags & ~RE_DFA_INJECT);
+
+      int next;
+      if (*d < 128 && dfa->states[s].next[*d].next
+	  && dfa->states[s].next[*d].cflags == cflags)
+	next = dfa->states[s].next[*d].next;
+      else
+	{
+	  unsigned int epoch = dfa->epoch;
+	  next = re_dfa_step (bufp, dfa, s, d, cflags);
+	  if (*d < 128 && dfa->epoch == epoch)
+	    {
+	      dfa->states[s].next[*d].next = next;
+	      dfa->states[s].next[*d].cflags = cflags;
+	    }
+	}
+
+      if (next & 1)
+	{
+	  result = pos;
+	  if (!longest)
+	    break;
+	}
+      s = next / 2 - 1;
+      if (!dfa->states[s].n && !(dfa->states[s].flags & RE_DFA_INJECT))
+	break;
+      pos += len;
+      charpos += charpos_by_bytes ? len : 1;
+      prev_c = c;
+      rarely_quit (++quit_count);
+    }
+
+#undef RE_DFA_ADDR
+
+  unbind_to (count, Qnil);
+  return result;
+}
+
+/* Submatches.
+
+   Confining the backtracker to the text that a match can span, as
+   re_dfa_match does, leaves it little to try for most patterns but
+   not for all: "\(a*\)*b\|a*" still backtracks exponentially over a
+   run of a's that it matches.  When the backtracker gives up there
+   too, the registers are computed instead by running all the threads
+   of the pattern in step over the text, as the DFA does, but keeping
+   the threads in the order the backtracker would try them and the
+   registers each has set (what is known as a Pike VM).  The match
+   the backtracker finds is then that of the first thread to reach the
+   end of the pattern (or for the longest match, the first to reach it
+   at the end the DFA found), and this takes time linear in the length
+   of the text.  Starting a thread at each position after the threads
+   already running likewise finds where the first match of a forward
+   search starts, since the backtracker tries each start in turn.
+
+   Which on_failure_jump_loop and on_failure_jump_nastyloop
+   instructions a thread went through at the current text position,
+   as the backtracker's CHECK_INFINITE_LOOP would find on its failure
+   stack, is kept while the thread is followed, since a loop the
+   thread reaches again then matched the empty string and is left.
+   Of the threads that reach the same pattern position without
+   consuming a character with the same such loops, only the first is
+   kept, since the backtracker tries what follows from there first for
+   it and the others cannot lead anywhere else.  Threads with other
+   such loops can, when a loop body that matched the empty string has
+   set a group again, so a few of these are kept as well.  */
+
+/* What an entry on the stack of struct re_pike asks for.  */
+enum re_pike_op
+  {
+    /* Follow the thread from a pattern position.  */
+    RE_PIKE_FOLLOW,
+    /* Restore a group boundary.  */
+    RE_PIKE_RESTORE,
+    /* Record that a loop instruction is, or is no longer, on the
+       failure stack.  */
+    RE_PIKE_PEND,
+    RE_PIKE_UNPEND
+  };
+
+struct re_pike_entry
+{
+  enum re_pike_op op;
+  /* The pattern position, or the group boundary to restore.  */
+  int arg;
+  ptrdiff_t value;
+};
+
+/* Threads about to consume a character, in the order the backtracker
+   would try them.  */
+struct re_pike_threads
+{
+  int n;
+  /* The pattern position of each thread.  */
+  int *pc;
+  /* The group boundaries of each thread, NCAPS per thread.  */
+  ptrdiff_t *caps;
+};
+
+struct re_pike
+{
+  struct re_pattern_buffer *bufp;
+  struct re_dfa *dfa;
+
+  /* The start of each group and its end, for groups 1 and up, or -1
+     if not set, along the thread being followed.  */
+  ptrdiff_t *caps;
+  ptrdiff_t ncaps;
+
+  /* What is left to follow, with room for 5 entries per visit of a
+     position.  */
+  struct re_pike_entry *stack;
+
+  /* For each loop instruction, whether the thread being followed went
+     through it at the current text position, and a hash of the set of
+     those it went through.  */
+  bool *pending;
+  unsigned int pending_hash;
+
+  /* For each pattern position, the hashes of the sets of pending loops
+     with which threads reached it at the current text position, and
+     how many there are, valid if the DFA marked the position.  */
+  unsigned int *seen;
+  unsigned char *nseen;
+
+  /* If nonnegative, where the match ends at the latest, and if the
+     DFA's longest flag is set, where it must end.  */
+  ptrdiff_t end;
+
+  /* The group boundaries of the match found, if any, and its end.  */
+  ptrdiff_t *match;
+  ptrdiff_t match_end;
+};
+
+/* How many sets of pending loops to tell apart at a pattern position.
+   This bounds the work per text position.  */
+enum { RE_PIKE_SEEN = 4 };
+
+static unsigned int
+re_pike_hash (int pc)
+{
+  return (pc + 1) * 2654435761u;
+}
+
+/* Return true if a thread that the backtracker tries before the one
+   being followed already reached pattern position PC, at which the
+   latter would then do nothing new; otherwise record that it did.  */
+static bool
+re_pike_seen (struct re_pike *pike, int pc)
+{
+  struct re_dfa *dfa = pike->dfa;
+  re_char *pattern = pike->bufp->buffer;
+  unsigned int *seen = pike->seen + pc * RE_PIKE_SEEN;
+
+  if (dfa->mark[pc] != dfa->generation)
+    {
+      dfa->mark[pc] = dfa->generation;
+      pike->nseen[pc] = 0;
+    }
+  /* What follows a character test does not depend on the loops
+     pending.  */
+  else if (pc == pike->bufp->used || dfa->exact_end[pc]
+	   || pattern[pc] == anychar || pattern[pc] == charset
+	   || pattern[pc] == charset_not || pattern[pc] == syntaxspec
+	   || pattern[pc] == notsyntaxspec)
+    return true;
+  else
+    {
+      int k;
+      for (k = 0; k < pike->nseen[pc]; k++)
+	if (seen[k] == pike->pending_hash)
+	  return true;
+      if (k == RE_PIKE_SEEN)
+	return true;
+    }
+
+  seen[pike->nseen[pc]++] = pike->pending_hash;
+  return false;
+}
+
+/* Add to LIST the threads that following the thread with the group
+   boundaries PIKE->caps from pattern position PC leads to without
+   consuming the character at POS, which is described by CFLAGS and
+   follows one described by FLAGS.  Return true if a thread reached
+   the end of the pattern, which makes the threads that the
+   backtracker would try after it moot.  */
+static bool
+re_pike_add (struct re_pike *pike, struct re_pike_threads *list,
+	     int pc, ptrdiff_t pos, int flags, int cflags)
+{
+  struct re_pattern_buffer *bufp = pike->bufp;
+  struct re_dfa *dfa = pike->dfa;
+  re_char *pattern = bufp->buffer;
+  int accept = bufp->used;
+  struct re_pike_entry *stack = pike->stack;
+  int n = 0;
+  bool matched = false;
+
+  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc, 0 };
+  while (n > 0)
+    {
+      struct re_pike_entry e = stack[--n];
+      switch (e.op)
+	{
+	case RE_PIKE_RESTORE:
+	  pike->caps[e.arg] = e.value;
+	  continue;
+
+	case RE_PIKE_PEND:
+	  pike->pending[e.arg] = true;
+	  pike->pending_hash += re_pike_hash (e.arg);
+	  continue;
+
+	case RE_PIKE_UNPEND:
+	  pike->pending[e.arg] = false;
+	  pike->pending_hash -= re_pike_hash (e.arg);
+	  continue;
+
+	case RE_PIKE_FOLLOW:
+	  break;
+	}
+
+      /* Once a match is found, just undo what was recorded.  */
+      if (matched)
+	continue;
+
+      pc = e.arg;
+      /* A loop that matched the empty string is left as the
+	 backtracker leaves it.  */
+      if (pc < accept && pike->pending[pc])
+	pc = (pattern[pc] == on_failure_jump_loop
+	      ? pc + 3 + extract_number (pattern + pc + 1)
+	      : pc + 3);
+
+      if (re_pike_seen (pike, pc))
+	continue;
+
+      if (pc == accept || (!dfa->exact_end[pc] && pattern[pc] == succeed))
+	{
+	  if (dfa->longest && 0 <= pike->end && pos != pike->end)
+	    continue;
+	  memcpy (pike->match, pike->caps, pike->ncaps * sizeof *pike->caps);
+	  pike->match_end = pos;
+	  matched = true;
+	  continue;
+	}
+
+      if (dfa->exact_end[pc])
+	goto consume;
+
+      switch (pattern[pc])
+	{
+	case no_op:
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 1, 0 };
+	  break;
+
+	case exactn:
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 2, 0 };
+	  break;
+
+	case anychar:
+	case charset:
+	case charset_not:
+	case syntaxspec:
+	case notsyntaxspec:
+	consume:
+	  list->pc[list->n] = pc;
+	  memcpy (list->caps + list->n * pike->ncaps, pike->caps,
+		  pike->ncaps * sizeof *pike->caps);
+	  list->n++;
+	  break;
+
+	case start_memory:
+	case stop_memory:
+	  {
+	    int i = 2 * (pattern[pc + 1] - 1) + (pattern[pc] == stop_memory);
+	    stack[n++] = (struct re_pike_entry) { RE_PIKE_RESTORE, i,
+						  pike->caps[i] };
+	    pike->caps[i] = pos;
+	    stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 2, 0 };
+	  }
+	  break;
+
+	case jump:
+	  stack[n++] = (struct re_pike_entry)
+	    { RE_PIKE_FOLLOW, re_dfa_jump_target (bufp, dfa, pc), 0 };
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_smart:
+	  stack[n++] = (struct re_pike_entry)
+	    { RE_PIKE_FOLLOW, pc + 3 + extract_number (pattern + pc + 1), 0 };
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 3, 0 };
+	  break;
+
+	case on_failure_jump_loop:
+	  /* The failure point is on the stack while the loop body is
+	     tried.  */
+	  stack[n++] = (struct re_pike_entry)
+	    { RE_PIKE_FOLLOW, pc + 3 + extract_number (pattern + pc + 1), 0 };
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_UNPEND, pc, 0 };
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 3, 0 };
+	  pike->pending[pc] = true;
+	  pike->pending_hash += re_pike_hash (pc);
+	  break;
+
+	case on_failure_jump_nastyloop:
+	  /* The cycle detection frame is pushed when the failure point,
+	     which goes back into the loop body, is popped.  */
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_UNPEND, pc, 0 };
+	  stack[n++] = (struct re_pike_entry)
+	    { RE_PIKE_FOLLOW, pc + 3 + extract_number (pattern + pc + 1), 0 };
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_PEND, pc, 0 };
+	  stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 3, 0 };
+	  break;
+
+	case begline:
+	case endline:
+	case begbuf:
+	case endbuf:
+	case wordbeg:
+	case wordend:
+	case wordbound:
+	case notwordbound:
+	case symbeg:
+	case symend:
+	  if (re_dfa_context_ok (pattern[pc], flags, cflags))
+	    stack[n++] = (struct re_pike_entry) { RE_PIKE_FOLLOW, pc + 1, 0 };
+	  break;
+
+	default:
+	  abort ();
+	}
+    }
+
+  return matched;
+}
+
+/* Use DFA, the DFA of BUFP, to find the match of BUFP in the virtual
+   concatenation of STRING1 and STRING2 that trying
+   re_match_2_internal with STOP at each character boundary from POS
+   through LAST in turn would find.  If END is nonnegative, the match
+   ends by END, which the DFA found to be the end of the longest one,
+   and if the longest match is wanted it ends there.  Store the
+   registers of the match in REGS if it is non-null, and its end in
+   *MATCH_END, and return its start, or -1 if there is no match after
+   all.  */
+static ptrdiff_t
+re_dfa_submatch (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		 re_char *string1, ptrdiff_t size1,
+		 re_char *string2, ptrdiff_t size2,
+		 ptrdiff_t pos, ptrdiff_t last, ptrdiff_t end, ptrdiff_t stop,
+		 struct re_registers *regs, ptrdiff_t *match_end)
+{
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  ptrdiff_t total = size1 + size2;
+  ptrdiff_t num_regs = bufp->re_nsub + 1;
+  int size = dfa->size;
+  unsigned short quit_count = 0;
+  struct re_pike pike = { .bufp = bufp, .dfa = dfa, .end = end,
+			  .ncaps = 2 * (num_regs - 1) + 1, .match_end = -1 };
+  struct re_pike_threads threads[2];
+  int prev_c = 0, flags;
+
+  REGEX_USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (pike.caps, 2, pike.ncaps);
+  pike.match = pike.caps + pike.ncaps;
+  SAFE_NALLOCA (pike.stack, 5 * RE_PIKE_SEEN, size);
+  SAFE_NALLOCA (pike.pending, 1, size);
+  memset (pike.pending, 0, size * sizeof *pike.pending);
+  SAFE_NALLOCA (pike.nseen, 1, size);
+  SAFE_NALLOCA (pike.seen, RE_PIKE_SEEN, size);
+  for (int i = 0; i < 2; i++)
+    {
+      SAFE_NALLOCA (threads[i].pc, 1, size);
+      SAFE_NALLOCA (threads[i].caps, pike.ncaps, size);
+    }
+  struct re_pike_threads *cur = &threads[0], *next = &threads[1];
+
+  bool props = dfa->need_syntax && parse_sexp_lookup_properties;
+  ptrdiff_t charpos = props ? RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos) : 0;
+  bool charpos_by_bytes = !(STRINGP (gl_state.object)
+			    || BUFFERP (gl_state.object)
+			    || NILP (gl_state.object));
+  /* Whether the fastmap can tell where matches start.  */
+  bool skip = bufp->fastmap && !bufp->can_be_null;
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  /* Syntax lookups can run Lisp; see re_match_2_internal.  */
+  if (props && !current_buffer->text->inhibit_shrinking)
+    {
+      record_unwind_protect_ptr (unwind_re_match, current_buffer);
+      current_buffer->text->inhibit_shrinking = 1;
+    }
+
+#define RE_DFA_ADDR(pos) \
+  ((pos) < size1 ? string1 + (pos) : string2 + ((pos) - size1))
+
+  if (pos == 0 || total == 0)
+    flags = RE_DFA_EDGE;
+  else
+    {
+      re_char *d = RE_DFA_ADDR (pos);
+      GET_CHAR_BEFORE_2 (prev_c, d, string1, string1 + size1,
+			 string2, string2 + size2);
+      flags = (re_dfa_char_flags (dfa, prev_c, charpos - 1, 0, 0)
+	       & RE_DFA_CHAR_FLAGS);
+    }
+
+  /* The character at POS and its flags.  */
+  int c = 0, len = 0, cflags = RE_DFA_EDGE;
+  if (pos < total)
+    {
+      GET_CHAR_AFTER (c, RE_DFA_ADDR (pos), len);
+      cflags = re_dfa_char_flags (dfa, c, charpos, prev_c, flags);
+      if (pos == stop)
+	cflags |= RE_DFA_LIMIT;
+    }
+
+  /* A match is tried at each start after those the threads already
+     running started at, so it comes last.  */
+  re_dfa_next_generation (dfa);
+  cur->n = 0;
+  for (int i = 0; i < pike.ncaps - 1; i++)
+    pike.caps[i] = -1;
+  pike.caps[pike.ncaps - 1] = pos;
+  bool matched = re_pike_add (&pike, cur, 0, pos, flags, cflags);
+
+  ptrdiff_t bound = end < 0 ? stop : end;
+  while (pos < bound && !(matched && dfa->longest && 0 <= end))
+    {
+      if (cur->n == 0)
+	{
+	  /* Nothing is under way; skip to where a match can start.  */
+	  if (matched || last <= pos)
+	    break;
+	  ptrdiff_t start = pos + len;
+	  if (skip)
+	    start = re_dfa_skip (bufp, string1, size1, string2, start,
+				 min (last, total - 1));
+	  if (last < start || bound <= start)
+	    break;
+	  pos = start;
+	  re_char *d = RE_DFA_ADDR (pos);
+	  GET_CHAR_BEFORE_2 (prev_c, d, string1, string1 + size1,
+			     string2, string2 + size2);
+	  if (props)
+	    charpos = RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos);
+	  flags = (re_dfa_char_flags (dfa, prev_c, charpos - 1, 0, 0)
+		   & RE_DFA_CHAR_FLAGS);
+	  GET_CHAR_AFTER (c, d, len);
+	  cflags = re_dfa_char_flags (dfa, c, charpos, prev_c, flags);
+	  if (pos == stop)
+	    cflags |= RE_DFA_LIMIT;
+	  re_dfa_next_generation (dfa);
+	  for (int i = 0; i < pike.ncaps - 1; i++)
+	    pike.caps[i] = -1;
+	  pike.caps[pike.ncaps - 1] = pos;
+	  matched = re_pike_add (&pike, cur, 0, pos, flags, cflags);
+	  continue;
+	}
+
+      re_char *d = RE_DFA_ADDR (pos);
+      ptrdiff_t npos = pos + len;
+      ptrdiff_t ncharpos = charpos + (charpos_by_bytes ? len : 1);
+      int nflags = cflags & RE_DFA_CHAR_FLAGS;
+      int nc = 0, nlen = 0, ncflags = RE_DFA_EDGE;
+      if (npos < total)
+	{
+	  GET_CHAR_AFTER (nc, RE_DFA_ADDR (npos), nlen);
+	  ncflags = re_dfa_char_flags (dfa, nc, ncharpos, c, nflags);
+	  if (npos == stop)
+	    ncflags |= RE_DFA_LIMIT;
+	}
+
+      re_dfa_next_generation (dfa);
+      next->n = 0;
+      bool cut = false;
+      for (int i = 0; i < cur->n; i++)
+	{
+	  int pc = re_dfa_consume (bufp, dfa, cur->pc[i], d, cflags);
+	  if (pc < 0)
+	    continue;
+	  memcpy (pike.caps, cur->caps + i * pike.ncaps,
+		  pike.ncaps * sizeof *pike.caps);
+	  if (re_pike_add (&pike, next, pc, npos, nflags, ncflags))
+	    {
+	      matched = cut = true;
+	      break;
+	    }
+	}
+      if (!cut && !matched && npos <= last)
+	{
+	  for (int i = 0; i < pike.ncaps - 1; i++)
+	    pike.caps[i] = -1;
+	  pike.caps[pike.ncaps - 1] = npos;
+	  matched = re_pike_add (&pike, next, 0, npos, nflags, ncflags);
+	}
+
+      struct re_pike_threads *t = cur;
+      cur = next;
+      next = t;
+      pos = npos;
+      charpos = ncharpos;
+      c = nc;
+      len = nlen;
+      cflags = ncflags;
+      rarely_quit (++quit_count);
+    }
+
+#undef RE_DFA_ADDR
+
+  unbind_to (count, Qnil);
+
+  ptrdiff_t result = -1;
+  if (0 <= pike.match_end)
+    {
+      ptrdiff_t start = pike.match[pike.ncaps - 1];
+      result = start;
+      *match_end = pike.match_end;
+      if (regs)
+	{
+	  re_alloc_registers (bufp, regs, num_regs);
+	  if (regs->num_regs > 0)
+	    {
+	      regs->start[0] = start;
+	      regs->end[0] = pike.match_end;
+	    }
+	  for (ptrdiff_t reg = 1; reg < num_regs; reg++)
+	    {
+	      ptrdiff_t rstart = pike.match[2 * (reg - 1)];
+	      ptrdiff_t rend = pike.match[2 * (reg - 1) + 1];
+	      if (rend < 0)
+		regs->start[reg] = regs->end[reg] = -1;
+	      else
+		{
+		  regs->start[reg] = rstart;
+		  regs->end[reg] = rend;
+		}
+	    }
+	  for (ptrdiff_t reg = num_regs; reg < regs->num_regs; reg++)
+	    regs->start[reg] = regs->end[reg] = -1;
+	}
+    }
+
+  SAFE_FREE ();
+  return result;
+}
+
+/* Narrow a forward search through RANGE positions from *STARTPOS to
+   the positions where a match could start, as told by DFA: no match
+   can start after the end of the first one to end, nor before the
+   first one to start, where *STARTPOS is moved.  Return the new
+   range, or -1 if no match is possible at all.  Trying a match at
+   each position in turn instead could run the DFA over the same text
+   from each of them, taking time quadratic in the length of the
+   text.  */
+static ptrdiff_t
+re_dfa_prescan (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		re_char *string1, ptrdiff_t size1,
+		re_char *string2, ptrdiff_t size2,
+		ptrdiff_t *startpos, ptrdiff_t range, ptrdiff_t stop)
+{
+  ptrdiff_t pos = *startpos;
+  ptrdiff_t end = re_dfa_search (bufp, dfa, string1, size1, string2, size2,
+				 pos, pos + range, stop, false);
+  if (end < 0)
+    return -1;
+  range = min (range, end - pos);
+  ptrdiff_t match_end;
+  ptrdiff_t start = re_dfa_submatch (bufp, dfa, string1, size1,
+				     string2, size2, pos, pos + range, -1,
+				     stop, NULL, &match_end);
+  if (start < 0)
+    return range;
+  *startpos = start;
+  return range - (start - pos);
+}
+
+/* Match BUFP, whose DFA DFA has taken over, at POS in the virtual
+   concatenation of STRING1 and STRING2 like re_match_2_internal.
+   Backtrack only if the DFA finds a match, and then only through the
+   end of the longest one; if that still backtracks too much, let
+   re_dfa_submatch compute the registers.  */
+static ptrdiff_t
+re_dfa_match (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+	      re_char *string1, ptrdiff_t size1,
+	      re_char *string2, ptrdiff_t size2,
+	      ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
+{
+  ptrdiff_t end = re_dfa_search (bufp, dfa, string1, size1, string2, size2,
+				 pos, pos, stop, true);
+  if (end < 0)
+    return -1;
+
+  /* Paths through the character at END cannot lead to a match, but
+     context tests at END look at it, and fail at STOP.  */
+  ptrdiff_t limit = stop;
+  if (end < stop)
+    {
+      re_char *d = end < size1 ? string1 + end : string2 + (end - size1);
+      limit = end + (RE_TARGET_MULTIBYTE_P (bufp)
+		     ? BYTES_BY_CHAR_HEAD (*d) : 1);
+    }
+
+  ptrdiff_t val = re_match_2_internal (bufp, string1, size1, string2, size2,
+				       pos, regs, limit, true);
+  if (val == -3)
+    {
+      ptrdiff_t match_end;
+      val = (re_dfa_submatch (bufp, dfa, string1, size1, string2, size2,
+			      pos, pos, end, stop, regs, &match_end) < 0
+	     ? -1 : match_end - pos);
+    }
+  return val;
+}
+
+/* Required literals.
+
+   Many patterns cannot match without some fixed string, like the
+   "error: " in "^.*error: \(.*\)$".  A forward search first looks for
+   that string with memmem, which is much faster than trying a match
+   at each position: it fails at once if the string is not there, and
+   otherwise no match can start after the string does.  If the string
+   lies at a bounded distance from the start of every match, or on the
+   same line, the search skips ahead to it too.  */
+
+struct re_literal
+{
+  /* How many characters can precede the literal in a match, or -1 if
+     there is no bound.  */
+  ptrdiff_t max_offset;
+
+  /* True if nothing before the literal in a match can be a newline.  */
+  bool_bf same_line : 1;
+
+  /* The index in BYTES of a byte that no other byte translates to,
+     or -1 if there is none.  */
+  int anchor;
+
+  /* True if text bytes must be mapped through FOLD before comparing
+     them with BYTES.  */
+  bool_bf folded : 1;
+
+  /* The byte that matches each text byte, for a pattern with a
+     translate table.  */
+  unsigned char fold[UCHAR_MAX + 1];
+
+  /* The literal itself, all ASCII.  */
+  int length;
+  unsigned char bytes[FLEXIBLE_ARRAY_MEMBER];
+};
+
+/* Return the pattern positions that can follow the instruction at PC
+   in the pattern of BUFP, storing them in NEXT.  A position of
+   BUFP->used means the end of the pattern.  Return the number of
+   positions stored.  */
+static int
+re_literal_successors (struct re_pattern_buffer *bufp, int pc, int next[2])
+{
+  re_char *p = bufp->buffer + pc;
+  int after = pc + re_dfa_insn_length (p);
+
+  switch (*p)
+    {
+    case succeed:
+      next[0] = bufp->used;
+      return 1;
+
+    case jump:
+      next[0] = pc + 3 + extract_number (p + 1);
+      return 1;
+
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+    case succeed_n:
+    case jump_n:
+      next[0] = after;
+      next[1] = pc + 3 + extract_number (p + 1);
+      return 2;
+
+    default:
+      next[0] = after;
+      return 1;
+    }
+}
+
+/* Return true if every match of the pattern of BUFP runs through the
+   instruction at PC.  VISITED and STACK are scratch areas of size
+   BUFP->used + 1.  If the result is true, VISITED is left marking the
+   positions reachable without going through PC.  */
+static bool
+re_literal_required_p (struct re_pattern_buffer *bufp, int pc,
+		       bool *visited, int *stack)
+{
+  int used = bufp->used;
+  int nstack = 0;
+
+  memset (visited, 0, (used + 1) * sizeof *visited);
+  visited[pc] = true;
+  if (!visited[0])
+    {
+      visited[0] = true;
+      stack[nstack++] = 0;
+    }
+  while (nstack > 0)
+    {
+      int next[2];
+      int here = stack[--nstack];
+      if (here == used)
+	return false;
+      for (int i = re_literal_successors (bufp, here, next); 0 < i--; )
+	if (0 <= next[i] && next[i] <= used && !visited[next[i]])
+	  {
+	    visited[next[i]] = true;
+	    stack[nstack++] = next[i];
+	  }
+    }
+  return true;
+}
+
+/* Return true if, under TRANSLATE, the ASCII pattern byte C matches
+   only ASCII characters.  */
+static bool
+re_literal_foldable (Lisp_Object translate, int c)
+{
+  if (NILP (translate))
+    return true;
+  if (RE_TRANSLATE (translate, c) != c
+      || CHAR_TABLE_EXTRA_SLOTS (XCHAR_TABLE (translate)) < 3)
+    return false;
+
+  /* The characters that translate to C are those in its cycle of
+     case equivalents.  */
+  Lisp_Object eqv = XCHAR_TABLE (translate)->extras[2];
+  if (!CHAR_TABLE_P (eqv))
+    return false;
+  int ch = c;
+  for (int i = 0; i < 16; i++)
+    {
+      Lisp_Object next = CHAR_TABLE_REF (eqv, ch);
+      if (!FIXNUMP (next))
+	return i == 0;
+      ch = XFIXNUM (next);
+      if (ch == c)
+	return true;
+      if (!ASCII_CHAR_P (ch) && RE_TRANSLATE (translate, ch) == c)
+	return false;
+    }
+  return false;
+}
+
+/* Return true if the instruction at P, in a pattern whose translate
+   table leaves newlines alone, can match a newline.  */
+static bool
+re_literal_newline_p (re_char *p)
+{
+  switch (*p)
+    {
+    case exactn:
+      return memchr (p + 2, '\n', p[1]) != NULL;
+
+    case charset:
+    case charset_not:
+      return ((*p == charset_not)
+	      != ('\n' < CHARSET_BITMAP_SIZE (p) * BYTEWIDTH
+		  && p[2 + '\n' / BYTEWIDTH] & (1 << ('\n' % BYTEWIDTH))));
+
+    case anychar:
+    case no_op:
+    case succeed:
+    case start_memory:
+    case stop_memory:
+    case jump:
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+    case succeed_n:
+    case jump_n:
+    case set_number_at:
+    case begline:
+    case endline:
+    case begbuf:
+    case endbuf:
+    case wordbound:
+    case notwordbound:
+    case wordbeg:
+    case wordend:
+    case symbeg:
+    case symend:
+    case at_dot:
+      return false;
+
+    default:
+      return true;
+    }
+}
+
+/* Find the longest run of ASCII bytes in the pattern of BUFP that
+   every match must contain, and return it as a new re_literal, or
+   return NULL if there is none worth searching for.  */
+static struct re_literal *
+re_literal_create (struct re_pattern_buffer *bufp)
+{
+  re_char *pattern = bufp->buffer;
+  int used = bufp->used;
+  Lisp_Object translate = bufp->translate;
+  bool multibyte = bufp->multibyte;
+  bool *visited = xmalloc ((used + 1) * sizeof *visited);
+  int *stack = xmalloc ((used + 1) * sizeof *stack);
+  int best = -1, best_pc = -1, best_length = 0;
+  ptrdiff_t best_offset = -1;
+
+  /* OFFSET counts the characters before PC while the pattern is a
+     plain sequence, and is -1 after that.  */
+  ptrdiff_t offset = 0;
+  for (int pc = 0; pc < used; pc += re_dfa_insn_length (pattern + pc))
+    {
+      re_opcode_t op = pattern[pc];
+      if (op == exactn && re_literal_required_p (bufp, pc, visited, stack))
+	{
+	  int n = pattern[pc + 1];
+	  ptrdiff_t chars = offset;
+	  for (int i = 0; i < n; )
+	    {
+	      int start = i;
+	      while (i < n && ASCII_CHAR_P (pattern[pc + 2 + i])
+		     && re_literal_foldable (translate, pattern[pc + 2 + i]))
+		i++;
+	      int length = i - start;
+	      if (length > best_length
+		  || (length == best_length && best_offset < 0
+		      && 0 <= chars))
+		{
+		  best = pc + 2 + start;
+		  best_pc = pc;
+		  best_length = length;
+		  best_offset = chars;
+		}
+	      if (0 <= chars)
+		chars += length;
+	      if (i < n)
+		{
+		  i++;
+		  while (multibyte && i < n && !CHAR_HEAD_P (pattern[pc + 2 + i]))
+		    i++;
+		  if (0 <= chars)
+		    chars++;
+		}
+	    }
+	}
+
+      if (offset < 0)
+	continue;
+      switch (op)
+	{
+	case exactn:
+	  for (int i = 0; i < pattern[pc + 1]; i++)
+	    if (!multibyte || CHAR_HEAD_P (pattern[pc + 2 + i]))
+	      offset++;
+	  break;
+
+	case anychar:
+	case charset:
+	case charset_not:
+	case syntaxspec:
+	case notsyntaxspec:
+	case categoryspec:
+	case notcategoryspec:
+	  offset++;
+	  break;
+
+	case no_op:
+	case start_memory:
+	case stop_memory:
+	case begline:
+	case endline:
+	case begbuf:
+	case endbuf:
+	case wordbound:
+	case notwordbound:
+	case wordbeg:
+	case wordend:
+	case symbeg:
+	case symend:
+	case at_dot:
+	  break;
+
+	default:
+	  offset = -1;
+	  break;
+	}
+    }
+
+  /* A single byte at the start is what the fastmap looks for anyway.  */
+  if (best_length == 0 || (best_length == 1 && best_offset == 0))
+    {
+      xfree (stack);
+      xfree (visited);
+      return NULL;
+    }
+
+  /* See whether anything that can come before the literal matches a
+     newline.  These are the instructions reachable without passing
+     through it, and the start of its own exactn.  */
+  bool same_line = ((NILP (translate)
+		     || RE_TRANSLATE (translate, '\n') == '\n')
+		    && !memchr (pattern + best_pc + 2, '\n',
+				best - (best_pc + 2)));
+  if (same_line)
+    {
+      re_literal_required_p (bufp, best_pc, visited, stack);
+      for (int pc = 0; pc < used && same_line;
+	   pc += re_dfa_insn_length (pattern + pc))
+	if (visited[pc] && pc != best_pc
+	    && re_literal_newline_p (pattern + pc))
+	  same_line = false;
+    }
+  xfree (stack);
+  xfree (visited);
+
+  struct re_literal *lit
+    = xmalloc (FLEXSIZEOF (struct re_literal, bytes, best_length));
+  lit->max_offset = best_offset;
+  lit->same_line = same_line;
+  lit->length = best_length;
+  memcpy (lit->bytes, pattern + best, best_length);
+  lit->folded = !NILP (translate);
+  for (int c = 0; c <= UCHAR_MAX; c++)
+    {
+      int translated = c;
+      if (lit->folded && ASCII_CHAR_P (c))
+	{
+	  translated = RE_TRANSLATE (translate, c);
+	  if (!ASCII_CHAR_P (translated))
+	    translated = c;
+	}
+      lit->fold[c] = translated;
+    }
+  lit->anchor = -1;
+  for (int i = 0; i < best_length && lit->anchor < 0; i++)
+    {
+      int c;
+      for (c = 0; c < 128; c++)
+	if (c != lit->bytes[i] && lit->fold[c] == lit->bytes[i])
+	  break;
+      if (c == 128)
+	lit->anchor = i;
+    }
+  return lit;
+}
+
+/* Return the required literal of BUFP, or NULL.  */
+static struct re_literal *
+re_literal_get (struct re_pattern_buffer *bufp)
+{
+  if (!bufp->literal_analyzed)
+    {
+      bufp->literal = re_literal_create (bufp);
+      bufp->literal_analyzed = true;
+    }
+  return bufp->literal;
+}
+
+/* Return true if LIT occurs at P.  */
+static bool
+re_literal_at (struct re_literal *lit, re_char *p)
+{
+  for (int i = 0; i < lit->length; i++)
+    if (lit->fold[p[i]] != lit->bytes[i])
+      return false;
+  return true;
+}
+
+/* Return the offset of the first occurrence of LIT in the SIZE bytes
+   at P, or -1 if there is none.  */
+static ptrdiff_t
+re_literal_memmem (struct re_literal *lit, re_char *p, ptrdiff_t size)
+{
+  int length = lit->length;
+  if (size < length)
+    return -1;
+  if (!lit->folded)
+    {
+      re_char *found = memmem (p, size, lit->bytes, length);
+      return found ? found - p : -1;
+    }
+
+  ptrdiff_t last = size - length;
+  int anchor = lit->anchor;
+  if (anchor < 0)
+    {
+      for (ptrdiff_t i = 0; i <= last; i++)
+	if (re_literal_at (lit, p + i))
+	  return i;
+      return -1;
+    }
+  for (ptrdiff_t i = 0; i <= last; i++)
+    {
+      re_char *a = memchr (p + i + anchor, lit->bytes[anchor], last - i + 1);
+      if (!a)
+	return -1;
+      i = a - p - anchor;
+      if (re_literal_at (lit, p + i))
+	return i;
+    }
+  return -1;
+}
+
+/* Return where LIT first occurs in the virtual concatenation of
+   STRING1 and STRING2 at or after POS and ending by STOP, or -1 if it
+   does not.  */
+static ptrdiff_t
+re_literal_search (struct re_literal *lit,
+		   re_char *string1, ptrdiff_t size1,
+		   re_char *string2, ptrdiff_t size2,
+		   ptrdiff_t pos, ptrdiff_t stop)
+{
+  int length = lit->length;
+  if (pos < size1)
+    {
+      ptrdiff_t found = re_literal_memmem (lit, string1 + pos,
+					   min (size1, stop) - pos);
+      if (found >= 0)
+	return pos + found;
+
+      /* Look for occurrences that straddle the two strings.  */
+      for (ptrdiff_t p = max (pos, size1 - length + 1);
+	   p < size1 && p + length <= stop; p++)
+	{
+	  int i = 0;
+	  while (i < length
+		 && (lit->fold[p + i < size1 ? string1[p + i]
+			       : string2[p + i - size1]]
+		     == lit->bytes[i]))
+	    i++;
+	  if (i == length)
+	    return p;
+	}
+      pos = size1;
+    }
+  ptrdiff_t found = re_literal_memmem (lit, string2 + (pos - size1),
+				       stop - pos);
+  return found < 0 ? -1 : pos + found;
+}
+
+/* Return the first position at or after POS where a match could start
+   in the virtual concatenation of STRING1 and STRING2 given that it
+   contains LIT, or -1 if LIT does not occur there by STOP.  MULTIBYTE
+   says whether the text is multibyte.  Set *LIT_POS to where LIT
+   first occurs.  */
+static ptrdiff_t
+re_literal_skip (struct re_literal *lit, bool multibyte,
+		 re_char *string1, ptrdiff_t size1,
+		 re_char *string2, ptrdiff_t size2,
+		 ptrdiff_t pos, ptrdiff_t stop, ptrdiff_t *lit_pos)
+{
+  ptrdiff_t found = re_literal_search (lit, string1, size1, string2, size2,
+				       pos, stop);
+  *lit_pos = found;
+  if (found < 0)
+    return -1;
+
+  ptrdiff_t start = found;
+  if (lit->max_offset < 0)
+    {
+      /* Back up to the start of the line, if a match must begin on
+	 the line where LIT is.  */
+      if (lit->same_line)
+	while (start > pos && *POS_ADDR_VSTRING (start - 1) != '\n')
+	  start--;
+      else
+	start = pos;
+      return start;
+    }
+
+  /* Back up from FOUND over as many characters as can precede LIT.  */
+  for (ptrdiff_t i = 0; i < lit->max_offset && start > pos; i++)
+    do
+      start--;
+    while (multibyte && start > pos
+	   && !CHAR_HEAD_P (*POS_ADDR_VSTRING (start)));
+  return start;
+}
+
+/* This is a separate function so that we can force an alloca cleanup
+   afterwards.  */
+static ptrdiff_t
+re_match_2_internal (struct re_pattern_buffer *bufp,
+		     re_char *string1, ptrdiff_t size1,
+		     re_char *string2, ptrdiff_t size2,
+		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop,
+		     bool limited)
+{
+  eassume (0 <= size1);
+  eassume (0 <= size2);
+  eassume (0 <= pos && pos <= stop && stop <= size1 + size2);
+
+  /* General temporaries.  */
+  int mcnt;
+
+  /* Just past the end of the corresponding string.  */
+  re_char *end1, *end2;
+
+  /* Pointers into string1 and string2, just past the last characters in
+     each to consider matching.  */
+  re_char *end_match_1, *end_match_2;
+
+  /* Where we are in the data, and the end of the current string.  */
+  re_char *d, *dend;
+
+  /* Used sometimes to remember where we were before starting matching
+     an operator so that we can go back in case of failure.  This "atomic"
+     behavior of matching opcodes is indispensable to the correctness
+     of the on_failure_keep_string_jump optimization.  */
+  re_char *dfail;
+
+  /* Where we are in the pattern, and the end of the pattern.  */
+  re_char *p = bufp->buffer;
+  re_char *pend = p + bufp->used;
+
+  /* We use this to map every character in the string.	*/
+  Lisp_Object translate = bufp->translate;
+
+  /* True if BUFP is setup from a multibyte regex.  */
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+
+  /* True if STRING1/STRING2 are multibyte.  */
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  /* Failure point stack.  Each place that can handle a failure further
+     down the line pushes a failure point on this stack.  It consists of
+     regstart, and regend for all registers corresponding to
+     the subexpressions we're currently inside, plus the number of such
+     registers, and, finally, two char *'s.  The first char * is where
+     to resume scanning the pattern; the second one is where to resume
+     scanning the strings.  */
+  fail_stack_type fail_stack;
+#ifdef DEBUG_COMPILES_ARGUMENTS
+  ptrdiff_t nfailure_points_pushed = 0, nfailure_points_popped = 0;
+#endif
+
+  /* We fill all the registers internally, independent of what we
+     return, for use in backreferences.  The number here includes
+     an element for register zero.  */
+  ptrdiff_t num_regs = bufp->re_nsub + 1;
+  eassume (0 < num_regs);
+
+  /* Information on the contents of registers. These are pointers into
+     the input strings; they record just what was matched (on this
+     attempt) by a subexpression part of the pattern, that is, the
+     regnum-th regstart pointer points to where in the pattern we began
+     matching and the regnum-th regend points to right after where we
+     stopped matching the regnum-th subexpression.  */
+  re_char **regstart UNINIT, **regend UNINIT;
+
+  /* The following record the register info as found in the above
+     variables when we find a match better than any we've seen before.
+     This happens as we backtrack through the failure points, which in
+     turn happens only if we have not yet matched the entire string. */
+  bool best_regs_set = false;
+  re_char **best_regstart UNINIT, **best_regend UNINIT;
+
+  /* Logically, this is 'best_regend[0]'.  But we don't want to have to
+     allocate space for that if we're not allocating space for anything
+     else (see below).  Also, we never need info about register 0 for
+     any of the other register vectors, and it seems rather a kludge to
+     treat 'best_regend' differently from the rest.  So we keep track of
+     the end of the best match so far in a separate variable.  We
+     initialize this to NULL so that when we backtrack the first time
+     and need to test it, it's not garbage.  */
+  re_char *match_end = NULL;
+
+  /* Final return value of the function.  */
+  ptrdiff_t retval = -1;        /* Presumes failure to match for now.  */
+
+  /* If LIMITED, how many more times backtracking may happen before
+     giving up.  */
+  int fails_left = RE_DFA_BACKTRACK_LIMIT;
+
+#ifdef DEBUG_COMPILES_ARGUMENTS
+  /* Counts the total number of registers pushed.  */
+  ptrdiff_t num_regs_pushed = 0;
+#endif
+
+  DEBUG_PRINT ("\nEntering re_match_2.\n");
+
+  REGEX_USE_SAFE_ALLOCA;
+
+  INIT_FAIL_STACK ();
+
+  specpdl_ref count = SPECPDL_INDEX ();
+
+  /* Prevent shrinking and relocation of buffer text if GC happens
+     while we are inside this function.  The calls to
+     UPDATE_SYNTAX_TABLE_* macros can call Lisp (via
+     `internal--syntax-propertize`); these calls are careful to defend against
+     buffer modifications, but even with no modifications, the buffer text may
+     be relocated during GC by `compact_buffer` which would invalidate
+     our C pointers to buffer text.  */
+  if (!current_buffer->text->inhibit_shrinking)
+    {
+      record_unwind_protect_ptr (unwind_re_match, current_buffer);
+      current_buffer->text->inhibit_shrinking = 1;
+    }
+
+  /* Do not bother to initialize all the register variables if there are
+     no groups in the pattern, as it takes a fair amount of time.  If
+     there are groups, we include space for register 0 (the whole
+     pattern) in REGSTART[0], even though we never use it, to avoid
+     the undefined behavior of subtracting 1 from REGSTART.  */
+  ptrdiff_t re_nsub = num_regs - 1;
+  if (0 < re_nsub)
+    {
+      regstart = SAFE_ALLOCA ((re_nsub * 4 + 1) * sizeof *regstart);
+      regend = regstart + num_regs;
+      best_regstart = regend + re_nsub;
+      best_regend = best_regstart + re_nsub;
+
+      /* Initialize subexpression text positions to unset, to mark ones
+	 that no start_memory/stop_memory has been seen for.  */
+      for (re_char **apos = regstart + 1; apos < best_regstart + 1; apos++)
+	*apos = NULL;
+    }
+
+  /* We move 'string1' into 'string2' if the latter's empty -- but not if
+     'string1' is null.  */
+  if (size2 == 0 && string1 != NULL)
+    {
+      string2 = string1;
+      size2 = size1;
+      string1 = 0;
+      size1 = 0;
+    }
+  end1 = string1 + size1;
+  end2 = string2 + size2;
+
+  /* P scans through the pattern as D scans through the data.
+     DEND is the end of the input string that D points within.
+     Advance D into the following input string whenever necessary, but
+     this happens before fetching; therefore, at the beginning of the
+     loop, D can be pointing at the end of a string, but it cannot
+     equal STRING2.  */
+  if (pos >= size1)
+    {
+      /* Only match within string2.  */
+      d = string2 + pos - size1;
+      dend = end_match_2 = string2 + stop - size1;
+      end_match_1 = end1;	/* Just to give it a value.  */
+    }
+  else
+    {
+      if (stop < size1)
+	{
+	  /* Only match within string1.  */
+	  end_match_1 = string1 + stop;
+	  /* BEWARE!
+	     When we reach end_match_1, PREFETCH normally switches to string2.
+	     But in the present case, this means that just doing a PREFETCH
+	     makes us jump from 'stop' to 'gap' within the string.
+	     What we really want here is for the search to stop as
+	     soon as we hit end_match_1.  That's why we set end_match_2
+	     to end_match_1 (since PREFETCH fails as soon as we hit
+	     end_match_2).  */
+	  end_match_2 = end_match_1;
+	}
+      else
+	{ /* It's important to use this code when STOP == SIZE so that
+	     moving D from end1 to string2 will not prevent the D == DEND
+	     check from catching the end of string.  */
+	  end_match_1 = end1;
+	  end_match_2 = string2 + stop - size1;
+	}
+      d = string1 + pos;
+      dend = end_match_1;
+    }
+
+  DEBUG_PRINT ("The compiled pattern is:\n");
+  DEBUG_PRINT_COMPILED_PATTERN (bufp, p, pend);
   DEBUG_PRINT ("The string to match is: \"");
   DEBUG_PRINT_DOUBLE_STRING (d, string1, size1, string2, size2);
   DEBUG_PRINT ("\"\n");
@@ -4346,31 +6510,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 	  /* If caller wants register contents data back, do it.  */
 	  if (regs)
 	    {
-	      /* Have the register data arrays been allocated?	*/
-	      if (bufp->regs_allocated == REGS_UNALLOCATED)
-		{ /* No.  So allocate them with malloc.  */
-		  ptrdiff_t n = max (RE_NREGS, num_regs);
-		  regs->start = xnmalloc (n, sizeof *regs->start);
-		  regs->end = xnmalloc (n, sizeof *regs->end);
-		  regs->num_regs = n;
-		  bufp->regs_allocated = REGS_REALLOCATE;
-		}
-	      else if (bufp->regs_allocated == REGS_REALLOCATE)
-		{ /* Yes.  If we need more elements than were already
-		     allocated, reallocate them.  If we need fewer, just
-		     leave it alone.  */
-		  ptrdiff_t n = regs->num_regs;
-		  if (n < num_regs)
-		    {
-		      n = max (n + (n >> 1), num_regs);
-		      regs->start
-			= xnrealloc (regs->start, n, sizeof *regs->start);
-		      regs->end = xnrealloc (regs->end, n, sizeof *regs->end);
-		      regs->num_regs = n;
-		    }
-		}
-	      else
-		eassert (bufp->regs_allocated == REGS_FIXED);
+	      re_alloc_registers (bufp, regs, num_regs);
 
 	      /* Convert the pointer data in 'regstart' and 'regend' to
 		 indices.  Register zero has to be set differently,
@@ -5215,6 +7355,12 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
       maybe_quit ();
       if (!FAIL_STACK_EMPTY ())
 	{
+	  if (limited && --fails_left < 0)
+	    {
+	      retval = -3;
+	      goto endof_re_match;
+	    }
+
 	  re_char *str, *pat;
 	  /* A restart point is known.  Restore to that state.  */
 	  DEBUG_PRINT ("\nFAIL:\n");
@@ -118,6 +118,24 @@ #define EMACS_REGEX_H 1
   /* If true, multi-byte form in the target of match should be
      recognized as a multibyte character.  */
   bool_bf target_multibyte : 1;
+
+  /* True if 'dfa' has been set up, or found to be of no use.  */
+  bool_bf dfa_analyzed : 1;
+
+  /* True once matching has backtracked too much, after which 'dfa'
+     is consulted before every backtracking match.  */
+  bool_bf dfa_eager : 1;
+
+  /* True if 'literal' has been set up.  */
+  bool_bf literal_analyzed : 1;
+
+  /* Lazily built DFA that tells where the pattern can match without
+     backtracking, or NULL.  */
+  struct re_dfa *dfa;
+
+  /* A string that every match contains, found when first searching
+     forward, or NULL if there is none worth looking for.  */
+  struct re_literal *literal;
 };
 
 /* Declarations for routines.  */
@@ -178,6 +196,9 @@ #define EMACS_REGEX_H 1
 			      ptrdiff_t num_regs,
 			      ptrdiff_t *starts, ptrdiff_t *ends);
 
+/* Free the memory BUFFER owns, other than its fastmap.  */
+extern void re_free_pattern (struct re_pattern_buffer *buffer);
+
 /* Character classes.  */
 typedef enum { RECC_ERROR = 0,
 	       RECC_ALNUM, RECC_ALPHA, RECC_WORD,
@@ -37,13 +37,17 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2024 Free Software
 
 #include "regex-emacs.h"
 
-#define REGEXP_CACHE_SIZE 20
-
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* Neighbors in the list of entries, most recently used first.  */
+  struct regexp_cache *next, *prev;
+  /* Next entry in the same bucket of regexp_cache_index.  An entry is
+     in the index if and only if its regexp is non-nil.  */
+  struct regexp_cache *hash_next;
+  /* Hash of the regexp and posix flag.  */
+  EMACS_UINT hash;
   Lisp_Object regexp, f_whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
@@ -57,11 +61,22 @@ #define REGEXP_CACHE_SIZE 20
   bool busy;
 };
 
-/* The instances of that struct.  */
-static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
+/* The ends of the list of entries; the head is the most recently
+   used one.  There are searchbuf_count entries.  Once there are
+   regexp-cache-size of them, the least recently used one that is not
+   busy is recompiled for each new regexp.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
+static ptrdiff_t searchbuf_count;
+
+/* Hash buckets of entries, indexed by hash modulo the number of
+   buckets, which is a power of 2.  */
+static struct regexp_cache **regexp_cache_index;
+static ptrdiff_t regexp_cache_index_size;
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* How often compile_pattern found a regexp in the cache, had to
+   compile it, and discarded another regexp to make room.  */
+static intmax_t regexp_cache_hits, regexp_cache_misses;
+static intmax_t regexp_cache_evictions;
 
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static EMACS_INT simple_search (EMACS_INT, unsigned char *, ptrdiff_t,
@@ -133,6 +148,140 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   cp->regexp = Fcopy_sequence (pattern);
 }
 
+/* Return the hash under which to index PATTERN compiled with POSIX.  */
+static EMACS_UINT
+regexp_cache_hash (Lisp_Object pattern, bool posix)
+{
+  return hash_string (SSDATA (pattern), SBYTES (pattern)) ^ posix;
+}
+
+/* Return the bucket of regexp_cache_index for HASH.  */
+static struct regexp_cache **
+regexp_cache_bucket (EMACS_UINT hash)
+{
+  return &regexp_cache_index[hash & (regexp_cache_index_size - 1)];
+}
+
+/* Add CP, whose regexp has just been compiled, to the index.  */
+static void
+regexp_cache_reindex (struct regexp_cache *cp)
+{
+  struct regexp_cache **bucket = regexp_cache_bucket (cp->hash);
+  cp->hash_next = *bucket;
+  *bucket = cp;
+}
+
+/* Remove CP, which has a non-nil regexp, from the index.  */
+static void
+regexp_cache_unindex (struct regexp_cache *cp)
+{
+  struct regexp_cache **p = regexp_cache_bucket (cp->hash);
+  while (*p != cp)
+    p = &(*p)->hash_next;
+  *p = cp->hash_next;
+}
+
+/* Unlink CP from the list of entries.  */
+static void
+regexp_cache_unlink (struct regexp_cache *cp)
+{
+  if (cp->prev)
+    cp->prev->next = cp->next;
+  else
+    searchbuf_head = cp->next;
+  if (cp->next)
+    cp->next->prev = cp->prev;
+  else
+    searchbuf_tail = cp->prev;
+}
+
+/* Make the index big enough for CAPACITY entries.  */
+static void
+regexp_cache_grow_index (ptrdiff_t capacity)
+{
+  ptrdiff_t size = regexp_cache_index_size;
+  if (capacity <= size)
+    return;
+  while (size < capacity)
+    size *= 2;
+  xfree (regexp_cache_index);
+  regexp_cache_index = xzalloc (size * sizeof *regexp_cache_index);
+  regexp_cache_index_size = size;
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    if (!NILP (cp->regexp))
+      regexp_cache_reindex (cp);
+}
+
+/* Return the number of entries the cache should hold at most.  */
+static ptrdiff_t
+regexp_cache_capacity (void)
+{
+  return clip_to_bounds (1, regexp_cache_size, 1 << 16);
+}
+
+/* Return an entry of the cache that is free to compile a new regexp
+   into.  Prefer making a new entry while there are fewer than the
+   capacity, and otherwise take the least recently used one that is
+   not busy.  */
+static struct regexp_cache *
+regexp_cache_victim (void)
+{
+  ptrdiff_t capacity = regexp_cache_capacity ();
+  struct regexp_cache *cp, *prev;
+
+  /* Discard entries beyond a capacity that has been lowered.  */
+  for (cp = searchbuf_tail; cp && searchbuf_count > capacity; cp = prev)
+    {
+      prev = cp->prev;
+      if (!cp->busy)
+	{
+	  if (!NILP (cp->regexp))
+	    {
+	      regexp_cache_unindex (cp);
+	      regexp_cache_evictions++;
+	    }
+	  regexp_cache_unlink (cp);
+	  re_free_pattern (&cp->buf);
+	  xfree (cp);
+	  searchbuf_count--;
+	}
+    }
+
+  if (searchbuf_count < capacity)
+    cp = NULL;
+  else
+    for (cp = searchbuf_tail; cp && cp->busy; cp = cp->prev)
+      continue;
+
+  if (!cp)
+    {
+      /* Make a new entry, even beyond the capacity if all the others
+	 are busy matching.  */
+      regexp_cache_grow_index (2 * max (capacity, searchbuf_count + 1));
+      cp = xzalloc (sizeof *cp);
+      cp->regexp = Qnil;
+      cp->f_whitespace_regexp = Qnil;
+      cp->syntax_table = Qnil;
+      cp->buf.allocated = 100;
+      cp->buf.buffer = xmalloc (100);
+      cp->buf.fastmap = cp->fastmap;
+      cp->prev = searchbuf_tail;
+      if (searchbuf_tail)
+	searchbuf_tail->next = cp;
+      else
+	searchbuf_head = cp;
+      searchbuf_tail = cp;
+      searchbuf_count++;
+    }
+  else if (!NILP (cp->regexp))
+    {
+      regexp_cache_unindex (cp);
+      cp->regexp = Qnil;
+      regexp_cache_evictions++;
+    }
+  return cp;
+}
+
 /* During gc, shrink compiled patterns to the size actually used.  */
 
 void
@@ -154,14 +303,27 @@ compact_regexp_cache (void)
 void
 clear_regexp_cache (void)
 {
-  int i;
-
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
     /* It's tempting to compare with the syntax-table we've actually changed,
        but it's not sufficient because char-table inheritance means that
        modifying one syntax-table can change others at the same time.  */
-    if (!searchbufs[i].busy && !EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+    if (!cp->busy && !EQ (cp->syntax_table, Qt) && !NILP (cp->regexp))
+      {
+	regexp_cache_unindex (cp);
+	cp->regexp = Qnil;
+      }
+}
+
+/* Mark the Lisp objects in the regexp cache.  */
+void
+mark_regexp_cache (void)
+{
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    {
+      mark_object (&cp->regexp);
+      mark_object (&cp->f_whitespace_regexp);
+      mark_object (&cp->syntax_table);
+    }
 }
 
 static void
@@ -194,53 +356,47 @@ freeze_pattern (struct regexp_cache *searchbuf)
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp, **lru_nonbusy;
-
-  for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
+  EMACS_UINT hash = regexp_cache_hash (pattern, posix);
+  struct regexp_cache *cp;
+
+  for (cp = *regexp_cache_bucket (hash); cp; cp = cp->hash_next)
+    if (cp->hash == hash
+	&& SCHARS (cp->regexp) == SCHARS (pattern)
+	&& !cp->busy
+	&& STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
+	&& !NILP (Fstring_equal (cp->regexp, pattern))
+	&& EQ (cp->buf.translate, translate)
+	&& cp->posix == posix
+	&& (EQ (cp->syntax_table, Qt)
+	    || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
+	&& !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
+	&& cp->buf.charset_unibyte == charset_unibyte)
+      break;
+
+  if (cp)
+    regexp_cache_hits++;
+  else
     {
-      cp = *cpp;
-      if (!cp->busy)
-        lru_nonbusy = cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
-          && !cp->busy
-	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
-	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && EQ (cp->buf.translate, translate)
-	  && cp->posix == posix
-	  && (EQ (cp->syntax_table, Qt)
-	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
-	  && cp->buf.charset_unibyte == charset_unibyte)
-	break;
-
-      /* If we're at the end of the cache, compile into the last
-	 (least recently used) non-busy cell in the cache.  */
-      if (cp->next == 0)
-	{
-          if (!lru_nonbusy)
-            error ("Too much matching reentrancy");
-          cpp = lru_nonbusy;
-          cp = *cpp;
-	compile_it:
-          eassert (!cp->busy);
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
-	}
+      regexp_cache_misses++;
+      cp = regexp_cache_victim ();
+      eassert (!cp->busy);
+      /* If this signals an error, CP is left with a nil regexp, out
+	 of the index.  */
+      compile_pattern_1 (cp, pattern, translate, posix);
+      cp->hash = hash;
+      regexp_cache_reindex (cp);
     }
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  /* Move CP to the front of the list to mark it as most recently
+     used.  */
+  if (cp != searchbuf_head)
+    {
+      regexp_cache_unlink (cp);
+      cp->prev = NULL;
+      cp->next = searchbuf_head;
+      searchbuf_head->prev = cp;
+      searchbuf_head = cp;
+    }
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -626,6 +782,414 @@ newline_cache_on_off (struct buffer *buf)
 }
 
 
+/* Counting newlines a block at a time.  Each word of a block is
+   compared with a word of newlines, and the zero bytes of the result
+   are counted in byte lanes of an accumulator that is summed once per
+   block, so the loops below can step over runs of short lines without
+   visiting them one by one.  */
+
+typedef uint64_t newline_word_t;
+
+#define NEWLINE_WORD_LSBS UINT64_C (0x0101010101010101)
+#define NEWLINE_WORD_LOW7 UINT64_C (0x7f7f7f7f7f7f7f7f)
+
+/* Return the number of newlines in the NEWLINE_BLOCK bytes at P.  */
+static ptrdiff_t
+newline_block_count (const unsigned char *p)
+{
+  newline_word_t lanes = 0;
+  for (int i = 0; i < NEWLINE_BLOCK; i += sizeof (newline_word_t))
+    {
+      newline_word_t w;
+      memcpy (&w, p + i, sizeof w);
+      w ^= NEWLINE_WORD_LSBS * '\n';
+      /* Bit 7 of each byte is set iff that byte of W is nonzero.  */
+      newline_word_t nonzero
+	= ((w & NEWLINE_WORD_LOW7) + NEWLINE_WORD_LOW7) | w;
+      lanes += (~nonzero >> 7) & NEWLINE_WORD_LSBS;
+    }
+  /* No lane exceeds NEWLINE_BLOCK / sizeof (newline_word_t), but all
+     eight can add up to 256, so sum them in pairs into 16-bit lanes
+     before summing those into the top 16 bits.  */
+  lanes = ((lanes & UINT64_C (0x00ff00ff00ff00ff))
+	   + ((lanes >> 8) & UINT64_C (0x00ff00ff00ff00ff)));
+  return (lanes * UINT64_C (0x0001000100010001)) >> 48;
+}
+
+/* Skip whole blocks of the N bytes starting at P as long as each has
+   at least one newline but fewer than *COUNT of them, and subtract
+   the newlines skipped from *COUNT.  Return the number of bytes
+   skipped, a multiple of NEWLINE_BLOCK.  The caller should look for
+   the remaining newlines one at a time from there, and need not call
+   this again until it is NEWLINE_BLOCK bytes further on: the block
+   where skipping stopped holds either no newline or the one wanted.
+
+   Stopping at newline-free blocks leaves long lines to the callers'
+   line-at-a-time loops, which is where find_newline records them in
+   the newline cache.  */
+
+ptrdiff_t
+skip_newlines_forward (const unsigned char *p, ptrdiff_t n, ptrdiff_t *count)
+{
+  ptrdiff_t skipped = 0;
+  for (; n - skipped >= NEWLINE_BLOCK; skipped += NEWLINE_BLOCK)
+    {
+      ptrdiff_t found = newline_block_count (p + skipped);
+      if (found == 0 || *count <= found)
+	break;
+      *count -= found;
+    }
+  return skipped;
+}
+
+/* Like skip_newlines_forward, but skip backward over the N bytes that
+   end at P, adding the newlines skipped to the negative *COUNT.  */
+
+ptrdiff_t
+skip_newlines_backward (const unsigned char *p, ptrdiff_t n, ptrdiff_t *count)
+{
+  ptrdiff_t skipped = 0;
+  for (; n - skipped >= NEWLINE_BLOCK; skipped += NEWLINE_BLOCK)
+    {
+      ptrdiff_t found = newline_block_count (p - skipped - NEWLINE_BLOCK);
+      if (found == 0 || -*count <= found)
+	break;
+      *count += found;
+    }
+  return skipped;
+}
+
+/* Line indexes.  A buffer's line index divides its text into chunks
+   of about LINE_CHUNK bytes and records how many bytes and newlines
+   each chunk holds, in two Fenwick trees so that the bytes and
+   newlines before any chunk are summed in logarithmic time.  The
+   number of the line holding a position, or the position after the
+   Nth newline, is then found by summing down to the right chunk and
+   scanning only within it.
+
+   Edits are noted by invalidate_line_index the way region caches
+   note them: only the extents of text at either end of the buffer
+   that are known to be unchanged are kept.  The next query rescans
+   the chunks covering the text in between, which for typical edits
+   is a chunk or two.  Chunk sizes are kept in bytes, so what is
+   unchanged at the ends keeps its byte length too.  */
+
+/* Bytes in a newly made chunk, and in the largest chunk an edit can
+   leave behind before the chunks around it are made anew.  */
+enum { LINE_CHUNK = 4096, LINE_CHUNK_MAX = 2 * LINE_CHUNK };
+
+/* Scans covering fewer bytes than this, or looking for fewer
+   newlines, are left to the scanning loops, which are quicker over
+   short distances.  */
+enum { LINE_INDEX_SPAN = 16 * LINE_CHUNK, LINE_INDEX_COUNT = 256 };
+
+struct line_index
+{
+  /* Number of chunks, and the number there is room for.  */
+  ptrdiff_t nchunks, size;
+
+  /* Bytes and newlines in each chunk, in buffer order.  */
+  ptrdiff_t *bytes, *lines;
+
+  /* Fenwick trees over BYTES and LINES.  Element I, counting from 1,
+     is the sum of the I & -I chunks ending with chunk I - 1.  */
+  ptrdiff_t *byte_tree, *line_tree;
+
+  /* Characters at the beginning and the end of the buffer that have
+     not changed since the index was last brought up to date, or
+     PTRDIFF_MAX if nothing has changed.  */
+  ptrdiff_t skip_head, skip_tail;
+};
+
+/* Return the sum of the first N elements of the Fenwick tree TREE.  */
+static ptrdiff_t
+fenwick_sum (const ptrdiff_t *tree, ptrdiff_t n)
+{
+  ptrdiff_t sum = 0;
+  for (; n > 0; n &= n - 1)
+    sum += tree[n];
+  return sum;
+}
+
+/* Add DELTA to element I (counting from 0) of the Fenwick tree TREE
+   of N elements.  */
+static void
+fenwick_add (ptrdiff_t *tree, ptrdiff_t n, ptrdiff_t i, ptrdiff_t delta)
+{
+  for (i++; i <= n; i += i & -i)
+    tree[i] += delta;
+}
+
+/* Make TREE the Fenwick tree of the N elements of VALS.  */
+static void
+fenwick_build (ptrdiff_t *tree, const ptrdiff_t *vals, ptrdiff_t n)
+{
+  for (ptrdiff_t i = 1; i <= n; i++)
+    tree[i] = vals[i - 1];
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      ptrdiff_t parent = i + (i & -i);
+      if (parent <= n)
+	tree[parent] += tree[i];
+    }
+}
+
+/* Return the largest I such that the first I elements of the Fenwick
+   tree TREE of N elements sum to less than *TARGET, and subtract
+   their sum from *TARGET.  */
+static ptrdiff_t
+fenwick_find (const ptrdiff_t *tree, ptrdiff_t n, ptrdiff_t *target)
+{
+  ptrdiff_t i = 0;
+  ptrdiff_t step = n ? (ptrdiff_t) 1 << (stdc_bit_width ((size_t) n) - 1) : 0;
+  for (; step; step >>= 1)
+    if (i + step <= n && tree[i + step] < *target)
+      {
+	i += step;
+	*target -= tree[i];
+      }
+  return i;
+}
+
+/* Return the number of newlines in the current buffer's text between
+   byte positions FROM and TO, regardless of narrowing.  */
+static ptrdiff_t
+count_newlines_bytes (ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t n = 0;
+  while (from < to)
+    {
+      ptrdiff_t ceiling = min (from < GPT_BYTE ? GPT_BYTE : Z_BYTE, to);
+      const unsigned char *p = BYTE_POS_ADDR (from);
+      const unsigned char *lim = p + (ceiling - from);
+      for (; lim - p >= NEWLINE_BLOCK; p += NEWLINE_BLOCK)
+	n += newline_block_count (p);
+      for (; p < lim; p++)
+	n += *p == '\n';
+      from = ceiling;
+    }
+  return n;
+}
+
+/* Return the byte position after the Nth newline at or after byte
+   position FROM in the current buffer, which must have that many.  */
+static ptrdiff_t
+nth_newline_end (ptrdiff_t from, ptrdiff_t n)
+{
+  for (;;)
+    {
+      ptrdiff_t ceiling = from < GPT_BYTE ? GPT_BYTE : Z_BYTE;
+      const unsigned char *base = BYTE_POS_ADDR (from);
+      const unsigned char *p = base, *lim = base + (ceiling - from);
+      for (; lim - p >= NEWLINE_BLOCK; p += NEWLINE_BLOCK)
+	{
+	  ptrdiff_t found = newline_block_count (p);
+	  if (n <= found)
+	    break;
+	  n -= found;
+	}
+      for (; (p = memchr (p, '\n', lim - p)); p++)
+	if (--n == 0)
+	  return from + (p - base) + 1;
+      from = ceiling;
+    }
+}
+
+/* Make room in LI for NCHUNKS chunks.  */
+static void
+line_index_reserve (struct line_index *li, ptrdiff_t nchunks)
+{
+  if (li->size < nchunks)
+    {
+      ptrdiff_t size = li->size;
+      ptrdiff_t *bytes = xpalloc (NULL, &size, nchunks - li->size, -1,
+				  4 * sizeof *bytes);
+      memcpy (bytes, li->bytes, li->nchunks * sizeof *bytes);
+      memcpy (bytes + size, li->lines, li->nchunks * sizeof *bytes);
+      xfree (li->bytes);
+      li->bytes = bytes;
+      li->lines = bytes + size;
+      /* The trees are indexed from 1.  */
+      li->byte_tree = bytes + 2 * size - 1;
+      li->line_tree = bytes + 3 * size - 1;
+      li->size = size;
+    }
+}
+
+/* Replace chunks [I, J) of LI by chunks holding the text of the
+   current buffer between byte positions FROM and TO.  */
+static void
+line_index_replace (struct line_index *li, ptrdiff_t i, ptrdiff_t j,
+		    ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t len = to - from;
+  ptrdiff_t old = j - i;
+
+  /* If the text fits in as many chunks as it did without leaving
+     them mostly empty, spread it evenly over them and update the
+     trees in place.  */
+  if (old && len <= old * LINE_CHUNK_MAX
+      && (old == 1 || len >= old * (LINE_CHUNK / 2)))
+    {
+      for (ptrdiff_t k = 0; k < old; k++)
+	{
+	  ptrdiff_t beg = from + len * k / old;
+	  ptrdiff_t end = from + len * (k + 1) / old;
+	  ptrdiff_t lines = count_newlines_bytes (beg, end);
+	  fenwick_add (li->byte_tree, li->nchunks, i + k,
+		       end - beg - li->bytes[i + k]);
+	  fenwick_add (li->line_tree, li->nchunks, i + k,
+		       lines - li->lines[i + k]);
+	  li->bytes[i + k] = end - beg;
+	  li->lines[i + k] = lines;
+	}
+      return;
+    }
+
+  ptrdiff_t new = (len + LINE_CHUNK - 1) / LINE_CHUNK;
+  ptrdiff_t nchunks = li->nchunks - old + new;
+  line_index_reserve (li, nchunks);
+  memmove (li->bytes + i + new, li->bytes + j,
+	   (li->nchunks - j) * sizeof *li->bytes);
+  memmove (li->lines + i + new, li->lines + j,
+	   (li->nchunks - j) * sizeof *li->lines);
+  for (ptrdiff_t k = 0; k < new; k++)
+    {
+      ptrdiff_t beg = from + k * LINE_CHUNK;
+      ptrdiff_t end = min (beg + LINE_CHUNK, to);
+      li->bytes[i + k] = end - beg;
+      li->lines[i + k] = count_newlines_bytes (beg, end);
+    }
+  li->nchunks = nchunks;
+  fenwick_build (li->byte_tree, li->bytes, nchunks);
+  fenwick_build (li->line_tree, li->lines, nchunks);
+}
+
+/* Bring LI up to date with the text of the current buffer.  */
+static void
+line_index_revalidate (struct line_index *li)
+{
+  if (li->skip_head == PTRDIFF_MAX)
+    return;
+
+  ptrdiff_t total = Z_BYTE - BEG_BYTE;
+
+  /* Edits may have left many chunks small or empty; once they
+     outnumber fresh ones by far, start over.  */
+  if (li->nchunks > 2 * (total / LINE_CHUNK) + 64)
+    {
+      li->nchunks = 0;
+      li->skip_head = li->skip_tail = 0;
+    }
+
+  ptrdiff_t old_total = fenwick_sum (li->byte_tree, li->nchunks);
+
+  ptrdiff_t head = min (li->skip_head, Z - BEG);
+  ptrdiff_t tail = min (li->skip_tail, Z - BEG - head);
+  ptrdiff_t head_bytes = CHAR_TO_BYTE (BEG + head) - BEG_BYTE;
+  ptrdiff_t tail_bytes = Z_BYTE - CHAR_TO_BYTE (Z - tail);
+  eassert (head_bytes + tail_bytes <= old_total);
+
+  /* The text that changed was within chunks [I, J), which now must
+     cover the text between the unchanged ends.  */
+  ptrdiff_t target = head_bytes + 1;
+  ptrdiff_t i = fenwick_find (li->byte_tree, li->nchunks, &target);
+  if (i == li->nchunks && i > 0)
+    i--;
+  target = old_total - tail_bytes;
+  ptrdiff_t j = fenwick_find (li->byte_tree, li->nchunks, &target) + 1;
+  j = min (max (j, i + 1), li->nchunks);
+  ptrdiff_t from = BEG_BYTE + fenwick_sum (li->byte_tree, i);
+  ptrdiff_t to = (BEG_BYTE + fenwick_sum (li->byte_tree, j)
+		  + (total - old_total));
+  line_index_replace (li, i, j, from, to);
+  li->skip_head = li->skip_tail = PTRDIFF_MAX;
+}
+
+/* Note that the text of the buffer whose line index is LI has changed,
+   except for its first HEAD and last TAIL characters.  */
+void
+invalidate_line_index (struct line_index *li, ptrdiff_t head, ptrdiff_t tail)
+{
+  li->skip_head = min (li->skip_head, head);
+  li->skip_tail = min (li->skip_tail, tail);
+}
+
+void
+free_line_index (struct line_index *li)
+{
+  xfree (li->bytes);
+  xfree (li);
+}
+
+/* Return the line index of the current buffer, up to date.  */
+static struct line_index *
+current_line_index (void)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+  if (!b->line_index)
+    b->line_index = xzalloc (sizeof *b->line_index);
+  line_index_revalidate (b->line_index);
+  return b->line_index;
+}
+
+/* Return the number of newlines before byte position POS in the
+   current buffer, regardless of narrowing.  */
+static ptrdiff_t
+line_index_lines_before (struct line_index *li, ptrdiff_t pos)
+{
+  ptrdiff_t target = pos - BEG_BYTE + 1;
+  ptrdiff_t i = fenwick_find (li->byte_tree, li->nchunks, &target);
+  return (fenwick_sum (li->line_tree, i)
+	  + count_newlines_bytes (pos - (target - 1), pos));
+}
+
+/* Return the byte position after the Nth newline of the current
+   buffer, which must have that many.  */
+static ptrdiff_t
+line_index_newline_end (struct line_index *li, ptrdiff_t n)
+{
+  ptrdiff_t target = n;
+  ptrdiff_t i = fenwick_find (li->line_tree, li->nchunks, &target);
+  return nth_newline_end (BEG_BYTE + fenwick_sum (li->byte_tree, i), target);
+}
+
+/* Look for COUNT newlines from byte position START toward byte
+   position LIMIT in the current buffer, forward if COUNT is positive
+   and backward otherwise, using the buffer's line index.  If there
+   are that many, set *FOUND to COUNT and *BYTEPOS to the position
+   after the last one found; otherwise set *FOUND to the number there
+   are, negated if COUNT is negative, and *BYTEPOS to LIMIT.
+
+   Return false, doing nothing, if the scan is too short for the
+   index to pay off.  */
+bool
+line_index_scan (ptrdiff_t start, ptrdiff_t limit, ptrdiff_t count,
+		 ptrdiff_t *found, ptrdiff_t *bytepos)
+{
+  if (eabs (count) < LINE_INDEX_COUNT
+      || eabs (limit - start) < LINE_INDEX_SPAN)
+    return false;
+
+  struct line_index *li = current_line_index ();
+  ptrdiff_t start_line = line_index_lines_before (li, start);
+  ptrdiff_t limit_line = line_index_lines_before (li, limit);
+  if (count > 0 ? limit_line - start_line < count
+      : start_line - limit_line < - count)
+    {
+      *found = limit_line - start_line;
+      *bytepos = limit;
+    }
+  else
+    {
+      *found = count;
+      *bytepos = line_index_newline_end (li, start_line + count
+					 + (count < 0));
+    }
+  return true;
+}
+
 /* Search for COUNT newlines between START/START_BYTE and END/END_BYTE.
 
    If COUNT is positive, search forwards; END must be >= START.
@@ -670,6 +1234,22 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
   if (end_byte == -1)
     end_byte = CHAR_TO_BYTE (end);
 
+  /* Far-off lines are found quicker with the line index.  */
+  if (eabs (count) >= LINE_INDEX_COUNT)
+    {
+      ptrdiff_t found, pos_byte;
+      if (start_byte == -1)
+	start_byte = CHAR_TO_BYTE (start);
+      if (line_index_scan (start_byte, end_byte, count, &found, &pos_byte))
+	{
+	  if (counted)
+	    *counted = found;
+	  if (bytepos)
+	    *bytepos = pos_byte;
+	  return pos_byte == end_byte ? end : BYTE_TO_CHAR (pos_byte);
+	}
+    }
+
   newline_cache = newline_cache_on_off (current_buffer);
   if (current_buffer->base_buffer)
     cache_buffer = current_buffer->base_buffer;
@@ -775,10 +1355,18 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  /* Nonpositive offsets (relative to LIM_ADDR and LIM_BYTE)
 	     of the base, the cursor, and the next line.  */
 	  ptrdiff_t base = start_byte - lim_byte;
-	  ptrdiff_t cursor, next;
+	  ptrdiff_t cursor, next, skip_from = base;
 
 	  for (cursor = base; cursor < 0; cursor = next)
 	    {
+	      /* Step over blocks of short lines in bulk.  */
+	      if (skip_from <= cursor)
+		{
+		  cursor += skip_newlines_forward (lim_addr + cursor, - cursor,
+						   &count);
+		  skip_from = cursor + NEWLINE_BLOCK;
+		}
+
               /* The dumb loop.  */
 	      unsigned char *nl = memchr (lim_addr + cursor, '\n', - cursor);
 	      next = nl ? nl - lim_addr : 0;
@@ -884,10 +1472,17 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	     the base, the cursor, and the previous line.  These
 	     offsets are at least -1.  */
 	  ptrdiff_t base = start_byte - ceiling_byte;
-	  ptrdiff_t cursor, prev;
+	  ptrdiff_t cursor, prev, skip_from = base;
 
 	  for (cursor = base; 0 < cursor; cursor = prev)
             {
+	      if (cursor <= skip_from)
+		{
+		  cursor -= skip_newlines_backward (ceiling_addr + cursor, cursor,
+						    &count);
+		  skip_from = cursor - NEWLINE_BLOCK;
+		}
+
 	      unsigned char *nl = memrchr (ceiling_addr, '\n', cursor);
 	      prev = nl ? nl - ceiling_addr : -1;
 
@@ -3360,18 +3955,39 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
     }
 }
 
+DEFUN ("regexp-cache-statistics", Fregexp_cache_statistics,
+       Sregexp_cache_statistics, 0, 1, 0,
+       doc: /* Return statistics about the cache of compiled regexps.
+The value is an alist of the form
+
+  ((size . SIZE) (hits . HITS) (misses . MISSES) (evictions . EVICTIONS))
+
+where SIZE is the number of regexps the cache holds, HITS and MISSES
+count the searches that found their regexp in the cache and those
+that had to compile it, and EVICTIONS counts the regexps discarded to
+make room for others.  See also `regexp-cache-size'.
+
+If RESET is non-nil, reset the counts to zero after returning them.  */)
+  (Lisp_Object reset)
+{
+  ptrdiff_t size = 0;
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    size += !NILP (cp->regexp);
+  Lisp_Object val = list4 (Fcons (Qsize, make_fixnum (size)),
+			   Fcons (Qhits, make_int (regexp_cache_hits)),
+			   Fcons (Qmisses, make_int (regexp_cache_misses)),
+			   Fcons (Qevictions,
+				  make_int (regexp_cache_evictions)));
+  if (!NILP (reset))
+    regexp_cache_hits = regexp_cache_misses = regexp_cache_evictions = 0;
+  return val;
+}
+
 static void syms_of_search_for_pdumper (void);
 
 void
 syms_of_search (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].f_whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
-    }
-
   /* Error condition used for failing searches.  */
   DEFSYM (Qsearch_failed, "search-failed");
 
@@ -3410,6 +4026,18 @@ syms_of_search (void)
 numbering of existing capture groups in unexpected ways.  */);
   Vsearch_spaces_regexp = Qnil;
 
+  DEFVAR_INT ("regexp-cache-size", regexp_cache_size,
+	      doc: /* Maximum number of compiled regexps to keep for reuse.
+Searching for a regexp that is not among the most recently used ones
+compiles it anew, so this should exceed the number of regexps that
+font-lock, completion and the like cycle through.
+`regexp-cache-statistics' tells how well the cache is doing.  */);
+  regexp_cache_size = 256;
+
+  DEFSYM (Qhits, "hits");
+  DEFSYM (Qmisses, "misses");
+  DEFSYM (Qevictions, "evictions");
+
   DEFSYM (Qinhibit_changing_match_data, "inhibit-changing-match-data");
   DEFVAR_LISP ("inhibit-changing-match-data", Vinhibit_changing_match_data,
       doc: /* Internal use only.
@@ -3438,6 +4066,7 @@ syms_of_search (void)
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
   defsubr (&Sre__describe_compiled);
+  defsubr (&Sregexp_cache_statistics);
 
   pdumper_do_now_and_after_load (syms_of_search_for_pdumper);
 }
@@ -3445,16 +4074,9 @@ syms_of_search (void)
 static void
 syms_of_search_for_pdumper (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      searchbufs[i].buf.allocated = 100;
-      searchbufs[i].buf.buffer = xmalloc (100);
-      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
-      searchbufs[i].regexp = Qnil;
-      searchbufs[i].f_whitespace_regexp = Qnil;
-      searchbufs[i].busy = false;
-      searchbufs[i].syntax_table = Qnil;
-      searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
-    }
-  searchbuf_head = &searchbufs[0];
+  searchbuf_head = searchbuf_tail = NULL;
+  searchbuf_count = 0;
+  regexp_cache_index_size = 64;
+  regexp_cache_index = xzalloc (regexp_cache_index_size
+				* sizeof *regexp_cache_index);
 }
@@ -31,7 +31,11 @@ Copyright (C) 2022-2024 Free Software Foundation, Inc.
 
 
 #include <config.h>
+
+#include <nproc.h>
+
 #include "lisp.h"
+#include "systhread.h"
 
 
 /* Reverse a slice of a vector in place, from lo up to (exclusive) hi. */
@@ -1072,6 +1076,316 @@ resolve_fun (Lisp_Object fun)
   return fun;
 }
 
+/* Fast paths for sorting with value< when no Lisp needs to run.
+
+   If every key is a fixnum, or every key is a string that compares
+   bytewise (unibyte or pure ASCII), the order of value< is known in
+   C and comparisons can neither signal nor call out to Lisp.  Fixnum
+   keys are then sorted by a stable LSD radix sort, and string keys by
+   a stable merge sort split across worker threads.  Both sort an
+   array of sort_item describing the keys and finally apply the
+   resulting permutation to the keys and values.  */
+
+/* Minimum length for which the fast paths are attempted; below it
+   timsort is as fast and exploits presorted input better.  */
+#define VALUELT_FAST_SORT_MIN 512
+
+/* Minimum number of elements given to one merge sort worker.  */
+#define SORT_PARALLEL_CHUNK_MIN 16384
+
+/* Maximum number of merge sort workers.  */
+#define SORT_PARALLEL_MAX 16
+
+/* Runs shorter than this are sorted by insertion.  */
+#define SORT_INSERTION_MAX 24
+
+struct sort_item
+{
+  union
+  {
+    EMACS_UINT bits;		/* Fixnum key, biased to sort unsigned.  */
+    const unsigned char *bytes;	/* String key data.  */
+  } u;
+  ptrdiff_t nbytes;		/* String key length in bytes.  */
+  ptrdiff_t idx;		/* Position of the element before sorting.  */
+};
+
+/* Return true iff string key A sorts before string key B.  */
+static inline bool
+sort_item_string_lt (const struct sort_item *a, const struct sort_item *b)
+{
+  int d = memcmp (a->u.bytes, b->u.bytes, min (a->nbytes, b->nbytes));
+  return d < 0 || (d == 0 && a->nbytes < b->nbytes);
+}
+
+/* Stable LSD radix sort of the N fixnum ITEMS, using TMP as scratch.
+   Passes over bytes that are the same for all keys are skipped.  */
+static void
+radix_sort_fixnums (struct sort_item *items, struct sort_item *tmp,
+		    ptrdiff_t n)
+{
+  enum { DIGITS = sizeof (EMACS_UINT) };
+  ptrdiff_t counts[DIGITS][UCHAR_MAX + 1] = { 0 };
+
+  for (ptrdiff_t i = 0; i < n; i++)
+    for (int d = 0; d < DIGITS; d++)
+      counts[d][(items[i].u.bits >> (d * CHAR_BIT)) & UCHAR_MAX]++;
+
+  struct sort_item *src = items, *dst = tmp;
+  for (int d = 0; d < DIGITS; d++)
+    {
+      int shift = d * CHAR_BIT;
+      if (counts[d][(src[0].u.bits >> shift) & UCHAR_MAX] == n)
+	continue;
+      ptrdiff_t pos = 0;
+      for (int b = 0; b <= UCHAR_MAX; b++)
+	{
+	  ptrdiff_t c = counts[d][b];
+	  counts[d][b] = pos;
+	  pos += c;
+	}
+      for (ptrdiff_t i = 0; i < n; i++)
+	dst[counts[d][(src[i].u.bits >> shift) & UCHAR_MAX]++] = src[i];
+      struct sort_item *t = src;
+      src = dst;
+      dst = t;
+    }
+  if (src != items)
+    memcpy (items, src, n * sizeof *items);
+}
+
+/* Merge the sorted string items SRC[LO, MID) and SRC[MID, HI) into
+   DST[LO, HI), preferring the left run on ties for stability.  */
+static void
+merge_string_items (const struct sort_item *src, struct sort_item *dst,
+		    ptrdiff_t lo, ptrdiff_t mid, ptrdiff_t hi)
+{
+  ptrdiff_t i = lo, j = mid, k = lo;
+  while (i < mid && j < hi)
+    dst[k++] = sort_item_string_lt (&src[j], &src[i]) ? src[j++] : src[i++];
+  memcpy (&dst[k], &src[i], (mid - i) * sizeof *dst);
+  k += mid - i;
+  memcpy (&dst[k], &src[j], (hi - j) * sizeof *dst);
+}
+
+/* Stable bottom-up merge sort of string ITEMS[LO, HI), using the same
+   range of TMP as scratch.  The result is left in ITEMS.  */
+static void
+merge_sort_string_items (struct sort_item *items, struct sort_item *tmp,
+			 ptrdiff_t lo, ptrdiff_t hi)
+{
+  for (ptrdiff_t run = lo; run < hi; run += SORT_INSERTION_MAX)
+    {
+      ptrdiff_t end = min (run + SORT_INSERTION_MAX, hi);
+      for (ptrdiff_t i = run + 1; i < end; i++)
+	{
+	  struct sort_item x = items[i];
+	  ptrdiff_t j = i;
+	  for (; j > run && sort_item_string_lt (&x, &items[j - 1]); j--)
+	    items[j] = items[j - 1];
+	  items[j] = x;
+	}
+    }
+
+  struct sort_item *src = items, *dst = tmp;
+  for (ptrdiff_t width = SORT_INSERTION_MAX; width < hi - lo; width *= 2)
+    {
+      for (ptrdiff_t l = lo; l < hi; l += 2 * width)
+	merge_string_items (src, dst, l, min (l + width, hi),
+			    min (l + 2 * width, hi));
+      struct sort_item *t = src;
+      src = dst;
+      dst = t;
+    }
+  if (src != items)
+    memcpy (&items[lo], &src[lo], (hi - lo) * sizeof *items);
+}
+
+/* A unit of merge sort work, run either by a worker thread or
+   inline by the thread calling tim_sort.  */
+struct sort_task
+{
+  struct sort_item *src, *dst;
+  ptrdiff_t lo, mid, hi;	/* MID < 0 means sort rather than merge.  */
+  struct sort_join *join;
+};
+
+/* Completion of a batch of sort_task.  */
+struct sort_join
+{
+  sys_mutex_t mutex;
+  sys_cond_t cond;
+  int pending;
+};
+
+static void
+sort_task_run (struct sort_task *task)
+{
+  if (task->mid < 0)
+    merge_sort_string_items (task->src, task->dst, task->lo, task->hi);
+  else
+    merge_string_items (task->src, task->dst,
+			task->lo, task->mid, task->hi);
+}
+
+static void *
+sort_task_worker (void *arg)
+{
+  struct sort_task *task = arg;
+  struct sort_join *join = task->join;
+  sort_task_run (task);
+  sys_mutex_lock (&join->mutex);
+  join->pending--;
+  sys_cond_signal (&join->cond);
+  sys_mutex_unlock (&join->mutex);
+  return NULL;
+}
+
+/* Run the N TASKS, handing all but the first to worker threads when
+   these can be created, and return after all have finished.  */
+static void
+run_sort_tasks (struct sort_task *tasks, int n)
+{
+  struct sort_join join = { .pending = 0 };
+  sys_mutex_init (&join.mutex);
+  sys_cond_init (&join.cond);
+
+  for (int i = 1; i < n; i++)
+    {
+      sys_thread_t thread;
+      tasks[i].join = &join;
+      sys_mutex_lock (&join.mutex);
+      join.pending++;
+      sys_mutex_unlock (&join.mutex);
+      if (!sys_thread_create (&thread, sort_task_worker, &tasks[i]))
+	{
+	  sys_mutex_lock (&join.mutex);
+	  join.pending--;
+	  sys_mutex_unlock (&join.mutex);
+	  sort_task_run (&tasks[i]);
+	}
+    }
+  if (n > 0)
+    sort_task_run (&tasks[0]);
+
+  sys_mutex_lock (&join.mutex);
+  while (join.pending > 0)
+    sys_cond_wait (&join.cond, &join.mutex);
+  sys_mutex_unlock (&join.mutex);
+  sys_cond_destroy (&join.cond);
+}
+
+/* Stable merge sort of the N string ITEMS, using TMP as scratch,
+   split into chunks sorted concurrently and then merged pairwise,
+   each round of merges also running concurrently.  */
+static void
+parallel_sort_strings (struct sort_item *items, struct sort_item *tmp,
+		       ptrdiff_t n)
+{
+  int nchunks = min (SORT_PARALLEL_MAX,
+		     min (num_processors (NPROC_CURRENT_OVERRIDABLE),
+			  n / SORT_PARALLEL_CHUNK_MIN));
+  nchunks = max (nchunks, 1);
+
+  ptrdiff_t bounds[SORT_PARALLEL_MAX + 1];
+  struct sort_task tasks[SORT_PARALLEL_MAX];
+  for (int i = 0; i <= nchunks; i++)
+    bounds[i] = n / nchunks * i + min (i, n % nchunks);
+  for (int i = 0; i < nchunks; i++)
+    tasks[i] = (struct sort_task) { .src = items, .dst = tmp,
+				    .lo = bounds[i], .mid = -1,
+				    .hi = bounds[i + 1] };
+  run_sort_tasks (tasks, nchunks);
+
+  struct sort_item *src = items, *dst = tmp;
+  while (nchunks > 1)
+    {
+      int ntasks = 0, nmerged = 0;
+      for (int i = 0; i < nchunks; i += 2)
+	{
+	  if (i + 1 < nchunks)
+	    tasks[ntasks++] = (struct sort_task) {
+	      .src = src, .dst = dst, .lo = bounds[i],
+	      .mid = bounds[i + 1], .hi = bounds[i + 2] };
+	  else
+	    memcpy (&dst[bounds[i]], &src[bounds[i]],
+		    (bounds[i + 1] - bounds[i]) * sizeof *dst);
+	  bounds[nmerged++] = bounds[i];
+	}
+      bounds[nmerged] = n;
+      run_sort_tasks (tasks, ntasks);
+      nchunks = nmerged;
+      struct sort_item *t = src;
+      src = dst;
+      dst = t;
+    }
+  if (src != items)
+    memcpy (items, src, n * sizeof *items);
+}
+
+/* Reorder the first N elements of VEC so that element I is the one
+   previously at ITEMS[I].idx, using SCRATCH as temporary storage.  */
+static void
+apply_sort_permutation (Lisp_Object *vec, const struct sort_item *items,
+			Lisp_Object *scratch, ptrdiff_t n)
+{
+  for (ptrdiff_t i = 0; i < n; i++)
+    scratch[i] = vec[items[i].idx];
+  memcpy (vec, scratch, n * sizeof *vec);
+}
+
+/* Sort the N elements of LO by value< without timsort if its keys
+   allow it.  Return true if sorted, false if LO is left untouched.  */
+static bool
+valuelt_fast_sort (sortslice lo, ptrdiff_t n)
+{
+  if (n < VALUELT_FAST_SORT_MIN)
+    return false;
+
+  bool fixnums = FIXNUMP (lo.keys[0]);
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object key = lo.keys[i];
+      if (fixnums
+	  ? !FIXNUMP (key)
+	  : !(STRINGP (key)
+	      && (!STRING_MULTIBYTE (key) || SCHARS (key) == SBYTES (key))))
+	return false;
+    }
+
+  USE_SAFE_ALLOCA;
+  struct sort_item *items, *tmp;
+  SAFE_NALLOCA (items, 2, n);
+  tmp = items + n;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object key = lo.keys[i];
+      if (fixnums)
+	items[i].u.bits = (EMACS_UINT) XFIXNUM (key) - MOST_NEGATIVE_FIXNUM;
+      else
+	{
+	  items[i].u.bytes = SDATA (key);
+	  items[i].nbytes = SBYTES (key);
+	}
+      items[i].idx = i;
+    }
+
+  /* No Lisp runs and nothing is allocated from the Lisp heap until
+     the permutation has been applied, so string data cannot move.  */
+  if (fixnums)
+    radix_sort_fixnums (items, tmp, n);
+  else
+    parallel_sort_strings (items, tmp, n);
+
+  Lisp_Object *scratch;
+  SAFE_NALLOCA (scratch, 1, n);
+  apply_sort_permutation (lo.keys, items, scratch, n);
+  if (lo.values != NULL)
+    apply_sort_permutation (lo.values, items, scratch, n);
+  SAFE_FREE ();
+  return true;
+}
+
 /* Sort the array SEQ with LENGTH elements in the order determined by
    PREDICATE (where Qnil means value<) and KEYFUNC (where Qnil means identity),
    optionally reversed.  */
@@ -1126,46 +1440,48 @@ tim_sort (Lisp_Object predicate, Lisp_Object keyfunc,
     for (ptrdiff_t i = 0; i < length; i++)
       keys[i] = call1 (keyfunc, seq[i]);
 
-  /* FIXME: This is where we would check the keys for interesting
-     properties for more optimized comparison (such as all being fixnums
-     etc).  */
-
-  /* March over the array once, left to right, finding natural runs,
-     and extending short natural runs to minrun elements.  */
-  const ptrdiff_t minrun = merge_compute_minrun (length);
-  ptrdiff_t nremaining = length;
-  do {
-    bool descending;
-
-    /* Identify the next run.  */
-    ptrdiff_t n = count_run (&ms, lo.keys, lo.keys + nremaining, &descending);
-    if (descending)
-      reverse_sortslice (&lo, n);
-    /* If the run is short, extend it to min(minrun, nremaining).  */
-    if (n < minrun)
-      {
-	const ptrdiff_t force = min (nremaining, minrun);
-	binarysort (&ms, lo, lo.keys + force, lo.keys + n);
-	n = force;
-      }
-    eassume (ms.n == 0
-	     || (ms.pending[ms.n - 1].base.keys + ms.pending[ms.n - 1].len
-		 == lo.keys));
-    found_new_run (&ms, n);
-    /* Push the new run on to the stack.  */
-    eassume (ms.n < MAX_MERGE_PENDING);
-    ms.pending[ms.n].base = lo;
-    ms.pending[ms.n].len = n;
-    ++ms.n;
-    /* Advance to find the next run.  */
-    sortslice_advance (&lo, n);
-    nremaining -= n;
-  } while (nremaining);
-
-  merge_force_collapse (&ms);
-  eassume (ms.n == 1);
-  eassume (ms.pending[0].len == length);
-  lo = ms.pending[0].base;
+  /* With value< and keys of a uniform, simple type, sort without
+     calling back into the general comparison.  */
+  if (!(NILP (predicate) && valuelt_fast_sort (lo, length)))
+    {
+      /* March over the array once, left to right, finding natural
+	 runs, and extending short natural runs to minrun elements.  */
+      const ptrdiff_t minrun = merge_compute_minrun (length);
+      ptrdiff_t nremaining = length;
+      do {
+	bool descending;
+
+	/* Identify the next run.  */
+	ptrdiff_t n = count_run (&ms, lo.keys, lo.keys + nremaining,
+				 &descending);
+	if (descending)
+	  reverse_sortslice (&lo, n);
+	/* If the run is short, extend it to min(minrun, nremaining).  */
+	if (n < minrun)
+	  {
+	    const ptrdiff_t force = min (nremaining, minrun);
+	    binarysort (&ms, lo, lo.keys + force, lo.keys + n);
+	    n = force;
+	  }
+	eassume (ms.n == 0
+		 || (ms.pending[ms.n - 1].base.keys + ms.pending[ms.n - 1].len
+		     == lo.keys));
+	found_new_run (&ms, n);
+	/* Push the new run on to the stack.  */
+	eassume (ms.n < MAX_MERGE_PENDING);
+	ms.pending[ms.n].base = lo;
+	ms.pending[ms.n].len = n;
+	++ms.n;
+	/* Advance to find the next run.  */
+	sortslice_advance (&lo, n);
+	nremaining -= n;
+      } while (nremaining);
+
+      merge_force_collapse (&ms);
+      eassume (ms.n == 1);
+      eassume (ms.pending[0].len == length);
+      lo = ms.pending[0].base;
+    }
 
   if (reverse)
     reverse_slice (seq, seq + length);
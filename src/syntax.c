@@ -27,6 +27,10 @@
 #include "intervals.h"
 #include "category.h"
 
+#ifdef HAVE_TREE_SITTER
+#include "tree-sitter.h"
+#endif
+
 /* Make syntax table lookup grant data in gl_state.  */
 #define SYNTAX(c) syntax_property (c, 1)
 #define SYNTAX_ENTRY(c) syntax_property_entry (c, 1)
@@ -148,6 +152,10 @@ SYNTAX_COMEND_FIRST (int c)
     EMACS_INT mindepth;	/* Minimum depth seen while scanning.  */
     /* Char number of most recent start-of-expression at current level */
     ptrdiff_t thislevelstart;
+    /* Char number of the start of the expression at the current level
+       that is being scanned, or has just been; -1 if unknown.  This and
+       THISLEVELSTART let scan_sexps_forward carry on where it stopped.  */
+    ptrdiff_t sexpstart;
     /* Char number of start of containing expression */
     ptrdiff_t prevlevelstart;
     ptrdiff_t location;	     /* Char number at which parsing stopped.  */
@@ -184,6 +192,8 @@ SYNTAX_COMEND_FIRST (int c)
                                 ptrdiff_t, ptrdiff_t, ptrdiff_t, EMACS_INT,
                                 bool, int);
 static void internalize_parse_state (Lisp_Object, struct lisp_parse_state *);
+static bool syntax_checkpoints_usable (void);
+static void parse_state_at (ptrdiff_t, struct lisp_parse_state *, bool);
 static bool in_classes (int c, int num_classes, const unsigned char *classes);
 static void parse_sexp_propertize (ptrdiff_t charpos);
 
@@ -551,6 +561,277 @@ dec_bytepos (ptrdiff_t bytepos)
 	     ? prev_char_len (bytepos) : 1));
 }
 
+#ifdef HAVE_TREE_SITTER
+
+/* When parse-sexp-use-tree-sitter is non-nil and the current buffer
+   has a parse tree, the scans below ask it where lists, strings and
+   comments end instead of reading every character in between.  A
+   node is trusted only when it is free of parse errors and the syntax
+   table agrees about the characters that delimit it, so the answer is
+   the one a scan of the text would give unless the grammar and the
+   syntax table disagree about the text in between.  Return that
+   tree, or NULL.  */
+
+static const TSTree *
+syntax_tree (void)
+{
+  return parse_sexp_use_tree_sitter ? tree_sitter_current_tree () : NULL;
+}
+
+/* Return the syntax, with flags, of the character at POS; store the
+   character in *C and whether it is quoted in *QUOTED.  Leave the
+   global syntax data as it was.  */
+
+static int
+tree_char_syntax (ptrdiff_t pos, int *c, bool *quoted)
+{
+  struct gl_state_s saved = gl_state;
+  ptrdiff_t pos_byte = CHAR_TO_BYTE (pos);
+  UPDATE_SYNTAX_TABLE (pos);
+  *c = FETCH_CHAR_AS_MULTIBYTE (pos_byte);
+  int syntax = SYNTAX_WITH_FLAGS (*c);
+  *quoted = char_quoted (pos, pos_byte);
+  gl_state = saved;
+  return syntax;
+}
+
+/* Return true if the character at POS is unquoted, has syntax CODE
+   and, unless TERM is negative, is TERM.  */
+
+static bool
+tree_char_is (ptrdiff_t pos, enum syntaxcode code, int term)
+{
+  int c;
+  bool quoted;
+  int syntax = tree_char_syntax (pos, &c, &quoted);
+  return (syntax & 0xff) == code && (term < 0 || c == term) && !quoted;
+}
+
+/* Return true if NODE is a token, or begins and ends with tokens, as
+   lists and strings do.  */
+
+static bool
+tree_node_delimited_p (TSNode node)
+{
+  uint32_t n = ts_node_child_count (node);
+  return (n == 0
+	  || (n >= 2
+	      && ts_node_child_count (ts_node_child (node, 0)) == 0
+	      && ts_node_child_count (ts_node_child (node, n - 1)) == 0));
+}
+
+/* Return the end of the smallest node of the parse tree that starts
+   at FROM, where there is an open paren or string quote, and ends
+   with an unquoted character of syntax CODE that is also TERM unless
+   TERM is negative.  Return 0 if there is no such node.  */
+
+static ptrdiff_t
+tree_node_end (ptrdiff_t from, enum syntaxcode code, int term)
+{
+  const TSTree *tree = syntax_tree ();
+  if (!tree)
+    return 0;
+
+  uint32_t byte = BUFFER_TO_SITTER (from);
+  for (TSNode node = ts_node_descendant_for_byte_range
+	 (ts_tree_root_node (tree), byte, byte + 1);
+       !ts_node_is_null (node) && ts_node_start_byte (node) == byte;
+       node = ts_node_parent (node))
+    {
+      ptrdiff_t end = SITTER_TO_BUFFER (ts_node_end_byte (node));
+      if (end > ZV || ts_node_has_error (node))
+	return 0;
+      if (end > from + 1 && tree_node_delimited_p (node)
+	  && tree_char_is (end - 1, code, term))
+	return end;
+    }
+  return 0;
+}
+
+/* Return the start of the smallest node of the parse tree that ends
+   just after TO, where there is a close paren or string quote, and
+   starts with an unquoted character of syntax CODE that is also TERM
+   unless TERM is negative.  Return 0 if there is no such node.  */
+
+static ptrdiff_t
+tree_node_start (ptrdiff_t to, enum syntaxcode code, int term)
+{
+  const TSTree *tree = syntax_tree ();
+  if (!tree)
+    return 0;
+
+  uint32_t byte = BUFFER_TO_SITTER (to), end_byte = BUFFER_TO_SITTER (to + 1);
+  for (TSNode node = ts_node_descendant_for_byte_range
+	 (ts_tree_root_node (tree), byte, byte + 1);
+       !ts_node_is_null (node) && ts_node_end_byte (node) == end_byte;
+       node = ts_node_parent (node))
+    {
+      ptrdiff_t start = SITTER_TO_BUFFER (ts_node_start_byte (node));
+      if (start < BEGV || ts_node_has_error (node))
+	return 0;
+      if (start < to && tree_node_delimited_p (node)
+	  && tree_char_is (start, code, term))
+	return start;
+    }
+  return 0;
+}
+
+/* Return the innermost comment node of the parse tree containing the
+   character at POS, or a null node if there is none.  Grammars list
+   comments among their extras, the named nodes that can appear
+   anywhere; which nodes are comments is not guessed from their
+   names.  */
+
+static TSNode
+tree_comment_at (const TSTree *tree, ptrdiff_t pos)
+{
+  uint32_t byte = BUFFER_TO_SITTER (pos);
+  TSNode node = ts_node_descendant_for_byte_range (ts_tree_root_node (tree),
+						   byte, byte + 1);
+  while (!ts_node_is_null (node)
+	 && !(ts_node_is_extra (node) && ts_node_is_named (node)))
+    node = ts_node_parent (node);
+  return node;
+}
+
+/* *FROM and *FROM_BYTE are just after the starter of a comment that
+   forw_comment is to scan.  Move them to two characters before the
+   end of the comment node starting there, so that forw_comment need
+   only look for the comment ender among the last few characters.
+   Leave them alone for a nested comment, whose depth the jump would
+   lose, and when an escape can hide a comment ender.  */
+
+static void
+tree_skip_comment (ptrdiff_t *from, ptrdiff_t *from_byte, bool comnested)
+{
+  if (comnested || comment_end_can_be_escaped || *from <= BEGV)
+    return;
+  const TSTree *tree = syntax_tree ();
+  if (!tree)
+    return;
+
+  ptrdiff_t pos = *from - 1;
+  TSNode node = tree_comment_at (tree, pos);
+  if (ts_node_is_null (node) || ts_node_has_error (node))
+    return;
+  ptrdiff_t start = SITTER_TO_BUFFER (ts_node_start_byte (node));
+  ptrdiff_t end = SITTER_TO_BUFFER (ts_node_end_byte (node));
+  if (pos - 1 <= start && start <= pos && *from < end - 2 && end <= ZV)
+    {
+      *from = end - 2;
+      *from_byte = CHAR_TO_BYTE (*from);
+      UPDATE_SYNTAX_TABLE_FORWARD (*from);
+    }
+}
+
+/* Return the start of the comment of style COMSTYLE that the comment
+   ender at FROM ends, according to the parse tree; 0 if the parse
+   tree finds no comment there; and -1 if it cannot tell.  */
+
+static ptrdiff_t
+tree_comment_start (ptrdiff_t from, ptrdiff_t stop, bool comnested,
+		    int comstyle)
+{
+  if (comnested || from <= stop)
+    return -1;
+  const TSTree *tree = syntax_tree ();
+  if (!tree)
+    return -1;
+
+  TSNode node = tree_comment_at (tree, from - 1);
+  if (ts_node_is_null (node))
+    /* Only a tree without errors can vouch that nothing before FROM
+       is a comment.  */
+    return ts_node_has_error (ts_tree_root_node (tree)) ? -1 : 0;
+  if (ts_node_has_error (node))
+    return -1;
+
+  ptrdiff_t start = SITTER_TO_BUFFER (ts_node_start_byte (node));
+  ptrdiff_t end = SITTER_TO_BUFFER (ts_node_end_byte (node));
+  if (start < stop || end < from || end > from + 2)
+    return -1;
+
+  /* Make sure the comment starts as the syntax table says one of this
+     style does, with the two-character starters taking precedence.  */
+  int c, c1;
+  bool quoted, quoted1;
+  int syntax = tree_char_syntax (start, &c, &quoted);
+  int style;
+  if (quoted)
+    return -1;
+  if (SYNTAX_FLAGS_COMSTART_FIRST (syntax) && start + 1 < from)
+    {
+      int other_syntax = tree_char_syntax (start + 1, &c1, &quoted1);
+      if (SYNTAX_FLAGS_COMSTART_SECOND (other_syntax))
+	{
+	  if (SYNTAX_FLAGS_COMMENT_NESTED (syntax)
+	      || SYNTAX_FLAGS_COMMENT_NESTED (other_syntax))
+	    return -1;
+	  style = SYNTAX_FLAGS_COMMENT_STYLE (other_syntax, syntax);
+	  return style == comstyle ? start : -1;
+	}
+    }
+  if ((syntax & 0xff) != Scomment || SYNTAX_FLAGS_COMMENT_NESTED (syntax))
+    return -1;
+  style = SYNTAX_FLAGS_COMMENT_STYLE (syntax, 0);
+  return style == comstyle ? start : -1;
+}
+
+/* Return the start of the top-level node of the parse tree containing
+   POS, or POS itself if it lies between top-level nodes.  Return 0 if
+   there is no parse tree to ask.  */
+
+static ptrdiff_t
+tree_defun_start (ptrdiff_t pos)
+{
+  const TSTree *tree = syntax_tree ();
+  if (!tree)
+    return 0;
+
+  TSNode node = ts_node_first_child_for_byte (ts_tree_root_node (tree),
+					      BUFFER_TO_SITTER (pos));
+  if (ts_node_is_null (node))
+    return pos;
+  ptrdiff_t start = SITTER_TO_BUFFER (ts_node_start_byte (node));
+  if (start >= pos)
+    return pos;
+  return start >= BEGV && !ts_node_has_error (node) ? start : 0;
+}
+
+#else /* !HAVE_TREE_SITTER */
+
+static ptrdiff_t
+tree_node_end (ptrdiff_t from, enum syntaxcode code, int term)
+{
+  return 0;
+}
+
+static ptrdiff_t
+tree_node_start (ptrdiff_t to, enum syntaxcode code, int term)
+{
+  return 0;
+}
+
+static void
+tree_skip_comment (ptrdiff_t *from, ptrdiff_t *from_byte, bool comnested)
+{
+}
+
+static ptrdiff_t
+tree_comment_start (ptrdiff_t from, ptrdiff_t stop, bool comnested,
+		    int comstyle)
+{
+  return -1;
+}
+
+static ptrdiff_t
+tree_defun_start (ptrdiff_t pos)
+{
+  return 0;
+}
+
+#endif /* !HAVE_TREE_SITTER */
+
 /* Return a defun-start position before POS and not too far before.
    It should be the last one before POS, or nearly the last.
 
@@ -581,6 +862,29 @@ find_defun_start (ptrdiff_t pos, ptrdiff_t pos_byte)
       && MODIFF == find_start_modiff)
     return find_start_value;
 
+  ptrdiff_t tree_start = tree_defun_start (pos);
+  if (tree_start)
+    {
+      find_start_value = tree_start;
+      find_start_value_byte = CHAR_TO_BYTE (tree_start);
+      goto found;
+    }
+  if (syntax_checkpoints_usable ())
+    {
+      struct lisp_parse_state state;
+      parse_state_at (pos, &state, false);
+      if (state.incomment || state.instring >= 0)
+	{
+	  find_start_value = state.comstr_start;
+	  find_start_value_byte = CHAR_TO_BYTE (find_start_value);
+	}
+      else
+	{
+	  find_start_value = pos;
+	  find_start_value_byte = pos_byte;
+	}
+      goto found;
+    }
   if (!NILP (Vcomment_use_syntax_ppss))
     {
       modiff_count modiffs = CHARS_MODIFF;
@@ -715,6 +1019,22 @@ back_comment (ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
      in the case of {{ c }}} because we ignore the last two chars which are
      assumed to be comment-enders although they aren't.  */
 
+  /* A parse tree knows where the comment starts, if there is one.  */
+  ptrdiff_t tree_start = tree_comment_start (from, stop, comnested, comstyle);
+  if (tree_start >= 0)
+    {
+      /* Leave the syntax data as the scan below does.  */
+      if (tree_start)
+	{
+	  from = tree_start;
+	  from_byte = CHAR_TO_BYTE (from);
+	  UPDATE_SYNTAX_TABLE_FORWARD (from - 1);
+	}
+      else
+	UPDATE_SYNTAX_TABLE_FORWARD (comment_end);
+      goto done;
+    }
+
   /* At beginning of range to scan, we're outside of strings;
      that determines quote parity to the comment-end.  */
   while (from != stop)
@@ -2479,6 +2799,7 @@ DEFUN ("forward-comment", Fforward_comment, Sforward_comment, 1, 1, 0,
 	  return Qnil;
 	}
       /* We're at the start of a comment.  */
+      tree_skip_comment (&from, &from_byte, comnested);
       found = forw_comment (from, from_byte, stop, comnested, comstyle, 0,
 			    &out_charpos, &out_bytepos, &dummy, &dummy2);
       from = out_charpos; from_byte = out_bytepos;
@@ -2634,7 +2955,7 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
   EMACS_INT min_depth = depth;  /* Err out if depth gets less than this.  */
   int comstyle = 0;		/* Style of comment encountered.  */
   bool comnested = 0;		/* Whether the comment is nestable or not.  */
-  ptrdiff_t temp_pos;
+  ptrdiff_t temp_pos, tree_pos;
   EMACS_INT last_good = from0;
   bool found;
   ptrdiff_t from_byte;
@@ -2737,6 +3058,7 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	    case Scomment:
 	      if (!parse_sexp_ignore_comments) break;
 	      UPDATE_SYNTAX_TABLE_FORWARD (from);
+	      tree_skip_comment (&from, &from_byte, comnested);
 	      found = forw_comment (from, from_byte, stop,
 				    comnested, comstyle, 0,
 				    &out_charpos, &out_bytepos, &dummy,
@@ -2768,6 +3090,14 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	      FALLTHROUGH;
 	    case Sopen:
 	      if (!++depth) goto done;
+	      /* Jump to the end of the list if a parse tree knows it.  */
+	      if (code == Sopen && parse_sexp_ignore_comments
+		  && (tree_pos = tree_node_end (from - 1, Sclose, -1)))
+		{
+		  from = tree_pos;
+		  from_byte = CHAR_TO_BYTE (from);
+		  if (!--depth) goto done;
+		}
 	      break;
 
 	    case Sclose:
@@ -2783,6 +3113,14 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	    case Sstring_fence:
 	      temp_pos = dec_bytepos (from_byte);
 	      stringterm = FETCH_CHAR_AS_MULTIBYTE (temp_pos);
+	      if (code == Sstring
+		  && (tree_pos = tree_node_end (from - 1, Sstring, stringterm)))
+		{
+		  from = tree_pos;
+		  from_byte = CHAR_TO_BYTE (from);
+		  if (!depth && sexpflag) goto done;
+		  break;
+		}
 	      while (1)
 		{
 		  enum syntaxcode c_code;
@@ -2920,6 +3258,14 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	      FALLTHROUGH;
 	    case Sclose:
 	      if (!++depth) goto done2;
+	      /* Jump to the start of the list if a parse tree knows it.  */
+	      if (code == Sclose && parse_sexp_ignore_comments
+		  && (tree_pos = tree_node_start (from, Sopen, -1)))
+		{
+		  from = tree_pos;
+		  from_byte = CHAR_TO_BYTE (from);
+		  if (!--depth) goto done2;
+		}
 	      break;
 
 	    case Sopen:
@@ -2967,6 +3313,13 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 
 	    case Sstring:
 	      stringterm = FETCH_CHAR_AS_MULTIBYTE (from_byte);
+	      if ((tree_pos = tree_node_start (from, Sstring, stringterm)))
+		{
+		  from = tree_pos;
+		  from_byte = CHAR_TO_BYTE (from);
+		  if (!depth && sexpflag) goto done2;
+		  break;
+		}
 	      while (true)
 		{
 		  if (from == stop)
@@ -3203,8 +3556,8 @@ #define INC_FROM				\
       curlevel->last = -1;
       tem = Fcdr (tem);
     }
-  curlevel->prev = -1;
-  curlevel->last = -1;
+  curlevel->prev = state->thislevelstart;
+  curlevel->last = state->sexpstart;
 
   state->quoted = 0;
   mindepth = depth;
@@ -3442,6 +3795,7 @@ #define INC_FROM				\
   state->depth = depth;
   state->mindepth = mindepth;
   state->thislevelstart = curlevel->prev;
+  state->sexpstart = curlevel->last;
   state->prevlevelstart
     = (curlevel == levelstart) ? -1 : (curlevel - 1)->last;
   state->location = from;
@@ -3469,11 +3823,15 @@ internalize_parse_state (Lisp_Object external, struct lisp_parse_state *state)
       state->quoted = 0;
       state->comstyle = 0;	/* comment style a by default.  */
       state->comstr_start = -1;	/* no comment/string seen.  */
+      state->thislevelstart = -1;
+      state->sexpstart = -1;
       state->levelstarts = Qnil;
       state->prev_syntax = Smax;
     }
   else
     {
+      state->thislevelstart = -1;
+      state->sexpstart = -1;
       tem = Fcar (external);
       state->depth = FIXNUMP (tem) ? XFIXNUM (tem) : 0;
 
@@ -3521,6 +3879,317 @@ internalize_parse_state (Lisp_Object external, struct lisp_parse_state *state)
     }
 }
 
+/* Parse states of the accessible portion of a buffer, saved at line
+   starts about every SYNTAX_CHECKPOINT_SPAN characters, so that the
+   state at a position can be found by parsing from the nearest one.
+   They are what syntax-ppss caches in Lisp, kept where
+   parse-partial-sexp, forward-comment and scan-lists can use them
+   without calling Lisp.  A buffer keeps them in its base buffer.
+   They stay valid while the syntax table, the narrowing and the
+   options affecting the parse do; changes to the text drop those
+   after the change.  */
+
+enum { SYNTAX_CHECKPOINT_SPAN = 2000 };
+
+struct syntax_checkpoints
+{
+  /* What the states were computed with.  */
+  Lisp_Object syntax_table;
+  ptrdiff_t begv;
+  bool_bf lookup_properties : 1;
+  bool_bf comment_end_escapable : 1;
+  bool_bf multibyte : 1;
+
+  /* The first USED of the SIZE elements of STATES are in use, in
+     increasing order of location.  Each MINDEPTH is the least depth
+     seen since BEGV.  */
+  ptrdiff_t used, size;
+  struct lisp_parse_state *states;
+
+  /* The state at the end of the last parse, if LAST_VALID.  */
+  bool last_valid;
+  struct lisp_parse_state last;
+};
+
+/* Whether CP was computed with the current buffer's settings.  */
+
+static bool
+syntax_checkpoints_current_p (struct syntax_checkpoints *cp)
+{
+  return (EQ (cp->syntax_table, BVAR (current_buffer, syntax_table))
+	  && cp->begv == BEGV
+	  && cp->lookup_properties == parse_sexp_lookup_properties
+	  && cp->comment_end_escapable == comment_end_can_be_escaped
+	  && (cp->multibyte
+	      == !NILP (BVAR (current_buffer, enable_multibyte_characters))));
+}
+
+/* Return the checkpoints of the current buffer, emptied if they were
+   computed with other settings or past the text that
+   syntax-propertize has seen since.  */
+
+static struct syntax_checkpoints *
+current_syntax_checkpoints (void)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+  struct syntax_checkpoints *cp = b->syntax_checkpoints;
+
+  if (!cp)
+    cp = b->syntax_checkpoints = xzalloc (sizeof *cp);
+  if (!syntax_checkpoints_current_p (cp))
+    {
+      cp->syntax_table = BVAR (current_buffer, syntax_table);
+      cp->begv = BEGV;
+      cp->lookup_properties = parse_sexp_lookup_properties;
+      cp->comment_end_escapable = comment_end_can_be_escaped;
+      cp->multibyte = !NILP (BVAR (current_buffer,
+				   enable_multibyte_characters));
+      cp->used = 0;
+      cp->last_valid = false;
+    }
+  if (parse_sexp_lookup_properties)
+    {
+      while (cp->used > 0
+	     && cp->states[cp->used - 1].location > syntax_propertize__done)
+	cp->used--;
+      if (cp->last.location > syntax_propertize__done)
+	cp->last_valid = false;
+    }
+  return cp;
+}
+
+/* Whether a parse that stopped at POS, a line start, can resume there
+   without losing track of the expression before it: the newline must
+   neither belong to a symbol nor be quoted.  */
+
+static bool
+resumable_line_start_p (ptrdiff_t pos, ptrdiff_t pos_byte)
+{
+  dec_both (&pos, &pos_byte);
+  SETUP_SYNTAX_TABLE (pos, 1);
+  enum syntaxcode code = SYNTAX (FETCH_CHAR_AS_MULTIBYTE (pos_byte));
+  if (code == Sword || code == Ssymbol || code == Squote
+      || code == Sescape || code == Scharquote)
+    return false;
+  if (pos == BEGV)
+    return true;
+  dec_both (&pos, &pos_byte);
+  UPDATE_SYNTAX_TABLE_BACKWARD (pos);
+  code = SYNTAX (FETCH_CHAR_AS_MULTIBYTE (pos_byte));
+  return code != Sescape && code != Scharquote;
+}
+
+/* Store into *STATE the state of a parse from BEGV to POS, which must
+   be in the accessible portion, starting from the nearest checkpoint
+   and saving new ones on the way.  STATE->mindepth is the least depth
+   seen since BEGV.
+
+   Unless EXACT, only the depth, the open parens and whether POS is in
+   a comment or string are needed, which allows starting from the last
+   parse or from one of the parens open where it ended, the way
+   syntax-ppss does.  */
+
+static void
+parse_state_at (ptrdiff_t pos, struct lisp_parse_state *state, bool exact)
+{
+  struct syntax_checkpoints *cp = current_syntax_checkpoints ();
+  Lisp_Object syntax_table = cp->syntax_table;
+  ptrdiff_t lo = 0, hi = cp->used;
+  ptrdiff_t from, from_byte;
+  EMACS_INT mindepth;
+  bool saving = true;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (cp->states[mid].location <= pos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  if (lo > 0)
+    {
+      *state = cp->states[lo - 1];
+      from = state->location;
+      from_byte = state->location_byte;
+    }
+  else
+    {
+      internalize_parse_state (Qnil, state);
+      from = BEGV;
+      from_byte = BEGV_BYTE;
+    }
+  mindepth = lo > 0 ? state->mindepth : 0;
+
+  if (!exact && cp->last_valid && cp->last.location <= pos
+      && cp->last.location > from)
+    {
+      *state = cp->last;
+      from = state->location;
+      from_byte = state->location_byte;
+      mindepth = state->mindepth;
+      saving = false;
+    }
+  else if (!exact && cp->last_valid && cp->last.location > pos)
+    {
+      /* Each paren open at the end of the last parse was seen
+	 outside comments and strings.  Start from the last one that
+	 is before POS and after FROM.  */
+      Lisp_Object tail = cp->last.levelstarts;
+      EMACS_INT depth = cp->last.depth - list_length (tail);
+      EMACS_INT paren_depth = 0;
+      Lisp_Object outer = Qnil, paren_outer = Qnil;
+      ptrdiff_t paren = -1;
+
+      for (; CONSP (tail) && XFIXNUM (XCAR (tail)) < pos;
+	   tail = XCDR (tail), depth++)
+	{
+	  if (XFIXNUM (XCAR (tail)) >= from)
+	    {
+	      paren = XFIXNUM (XCAR (tail));
+	      paren_depth = depth;
+	      paren_outer = outer;
+	    }
+	  outer = Fcons (XCAR (tail), outer);
+	}
+      if (paren >= 0)
+	{
+	  internalize_parse_state (Qnil, state);
+	  state->depth = paren_depth;
+	  state->levelstarts = Fnreverse (paren_outer);
+	  from = paren;
+	  from_byte = CHAR_TO_BYTE (paren);
+	  mindepth = paren_depth;
+	  saving = false;
+	}
+    }
+
+  while (true)
+    {
+      ptrdiff_t end = pos, end_byte = CHAR_TO_BYTE (pos);
+      bool save = false;
+
+      /* Stop at the first suitable line start a span further on, if
+	 it comes before POS and is past the last checkpoint.  */
+      if (saving && pos - from > SYNTAX_CHECKPOINT_SPAN && lo == cp->used)
+	{
+	  ptrdiff_t counted, bytepos;
+	  ptrdiff_t start = from + SYNTAX_CHECKPOINT_SPAN;
+	  ptrdiff_t next = find_newline (start, CHAR_TO_BYTE (start),
+					 pos, end_byte, 1, &counted,
+					 &bytepos, false);
+	  if (counted == 1 && next < pos
+	      && resumable_line_start_p (next, bytepos))
+	    {
+	      end = next;
+	      end_byte = bytepos;
+	      save = true;
+	    }
+	}
+
+      scan_sexps_forward (state, from, from_byte, end,
+			  TYPE_MINIMUM (EMACS_INT), false, 0);
+      mindepth = min (mindepth, state->mindepth);
+      state->mindepth = mindepth;
+      if (!save)
+	break;
+      from = state->location;
+      from_byte = state->location_byte;
+
+      /* Lisp run to set syntax properties may have used or reset the
+	 checkpoints meanwhile; only add to them if they are still
+	 ours and end before FROM.  */
+      if (from == end
+	  && (!parse_sexp_lookup_properties
+	      || from <= syntax_propertize__done)
+	  && EQ (cp->syntax_table, syntax_table)
+	  && syntax_checkpoints_current_p (cp)
+	  && (cp->used == 0
+	      || cp->states[cp->used - 1].location < from))
+	{
+	  if (cp->used == cp->size)
+	    cp->states = xpalloc (cp->states, &cp->size, 1, -1,
+				  sizeof *cp->states);
+	  cp->states[cp->used++] = *state;
+	}
+      lo = cp->used;
+    }
+
+  if (EQ (cp->syntax_table, syntax_table)
+      && syntax_checkpoints_current_p (cp)
+      && (!parse_sexp_lookup_properties
+	  || state->location <= syntax_propertize__done))
+    {
+      cp->last = *state;
+      cp->last_valid = true;
+    }
+}
+
+/* Whether forward-comment and scan-lists can take parse states from
+   the checkpoints where they would otherwise call syntax-ppss, which
+   parses with syntax-ppss-table if that is set.  */
+
+static bool
+syntax_checkpoints_usable (void)
+{
+  if (NILP (Vcomment_use_syntax_ppss))
+    return false;
+  Lisp_Object table = find_symbol_value (XSYMBOL (Qsyntax_ppss_table),
+				       NULL);
+  return NILP (table) || EQ (table, Qunbound);
+}
+
+/* Drop the checkpoints of BUF at or after POS, whose text is about to
+   change.  */
+
+void
+invalidate_syntax_checkpoints (struct buffer *buf, ptrdiff_t pos)
+{
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+  struct syntax_checkpoints *cp = buf->syntax_checkpoints;
+  if (cp)
+    {
+      while (cp->used > 0 && cp->states[cp->used - 1].location >= pos)
+	cp->used--;
+      if (cp->last.location >= pos)
+	cp->last_valid = false;
+    }
+}
+
+DEFUN ("internal--syntax-invalidate-checkpoints",
+       Finternal__syntax_invalidate_checkpoints,
+       Sinternal__syntax_invalidate_checkpoints, 1, 1, 0,
+       doc: /* Forget the parse states saved at or after BEG.
+`syntax-ppss-invalidate-cache' calls this when the syntax of the text
+after BEG may have changed, for instance when `syntax-propertize'
+reapplies `syntax-table' properties there.  */)
+  (Lisp_Object beg)
+{
+  invalidate_syntax_checkpoints (current_buffer, fix_position (beg));
+  return Qnil;
+}
+
+void
+free_syntax_checkpoints (struct syntax_checkpoints *cp)
+{
+  xfree (cp->states);
+  xfree (cp);
+}
+
+/* Mark the Lisp objects in CP for GC.  */
+
+void
+mark_syntax_checkpoints (struct syntax_checkpoints *cp)
+{
+  mark_object (&cp->syntax_table);
+  for (ptrdiff_t i = 0; i < cp->used; i++)
+    mark_object (&cp->states[i].levelstarts);
+  if (cp->last_valid)
+    mark_object (&cp->last.levelstarts);
+}
+
 DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
        doc: /* Parse from FROM to TO using prevailing syntax table.
 Return 11-element state consisting of:
@@ -3573,11 +4242,20 @@ DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
       target = XFIXNUM (targetdepth);
     }
 
-  internalize_parse_state (oldstate, &state);
-  scan_sexps_forward (&state, XFIXNUM (from), CHAR_TO_BYTE (XFIXNUM (from)),
-		      XFIXNUM (to), target, !NILP (stopbefore),
-		      (NILP (commentstop)
-		       ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)));
+  /* A plain parse from the start of the buffer can resume from the
+     checkpoint nearest TO.  */
+  if (XFIXNUM (from) == BEGV && NILP (oldstate) && NILP (targetdepth)
+      && NILP (stopbefore) && NILP (commentstop))
+    parse_state_at (XFIXNUM (to), &state, true);
+  else
+    {
+      internalize_parse_state (oldstate, &state);
+      scan_sexps_forward (&state, XFIXNUM (from),
+			  CHAR_TO_BYTE (XFIXNUM (from)),
+			  XFIXNUM (to), target, !NILP (stopbefore),
+			  (NILP (commentstop)
+			   ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)));
+    }
 
   SET_PT_BOTH (state.location, state.location_byte);
 
@@ -3701,6 +4379,7 @@ syms_of_syntax (void)
 {
   DEFSYM (Qsyntax_table_p, "syntax-table-p");
   DEFSYM (Qsyntax_ppss, "syntax-ppss");
+  DEFSYM (Qsyntax_ppss_table, "syntax-ppss-table");
   DEFVAR_LISP ("comment-use-syntax-ppss",
 	       Vcomment_use_syntax_ppss,
 	       doc: /* Non-nil means `forward-comment' can use `syntax-ppss' internally.  */);
@@ -3722,6 +4401,18 @@ syms_of_syntax (void)
   DEFVAR_BOOL ("parse-sexp-ignore-comments", parse_sexp_ignore_comments,
 	       doc: /* Non-nil means `forward-sexp', etc., should treat comments as whitespace.  */);
 
+  DEFVAR_BOOL ("parse-sexp-use-tree-sitter", parse_sexp_use_tree_sitter,
+	       doc: /* Non-nil means `forward-sexp', etc., may ask tree-sitter.
+When this is non-nil and the current buffer has a tree-sitter parse
+tree, scans over lists, strings and comments jump over the nodes of
+the tree that span them instead of reading each character in them.
+A node is used only if it has no parse errors and the syntax table
+agrees about the characters that start and end it.  The grammar is
+trusted about the text in between, so where it parses that text
+differently from the syntax table, as across preprocessor
+conditionals, the scans can end elsewhere than with this nil.  */);
+  parse_sexp_use_tree_sitter = false;
+
   DEFVAR_BOOL ("parse-sexp-lookup-properties", parse_sexp_lookup_properties,
 	       doc: /* Non-nil means `forward-sexp', etc., obey `syntax-table' property.
 Otherwise, that text property is simply ignored.
@@ -3796,4 +4487,5 @@ syms_of_syntax (void)
   defsubr (&Sscan_sexps);
   defsubr (&Sbackward_prefix_chars);
   defsubr (&Sparse_partial_sexp);
+  defsubr (&Sinternal__syntax_invalidate_checkpoints);
 }
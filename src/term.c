@@ -228,6 +228,81 @@ tty_reset_terminal_modes (struct terminal *terminal)
     }
 }
 
+/* Send the output collected since tty_update_begin to the terminal
+   TTY, and stop collecting it.  */
+
+static void
+tty_send_update (struct tty_display_info *tty)
+{
+#ifdef HAVE_OPEN_MEMSTREAM
+  if (!tty->device_output)
+    return;
+
+  tty->output = tty->device_output;
+  tty->device_output = NULL;
+  if (fflush (tty->update_stream) == 0)
+    {
+      off_t nbytes = ftello (tty->update_stream);
+      if (nbytes > 0)
+	{
+	  /* Output written outside of the update goes first.  */
+	  fflush (tty->output);
+	  emacs_write (fileno (tty->output), tty->update_buffer, nbytes);
+	}
+    }
+  clearerr (tty->update_stream);
+  fseeko (tty->update_stream, 0, SEEK_SET);
+
+  /* Unless this is the unwind handler running, pop it, or disable it
+     if something has since been pushed above it.  */
+  specpdl_ref unwind = tty->update_unwind;
+  if (specpdl_ref_lt (unwind, SPECPDL_INDEX ()))
+    {
+      if (specpdl_ref_eq (specpdl_ref_add (unwind, 1), SPECPDL_INDEX ()))
+	unbind_to (unwind, Qnil);
+      else
+	clear_unwind_protect (unwind);
+    }
+#endif
+}
+
+#ifdef HAVE_OPEN_MEMSTREAM
+static void
+tty_unwind_update (void *tty)
+{
+  tty_send_update (tty);
+}
+#endif
+
+/* Flag the beginning of a display update on a termcap terminal.
+   Divert the terminal's output to memory until the update ends, so
+   that the whole update reaches the terminal in a single write
+   instead of whenever the stdio buffer fills up.  Should the update
+   be left by a non-local exit, an unwind handler sends what it has
+   collected and restores the output.  */
+
+static void
+tty_update_begin (struct frame *f)
+{
+#ifdef HAVE_OPEN_MEMSTREAM
+  struct tty_display_info *tty = FRAME_TTY (f);
+
+  if (!tty->output || tty->device_output)
+    return;
+  if (!tty->update_stream)
+    {
+      tty->update_stream = open_memstream (&tty->update_buffer,
+					   &tty->update_buffer_size);
+      if (!tty->update_stream)
+	return;
+    }
+  tty->device_output = tty->output;
+  tty->output = tty->update_stream;
+  tty->update_unwind = SPECPDL_INDEX ();
+  record_unwind_protect_ptr (tty_unwind_update, tty);
+#endif
+}
+
 /* Flag the end of a display update on a termcap terminal. */
 
 static void
@@ -239,6 +314,7 @@ tty_update_end (struct frame *f)
     tty_show_cursor (tty);
   tty_turn_off_insert (tty);
   tty_background_highlight (tty);
+  tty_send_update (tty);
   fflush (tty->output);
 }
 
@@ -721,12 +797,112 @@ encode_terminal_code (struct glyph *src, int src_len,
 
 
 
+/* Return true if faces FACE1 and FACE2 look the same on a text
+   terminal, so that glyphs in one can be written with the appearance
+   modes of the other.  */
+
+static bool
+tty_same_appearance_p (struct face *face1, struct face *face2)
+{
+  return (face1 == face2
+	  || (face1->foreground == face2->foreground
+	      && face1->background == face2->background
+	      && face1->underline == face2->underline
+	      && face1->underline_color == face2->underline_color
+	      && face1->tty_bold_p == face2->tty_bold_p
+	      && face1->tty_italic_p == face2->tty_italic_p
+	      && face1->tty_reverse_p == face2->tty_reverse_p
+	      && face1->tty_strike_through_p == face2->tty_strike_through_p));
+}
+
+/* Encode the LEN glyphs at STRING with CODING and send them to the
+   terminal TTY.  LAST means they are the last glyphs to encode.  */
+
+static void
+tty_write_encoded_glyphs (struct tty_display_info *tty, struct glyph *string,
+			  int len, struct coding_system *coding, bool last)
+{
+  unsigned char *conversion_buffer;
+
+  if (last)
+    coding->mode |= CODING_MODE_LAST_BLOCK;
+  conversion_buffer = encode_terminal_code (string, len, coding);
+  if (coding->produced > 0)
+    {
+      block_input ();
+      fwrite (conversion_buffer, 1, coding->produced, tty->output);
+      clearerr (tty->output);
+      if (tty->termscript)
+	fwrite (conversion_buffer, 1, coding->produced, tty->termscript);
+      unblock_input ();
+    }
+}
+
+/* Value is the character of GLYPH if the terminal's "rp" capability
+   can repeat it, or -1 if it can't.  */
+
+static int
+tty_repeatable_char (struct glyph *glyph)
+{
+  return (glyph->type == CHAR_GLYPH
+	  && !glyph->padding_p
+	  && glyph->u.ch >= ' ' && glyph->u.ch < 0177
+	  ? glyph->u.ch : -1);
+}
+
+/* Send the LEN glyphs at STRING, which all look the same, to the
+   terminal TTY, like tty_write_encoded_glyphs.  Send runs of a
+   repeated ASCII character that are longer than what it costs to
+   repeat it with the "rp" capability as that capability.  */
+
+static void
+tty_write_glyph_run (struct tty_display_info *tty, struct glyph *string,
+		     int len, struct coding_system *coding, bool last)
+{
+  int start = 0;
+
+  if (tty->TS_repeat
+      && len > tty->RPov
+      && GLYPH_TABLE_LENGTH == 0
+      && !CODING_REQUIRE_FLUSHING (coding)
+      && !NILP (CODING_ATTR_ASCII_COMPAT (CODING_ID_ATTRS (coding->id))))
+    {
+      int i = 0;
+
+      while (i < len)
+	{
+	  int c = tty_repeatable_char (string + i);
+	  int end = i + 1;
+
+	  if (c >= 0)
+	    while (end < len && tty_repeatable_char (string + end) == c)
+	      ++end;
+
+	  if (c >= 0 && end - i > tty->RPov)
+	    {
+	      char *p;
+
+	      if (i > start)
+		tty_write_encoded_glyphs (tty, string + start, i - start,
+					  coding, false);
+	      p = tparam (tty->TS_repeat, NULL, 0, c, end - i, 0, 0);
+	      OUTPUT1 (tty, p);
+	      xfree (p);
+	      start = end;
+	    }
+	  i = end;
+	}
+    }
+
+  if (start < len)
+    tty_write_encoded_glyphs (tty, string + start, len - start, coding, last);
+}
+
 /* An implementation of write_glyphs for termcap frames. */
 
 static void
 tty_write_glyphs (struct frame *f, struct glyph *string, int len)
 {
-  unsigned char *conversion_buffer;
   struct coding_system *coding;
   int n, stringlen;
 
@@ -758,30 +934,23 @@ tty_write_glyphs (struct frame *f, struct glyph *string, int len)
 
   for (stringlen = len; stringlen != 0; stringlen -= n)
     {
-      /* Identify a run of glyphs with the same face.  */
+      /* Identify a run of glyphs that look the same.  Faces that
+	 differ only in attributes a terminal cannot show, like the
+	 font, need no change of appearance modes between them.  */
       int face_id = string->face_id;
+      struct face *face = FACE_FROM_ID (f, face_id);
 
       for (n = 1; n < stringlen; ++n)
-	if (string[n].face_id != face_id)
+	if (string[n].face_id != face_id
+	    && !tty_same_appearance_p (face,
+				       FACE_FROM_ID (f, string[n].face_id)))
 	  break;
 
       /* Turn appearance modes of the face of the run on.  */
       tty_highlight_if_desired (tty);
       turn_on_face (f, face_id);
 
-      if (n == stringlen)
-	/* This is the last run.  */
-	coding->mode |= CODING_MODE_LAST_BLOCK;
-      conversion_buffer = encode_terminal_code (string, n, coding);
-      if (coding->produced > 0)
-	{
-	  block_input ();
-	  fwrite (conversion_buffer, 1, coding->produced, tty->output);
-	  clearerr (tty->output);
-	  if (tty->termscript)
-	    fwrite (conversion_buffer, 1, coding->produced, tty->termscript);
-	  unblock_input ();
-	}
+      tty_write_glyph_run (tty, string, n, coding, n == stringlen);
       string += n;
 
       /* Turn appearance modes off.  */
@@ -1197,11 +1366,19 @@ calculate_costs (struct frame *frame)
 
       calculate_ins_del_char_costs (frame);
 
-      /* Don't use TS_repeat if its padding is worse than sending the chars */
+      /* Don't use TS_repeat if its padding is worse than sending the
+	 chars.  A terminal without padding can use it at any speed.  */
       if (tty->TS_repeat
 	  && (baud_rate <= 0
-	      || per_line_cost (tty->TS_repeat) < 9000 / baud_rate))
-        tty->RPov = string_cost (tty->TS_repeat);
+	      || per_line_cost (tty->TS_repeat) <= 9000 / baud_rate))
+	{
+	  /* What repeating a character costs, which hardly depends on
+	     how often it is repeated.  */
+	  char *p = tparam (tty->TS_repeat, NULL, 0, ' ', FRAME_COLS (frame),
+			    0, 0);
+	  tty->RPov = string_cost (p);
+	  xfree (p);
+	}
       else
         tty->RPov = FRAME_COLS (frame) * 2;
 
@@ -2299,6 +2476,7 @@ DEFUN ("suspend-tty", Fsuspend_tty, Ssuspend_tty, 0, 1, 0,
       XSETTERMINAL (term, t);
       CALLN (Frun_hook_with_args, intern ("suspend-tty-functions"), term);
 
+      tty_send_update (t->display_info.tty);
       reset_sys_modes (t->display_info.tty);
       delete_keyboard_wait_descriptor (fileno (f));
 
@@ -3922,6 +4100,7 @@ set_tty_hooks (struct terminal *terminal)
   terminal->ring_bell_hook = &tty_ring_bell;
   terminal->reset_terminal_modes_hook = &tty_reset_terminal_modes;
   terminal->set_terminal_modes_hook = &tty_set_terminal_modes;
+  terminal->update_begin_hook = &tty_update_begin;
   terminal->update_end_hook = &tty_update_end;
 #ifdef MSDOS
   terminal->menu_show_hook = &x_menu_show;
@@ -4569,8 +4748,14 @@ delete_tty (struct terminal *terminal)
       if (tty->input != stdin)
         fclose (tty->input);
     }
+  tty_send_update (tty);
   if (tty->output && tty->output != stdout && tty->output != tty->input)
     fclose (tty->output);
+#ifdef HAVE_OPEN_MEMSTREAM
+  if (tty->update_stream)
+    fclose (tty->update_stream);
+  free (tty->update_buffer);
+#endif
   if (tty->termscript)
     fclose (tty->termscript);
 
@@ -58,6 +58,20 @@ #define EMACS_TERMCHAR_H
      calls to flush.  */
   size_t output_buffer_size;
 
+#ifdef HAVE_OPEN_MEMSTREAM
+  /* While a frame is being updated, OUTPUT is UPDATE_STREAM, an
+     in-memory stream writing to UPDATE_BUFFER, and DEVICE_OUTPUT is
+     the stream OUTPUT was before the update began.  The update is
+     sent to DEVICE_OUTPUT in a single write when it ends.  Outside
+     of updates, DEVICE_OUTPUT is NULL.  UPDATE_UNWIND is the specpdl
+     entry that sends the update if a non-local exit leaves it.  */
+  FILE *update_stream;
+  char *update_buffer;
+  size_t update_buffer_size;
+  FILE *device_output;
+  specpdl_ref update_unwind;
+#endif
+
   FILE *termscript;             /* If nonzero, send all terminal output
                                    characters to this stream also.  */
 
@@ -606,6 +606,32 @@ DEFUN ("get-text-property", Fget_text_property, Sget_text_property, 2, 3, 0,
   return textget (Ftext_properties_at (position, object), prop);
 }
 
+/* Subroutine of get_char_property_and_overlay.  If OVERLAY, which
+   spans BEG to END, has a non-nil property PROP and applies to window
+   W, and has a higher priority than *RESULT, make it the *RESULT,
+   using one of the two ITEMS, and store its property in *RESULT_TEM.  */
+
+static void
+consider_overlay_property (Lisp_Object overlay, ptrdiff_t beg, ptrdiff_t end,
+			   Lisp_Object prop, struct window *w,
+			   struct sortvec *items, struct sortvec **result,
+			   Lisp_Object *result_tem)
+{
+  Lisp_Object tem = Foverlay_get (overlay, prop);
+  struct sortvec *this;
+
+  if (NILP (tem) || (w && !overlay_matches_window (w, overlay)))
+    return;
+
+  this = (*result == items ? items + 1 : items);
+  make_sortvec_item (this, overlay, beg, end);
+  if (!*result || (compare_overlays (*result, this) < 0))
+    {
+      *result = this;
+      *result_tem = tem;
+    }
+}
+
 /* Return the value of char's property PROP, in OBJECT at POSITION.
    OBJECT is optional and defaults to the current buffer.
    If OVERLAY is non-0, then in the case that the returned property is from
@@ -636,32 +662,44 @@ get_char_property_and_overlay (Lisp_Object position, register Lisp_Object prop,
   if (BUFFERP (object))
     {
       struct buffer *b = XBUFFER (object);
-      struct itree_node *node;
       struct sortvec items[2];
       struct sortvec *result = NULL;
       Lisp_Object result_tem = Qnil;
+      Lisp_Object *recorded = NULL;
+      ptrdiff_t nrecorded;
 
       if (!(BUF_BEGV (b) <= pos
 	     && pos <= BUF_ZV (b)))
 	xsignal1 (Qargs_out_of_range, position);
 
+      /* Redisplay might have recorded the overlays covering POS.  */
+      if (b == current_buffer)
+	recorded = recorded_overlays_at (pos, &nrecorded);
+
       /* Now check the overlays in order of decreasing priority.  */
-      ITREE_FOREACH (node, b->overlays, pos, pos + 1, ASCENDING)
+      if (recorded)
+	for (ptrdiff_t i = 0; i < nrecorded; i++)
+	  consider_overlay_property (recorded[i], OVERLAY_START (recorded[i]),
+				     OVERLAY_END (recorded[i]), prop, w,
+				     items, &result, &result_tem);
+      else
 	{
-	  Lisp_Object tem = Foverlay_get (node->data, prop);
-          struct sortvec *this;
-
-	  if (NILP (tem) || node->end < pos + 1
-	      || (w && !overlay_matches_window (w, node->data)))
-	    continue;
-
-          this = (result == items ? items + 1 : items);
-          make_sortvec_item (this, node->data);
-          if (!result || (compare_overlays (result, this) < 0))
-            {
-              result = this;
-              result_tem = tem;
-            }
+	  /* Unlike ITREE_FOREACH, itree_snapshot does not apply pending
+	     offsets to the tree, so take the positions from it too.  */
+	  struct itree_interval intervals[16], *iv = intervals;
+	  ptrdiff_t n, nmax = ARRAYELTS (intervals);
+	  USE_SAFE_ALLOCA;
+	  while ((n = itree_snapshot (b->overlays, pos, pos + 1,
+				      iv, nmax, NULL)) == nmax)
+	    {
+	      nmax *= 2;
+	      SAFE_NALLOCA (iv, 1, nmax);
+	    }
+	  for (ptrdiff_t i = 0; i < n; i++)
+	    if (iv[i].end >= pos + 1)
+	      consider_overlay_property (iv[i].data, iv[i].begin, iv[i].end,
+					 prop, w, items, &result, &result_tem);
+	  SAFE_FREE ();
 	}
       if (result)
         {
@@ -41,8 +41,6 @@ make_sitter (TSParser *parser, TSTree *tree, Lisp_Object progmode_arg)
   ptr->prev_tree = NULL;
   ptr->tree = tree;
   ptr->highlighter = NULL;
-  ptr->highlight_names = NULL;
-  ptr->highlights_query = NULL;
   ptr->indents_query = NULL;
   ptr->dirty = true;
   return make_lisp_ptr (ptr, Lisp_Vectorlike);
@@ -134,6 +132,26 @@ tree_sitter_language_functor (Lisp_Object progmode)
   return i >= 0 ? (TSLanguageFunctor) (xmint_pointer (HASH_VALUE (h, i))) : NULL;
 }
 
+/* Parsers of collected sitters, kept for reuse since a parser's
+   allocations outlive any one buffer.  */
+
+static TSParser *idle_parsers[8];
+static int n_idle_parsers;
+
+/* Called by the garbage collector when the sitter owning PARSER dies.  */
+
+void
+tree_sitter_release_parser (TSParser *parser)
+{
+  if (n_idle_parsers < ARRAYELTS (idle_parsers))
+    {
+      ts_parser_reset (parser);
+      idle_parsers[n_idle_parsers++] = parser;
+    }
+  else
+    ts_parser_delete (parser);
+}
+
 static Lisp_Object
 tree_sitter_create (Lisp_Object progmode)
 {
@@ -145,7 +163,9 @@ tree_sitter_create (Lisp_Object progmode)
   fn = tree_sitter_language_functor (progmode);
   if (fn != NULL)
     {
-      TSParser *ts_parser = ts_parser_new ();
+      TSParser *ts_parser = (n_idle_parsers > 0
+			     ? idle_parsers[--n_idle_parsers]
+			     : ts_parser_new ());
       ts_parser_set_language (ts_parser, fn ());
       tree_sitter = make_sitter (ts_parser, NULL, progmode);
     }
@@ -222,11 +242,86 @@ highlight_region (const TSHighlightEventSlice *slice,
     ? Qnil : list2 (make_fixnum (smallest), make_fixnum (biggest));
 }
 
-static TSHighlighter *
-ensure_highlighter(Lisp_Object sitter)
+/* A highlighter built from a language's highlights.scm and the names
+   in `tree-sitter-highlight-alist'.  It is built when the first buffer
+   of the language needs it and shared by all later ones, so reading
+   and compiling the query file happens once per language.  */
+
+struct tree_sitter_highlighter
+{
+  struct tree_sitter_highlighter *next;
+
+  /* Number of sitters using this highlighter.  */
+  ptrdiff_t refcount;
+
+  /* True if the alist has since changed, so that no new sitter should
+     use this highlighter and it can go once the last user dies.  */
+  bool stale;
+
+  char *language;
+  char *file;
+
+  /* Copies of the highlight names, in the order of the alist.  */
+  ptrdiff_t count;
+  const char **names;
+
+  char *query;
+  TSHighlighter *highlighter;
+};
+
+static struct tree_sitter_highlighter *highlighters;
+
+static void
+free_highlighter (struct tree_sitter_highlighter *hl)
+{
+  if (hl->highlighter != NULL)
+    ts_highlighter_delete (hl->highlighter);
+  for (ptrdiff_t i = 0; i < hl->count; ++i)
+    xfree ((char *) hl->names[i]);
+  xfree (hl->names);
+  xfree (hl->query);
+  xfree (hl->file);
+  xfree (hl->language);
+  xfree (hl);
+}
+
+/* Called by the garbage collector when a sitter using HL dies.  The
+   highlighter is kept when unused, for the next buffer of the
+   language, unless it is stale.  */
+
+void
+tree_sitter_release_highlighter (struct tree_sitter_highlighter *hl)
 {
-  TSHighlighter *ret = XTREE_SITTER (sitter)->highlighter;
-  if (ret == NULL)
+  if (--hl->refcount == 0 && hl->stale)
+    {
+      struct tree_sitter_highlighter **p = &highlighters;
+      while (*p != hl)
+	p = &(*p)->next;
+      *p = hl->next;
+      free_highlighter (hl);
+    }
+}
+
+/* Return whether HL was built from the names in ALIST.  */
+
+static bool
+highlighter_names_match (struct tree_sitter_highlighter *hl,
+			 Lisp_Object alist, ptrdiff_t count)
+{
+  if (hl->count != count)
+    return false;
+  for (ptrdiff_t i = 0; CONSP (alist); alist = XCDR (alist), ++i)
+    if (!STRINGP (XCAR (XCAR (alist)))
+	|| strcmp (hl->names[i], SSDATA (XCAR (XCAR (alist)))) != 0)
+      return false;
+  return true;
+}
+
+static struct tree_sitter_highlighter *
+ensure_highlighter (Lisp_Object sitter)
+{
+  struct tree_sitter_highlighter *hl = XTREE_SITTER (sitter)->highlighter;
+  if (hl == NULL)
     {
       char *scope;
       const char *error = NULL;
@@ -236,81 +331,97 @@ ensure_highlighter(Lisp_Object sitter)
 	language = Fcdr_safe (Fassq (XTREE_SITTER (sitter)->progmode,
 				     Fsymbol_value (Qtree_sitter_mode_alist)));
       const EMACS_INT count = XFIXNUM (Flength (alist));
-      XTREE_SITTER (sitter)->highlight_names = xmalloc(sizeof (char *) * count);
       intptr_t i = 0;
+      long highlights_query_length;
       FILE *fp = NULL;
 
       eassert (!NILP (language)); /* by tree_sitter_create() */
 
+      highlights_scm =
+	concat2 (Ffile_name_as_directory (Fsymbol_value (Qtree_sitter_resources_dir)),
+		 concat3 (build_string ("queries/"), language,
+			  build_string ("/highlights.scm")));
+
       FOR_EACH_TAIL (alist)
+	CHECK_STRING (XCAR (XCAR (alist)));
+      alist = Fsymbol_value (Qtree_sitter_highlight_alist); /* FOR_EACH_TAIL mucks */
+
+      for (struct tree_sitter_highlighter **p = &highlighters; *p != NULL; )
 	{
-	  CHECK_STRING (XCAR (XCAR (alist)));
-	  XTREE_SITTER (sitter)->highlight_names[i++] =
-	    SSDATA (XCAR (XCAR (alist)));
+	  hl = *p;
+	  if (!hl->stale
+	      && strcmp (hl->language, SSDATA (language)) == 0
+	      && strcmp (hl->file, SSDATA (highlights_scm)) == 0)
+	    {
+	      if (highlighter_names_match (hl, alist, count))
+		{
+		  ++hl->refcount;
+		  XTREE_SITTER (sitter)->highlighter = hl;
+		  return hl;
+		}
+	      hl->stale = true;
+	      if (hl->refcount == 0)
+		{
+		  *p = hl->next;
+		  free_highlighter (hl);
+		  continue;
+		}
+	    }
+	  p = &hl->next;
 	}
-      alist = Fsymbol_value (Qtree_sitter_highlight_alist); /* FOR_EACH_TAIL mucks */
+
+      hl = xzalloc (sizeof *hl);
+      hl->language = xstrdup (SSDATA (language));
+      hl->file = xstrdup (SSDATA (highlights_scm));
+      hl->names = xzalloc (sizeof (char *) * count);
+      FOR_EACH_TAIL (alist)
+	hl->names[i++] = xstrdup (SSDATA (XCAR (XCAR (alist))));
+      hl->count = i;
 
       USE_SAFE_ALLOCA;
       scope = SAFE_ALLOCA (strlen ("scope.") + SCHARS (language) + 1);
       sprintf (scope, "scope.%s", SSDATA (language));
 
-      ret = (XTREE_SITTER (sitter)->highlighter =
-	     ts_highlighter_new (XTREE_SITTER (sitter)->highlight_names,
-				 XTREE_SITTER (sitter)->highlight_names,
-				 (uint32_t) count));
-      highlights_scm =
-	concat2 (Ffile_name_as_directory (Fsymbol_value (Qtree_sitter_resources_dir)),
-		 concat3 (build_string ("queries/"), language,
-			  build_string ("/highlights.scm")));
+      hl->highlighter = ts_highlighter_new (hl->names, hl->names,
+					    (uint32_t) count);
+
+      fp = fopen (SSDATA (highlights_scm), "rb");
+      if (!fp) {
+	  suberror = highlights_scm;
+	  error = "Cannot fopen";
+	  goto finally;
+      }
+      fseek (fp, 0L, SEEK_END);
+      highlights_query_length = ftell (fp);
+      rewind (fp);
+
+      hl->query = xzalloc (highlights_query_length + 1);
 
-      if (NILP (highlights_scm))
+      if (1 != fread (hl->query, highlights_query_length, 1, fp))
 	{
-	  suberror = language;
-	  error = "Could not locate highlights scm";
+	  suberror = highlights_scm;
+	  error = "Cannot fread";
 	}
       else
 	{
-	  long highlights_query_length;
-	  fp = fopen (SSDATA (highlights_scm), "rb");
-	  if (!fp) {
-	      suberror = highlights_scm;
-	      error = "Cannot fopen";
-	      goto finally;
-	  }
-	  fseek (fp, 0L, SEEK_END);
-	  highlights_query_length = ftell (fp);
-	  rewind (fp);
-
-	  XTREE_SITTER (sitter)->highlights_query =
-	    xzalloc(highlights_query_length + 1);
-
-	  if (1 != fread (XTREE_SITTER (sitter)->highlights_query,
-			  highlights_query_length, 1, fp))
+	  TSHighlightError ts_highlight_error =
+	    ts_highlighter_add_language
+	    (hl->highlighter,
+	     SSDATA (language),
+	     scope,
+	     NULL,
+	     ts_parser_language (XTREE_SITTER (sitter)->parser),
+	     hl->query,
+	     "",
+	     "",
+	     strlen (hl->query),
+	     0,
+	     0,
+	     false);
+	  if (ts_highlight_error != TSHighlightOk)
 	    {
-	      suberror = highlights_scm;
-	      error = "Cannot fread";
-	    }
-	  else
-	    {
-	      TSHighlightError ts_highlight_error =
-		ts_highlighter_add_language
-		(ret,
-		 SSDATA (language),
-		 scope,
-		 NULL,
-		 ts_parser_language (XTREE_SITTER (sitter)->parser),
-		 XTREE_SITTER (sitter)->highlights_query,
-		 "",
-		 "",
-		 strlen (XTREE_SITTER (sitter)->highlights_query),
-		 0,
-		 0,
-		 false);
-	      if (ts_highlight_error != TSHighlightOk)
-		{
-		  suberror = make_fixnum (ts_highlight_error);
-		  error = "ts_highlighter_add_language non-Ok return";
-		}
+	      suberror = make_fixnum (ts_highlight_error);
+	      error = "ts_highlighter_add_language non-Ok return";
 	    }
 	}
 
@@ -319,9 +430,16 @@ ensure_highlighter(Lisp_Object sitter)
       if (fp != NULL)
 	fclose (fp);
       if (error != NULL)
-	xsignal2 (Qtree_sitter_error, build_string (error), suberror);
+	{
+	  free_highlighter (hl);
+	  xsignal2 (Qtree_sitter_error, build_string (error), suberror);
+	}
+      hl->refcount = 1;
+      hl->next = highlighters;
+      highlighters = hl;
+      XTREE_SITTER (sitter)->highlighter = hl;
     }
-  return ret;
+  return hl;
 }
 
 static const char*
@@ -371,13 +489,12 @@ parsed_tree (struct Lisp_Tree_Sitter *sitter)
     {
       TSTree *tree = sitter->tree;
       sitter->dirty = false;
-      if (sitter->prev_tree != NULL)
-	{
-	  ts_tree_delete (sitter->prev_tree);
-	  sitter->prev_tree = NULL;
-	}
 
-      sitter->prev_tree = ts_tree_copy (tree);
+      /* PREV_TREE is the tree as of the last call to
+	 `tree-sitter-changed-ranges', edited in step with TREE, so
+	 that changes accumulate over reparses until reported.  */
+      if (sitter->prev_tree == NULL)
+	sitter->prev_tree = ts_tree_copy (tree);
       sitter->tree =
 	ts_parser_parse (sitter->parser,
 			 tree,
@@ -391,6 +508,26 @@ parsed_tree (struct Lisp_Tree_Sitter *sitter)
   return sitter->tree;
 }
 
+/* Return the current buffer's parse tree, reparsed if edits have made
+   it stale, or NULL if the buffer has none.  Unlike Ftree_sitter, do
+   not create a sitter or signal, so that the syntax scans can call
+   this on any buffer.  */
+
+const TSTree *
+tree_sitter_current_tree (void)
+{
+  struct buffer *b = current_buffer;
+  if (b->base_buffer != NULL && !MODE_OVERLAY_INDIRECT_P (b))
+    b = b->base_buffer;
+
+  Lisp_Object sitter = find_symbol_value (XSYMBOL (Qtree_sitter_sitter), b);
+  if (!TREE_SITTERP (sitter)
+      || !EQ (XTREE_SITTER (sitter)->progmode, BVAR (b, major_mode))
+      || XTREE_SITTER (sitter)->tree == NULL)
+    return NULL;
+  return parsed_tree (XTREE_SITTER (sitter));
+}
+
 static Lisp_Object
 do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
 {
@@ -401,7 +538,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
   sitter = Ftree_sitter (Fcurrent_buffer ());
   if (!NILP (sitter))
     {
-      TSHighlighter *ts_highlighter = ensure_highlighter (sitter);
+      struct tree_sitter_highlighter *hl = ensure_highlighter (sitter);
       Lisp_Object language = Fcdr_safe (Fassq (XTREE_SITTER (sitter)->progmode,
 					       Fsymbol_value (Qtree_sitter_mode_alist)));
       Lisp_Object max_bytes = Fsymbol_value (Qjit_lock_chunk_size);
@@ -411,7 +548,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
       scope = SAFE_ALLOCA (strlen ("scope.") + SCHARS (language) + 1);
       sprintf (scope, "scope.%s", SSDATA (language));
 
-      if (ts_highlighter)
+      if (hl->highlighter)
 	{
 	  TSNode node = ts_node_first_child_for_byte
 	    (ts_tree_root_node (parsed_tree (XTREE_SITTER (sitter))),
@@ -449,7 +586,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
 	      node.context[0] = 0;
 
 	      ts_highlight_event_slice =
-		ts_highlighter_return_highlights (ts_highlighter, scope,
+		ts_highlighter_return_highlights (hl->highlighter, scope,
 						  SSDATA (source_code),
 						  (uint32_t) SBYTES (source_code),
 						  node,
@@ -457,8 +594,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
 
 	      /* restore to absolute coords */
 	      node.context[0] = restore_start;
-	      retval = nconc2 (fn (&ts_highlight_event_slice, node,
-				   XTREE_SITTER (sitter)->highlight_names),
+	      retval = nconc2 (fn (&ts_highlight_event_slice, node, hl->names),
 			       retval);
 	      ts_highlighter_free_highlights (ts_highlight_event_slice);
 	      ts_highlight_buffer_delete (ts_highlight_buffer);
@@ -1265,11 +1401,19 @@ DEFUN ("tree-sitter-calculate-indent",
 				  (Fsymbol_value (Qtree_sitter_resources_dir)),
 				  build_string ("queries/"),
 				  language));
+  /* A file given by absolute name in tree-sitter-indent-alist can
+     serve several languages, so key on both, as tree_sitter_query
+     does.  */
+  Lisp_Object key = Fcons (language, indents_scm);
   hash_hash_t hash;
-  i = hash_lookup_get_hash (h, indents_scm, &hash);
+  i = hash_lookup_get_hash (h, key, &hash);
 
-  /* First retrieve the query.  */
-  if (XTREE_SITTER (sitter)->indents_query == NULL || i < 0)
+  /* First retrieve the query.  The cache maps each language and file
+     to its source and compiled query, which all buffers share.  */
+  if (i >= 0)
+    XTREE_SITTER (sitter)->indents_query =
+      xmint_pointer (XCDR (HASH_VALUE (h, i)));
+  else
     {
       /* stack of cons pairs (SCM . SCM_CONTENT) */
       Lisp_Object stack = list1 (Fcons (indents_scm, Qnil));
@@ -1398,10 +1542,10 @@ DEFUN ("tree-sitter-calculate-indent",
 	}
       else
 	{
-	  if (XTREE_SITTER (sitter)->indents_query != NULL)
-	    ts_query_delete (XTREE_SITTER (sitter)->indents_query);
 	  XTREE_SITTER (sitter)->indents_query = query;
-	  i = hash_put (h, indents_scm, build_string (query_buf), hash);
+	  i = hash_put (h, key,
+			Fcons (build_string (query_buf), make_misc_ptr (query)),
+			hash);
 	}
       xfree (query_buf);
     }
@@ -1413,7 +1557,7 @@ DEFUN ("tree-sitter-calculate-indent",
       record_unwind_protect_excursion ();
       void *itdata = bidi_shelve_cache ();
 
-      Lisp_Object source_query = HASH_VALUE (h, i);
+      Lisp_Object source_query = XCAR (HASH_VALUE (h, i));
       const uint32_t sitter_beg =
 	ts_node_start_byte (XTREE_SITTER_NODE (enclosing_node)->node);
       const uint32_t sitter_end =
@@ -1704,6 +1848,260 @@ DEFUN ("tree-sitter-calculate-indent",
   return result;
 }
 
+/* Return the name of the predicate starting at STEP of QUERY if it is
+   not one query_predicates_hold applies, or takes arguments it does
+   not expect; otherwise return NULL.  */
+
+static const char *
+query_predicate_unsupported (const TSQuery *query,
+			     const TSQueryPredicateStep *step)
+{
+  uint32_t length;
+  const char *name = ts_query_string_value_for_id (query, step->value_id,
+						   &length);
+  bool match = (strcmp (name, "match?") == 0
+		|| strcmp (name, "not-match?") == 0);
+  if (!match
+      && strcmp (name, "eq?") != 0 && strcmp (name, "not-eq?") != 0)
+    return name;
+  if (step[1].type != TSQueryPredicateStepTypeCapture
+      || step[2].type == TSQueryPredicateStepTypeDone
+      || (match && step[2].type != TSQueryPredicateStepTypeString)
+      || step[3].type != TSQueryPredicateStepTypeDone)
+    return name;
+  return NULL;
+}
+
+/* Return the buffer text of the first node MATCH captures as CAPTURE,
+   or nil if it captures none.  */
+
+static Lisp_Object
+query_capture_text (const TSQueryMatch *match, uint32_t capture)
+{
+  for (uint16_t i = 0; i < match->capture_count; i++)
+    if (match->captures[i].index == capture)
+      {
+	TSNode node = match->captures[i].node;
+	return make_buffer_string (SITTER_TO_BUFFER (ts_node_start_byte (node)),
+				   SITTER_TO_BUFFER (ts_node_end_byte (node)),
+				   false);
+      }
+  return Qnil;
+}
+
+/* Return whether MATCH of QUERY satisfies the predicates of its
+   pattern.  tree_sitter_query has checked that they are all eq?,
+   not-eq?, match? or not-match?.  A predicate on a capture the match
+   lacks holds.  */
+
+static bool
+query_predicates_hold (const TSQuery *query, const TSQueryMatch *match)
+{
+  uint32_t nsteps;
+  const TSQueryPredicateStep *step
+    = ts_query_predicates_for_pattern (query, match->pattern_index, &nsteps);
+  const TSQueryPredicateStep *end = step + nsteps;
+
+  for (; step < end; step += 4)
+    {
+      uint32_t length;
+      const char *name = ts_query_string_value_for_id (query, step->value_id,
+						       &length);
+      bool negate = strncmp (name, "not-", 4) == 0;
+      Lisp_Object text = query_capture_text (match, step[1].value_id);
+      Lisp_Object arg;
+      bool holds;
+
+      if (NILP (text))
+	continue;
+      if (step[2].type == TSQueryPredicateStepTypeString)
+	{
+	  const char *value = ts_query_string_value_for_id
+	    (query, step[2].value_id, &length);
+	  arg = make_string (value, length);
+	}
+      else
+	{
+	  arg = query_capture_text (match, step[2].value_id);
+	  if (NILP (arg))
+	    continue;
+	}
+      if (strstr (name, "match?"))
+	holds = fast_string_match (arg, text) >= 0;
+      else
+	holds = !NILP (Fstring_equal (text, arg));
+      if (holds == negate)
+	return false;
+    }
+  return true;
+}
+
+/* Compiled queries kept by tree_sitter_query.  When it holds this many
+   and another is compiled, all are freed.  */
+
+#define TREE_SITTER_QUERY_CACHE_MAX 256
+
+/* Return the query compiled from SOURCE for the language of SITTER.
+   Compiled queries are kept, keyed by language and source, so each
+   costs one compilation however many buffers and calls use it.  Signal
+   an error if SOURCE uses a predicate query_predicates_hold cannot
+   apply, rather than ignore it.  */
+
+static TSQuery *
+tree_sitter_query (Lisp_Object sitter, Lisp_Object source)
+{
+  static Lisp_Object cache = LISPSYM_INITIALLY (Qnil);
+  struct Lisp_Hash_Table *h;
+  ptrdiff_t i;
+
+  CHECK_STRING (source);
+  if (NILP (cache))
+    {
+      cache = make_hash_table (&hashtest_equal, DEFAULT_HASH_SIZE, Weak_None);
+      staticpro (&cache);
+    }
+  h = XHASH_TABLE (cache);
+
+  Lisp_Object progmode = XTREE_SITTER (sitter)->progmode;
+  Lisp_Object language =
+    Fcdr_safe (Fassq (progmode, Fsymbol_value (Qtree_sitter_mode_alist)));
+  Lisp_Object key = Fcons (language, source);
+  hash_hash_t hash;
+  i = hash_lookup_get_hash (h, key, &hash);
+  if (i < 0)
+    {
+      TSLanguageFunctor fn = tree_sitter_language_functor (progmode);
+      uint32_t error_offset;
+      TSQueryError error_type;
+      TSQuery *query = ts_query_new (fn (), SSDATA (source),
+				     (uint32_t) SBYTES (source),
+				     &error_offset, &error_type);
+      if (query == NULL)
+	xsignal3 (Qtree_sitter_error, build_string ("Invalid query"),
+		  make_fixnum (error_type),
+		  make_fixnum (string_byte_to_char (source, error_offset)));
+      for (uint32_t pattern = 0; pattern < ts_query_pattern_count (query);
+	   pattern++)
+	{
+	  uint32_t nsteps;
+	  const TSQueryPredicateStep *step
+	    = ts_query_predicates_for_pattern (query, pattern, &nsteps);
+	  for (const TSQueryPredicateStep *end = step + nsteps; step < end;)
+	    {
+	      const char *name = query_predicate_unsupported (query, step);
+	      if (name)
+		{
+		  Lisp_Object predicate = build_string (name);
+		  ts_query_delete (query);
+		  xsignal2 (Qtree_sitter_error,
+			    build_string ("Unsupported query predicate"),
+			    predicate);
+		}
+	      step += 4;
+	    }
+	}
+      if (h->count >= TREE_SITTER_QUERY_CACHE_MAX)
+	{
+	  DOHASH_SAFE (h, j)
+	    ts_query_delete (xmint_pointer (HASH_VALUE (h, j)));
+	  Fclrhash (cache);
+	}
+      /* Key on a copy, which the caller cannot alter.  */
+      i = hash_put (h, Fcons (language, Fcopy_sequence (source)),
+		    make_misc_ptr (query), hash);
+    }
+  return xmint_pointer (HASH_VALUE (h, i));
+}
+
+DEFUN ("tree-sitter-query-captures",
+       Ftree_sitter_query_captures, Stree_sitter_query_captures,
+       1, 3, 0,
+       doc: /* Return the captures of QUERY in nodes overlapping BEG to END.
+QUERY is a string in the tree-sitter query language.  It is compiled
+once for the language of the current buffer and kept for later calls.
+BEG and END default to the accessible portion of the buffer.
+
+The value is a vector of fixnums, three for each capture in the order
+the captures occur: the index of the capture's name in the value of
+`tree-sitter-query-capture-names', and the start and end of the
+captured node.
+
+QUERY may use the predicates #eq?, #not-eq?, #match? and #not-match?.
+The pattern of #match? is an Emacs regexp.  Any other predicate
+signals an error.  */)
+  (Lisp_Object query, Lisp_Object beg, Lisp_Object end)
+{
+  static TSQueryCursor *cursor;
+  Lisp_Object sitter = Ftree_sitter (Fcurrent_buffer ());
+  TSQuery *ts_query = tree_sitter_query (sitter, query);
+  unsigned short int quit_count = 0;
+
+  if (NILP (beg))
+    beg = make_fixnum (BEGV);
+  if (NILP (end))
+    end = make_fixnum (ZV);
+  validate_region (&beg, &end);
+
+  if (cursor == NULL)
+    cursor = ts_query_cursor_new ();
+  ts_query_cursor_set_byte_range (cursor,
+				  BUFFER_TO_SITTER (XFIXNUM (beg)),
+				  BUFFER_TO_SITTER (XFIXNUM (end)));
+  ts_query_cursor_exec (cursor, ts_query,
+			ts_tree_root_node (parsed_tree (XTREE_SITTER (sitter))));
+
+  /* Collect the captures in a vector that grows as needed, and return
+     a copy trimmed to size.  */
+  Lisp_Object captures = initialize_vector (3 * 64, Qnil);
+  ptrdiff_t n = 0;
+  TSQueryMatch match;
+  uint32_t index;
+  while (ts_query_cursor_next_capture (cursor, &match, &index))
+    {
+      if (!query_predicates_hold (ts_query, &match))
+	{
+	  ts_query_cursor_remove_match (cursor, match.id);
+	  continue;
+	}
+      TSNode node = match.captures[index].node;
+      if (ASIZE (captures) - n < 3)
+	captures = larger_vector (captures, 3, -1);
+      ASET (captures, n++, make_fixnum (match.captures[index].index));
+      ASET (captures, n++,
+	    make_fixnum (SITTER_TO_BUFFER (ts_node_start_byte (node))));
+      ASET (captures, n++,
+	    make_fixnum (SITTER_TO_BUFFER (ts_node_end_byte (node))));
+      rarely_quit (++quit_count);
+    }
+
+  Lisp_Object result = make_vector (n);
+  memcpy (XVECTOR (result)->contents, XVECTOR (captures)->contents,
+	  n * word_size);
+  return result;
+}
+
+DEFUN ("tree-sitter-query-capture-names",
+       Ftree_sitter_query_capture_names, Stree_sitter_query_capture_names,
+       1, 1, 0,
+       doc: /* Return a vector of the capture names of QUERY.
+The captures that `tree-sitter-query-captures' returns refer to these
+names by their index.  */)
+  (Lisp_Object query)
+{
+  Lisp_Object sitter = Ftree_sitter (Fcurrent_buffer ());
+  TSQuery *ts_query = tree_sitter_query (sitter, query);
+  uint32_t count = ts_query_capture_count (ts_query);
+  Lisp_Object names = initialize_vector (count, Qnil);
+
+  for (uint32_t i = 0; i < count; i++)
+    {
+      uint32_t length;
+      const char *name = ts_query_capture_name_for_id (ts_query, i, &length);
+      ASET (names, i, make_string (name, length));
+    }
+  return names;
+}
+
 DEFUN ("tree-sitter-highlights",
        Ftree_sitter_highlights, Stree_sitter_highlights,
        2, 2, "r",
@@ -1728,15 +2126,22 @@ DEFUN ("tree-sitter-highlight-region",
 DEFUN ("tree-sitter-changed-range",
        Ftree_sitter_changed_range, Stree_sitter_changed_range,
        0, 1, 0,
-       doc: /* Return list of BEG and END of TSRange. */)
+       doc: /* Return list of BEG and END of TSRange.
+The range is the first that changed since the last call to
+`tree-sitter-changed-ranges', which consumes the changes; it is not
+limited to the last reparse.  */)
   (Lisp_Object buffer)
 {
+  specpdl_ref count = SPECPDL_INDEX ();
   Lisp_Object retval = Qnil, sitter;
 
   if (NILP (buffer))
     buffer = Fcurrent_buffer ();
 
   CHECK_BUFFER (buffer);
+  /* The parse reads, and the positions refer to, BUFFER.  */
+  record_unwind_current_buffer ();
+  set_buffer_internal (XBUFFER (buffer));
   sitter = Ftree_sitter (buffer);
 
   if (!NILP (sitter))
@@ -1745,9 +2150,9 @@ DEFUN ("tree-sitter-changed-range",
 	*prev_tree = XTREE_SITTER (sitter)->prev_tree;
       if (tree != NULL && prev_tree != NULL)
 	{
-	  uint32_t count;
-	  TSRange *range = ts_tree_get_changed_ranges (prev_tree, tree, &count);
-	  if (count)
+	  uint32_t nranges;
+	  TSRange *range = ts_tree_get_changed_ranges (prev_tree, tree, &nranges);
+	  if (nranges)
 	    {
 	      uint32_t sitter_end_byte = min (ZV_BYTE-1, range->end_byte);
 	      retval = list2 (make_fixnum (SITTER_TO_BUFFER (range->start_byte)),
@@ -1756,7 +2161,54 @@ DEFUN ("tree-sitter-changed-range",
 	    }
 	}
     }
-  return retval;
+  return unbind_to (count, retval);
+}
+
+DEFUN ("tree-sitter-changed-ranges",
+       Ftree_sitter_changed_ranges, Stree_sitter_changed_ranges,
+       0, 1, 0,
+       doc: /* Return the ranges of BUFFER whose parse changed.
+The value is a list of (BEG . END) in buffer order, covering the text
+whose syntax nodes differ from those of the previous call.  Each change
+is reported only once.  */)
+  (Lisp_Object buffer)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  Lisp_Object retval = Qnil, sitter;
+
+  if (NILP (buffer))
+    buffer = Fcurrent_buffer ();
+
+  CHECK_BUFFER (buffer);
+  /* The parse reads, and the positions refer to, BUFFER.  */
+  record_unwind_current_buffer ();
+  set_buffer_internal (XBUFFER (buffer));
+  sitter = Ftree_sitter (buffer);
+
+  if (!NILP (sitter))
+    {
+      struct Lisp_Tree_Sitter *ts = XTREE_SITTER (sitter);
+      const TSTree *tree = parsed_tree (ts);
+      if (tree != NULL && ts->prev_tree != NULL)
+	{
+	  uint32_t nranges;
+	  TSRange *ranges = ts_tree_get_changed_ranges (ts->prev_tree, tree,
+							&nranges);
+	  for (uint32_t i = nranges; i > 0; --i)
+	    {
+	      uint32_t end_byte = min (Z_BYTE - 1, ranges[i - 1].end_byte);
+	      retval =
+		Fcons (Fcons (make_fixnum (SITTER_TO_BUFFER
+					   (ranges[i - 1].start_byte)),
+			      make_fixnum (SITTER_TO_BUFFER (end_byte))),
+		       retval);
+	    }
+	  free (ranges);
+	  ts_tree_delete (ts->prev_tree);
+	  ts->prev_tree = NULL;
+	}
+    }
+  return unbind_to (count, retval);
 }
 
 DEFUN ("tree-sitter",
@@ -1878,6 +2330,8 @@ #define tree_sitter_record_change_initial_CAPACITY 16
 	      };
 	      XTREE_SITTER (sitter)->dirty = true;
 	      ts_tree_edit (tree, &edit);
+	      if (XTREE_SITTER (sitter)->prev_tree != NULL)
+		ts_tree_edit (XTREE_SITTER (sitter)->prev_tree, &edit);
 	    }
 	  else
 	    xsignal1 (Qtree_sitter_error, BVAR (buffers[i], name));
@@ -1918,6 +2372,8 @@ syms_of_tree_sitter (void)
 
   defsubr (&Stree_sitter);
   defsubr (&Stree_sitter_root_node);
+  defsubr (&Stree_sitter_query_captures);
+  defsubr (&Stree_sitter_query_capture_names);
   defsubr (&Stree_sitter_node_sexp);
   defsubr (&Stree_sitter_node_at);
   defsubr (&Stree_sitter_node_type);
@@ -1952,5 +2408,6 @@ syms_of_tree_sitter (void)
   defsubr (&Stree_sitter_highlights);
   defsubr (&Stree_sitter_highlight_region);
   defsubr (&Stree_sitter_changed_range);
+  defsubr (&Stree_sitter_changed_ranges);
   defsubr (&Stree_sitter__testable);
 }
@@ -50,9 +50,8 @@ #define SITTER_TO_BUFFER(byte) (BYTE_TO_CHAR ((EMACS_INT) byte + 1))
   TSParser *parser;
   TSTree *prev_tree;
   TSTree *tree;
-  TSHighlighter *highlighter;
-  const char **highlight_names;
-  char *highlights_query;
+  /* Shared with the other sitters of the language.  */
+  struct tree_sitter_highlighter *highlighter;
   TSQuery *indents_query;
   bool dirty;
 } GCALIGNED_STRUCT;
@@ -114,6 +113,10 @@ CHECK_TREE_SITTER_CURSOR (Lisp_Object x)
   CHECK_TYPE (TREE_SITTER_CURSORP (x), Qtree_sitter_cursorp, x);
 }
 
+extern const TSTree *tree_sitter_current_tree (void);
+extern void tree_sitter_release_highlighter (struct tree_sitter_highlighter *);
+extern void tree_sitter_release_parser (TSParser *);
+
 INLINE_HEADER_END
 
 #endif /* EMACS_TREE_SITTER_H */
@@ -224,6 +224,10 @@ #define WINDOW_H_INCLUDED
     struct glyph_matrix *current_matrix;
     struct glyph_matrix *desired_matrix;
 
+    /* Starts of the screen lines of a continued line, used to move
+       up through it.  See move_it_backward.  */
+    struct sline_cache *sline_cache;
+
     /* Number saying how recently window was selected.  */
     EMACS_INT use_time;
 
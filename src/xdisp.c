@@ -762,6 +762,8 @@ #define THIN_SPACE_WIDTH 1
 static void display_menu_bar (struct window *);
 static void display_tab_bar (struct window *);
 static void update_tab_bar (struct frame *, bool);
+static ptrdiff_t display_count_lines_logically (ptrdiff_t, ptrdiff_t,
+					       ptrdiff_t, ptrdiff_t *);
 static ptrdiff_t display_count_lines (ptrdiff_t, ptrdiff_t, ptrdiff_t,
 				      ptrdiff_t *);
 static void pint2str (register char *, register int, register ptrdiff_t);
@@ -2633,11 +2635,13 @@ init_iterator (struct it *it, struct window *w,
 	  face_change = false;
 	  XFRAME (w->frame)->face_change = 0;
 	  free_all_realized_faces (Qnil);
+	  clear_sline_caches ();
 	}
       else if (XFRAME (w->frame)->face_change)
 	{
 	  XFRAME (w->frame)->face_change = 0;
 	  free_all_realized_faces (w->frame);
+	  clear_sline_caches ();
 	}
     }
 
@@ -3207,6 +3211,287 @@ init_to_row_end (struct it *it, struct window *w, struct glyph_row *row)
   return success;
 }
 
+/* Redisplay looks up the overlays at every position where it stops,
+   and finding them descends the buffer's tree of overlays each time,
+   which is slow when there are many overlays.  Instead, the tree is
+   queried once for the overlays in a region of text around the part
+   of the buffer being displayed, and the result is recorded here.
+   The positions in the region where overlays begin or end, sorted,
+   divide it into segments, and the non-empty overlays covering each
+   segment are recorded.  The record stays valid as long as the
+   buffer's characters, its overlays and its accessible portion don't
+   change.  */
+
+struct overlay_region
+{
+  /* The buffer whose overlays are recorded, and its state when they
+     were recorded.  */
+  Lisp_Object buffer;
+  struct itree_tree *tree;
+  modiff_count chars_modiff, overlay_modiff;
+  ptrdiff_t begv, zv;
+
+  /* The region from BOUNDS[0] to BOUNDS[NBOUNDS - 1], and the
+     positions in between where overlays begin or end.  */
+  ptrdiff_t *bounds;
+  ptrdiff_t nbounds, bounds_size;
+
+  /* The overlays covering the segment from BOUNDS[I] to BOUNDS[I + 1]
+     are OVERLAYS[COVER[I]] to OVERLAYS[COVER[I + 1] - 1].  COVER is
+     not valid if COVER_P is false, because there were too many.  */
+  ptrdiff_t *cover;
+  ptrdiff_t cover_size;
+  Lisp_Object *overlays;
+  ptrdiff_t overlays_size;
+  bool cover_p;
+
+  /* The number of characters the region was meant to span.  */
+  ptrdiff_t span;
+};
+
+static struct overlay_region overlay_region;
+
+/* An overlay found in the region when recording it.  */
+
+struct region_overlay
+{
+  Lisp_Object overlay;
+  ptrdiff_t begin, end;
+};
+
+static struct region_overlay *region_overlays;
+static ptrdiff_t region_overlays_size;
+
+/* Return true if the overlays recorded in overlay_region are those
+   of the current buffer as it is now.  */
+
+static bool
+overlay_region_valid_p (void)
+{
+  struct overlay_region *r = &overlay_region;
+
+  return (BUFFERP (r->buffer)
+	  && XBUFFER (r->buffer) == current_buffer
+	  && r->tree == current_buffer->overlays
+	  && r->chars_modiff == CHARS_MODIFF
+	  && r->overlay_modiff == OVERLAY_MODIFF
+	  && r->begv == BEGV
+	  && r->zv == ZV);
+}
+
+/* Return the index of the segment of overlay_region containing POS
+   in the current buffer, or -1 if the overlays at POS are not
+   recorded.  */
+
+static ptrdiff_t
+overlay_region_segment (ptrdiff_t pos)
+{
+  struct overlay_region *r = &overlay_region;
+
+  if (!(r->nbounds
+	&& r->bounds[0] <= pos && pos < r->bounds[r->nbounds - 1]
+	&& overlay_region_valid_p ()))
+    return -1;
+
+  ptrdiff_t lo = 0, hi = r->nbounds - 1;
+  while (hi - lo > 1)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (r->bounds[mid] <= pos)
+	lo = mid;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+static int
+compare_region_bounds (const void *a, const void *b)
+{
+  ptrdiff_t x = *(const ptrdiff_t *) a, y = *(const ptrdiff_t *) b;
+  return (x > y) - (x < y);
+}
+
+/* Record the overlays of the current buffer in a region around POS,
+   which W displays.  After a change, the region is just large enough
+   for redisplaying a line or two; if redisplay goes on past it through
+   the same text, the next region is twice as large, up to what W
+   might display.  */
+
+static void
+record_overlay_region (struct window *w, ptrdiff_t pos)
+{
+  struct overlay_region *r = &overlay_region;
+  ptrdiff_t max_span = clip_to_bounds (4096,
+				       (2 * (ptrdiff_t) WINDOW_TOTAL_LINES (w)
+					* WINDOW_TOTAL_COLS (w)),
+				       1 << 16);
+  r->span = (overlay_region_valid_p ()
+	     ? min (2 * r->span, max_span)
+	     : 512);
+  ptrdiff_t beg = max (BEGV, pos - r->span / 4);
+  ptrdiff_t end = min (ZV, pos + r->span);
+  ptrdiff_t n = 0, nbounds = 0;
+  struct itree_node *node;
+
+  XSETBUFFER (r->buffer, current_buffer);
+  r->tree = current_buffer->overlays;
+  r->chars_modiff = CHARS_MODIFF;
+  r->overlay_modiff = OVERLAY_MODIFF;
+  r->begv = BEGV;
+  r->zv = ZV;
+  r->nbounds = 0;
+
+  /* Collect the overlays intersecting the region, by increasing
+     start position, and the positions where they begin and end.  */
+  ITREE_FOREACH (node, current_buffer->overlays, beg, end, ASCENDING)
+    {
+      if (n == region_overlays_size)
+	region_overlays = xpalloc (region_overlays, &region_overlays_size,
+				   1, -1, sizeof *region_overlays);
+      region_overlays[n++] = (struct region_overlay) { node->data,
+						       node->begin,
+						       node->end };
+    }
+  if (r->bounds_size < 2 * n + 2)
+    r->bounds = xpalloc (r->bounds, &r->bounds_size,
+			 2 * n + 2 - r->bounds_size, -1, sizeof *r->bounds);
+  r->bounds[nbounds++] = beg;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      if (beg < region_overlays[i].begin && region_overlays[i].begin < end)
+	r->bounds[nbounds++] = region_overlays[i].begin;
+      if (beg < region_overlays[i].end && region_overlays[i].end < end)
+	r->bounds[nbounds++] = region_overlays[i].end;
+    }
+  r->bounds[nbounds++] = end;
+  qsort (r->bounds, nbounds, sizeof *r->bounds, compare_region_bounds);
+  ptrdiff_t k = 1;
+  for (ptrdiff_t i = 1; i < nbounds; i++)
+    if (r->bounds[i] != r->bounds[k - 1])
+      r->bounds[k++] = r->bounds[i];
+  r->nbounds = nbounds = k;
+
+  /* Sweep the segments, keeping track of the overlays covering each
+     one, unless that would record much more than the overlays
+     themselves, when they overlap a lot.  */
+  if (r->cover_size < nbounds)
+    r->cover = xpalloc (r->cover, &r->cover_size,
+			nbounds - r->cover_size, -1, sizeof *r->cover);
+  ptrdiff_t limit = 16 * n + 1024, ncover = 0, next = 0, nactive = 0;
+  r->cover_p = true;
+  for (ptrdiff_t i = 0; i < nbounds - 1; i++)
+    {
+      ptrdiff_t p = r->bounds[i];
+
+      /* Keep the overlays that still cover P at the front of
+	 region_overlays, and add those beginning at P.  */
+      k = 0;
+      for (ptrdiff_t j = 0; j < nactive; j++)
+	if (region_overlays[j].end > p)
+	  region_overlays[k++] = region_overlays[j];
+      nactive = k;
+      for (; next < n && region_overlays[next].begin <= p; next++)
+	if (region_overlays[next].end > p)
+	  region_overlays[nactive++] = region_overlays[next];
+
+      if (ncover + nactive > limit)
+	{
+	  r->cover_p = false;
+	  break;
+	}
+      if (r->overlays_size < ncover + nactive)
+	r->overlays = xpalloc (r->overlays, &r->overlays_size,
+			       ncover + nactive - r->overlays_size, -1,
+			       sizeof *r->overlays);
+      r->cover[i] = ncover;
+      for (ptrdiff_t j = 0; j < nactive; j++)
+	r->overlays[ncover++] = region_overlays[j].overlay;
+    }
+  r->cover[nbounds - 1] = ncover;
+}
+
+/* Return the overlays of the current buffer recorded as covering POS,
+   and store their number in *NOVERLAYS.  Value is NULL if they are
+   not recorded.  The caller must not change the overlays.  */
+
+Lisp_Object *
+recorded_overlays_at (ptrdiff_t pos, ptrdiff_t *noverlays)
+{
+  struct overlay_region *r = &overlay_region;
+  ptrdiff_t i = overlay_region_segment (pos);
+
+  if (i < 0 || !r->cover_p)
+    return NULL;
+  *noverlays = r->cover[i + 1] - r->cover[i];
+  return r->overlays + r->cover[i];
+}
+
+/* Return the segment of the overlays of the current buffer recorded
+   around POS, recording them for window W first if needed.  Value is
+   -1 if they cannot be recorded.  */
+
+static ptrdiff_t
+window_overlay_segment (struct window *w, ptrdiff_t pos)
+{
+  ptrdiff_t i = overlay_region_segment (pos);
+
+  if (i < 0 && BEGV <= pos && pos < ZV)
+    {
+      record_overlay_region (w, pos);
+      i = overlay_region_segment (pos);
+    }
+  return i;
+}
+
+/* Like next_overlay_change (POS, false), for use by redisplay of
+   window W.  */
+
+ptrdiff_t
+window_next_overlay_change (struct window *w, ptrdiff_t pos)
+{
+  struct overlay_region *r = &overlay_region;
+
+  if (!current_buffer->overlays)
+    return ZV;
+
+  ptrdiff_t i = window_overlay_segment (w, pos);
+
+  /* The end of the region is not an overlay change, unless the
+     region extends to ZV.  */
+  if (i >= 0 && (i + 2 < r->nbounds || r->bounds[i + 1] == ZV))
+    return r->bounds[i + 1];
+  return next_overlay_change (pos, false);
+}
+
+/* Like overlays_at (POS, false, VEC_PTR, LEN_PTR, NEXT_PTR), for use
+   by redisplay of window W, except that the overlays are in no
+   particular order, and the value stored in *NEXT_PTR is the next
+   position where the overlays at POS might change.  */
+
+ptrdiff_t
+window_overlays_at (struct window *w, ptrdiff_t pos,
+		    Lisp_Object **vec_ptr, ptrdiff_t *len_ptr,
+		    ptrdiff_t *next_ptr)
+{
+  struct overlay_region *r = &overlay_region;
+  ptrdiff_t i;
+
+  if (current_buffer->overlays
+      && (i = window_overlay_segment (w, pos)) >= 0
+      && r->cover_p)
+    {
+      ptrdiff_t n = r->cover[i + 1] - r->cover[i];
+      memcpy (*vec_ptr, r->overlays + r->cover[i],
+	      min (n, *len_ptr) * sizeof **vec_ptr);
+      if (next_ptr)
+	*next_ptr = r->bounds[i + 1];
+      return n;
+    }
+  return overlays_at (pos, false, vec_ptr, len_ptr, next_ptr);
+}
+
+
 /* Called when IT reaches IT->stop_charpos.  Handle text property and
    overlay changes.  Set IT->stop_charpos to the next position where
    to stop.  */
@@ -3356,7 +3641,8 @@ compute_stop_pos (struct it *it)
       bytepos = IT_BYTEPOS (*it);
 
       it->end_charpos = min (it->end_charpos, ZV);
-      it->stop_charpos = min (it->end_charpos, next_overlay_change (charpos, false));
+      it->stop_charpos = min (it->end_charpos,
+			      window_next_overlay_change (it->w, charpos));
 
       if (toofar < it->stop_charpos)
 	{
@@ -8975,6 +9261,383 @@ emulate_display_sline (struct it *it, ptrdiff_t to_charpos, int to_x,
 #undef SET_CLOSEST_PAST_CHARPOS
 #undef COULD_WRAP_P
 
+/* Each window caches the starts of the screen lines of one continued
+   line, in the order move_it_forward reaches them.  STARTS[0] is the
+   visible line start preceding_line_start_visible found, and
+   STARTS[K] is the start of the K-th continuation line after it,
+   together with the iterator's continuation_lines_width and the
+   pixel y of that screen line relative to STARTS[0].
+
+   move_it_backward consults the cache to reseat an iterator a few
+   screen lines back instead of at the line start, so that moving up
+   through a long line that defeats the behaved_p shortcuts (tabs,
+   display properties, faces of varying height) does not rescan the
+   line from its start each time.  The cache is only valid for the
+   buffer text, overlays, geometry and display settings it was
+   computed with.  Changes to faces and char-tables, which can happen
+   in place, invalidate all caches through clear_sline_caches.  */
+
+struct sline_start
+{
+  ptrdiff_t charpos, bytepos;
+  int continuation_lines_width;
+  int y;
+};
+
+enum { SLINE_CACHE_SETTINGS = 14 };
+
+struct sline_cache
+{
+  /* What the entries depend on.  */
+  struct buffer *buffer;
+  modiff_count modiff, overlay_modiff;
+  ptrdiff_t begv, zv, selective;
+  int first_visible_x, text_width, tab_width;
+  enum line_wrap_method line_wrap;
+  unsigned epoch;
+
+  /* The values of the variables that affect where screen lines start,
+     compared with EQ.  These are marked by mark_sline_cache, so that
+     a new object cannot take the place of a cached one.  */
+  Lisp_Object settings[SLINE_CACHE_SETTINGS];
+
+  /* The screen line starts.  */
+  struct sline_start *starts;
+  ptrdiff_t n, size;
+
+  /* True if scanning from the last start could not add the screen
+     lines after it, so that there is no point in trying again.  */
+  bool stuck;
+};
+
+/* Incremented to invalidate the caches of all windows.  */
+
+static unsigned sline_cache_epoch;
+
+/* Invalidate the screen line caches of all windows.  */
+
+void
+clear_sline_caches (void)
+{
+  sline_cache_epoch++;
+}
+
+/* Don't cache more screen lines than this for a single line.  */
+
+enum { SLINE_CACHE_MAX = 1 << 16 };
+
+/* Free the screen line cache of window W.  */
+
+void
+free_sline_cache (struct window *w)
+{
+  if (w->sline_cache)
+    {
+      xfree (w->sline_cache->starts);
+      xfree (w->sline_cache);
+      w->sline_cache = NULL;
+    }
+}
+
+/* Mark the objects the screen line cache of window W refers to.  */
+
+void
+mark_sline_cache (struct window *w)
+{
+  if (w->sline_cache)
+    mark_objects (w->sline_cache->settings, SLINE_CACHE_SETTINGS);
+}
+
+/* Store in SETTINGS the values of the variables other than those
+   struct sline_cache has members for that affect where IT's screen
+   lines start.  */
+
+static void
+sline_cache_settings (const struct it *it, Lisp_Object *settings)
+{
+  int i = 0;
+
+  settings[i++] = BVAR (current_buffer, invisibility_spec);
+  settings[i++] = Vwrap_prefix;
+  settings[i++] = Vline_prefix;
+  settings[i++] = BVAR (current_buffer, ctl_arrow);
+  settings[i++] = BVAR (current_buffer, selective_display_ellipses);
+  settings[i++] = BVAR (current_buffer, bidi_display_reordering);
+  settings[i++] = BVAR (current_buffer, bidi_paragraph_direction);
+  settings[i++] = BVAR (current_buffer, bidi_paragraph_start_re);
+  settings[i++] = BVAR (current_buffer, bidi_paragraph_separate_re);
+  /* The window, buffer or standard display table in use.  */
+  settings[i++] = it->dp ? make_lisp_ptr (it->dp, Lisp_Vectorlike) : Qnil;
+  settings[i++] = Vglyphless_char_display;
+  settings[i++] = Vnobreak_char_display;
+  settings[i++] = Vchar_width_table;
+  settings[i++] = word_wrap_by_category ? Qt : Qnil;
+  eassert (i == SLINE_CACHE_SETTINGS);
+}
+
+/* Forget the screen line starts cached for window W.  */
+
+static void
+clear_sline_cache (struct window *w)
+{
+  if (w->sline_cache)
+    w->sline_cache->n = 0;
+}
+
+/* Return true if IT may use or add to its window's screen line
+   cache.  */
+
+static bool
+sline_cache_usable_p (const struct it *it)
+{
+  /* Changes such as face or frame changes that invalidate whole
+     windows affect the screen lines of every window.  */
+  if (windows_or_buffers_changed
+      && windows_or_buffers_changed != REDISPLAY_SOME)
+    {
+      sline_cache_epoch++;
+      return false;
+    }
+
+  return (!it->w->pseudo_window_p
+	  && BUFFERP (it->w->contents)
+	  && XBUFFER (it->w->contents) == current_buffer
+	  && it->line_wrap != TRUNCATE
+	  && it->last_visible_x > it->first_visible_x
+	  && NILP (Vdisplay_line_numbers));
+}
+
+/* Return the screen line cache of IT's window if it is valid for IT,
+   or NULL.  */
+
+static struct sline_cache *
+valid_sline_cache (const struct it *it)
+{
+  struct sline_cache *c = it->w->sline_cache;
+  Lisp_Object settings[SLINE_CACHE_SETTINGS];
+
+  if (!(c && c->n > 0
+	&& sline_cache_usable_p (it)
+	&& c->epoch == sline_cache_epoch
+	&& c->buffer == current_buffer
+	&& c->modiff == MODIFF
+	&& c->overlay_modiff == OVERLAY_MODIFF
+	&& c->begv == BEGV
+	&& c->zv == ZV
+	&& c->selective == it->selective
+	&& c->first_visible_x == it->first_visible_x
+	&& c->text_width == it->last_visible_x - it->first_visible_x
+	&& c->tab_width == it->tab_width
+	&& c->line_wrap == it->line_wrap))
+    return NULL;
+
+  sline_cache_settings (it, settings);
+  for (int i = 0; i < SLINE_CACHE_SETTINGS; i++)
+    if (!EQ (c->settings[i], settings[i]))
+      return NULL;
+  return c;
+}
+
+/* Make the visible line start IT is at the first entry of its
+   window's screen line cache, unless it already is.  */
+
+static void
+sline_cache_anchor (struct it *it)
+{
+  struct window *w = it->w;
+  struct sline_cache *c = valid_sline_cache (it);
+
+  if ((c && c->starts[0].charpos == IT_CHARPOS (*it))
+      || !sline_cache_usable_p (it))
+    return;
+
+  if (!w->sline_cache)
+    w->sline_cache = xzalloc (sizeof *w->sline_cache);
+  c = w->sline_cache;
+  c->buffer = current_buffer;
+  c->modiff = MODIFF;
+  c->overlay_modiff = OVERLAY_MODIFF;
+  c->begv = BEGV;
+  c->zv = ZV;
+  c->selective = it->selective;
+  c->first_visible_x = it->first_visible_x;
+  c->text_width = it->last_visible_x - it->first_visible_x;
+  c->tab_width = it->tab_width;
+  c->line_wrap = it->line_wrap;
+  c->epoch = sline_cache_epoch;
+  sline_cache_settings (it, c->settings);
+  if (c->size == 0)
+    c->starts = xpalloc (NULL, &c->size, 16, SLINE_CACHE_MAX,
+			 sizeof *c->starts);
+  c->starts[0].charpos = IT_CHARPOS (*it);
+  c->starts[0].bytepos = IT_BYTEPOS (*it);
+  c->starts[0].continuation_lines_width = 0;
+  c->starts[0].y = 0;
+  c->n = 1;
+  c->stuck = false;
+}
+
+/* IT has just moved from a screen line that started at CHARPOS and
+   pixel y Y to the start of the screen line continuing it.  If the
+   former is the last screen line start cached for IT's window, cache
+   the new one.  */
+
+static void
+sline_cache_add (struct it *it, ptrdiff_t charpos, int y)
+{
+  struct sline_cache *c = valid_sline_cache (it);
+  struct sline_start *last;
+
+  if (!c || c->starts[c->n - 1].charpos != charpos
+      || it->method != GET_FROM_BUFFER
+      || it->sp != 0
+      /* Reseating IT at a position where overlays start or end would
+	 display their strings again, even if this screen line starts
+	 after them.  */
+      || overlay_touches_p (IT_CHARPOS (*it))
+      /* With bidi reordering, the position that starts a screen line
+	 is its first in logical order only if it is left-to-right.  */
+      || (it->bidi_p
+	  && (it->bidi_it.paragraph_dir != L2R
+	      || it->bidi_it.resolved_level != 0)))
+    return;
+
+  if (c->n == c->size)
+    {
+      if (c->size == SLINE_CACHE_MAX)
+	return;
+      c->starts = xpalloc (c->starts, &c->size, 1, SLINE_CACHE_MAX,
+			   sizeof *c->starts);
+    }
+  last = &c->starts[c->n - 1];
+  c->starts[c->n].charpos = IT_CHARPOS (*it);
+  c->starts[c->n].bytepos = IT_BYTEPOS (*it);
+  c->starts[c->n].continuation_lines_width = it->continuation_lines_width;
+  c->starts[c->n].y = last->y + it->current_y - y;
+  c->n++;
+}
+
+/* Return the index of the cached screen line that contains CHARPOS,
+   or -1 if it is not known.  */
+
+static ptrdiff_t
+sline_cache_index (const struct sline_cache *c, ptrdiff_t charpos)
+{
+  ptrdiff_t lo = 0, hi = c->n;
+
+  if (charpos < c->starts[0].charpos)
+    return -1;
+
+  /* Find the last start at or before CHARPOS.  */
+  while (hi - lo > 1)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (c->starts[mid].charpos <= charpos)
+	lo = mid;
+      else
+	hi = mid;
+    }
+
+  /* CHARPOS may be past the end of the last screen line cached.  */
+  if (lo == c->n - 1 && c->starts[lo].charpos != charpos)
+    return -1;
+  return lo;
+}
+
+/* Return the index of the cached screen line of IT's window that
+   contains CHARPOS, extending the cache to CHARPOS if CHARPOS is
+   later on the line the cache ends on.  Return -1 if the cache has
+   nothing for CHARPOS.  */
+
+static ptrdiff_t
+sline_cache_find (struct it *it, ptrdiff_t charpos)
+{
+  struct sline_cache *c = valid_sline_cache (it);
+  struct sline_start *last;
+  struct it it2;
+  void *it2data = NULL;
+  ptrdiff_t k, n, counted = 0;
+
+  if (!c)
+    return -1;
+  k = sline_cache_index (c, charpos);
+  if (k >= 0 || charpos < c->starts[0].charpos)
+    return k;
+
+  /* Not if CHARPOS is on a later line.  */
+  if (c->stuck)
+    return -1;
+  last = &c->starts[c->n - 1];
+  find_newline (last->charpos, last->bytepos, charpos, -1, 1,
+		&counted, NULL, false);
+  if (counted)
+    return -1;
+
+  /* Scan from the last screen line start to CHARPOS, which adds the
+     screen lines in between.  */
+  n = c->n;
+  SAVE_IT (it2, *it, it2data);
+  IT_CHARPOS (*it) = last->charpos;
+  IT_BYTEPOS (*it) = last->bytepos;
+  it->current_x = it->hpos = 0;
+  reseat_1 (it, it->current.pos, true);
+  it->continuation_lines_width = last->continuation_lines_width;
+  move_it_forward (it, charpos, -1, MOVE_TO_POS, NULL);
+  /* Unless every screen line the scan went through was added,
+     CHARPOS's screen line is not known.  */
+  if (it->vpos - it2.vpos == c->n - n)
+    {
+      k = sline_cache_index (c, charpos);
+      if (k < 0)
+	/* CHARPOS is on the last screen line.  */
+	k = c->n - 1;
+    }
+  else
+    c->stuck = true;
+  RESTORE_IT (it, &it2, it2data);
+  return k;
+}
+
+/* Reseat IT at the start of the screen line containing its position
+   if its window's screen line cache knows it, adding to IT's vpos and
+   current_y the screen lines between that and the visible line start.
+   Otherwise reseat IT at the visible line start.  */
+
+void
+reseat_preceding_sline_start (struct it *it)
+{
+  struct sline_cache *c;
+  struct text_pos pos;
+  ptrdiff_t k;
+
+  /* move_it_forward has faster ways through behaved lines.  */
+  if (behaved_p (it))
+    {
+      reseat_preceding_line_start (it);
+      return;
+    }
+
+  k = (it->method == GET_FROM_BUFFER
+       ? sline_cache_find (it, IT_CHARPOS (*it))
+       : -1);
+  if (k < 0)
+    {
+      reseat_preceding_line_start (it);
+      sline_cache_anchor (it);
+      return;
+    }
+
+  /* Start a screen line early, since a scan to the start of a screen
+     line can end at the end of the one before.  */
+  k = max (k - 1, 0);
+  c = it->w->sline_cache;
+  SET_TEXT_POS (pos, c->starts[k].charpos, c->starts[k].bytepos);
+  reseat (it, pos, true);
+  it->continuation_lines_width = c->starts[k].continuation_lines_width;
+  it->vpos += k;
+  it->current_y += c->starts[k].y;
+}
+
 /* Move IT forward until it satisfies OP, which can be one of
    MOVE_TO_POS
    MOVE_TO_Y
@@ -8999,6 +9662,12 @@ move_it_forward (struct it *it, ptrdiff_t to_charpos, int op_to, int op,
       enum move_it_result skip = MOVE_UNDEFINED;
       struct it it2;
       void *it2data = NULL;
+      /* Where this screen line starts, if IT is at its start.  */
+      ptrdiff_t sline_charpos = (it->current_x == 0
+				 && it->method == GET_FROM_BUFFER
+				 ? IT_CHARPOS (*it) : -1);
+      int sline_y = it->current_y;
+      bool continued_p = false;
       SAVE_IT (it2, *it, it2data);
 
       if (op & MOVE_TO_VPOS)
@@ -9169,6 +9838,7 @@ move_it_forward (struct it *it, ptrdiff_t to_charpos, int op_to, int op,
 	    }
 	  else
 	    {
+	      continued_p = true;
 	    move_it_forward_continued:
 	      it->continuation_lines_width += it->current_x;
 	    }
@@ -9183,6 +9853,9 @@ move_it_forward (struct it *it, ptrdiff_t to_charpos, int op_to, int op,
       ++it->vpos;
       it->current_x = it->hpos = it->max_ascent = it->max_descent = 0;
       it->line_number_produced_p = false;
+
+      if (continued_p && sline_charpos >= 0)
+	sline_cache_add (it, sline_charpos, sline_y);
     }
 
  move_it_forward_done:
@@ -9310,13 +9983,57 @@ move_it_backward (struct it *it, int op_to, int op)
       ptrdiff_t capped = behaved_p (it)
 	? max (BEGV, from_pos - nchars_per_sline * estimated_slines)
 	: -1;
+      ptrdiff_t k = -1;
+      int i = 0, continuation_lines_width = 0;
 
       eassume (op_to >= 0);
 
-      for (int i = 0; i < estimated_slines && IT_CHARPOS (*it) > BEGV; ++i)
+      /* Start from a cached screen line start if there is one.  */
+      if (capped == -1
+	  && it->method == GET_FROM_BUFFER
+	  && (k = sline_cache_find (it, from_pos)) >= 0)
+	{
+	  struct sline_cache *c = it->w->sline_cache;
+	  ptrdiff_t j = k;
+
+	  if (op == MOVE_TO_VPOS)
+	    j = k - op_to;
+	  else
+	    while (j >= 0 && c->starts[k].y - c->starts[j].y < op_to)
+	      j--;
+	  /* Go back one more screen line: a scan to FROM_POS can end at
+	     the end of the screen line before FROM_POS's, and the code
+	     below moves forward again as it would from the line
+	     start.  */
+	  j--;
+
+	  if (j >= 0)
+	    {
+	      i = estimated_slines;
+	      continuation_lines_width = c->starts[j].continuation_lines_width;
+	    }
+	  else if (from_pos > c->starts[0].charpos)
+	    {
+	      /* Continue from the line start, where the first step below
+		 would have taken IT.  */
+	      i = 1;
+	      j = 0;
+	    }
+	  if (i > 0)
+	    {
+	      IT_CHARPOS (*it) = c->starts[j].charpos;
+	      IT_BYTEPOS (*it) = c->starts[j].bytepos;
+	    }
+	}
+
+      for (; i < estimated_slines && IT_CHARPOS (*it) > BEGV; ++i)
 	{
 	  if (capped == -1)
-	    preceding_line_start_visible (it);
+	    {
+	      preceding_line_start_visible (it);
+	      if (i == 0 && k < 0)
+		sline_cache_anchor (it);
+	    }
 	  else /* speedups are possible */
 	    {
 	      ptrdiff_t cp = IT_CHARPOS (*it),
@@ -9350,8 +10067,9 @@ move_it_backward (struct it *it, int op_to, int op)
 	}
 
       /* More shallow assignment */
-      it->current_x = it->hpos = it->continuation_lines_width = 0;
+      it->current_x = it->hpos = 0;
       reseat_1 (it, it->current.pos, true);
+      it->continuation_lines_width = continuation_lines_width;
 
       /* "Then from that position, call move_it_forward() on a throwaway
 	 IT_FROM to FROM_POS."  */
@@ -14452,6 +15170,165 @@ propagate_buffer_redisplay (void)
     }
 }
 
+
+/***********************************************************************
+			 Redisplay statistics
+ ***********************************************************************/
+
+/* When redisplay_record_statistics is set, every window redisplayed
+   adds an entry to a ring of the last REDISPLAY_STATISTICS_SIZE.  */
+
+enum { REDISPLAY_STATISTICS_SIZE = 256 };
+
+struct redisplay_statistic
+{
+  /* Which call of redisplay_internal this entry belongs to.  */
+  EMACS_INT cycle;
+
+  /* A symbol for the method that produced the window's display, or
+     nil if it was abandoned, e.g. to retry with larger matrices.  */
+  Lisp_Object strategy;
+
+  /* Rows produced by display_sline and glyphs compared by update_window
+     for the window.  */
+  EMACS_INT rows, glyphs;
+
+  /* Time spent redisplaying and updating the window.  */
+  struct timespec time;
+};
+
+static struct redisplay_statistic redisplay_statistics[REDISPLAY_STATISTICS_SIZE];
+
+/* The windows of the entries, as a vector to keep them from GC.  */
+static Lisp_Object redisplay_statistics_windows;
+
+/* Number of entries recorded since the ring was last reset.  */
+static EMACS_INT redisplay_statistics_count;
+
+static EMACS_INT redisplay_statistics_cycle;
+
+/* Number of rows display_sline has produced, ever.  */
+static EMACS_INT redisplay_rows_produced;
+
+/* Start measuring the redisplay of a window.  Store the number of rows
+   produced so far in *ROWS and return the current time if statistics
+   are being recorded.  */
+
+static struct timespec
+start_redisplay_statistic (EMACS_INT *rows)
+{
+  *rows = redisplay_rows_produced;
+  return (redisplay_record_statistics
+	  ? current_timespec () : make_timespec (0, 0));
+}
+
+/* Record that STRATEGY redisplayed W, producing the rows since ROWS in
+   the time since START.  */
+
+static void
+record_redisplay_statistic (struct window *w, Lisp_Object strategy,
+			    EMACS_INT rows, struct timespec start)
+{
+  if (!redisplay_record_statistics
+      || (NILP (strategy) && rows == redisplay_rows_produced))
+    return;
+
+  int i = redisplay_statistics_count++ % REDISPLAY_STATISTICS_SIZE;
+  struct redisplay_statistic *entry = &redisplay_statistics[i];
+  entry->cycle = redisplay_statistics_cycle;
+  entry->strategy = strategy;
+  entry->rows = redisplay_rows_produced - rows;
+  entry->glyphs = 0;
+  /* START is zero if recording was turned on in the meantime.  */
+  entry->time = (timespec_sign (start)
+		 ? timespec_sub (current_timespec (), start)
+		 : make_timespec (0, 0));
+  Lisp_Object window;
+  XSETWINDOW (window, w);
+  ASET (redisplay_statistics_windows, i, window);
+}
+
+/* Add GLYPHS compared and the time since START to the entry of W in
+   the current redisplay cycle.  Called by update_window.  */
+
+void
+add_redisplay_update_statistic (struct window *w, EMACS_INT glyphs,
+				struct timespec start)
+{
+  EMACS_INT n = min (redisplay_statistics_count, REDISPLAY_STATISTICS_SIZE);
+
+  for (EMACS_INT k = redisplay_statistics_count - 1;
+       k >= redisplay_statistics_count - n;
+       k--)
+    {
+      int i = k % REDISPLAY_STATISTICS_SIZE;
+      struct redisplay_statistic *entry = &redisplay_statistics[i];
+      if (entry->cycle != redisplay_statistics_cycle)
+	break;
+      if (XWINDOW (AREF (redisplay_statistics_windows, i)) == w)
+	{
+	  entry->glyphs += glyphs;
+	  if (timespec_sign (start))
+	    entry->time = timespec_add (entry->time,
+					timespec_sub (current_timespec (),
+						      start));
+	  break;
+	}
+    }
+}
+
+DEFUN ("redisplay-statistics", Fredisplay_statistics,
+       Sredisplay_statistics, 0, 1, 0,
+       doc: /* Return statistics about the recent redisplay of windows.
+Statistics are only recorded when `redisplay-record-statistics' is
+non-nil.  The value is a list of entries, oldest first, for the last
+windows redisplayed.  Each entry has the form
+
+  (CYCLE WINDOW STRATEGY ROWS GLYPHS SECONDS)
+
+where CYCLE numbers the redisplay cycle, WINDOW is the window
+redisplayed and STRATEGY is how its display was produced:
+
+  `line'      only the line of point was redisplayed,
+  `cursor'    only the cursor moved,
+  `insdel'    the rows of a change were redisplayed and others moved,
+  `reuse'     the rows of a window that scrolled were reused,
+  `scroll'    the window was scrolled to bring point into view,
+  `window'    the whole window was redisplayed from its start,
+  `recenter'  the whole window was redisplayed around point,
+  nil         the display was abandoned, to be retried.
+
+ROWS is the number of screen lines produced, GLYPHS the number of
+glyphs compared to the screen to update it, and SECONDS the time spent
+on the window.
+
+If RESET is non-nil, discard the entries after returning them.  */)
+  (Lisp_Object reset)
+{
+  Lisp_Object val = Qnil;
+  EMACS_INT n = min (redisplay_statistics_count, REDISPLAY_STATISTICS_SIZE);
+
+  for (EMACS_INT k = redisplay_statistics_count - 1;
+       k >= redisplay_statistics_count - n;
+       k--)
+    {
+      int i = k % REDISPLAY_STATISTICS_SIZE;
+      struct redisplay_statistic *entry = &redisplay_statistics[i];
+      val = Fcons (CALLN (Flist, make_int (entry->cycle),
+			  AREF (redisplay_statistics_windows, i),
+			  entry->strategy, make_int (entry->rows),
+			  make_int (entry->glyphs),
+			  make_float (timespectod (entry->time))),
+		   val);
+    }
+  if (!NILP (reset))
+    {
+      redisplay_statistics_count = 0;
+      Ffillarray (redisplay_statistics_windows, Qnil);
+    }
+  return val;
+}
+
 #define STOP_POLLING					\
 do { if (!polling_stopped_here) stop_polling ();	\
        polling_stopped_here = true; } while (false)
@@ -14638,6 +15515,10 @@ #define AINC(a,i)							\
   AINC (Vredisplay__all_windows_cause, windows_or_buffers_changed);
   AINC (Vredisplay__mode_lines_cause, update_mode_lines);
 
+  redisplay_statistics_cycle++;
+  EMACS_INT stats_rows;
+  struct timespec stats_start = start_redisplay_statistic (&stats_rows);
+
   /* display_sline() records static_* variables for analysis here.  */
   tlbufpos = static_sline_start_pos;
   tlendpos = static_sline_end_pos;
@@ -14750,6 +15631,7 @@ #define AINC(a,i)							\
 #ifdef HAVE_WINDOW_SYSTEM
 	      update_window_fringes (w, false);
 #endif
+	      record_redisplay_statistic (w, Qline, stats_rows, stats_start);
 	      goto update;
 	    }
 	  else
@@ -14801,8 +15683,9 @@ #define AINC(a,i)							\
 	      move_cursor (w, row, w->current_matrix, 0, 0, 0, 0);
 	      if (partially_visible_cursor (w, w->current_matrix))
 		goto cancel;
-	      else
-		goto update;
+	      record_redisplay_statistic (w, Qcursor, stats_rows,
+					  stats_start);
+	      goto update;
 	    }
 	  else
 	    goto cancel;
@@ -15282,6 +16165,8 @@ mark_window_display_accurate_1 (struct window *w, bool accurate_p)
 	w->window_end_valid = true;
       w->update_mode_line = false;
     }
+  else
+    clear_sline_cache (w);
 
   w->redisplay = !accurate_p;
 }
@@ -16808,12 +17693,16 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
   int tem, centering_position = -1;
   bool used_current_matrix_p = false;
   bool last_line_misfit = false;
+  Lisp_Object strategy = Qnil;
 
   specpdl_ref count = SPECPDL_INDEX ();
 
   if (!NILP (all) && !needs_redisplay (w))
     return unbind_to (count, Qnil);
 
+  EMACS_INT stats_rows;
+  struct timespec stats_start = start_redisplay_statistic (&stats_rows);
+
   /* Make sure that both W's markers are valid.  */
   eassert (XMARKER (w->start)->buffer == XBUFFER (w->contents));
   eassert (XMARKER (w->pointm)->buffer == XBUFFER (w->contents));
@@ -17062,6 +17951,7 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
 	    }
 	}
 
+      strategy = Qwindow;
       goto done;
     }
 
@@ -17076,6 +17966,7 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
 	{
 	case CURSOR_MOVEMENT_SUCCESS:
 	  used_current_matrix_p = true;
+	  strategy = Qcursor;
 	  goto done;
 	  break;
 	case CURSOR_MOVEMENT_MUST_SCROLL:
@@ -17102,7 +17993,10 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
       if (f->fonts_changed)
 	goto need_larger_matrices;
       if (tem > 0)
-	goto done;
+	{
+	  strategy = Qinsdel;
+	  goto done;
+	}
 
       /* Otherwise try_window_insdel has returned -1 which means that we
 	 don't want the alternative below this comment to execute.  */
@@ -17171,7 +18065,10 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
 	    }
 	    /* Drop through and scroll.  */
 	  else
-	    goto done;
+	    {
+	      strategy = used_current_matrix_p ? Qreuse : Qwindow;
+	      goto done;
+	    }
 	}
       else
 	clear_glyph_matrix (w->desired_matrix);
@@ -17206,6 +18103,7 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
 			     emacs_scroll_step, last_line_misfit))
 	{
 	case SCROLLING_SUCCESS:
+	  strategy = Qscroll;
 	  goto done;
 	  break;
 	case SCROLLING_NEED_LARGER_MATRICES:
@@ -17337,6 +18235,7 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
       || MINI_WINDOW_P (w)
       || !(used_current_matrix_p = try_window_reusing_current_matrix (w)))
     use_desired_matrix = (1 == try_window (window, wstart, 0));
+  strategy = used_current_matrix_p ? Qreuse : Qrecenter;
 
   bidi_unshelve_cache (itdata, false);
 
@@ -17664,6 +18563,8 @@ redisplay_window (Lisp_Object window, Lisp_Object all)
 	(*FRAME_TERMINAL (f)->redeem_scroll_bar_hook) (w);
     }
 
+  record_redisplay_statistic (w, f->fonts_changed ? Qnil : strategy,
+			      stats_rows, stats_start);
   return unbind_to (count, Qnil);
 }
 
@@ -18445,6 +19346,63 @@ row_containing_pos (struct window *w, ptrdiff_t charpos,
 }
 
 
+/* Return whether the line numbers of rows of W's current matrix that
+   try_window_insdel wants to reuse are still right.  IT has just
+   displayed the new lines up to STOP_POS, where AFTER_GAP begins,
+   and DY is how far the rows from AFTER_GAP on move.  The reused rows
+   are those up to BEFORE_GAP and from AFTER_GAP to the window end.  */
+
+static bool
+lnum_rows_reusable_p (struct window *w, struct it *it,
+		      struct glyph_row *before_gap,
+		      struct glyph_row *after_gap, ptrdiff_t stop_pos,
+		      int dy)
+{
+  struct glyph_row *row;
+  /* Like produce_line_number, which computes IT's pt_lnum only when
+     the current line's number has a face of its own.  */
+  bool current_face_p
+    = (merge_faces (w, Qline_number, 0, DEFAULT_FACE_ID)
+       != merge_faces (w, Qline_number_current_line, 0, DEFAULT_FACE_ID));
+
+  /* A moved row at the window end would have to be completed with
+     a fresh iterator, which could number it differently.  */
+  if (dy != 0 || it->lnum_width == 0 || it->lnum_bytepos == 0)
+    return false;
+
+  if (after_gap)
+    {
+      ptrdiff_t ignored;
+      ptrdiff_t stop_lnum
+	= (it->lnum + 1
+	   + display_count_lines_logically (it->lnum_bytepos,
+					    CHAR_TO_BYTE (stop_pos),
+					    stop_pos, &ignored));
+      if (stop_lnum != after_gap->lnum)
+	return false;
+    }
+
+  for (row = MATRIX_FIRST_TEXT_ROW (w->current_matrix);
+       row <= MATRIX_ROW (w->current_matrix, w->window_end_vpos);
+       row++)
+    {
+      /* Skip the rows that were displayed anew.  */
+      if (before_gap ? row == before_gap + 1 : row < after_gap || !after_gap)
+	{
+	  if (!after_gap)
+	    break;
+	  row = after_gap;
+	}
+      if (row->lnum <= 0
+	  || row->lnum_width != it->lnum_width
+	  || (current_face_p
+	      && row->lnum_current_p != (row->lnum == it->pt_lnum + 1)))
+	return false;
+    }
+  return true;
+}
+
+
 /* Try to redisplay window W by reusing its existing display.  W's
    current matrix must be up to date when this function is called,
    i.e., window_end_valid must be true.
@@ -18567,13 +19525,6 @@ #define GIVE_UP(X) return 0
   if (overlay_arrows_changed_p (false))
     GIVE_UP (12);
 
-  /* When word-wrap is on, adding a space to the first word of a
-     wrapped line can change the wrap position, altering the line
-     above it.  It might be worthwhile to handle this more
-     intelligently, but for now just redisplay from scratch.  */
-  if (!NILP (BVAR (XBUFFER (w->contents), word_wrap)))
-    GIVE_UP (21);
-
   /* Under bidi reordering, adding or deleting a character in the
      beginning of a paragraph, before the first strong directional
      character, can change the base direction of the paragraph (unless
@@ -18591,14 +19542,11 @@ #define GIVE_UP(X) return 0
   if (!NILP (BVAR (XBUFFER (w->contents), extra_line_spacing)))
     GIVE_UP (23);
 
-  /* Give up if display-line-numbers is in relative mode, or when the
-     current line's number needs to be displayed in a distinct face.  */
+  /* Give up if display-line-numbers is in relative mode, where moving
+     point renumbers every line.  Absolute line numbers are checked
+     against the rows to reuse once the new lines are displayed.  */
   if (EQ (Vdisplay_line_numbers, Qrelative)
-      || EQ (Vdisplay_line_numbers, Qvisual)
-      || (!NILP (Vdisplay_line_numbers)
-	  && NILP (Finternal_lisp_face_equal_p (Qline_number,
-						Qline_number_current_line,
-						w->frame))))
+      || EQ (Vdisplay_line_numbers, Qvisual))
     GIVE_UP (24);
 
   /* composition-break-at-point is incompatible with the optimizations
@@ -18763,6 +19711,21 @@ #define GIVE_UP(X) return 0
      start of current_buffer.  Value is null if changes start in the
      first line of window.  */
   before_gap = last_unchanged_row_before_gap (w);
+
+  /* When word-wrap is on, adding a space to the first word of a
+     wrapped line can change the wrap position, altering the rows
+     above it.  Start displaying at the beginning of the line.  */
+  if (before_gap && !NILP (BVAR (XBUFFER (w->contents), word_wrap)))
+    {
+      while (before_gap && before_gap->continued_p)
+	before_gap = (before_gap > MATRIX_FIRST_TEXT_ROW (current_matrix)
+		      ? before_gap - 1 : NULL);
+      if (!before_gap
+	  && MATRIX_ROW_CONTINUATION_LINE_P (MATRIX_FIRST_TEXT_ROW
+					     (current_matrix)))
+	GIVE_UP (21);
+    }
+
   if (before_gap)
     {
       /* Avoid starting to display in the middle of a character, a TAB
@@ -18795,6 +19758,12 @@ #define GIVE_UP(X) return 0
       it.glyph_row = MATRIX_ROW (desired_matrix, it.vpos);
       it.current_y = MATRIX_ROW_BOTTOM_Y (before_gap);
 
+      /* Number the new lines as wide as the ones kept above them,
+	 which is what a full redisplay would compute from the same
+	 window start.  */
+      if (before_gap->lnum > 0)
+	it.lnum_width = before_gap->lnum_width;
+
       eassert (it.hpos == 0 && it.current_x == 0);
     }
   else
@@ -18914,6 +19883,17 @@ #define GIVE_UP(X) return 0
       after_gap = NULL;
     }
 
+  /* Rows kept from the current matrix show the line numbers they were
+     drawn with.  Reuse them only if the numbers, their width and the
+     face of the current line's number are still right, which is the
+     case for most changes within a line.  */
+  if (!NILP (Vdisplay_line_numbers)
+      && !lnum_rows_reusable_p (w, &it, before_gap, after_gap, stop_pos, dy))
+    {
+      clear_glyph_matrix (w->desired_matrix);
+      return 0;
+    }
+
   /* Find the cursor if not already found.  We have to decide whether
      PT will appear on this window (it sometimes doesn't, but this is
      not a very frequent case.)  This decision has to be made before
@@ -20939,6 +21919,13 @@ produce_line_number (struct it *it)
 
   /* Record the width in pixels we need for the line number display.  */
   it->lnum_pixel_width = tem_it.current_x;
+  if (it->glyph_row)
+    {
+      it->glyph_row->lnum = this_line + 1;
+      it->glyph_row->lnum_width = it->lnum_width;
+      it->glyph_row->lnum_current_p = (tem_it.face_id == current_lnum_face_id
+				       && lnum_face_id != current_lnum_face_id);
+    }
   /* Copy the produced glyphs into IT's glyph_row.  */
   struct glyph *g = scratch_glyph_row.glyphs[TEXT_AREA];
   struct glyph *e = g + scratch_glyph_row.used[TEXT_AREA];
@@ -21062,6 +22049,7 @@ row_text_area_empty (struct glyph_row *row)
 static bool
 display_sline (struct it *it, int cursor_vpos)
 {
+  redisplay_rows_produced++;
   struct glyph_row *row = it->glyph_row;
   Lisp_Object overlay_arrow_string;
   struct it wrap_it;
@@ -24761,12 +25749,22 @@ display_count_lines (ptrdiff_t start_byte,
   register unsigned char *ceiling_addr;
   ptrdiff_t orig_count = count;
 
+  /* How far from BASE the scan must get before blocks of lines are
+     again worth skipping in bulk; see skip_newlines_forward.  */
+  ptrdiff_t skip_from;
+
   /* If we are not in selective display mode,
      check only for newlines.  */
   bool selective_display
     = (!NILP (BVAR (current_buffer, selective_display))
        && !FIXNUMP (BVAR (current_buffer, selective_display)));
 
+  ptrdiff_t found;
+  if (!selective_display
+      && line_index_scan (start_byte, limit_byte, count, &found, byte_pos_ptr))
+    return (found != count ? eabs (found)
+	    : count > 0 ? count : - count - 1);
+
   if (count > 0)
     {
       while (start_byte < limit_byte)
@@ -24775,6 +25773,7 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling = min (limit_byte - 1, ceiling);
 	  ceiling_addr = BYTE_POS_ADDR (ceiling) + 1;
 	  base = (cursor = BYTE_POS_ADDR (start_byte));
+	  skip_from = 0;
 
 	  do
 	    {
@@ -24788,6 +25787,13 @@ display_count_lines (ptrdiff_t start_byte,
 		}
 	      else
 		{
+		  if (skip_from <= cursor - base)
+		    {
+		      cursor += skip_newlines_forward (cursor,
+						       ceiling_addr - cursor,
+						       &count);
+		      skip_from = cursor - base + NEWLINE_BLOCK;
+		    }
 		  cursor = memchr (cursor, '\n', ceiling_addr - cursor);
 		  if (!cursor)
 		    break;
@@ -24815,6 +25821,7 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling = max (limit_byte, ceiling);
 	  ceiling_addr = BYTE_POS_ADDR (ceiling);
 	  base = (cursor = BYTE_POS_ADDR (start_byte - 1) + 1);
+	  skip_from = 0;
 	  while (true)
 	    {
 	      if (selective_display)
@@ -24827,6 +25834,13 @@ display_count_lines (ptrdiff_t start_byte,
 		}
 	      else
 		{
+		  if (base - cursor >= skip_from)
+		    {
+		      cursor -= skip_newlines_backward (cursor,
+							cursor - ceiling_addr,
+							&count);
+		      skip_from = base - cursor + NEWLINE_BLOCK;
+		    }
 		  cursor = memrchr (ceiling_addr, '\n', cursor - ceiling_addr);
 		  if (!cursor)
 		    break;
@@ -32766,6 +33780,22 @@ syms_of_xdisp (void)
 
   DEFSYM (Qredisplay_internal_xC_functionx, "redisplay_internal (C function)");
 
+  /* Strategies reported by `redisplay-statistics'.  */
+  DEFSYM (Qline, "line");
+  DEFSYM (Qcursor, "cursor");
+  DEFSYM (Qinsdel, "insdel");
+  DEFSYM (Qreuse, "reuse");
+  DEFSYM (Qscroll, "scroll");
+  DEFSYM (Qwindow, "window");
+  DEFSYM (Qrecenter, "recenter");
+
+  redisplay_statistics_windows
+    = initialize_vector (REDISPLAY_STATISTICS_SIZE, Qnil);
+  staticpro (&redisplay_statistics_windows);
+
+  overlay_region.buffer = Qnil;
+  staticpro (&overlay_region.buffer);
+
   DEFVAR_BOOL ("scroll-minibuffer-conservatively",
                scroll_minibuffer_conservatively,
                doc: /* Non-nil means scroll conservatively in minibuffer windows.
@@ -32798,6 +33828,7 @@ syms_of_xdisp (void)
 #endif
   defsubr (&Sline_pixel_height);
   defsubr (&Sformat_mode_line);
+  defsubr (&Sredisplay_statistics);
   defsubr (&Sinvisible_p);
   defsubr (&Scurrent_bidi_paragraph_direction);
   defsubr (&Swindow_text_pixel_size);
@@ -33711,6 +34742,13 @@ syms_of_xdisp (void)
 Internal use only.  */);
   Vredisplay__mode_lines_cause = Fmake_hash_table (0, NULL);
 
+  DEFVAR_BOOL ("redisplay-record-statistics", redisplay_record_statistics,
+	       doc: /* Non-nil means record statistics about redisplay.
+They tell which strategy redisplayed each window and how much work it
+took, and are returned by `redisplay-statistics'.  Recording them adds
+some overhead to redisplay.  */);
+  redisplay_record_statistics = false;
+
   DEFVAR_BOOL ("display-raw-bytes-as-hex", display_raw_bytes_as_hex,
     doc: /* Non-nil means display raw bytes in hexadecimal format.
 The default is to use octal format (\\200) whereas hexadecimal (\\x80)
@@ -299,10 +299,17 @@ #define IGNORE_DEFFACE_P(ATTR) EQ (ATTR, QCignore_defface)
 
 #define RESET_P(ATTR) EQ (ATTR, Qreset)
 
-/* Size of hash table of realized faces in face caches (should be a
-   prime number).  */
+/* Sizes of the hash table of realized faces in face caches (should be
+   prime numbers).  A table starts with the first size, and grows to
+   the next one when it holds twice as many faces as it has buckets.  */
 
-#define FACE_CACHE_BUCKETS_SIZE 1009
+static int const face_cache_buckets_sizes[] =
+  { 127, 509, 1009, 4093, 16381, 65521 };
+
+/* Maximum number of slots of the memo of a face cache (a power of 2).
+   A memo that would need more is emptied instead.  */
+
+#define FACE_MEMO_MAX_SIZE (1 << 16)
 
 char unspecified_fg[] = "unspecified-fg", unspecified_bg[] = "unspecified-bg";
 
@@ -752,6 +759,40 @@ DEFUN ("clear-face-cache", Fclear_face_cache, Sclear_face_cache, 0, 1, 0,
   return Qnil;
 }
 
+DEFUN ("face-cache-statistics", Fface_cache_statistics,
+       Sface_cache_statistics, 0, 2, 0,
+       doc: /* Return statistics about the cache of realized faces of FRAME.
+FRAME nil or omitted means use the selected frame.  The value is a list
+
+  (FACES BUCKETS MERGES HITS MISSES)
+
+where FACES is the number of faces realized on FRAME, BUCKETS the size
+of the hash table holding them, and MERGES the number of results of
+merging a face named by a `face' property into a realized face that
+are memoized.
+HITS and MISSES count the lookups of merged faces answered by the
+memo, and those that were not.
+
+If RESET is non-nil, reset HITS and MISSES after returning them.  */)
+  (Lisp_Object frame, Lisp_Object reset)
+{
+  struct face_cache *c = FRAME_FACE_CACHE (decode_live_frame (frame));
+  int faces = 0;
+
+  if (!c)
+    return list5 (make_fixnum (0), make_fixnum (0), make_fixnum (0),
+		  make_fixnum (0), make_fixnum (0));
+  for (int i = 0; i < c->used; i++)
+    if (c->faces_by_id[i])
+      faces++;
+  Lisp_Object val = list5 (make_fixnum (faces), make_fixnum (c->buckets_size),
+			   make_fixnum (c->memo_used), make_int (c->memo_hits),
+			   make_int (c->memo_misses));
+  if (!NILP (reset))
+    c->memo_hits = c->memo_misses = 0;
+  return val;
+}
+
 
 /***********************************************************************
 			      X Pixmaps
@@ -2452,6 +2493,11 @@ evaluate_face_filter (Lisp_Object filter, struct window *w,
   return false;
 }
 
+/* Set by filter_face_ref when it meets a `:filtered' face reference,
+   whose meaning depends on the window.  See lookup_merged_face.  */
+
+static bool face_ref_filtered;
+
 /* Determine whether FACE_REF is a "filter" face specification (case
    #4 in merge_face_ref).  If it is, evaluate the filter, and if the
    filter matches, return the filtered face spec.  If the filter does
@@ -2480,6 +2526,7 @@ filter_face_ref (Lisp_Object face_ref,
     if (!EQ (XCAR (face_ref), QCfiltered))
       return face_ref;
     face_ref = XCDR (face_ref);
+    face_ref_filtered = true;
 
     if (!CONSP (face_ref))
       goto err;
@@ -4661,15 +4708,103 @@ make_face_cache (struct frame *f)
 {
   struct face_cache *c = xmalloc (sizeof *c);
 
-  c->buckets = xzalloc (FACE_CACHE_BUCKETS_SIZE * sizeof *c->buckets);
+  c->buckets_size = face_cache_buckets_sizes[0];
+  c->buckets = xzalloc (c->buckets_size * sizeof *c->buckets);
   c->size = 50;
   c->used = 0;
   c->faces_by_id = xmalloc (c->size * sizeof *c->faces_by_id);
+  c->memo = NULL;
+  c->memo_size = c->memo_used = 0;
+  c->memo_hits = c->memo_misses = 0;
   c->f = f;
   c->menu_face_changed_p = menu_face_changed_default;
   return c;
 }
 
+/* Forget the merged faces memoized in face cache C.  The garbage
+   collector calls this instead of marking the memo, so that it does
+   not keep uninterned face symbols alive.  */
+
+void
+clear_face_memo (struct face_cache *c)
+{
+  if (c->memo_used)
+    {
+      for (int i = 0; i < c->memo_size; i++)
+	c->memo[i].face_ref = Qnil;
+      c->memo_used = 0;
+    }
+}
+
+/* Return the slot of the memo of face cache C for merging FACE_REF
+   into the realized face BASE_FACE_ID with ATTR_FILTER: the slot
+   holding the result if it is memoized, otherwise the free slot where
+   it would go.  The memo must have been allocated.  */
+
+static struct face_memo *
+face_memo_slot (struct face_cache *c, Lisp_Object face_ref,
+		int base_face_id, int attr_filter)
+{
+  EMACS_UINT hash = sxhash_combine (sxhash_combine (XHASH (face_ref),
+						    base_face_id),
+				    attr_filter);
+  int mask = c->memo_size - 1;
+
+  for (int i = knuth_hash (reduce_emacs_uint_to_hash_hash (hash),
+			   elogb (c->memo_size));
+       ; i = (i + 1) & mask)
+    {
+      struct face_memo *m = &c->memo[i];
+      if (NILP (m->face_ref)
+	  || (EQ (m->face_ref, face_ref)
+	      && m->base_face_id == base_face_id
+	      && m->attr_filter == attr_filter))
+	return m;
+    }
+}
+
+/* Record in the memo of face cache C that merging FACE_REF into the
+   realized face BASE_FACE_ID with ATTR_FILTER gives the realized face
+   FACE_ID.  The memo is kept at most three quarters full, growing it
+   up to FACE_MEMO_MAX_SIZE slots, and emptied when it cannot grow.  */
+
+static void
+face_memo_put (struct face_cache *c, Lisp_Object face_ref,
+	       int base_face_id, int attr_filter, int face_id)
+{
+  if (4 * (c->memo_used + 1) > 3 * c->memo_size)
+    {
+      if (c->memo_size < FACE_MEMO_MAX_SIZE)
+	{
+	  struct face_memo *old = c->memo;
+	  int old_size = c->memo_size;
+
+	  c->memo_size = old_size ? 2 * old_size : 256;
+	  c->memo = xzalloc (c->memo_size * sizeof *c->memo);
+	  c->memo_used = 0;
+	  for (int i = 0; i < old_size; i++)
+	    if (!NILP (old[i].face_ref))
+	      {
+		*face_memo_slot (c, old[i].face_ref, old[i].base_face_id,
+				 old[i].attr_filter) = old[i];
+		c->memo_used++;
+	      }
+	  xfree (old);
+	}
+      else
+	clear_face_memo (c);
+    }
+
+  struct face_memo *m = face_memo_slot (c, face_ref, base_face_id,
+					attr_filter);
+  if (NILP (m->face_ref))
+    c->memo_used++;
+  m->face_ref = face_ref;
+  m->base_face_id = base_face_id;
+  m->attr_filter = attr_filter;
+  m->face_id = face_id;
+}
+
 #ifdef HAVE_WINDOW_SYSTEM
 
 /* Clear out all graphics contexts for all realized faces, except for
@@ -4726,8 +4861,9 @@ free_realized_faces (struct face_cache *c)
       /* Forget the escape-glyph and glyphless-char faces.  */
       forget_escape_and_glyphless_faces ();
       c->used = 0;
-      size = FACE_CACHE_BUCKETS_SIZE * sizeof *c->buckets;
+      size = c->buckets_size * sizeof *c->buckets;
       memset (c->buckets, 0, size);
+      clear_face_memo (c);
 
       /* Must do a thorough redisplay the next time.  Mark current
 	 matrices as invalid because they will reference faces freed
@@ -4773,24 +4909,22 @@ free_face_cache (struct face_cache *c)
       free_realized_faces (c);
       xfree (c->buckets);
       xfree (c->faces_by_id);
+      xfree (c->memo);
       xfree (c);
     }
 }
 
 
-/* Cache realized face FACE in face cache C.  HASH is the hash value
-   of FACE.  If FACE is for ASCII characters (i.e. FACE->ascii_face ==
-   FACE), insert the new face to the beginning of the collision list
-   of the face hash table of C.  Otherwise, add the new face to the
-   end of the collision list.  This way, lookup_face can quickly find
-   that a requested face is not cached.  */
+/* Insert face FACE into the hash table of face cache C.  If FACE is
+   for ASCII characters (i.e. FACE->ascii_face == FACE), insert it at
+   the beginning of the collision list of its bucket.  Otherwise, add
+   it to the end of the collision list.  This way, lookup_face can
+   quickly find that a requested face is not cached.  */
 
 static void
-cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
+link_face (struct face_cache *c, struct face *face)
 {
-  int i = hash % FACE_CACHE_BUCKETS_SIZE;
-
-  face->hash = hash;
+  int i = face->hash % c->buckets_size;
 
   if (face->ascii_face != face)
     {
@@ -4817,6 +4951,38 @@ cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
 	face->next->prev = face;
       c->buckets[i] = face;
     }
+}
+
+/* Give the hash table of face cache C the next larger number of
+   buckets, if there is one, and rehash the faces in it.  */
+
+static void
+grow_face_cache_buckets (struct face_cache *c)
+{
+  int n = 0;
+
+  while (face_cache_buckets_sizes[n] <= c->buckets_size)
+    if (++n == ARRAYELTS (face_cache_buckets_sizes))
+      return;
+
+  xfree (c->buckets);
+  c->buckets_size = face_cache_buckets_sizes[n];
+  c->buckets = xzalloc (c->buckets_size * sizeof *c->buckets);
+  for (int i = 0; i < c->used; ++i)
+    if (c->faces_by_id[i])
+      link_face (c, c->faces_by_id[i]);
+}
+
+/* Cache realized face FACE in face cache C.  HASH is the hash value
+   of FACE.  */
+
+static void
+cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
+{
+  int i;
+
+  face->hash = hash;
+  link_face (c, face);
 
   /* Find a free slot in C->faces_by_id and use the index of the free
      slot as FACE->id.  */
@@ -4834,7 +5000,7 @@ cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
     int j, n;
     struct face *face1;
 
-    for (j = n = 0; j < FACE_CACHE_BUCKETS_SIZE; ++j)
+    for (j = n = 0; j < c->buckets_size; ++j)
       for (face1 = c->buckets[j]; face1; face1 = face1->next)
 	if (face1->id == i)
 	  ++n;
@@ -4853,6 +5019,9 @@ cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
     }
 
   c->faces_by_id[face->id] = face;
+
+  if (c->used > 2 * c->buckets_size)
+    grow_face_cache_buckets (c);
 }
 
 
@@ -4861,7 +5030,7 @@ cache_face (struct face_cache *c, struct face *face, uintptr_t hash)
 static void
 uncache_face (struct face_cache *c, struct face *face)
 {
-  int i = face->hash % FACE_CACHE_BUCKETS_SIZE;
+  int i = face->hash % c->buckets_size;
 
   if (face->prev)
     face->prev->next = face->next;
@@ -4874,6 +5043,9 @@ uncache_face (struct face_cache *c, struct face *face)
   c->faces_by_id[face->id] = NULL;
   if (face->id == c->used)
     --c->used;
+
+  /* The memo might refer to FACE by its ID, which will be reused.  */
+  clear_face_memo (c);
 }
 
 
@@ -4893,7 +5065,7 @@ lookup_face (struct frame *f, Lisp_Object *attr)
 
   /* Look up ATTR in the face cache.  */
   uintptr_t hash = lface_hash (attr);
-  int i = hash % FACE_CACHE_BUCKETS_SIZE;
+  int i = hash % cache->buckets_size;
 
   for (face = cache->buckets[i]; face; face = face->next)
     {
@@ -4919,6 +5091,56 @@ lookup_face (struct frame *f, Lisp_Object *attr)
   return face->id;
 }
 
+/* Return the ID of the realized face for ASCII characters that results
+   from merging the face reference FACE_REF into the realized face
+   BASE_FACE_ID on frame F, with ATTR_FILTER as for merge_face_ref.
+   W is the window where the face is displayed.
+
+   This is what redisplay does every time the `face' property changes,
+   so when FACE_REF is a face name the result is memoized in the face
+   cache of F.  Lists and property lists are not memoized, because
+   they can be changed in place.  The memo is emptied whenever faces
+   are freed, which is how changes to face definitions reach it, and
+   at each garbage collection.  It is not used while
+   `face-remapping-alist' is non-nil, since that too can be changed in
+   place, and results that depend on the window through
+   `:filtered' face references are not memoized.  */
+
+static int
+lookup_merged_face (struct window *w, struct frame *f, Lisp_Object face_ref,
+		    int base_face_id, enum lface_attribute_index attr_filter)
+{
+  struct face_cache *c = FRAME_FACE_CACHE (f);
+  struct face *base_face = FACE_FROM_ID (f, base_face_id);
+  Lisp_Object attrs[LFACE_VECTOR_SIZE];
+  bool memoize = SYMBOLP (face_ref) && NILP (Vface_remapping_alist);
+
+  if (memoize && c->memo_used)
+    {
+      struct face_memo *m = face_memo_slot (c, face_ref, base_face_id,
+					    attr_filter);
+      if (!NILP (m->face_ref))
+	{
+	  c->memo_hits++;
+	  return m->face_id;
+	}
+    }
+
+  memcpy (attrs, base_face->lface, sizeof attrs);
+  face_ref_filtered = false;
+  if (!merge_face_ref (w, f, face_ref, attrs, true, NULL, attr_filter))
+    memoize = false;
+  memoize &= !face_ref_filtered;
+
+  int face_id = lookup_face (f, attrs);
+  if (memoize)
+    {
+      c->memo_misses++;
+      face_memo_put (c, face_ref, base_face_id, attr_filter, face_id);
+    }
+  return face_id;
+}
+
 #ifdef HAVE_WINDOW_SYSTEM
 /* Look up a realized face that has the same attributes as BASE_FACE
    except for the font in the face cache of frame F.  If FONT-OBJECT
@@ -4938,7 +5160,7 @@ face_for_font (struct frame *f, Lisp_Object font_object,
   eassert (cache != NULL);
   base_face = base_face->ascii_face;
   hash = lface_hash (base_face->lface);
-  i = hash % FACE_CACHE_BUCKETS_SIZE;
+  i = hash % cache->buckets_size;
 
   for (face = cache->buckets[i]; face; face = face->next)
     {
@@ -6724,8 +6946,17 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
   /* Look at properties from overlays.  */
   USE_SAFE_ALLOCA;
   {
-    ptrdiff_t next_overlay;
-    GET_OVERLAYS_AT (pos, overlay_vec, noverlays, &next_overlay);
+    ptrdiff_t next_overlay, len = 40;
+    SAFE_NALLOCA (overlay_vec, 1, len);
+    noverlays = window_overlays_at (w, pos, &overlay_vec, &len,
+				    &next_overlay);
+    if (noverlays > len)
+      {
+	len = noverlays;
+	SAFE_NALLOCA (overlay_vec, 1, len);
+	noverlays = window_overlays_at (w, pos, &overlay_vec, &len,
+					&next_overlay);
+      }
     if (next_overlay < endpos)
       endpos = next_overlay;
   }
@@ -6763,12 +6994,21 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
       return default_face->id;
     }
 
-  /* Begin with attributes from the default face.  */
-  memcpy (attrs, default_face->lface, sizeof(attrs));
-
-  /* Merge in attributes specified via text properties.  */
-  if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
+  /* Begin with attributes from the default face, merged with those
+     specified via text properties.  */
+  if (NILP (prop))
+    memcpy (attrs, default_face->lface, sizeof attrs);
+  else
+    {
+      int face_id = lookup_merged_face (w, f, prop, default_face->id,
+					attr_filter);
+      if (noverlays == 0)
+	{
+	  SAFE_FREE ();
+	  return face_id;
+	}
+      memcpy (attrs, FACE_FROM_ID (f, face_id)->lface, sizeof attrs);
+    }
 
   /* Now merge the overlay data.  */
   noverlays = sort_overlays (overlay_vec, noverlays, w);
@@ -6865,18 +7105,15 @@ face_for_overlay_string (struct window *w, ptrdiff_t pos,
       && NILP (Vface_remapping_alist))
     return DEFAULT_FACE_ID;
 
-  /* Begin with attributes from the default face.  */
   default_face = FACE_FROM_ID (f, lookup_basic_face (w, f, DEFAULT_FACE_ID));
-  memcpy (attrs, default_face->lface, sizeof attrs);
 
   /* Merge in attributes specified via text properties.  */
   if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
+    return lookup_merged_face (w, f, prop, default_face->id, attr_filter);
 
-  *endptr = endpos;
-
-  /* Look up a realized face with the given face attributes,
+  /* Look up a realized face with the attributes of the default face,
      or realize a new one for ASCII characters.  */
+  memcpy (attrs, default_face->lface, sizeof attrs);
   return lookup_face (f, attrs);
 }
 
@@ -6948,15 +7185,13 @@ face_at_string_position (struct window *w, Lisp_Object string,
 	  || FACE_SUITABLE_FOR_ASCII_CHAR_P (base_face)))
     return base_face->id;
 
-  /* Begin with attributes from the base face.  */
-  memcpy (attrs, base_face->lface, sizeof attrs);
-
   /* Merge in attributes specified via text properties.  */
   if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
+    return lookup_merged_face (w, f, prop, base_face->id, attr_filter);
 
-  /* Look up a realized face with the given face attributes,
+  /* Look up a realized face with the attributes of the base face,
      or realize a new one for ASCII characters.  */
+  memcpy (attrs, base_face->lface, sizeof attrs);
   return lookup_face (f, attrs);
 }
 
@@ -7384,6 +7619,7 @@ syms_of_xfaces (void)
   defsubr (&Sshow_face_resources);
 #endif /* GLYPH_DEBUG */
   defsubr (&Sclear_face_cache);
+  defsubr (&Sface_cache_statistics);
   defsubr (&Stty_suppress_bold_inverse_default_colors);
 
 #if defined DEBUG_X_COLORS && defined HAVE_X_WINDOWS
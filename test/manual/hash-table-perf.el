@@ -0,0 +1,111 @@
+;;; hash-table-perf.el --- gethash/puthash heavy workloads  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Run with
+;;
+;;   src/emacs -Q --batch -l test/manual/hash-table-perf.el \
+;;     -f hash-table-perf-run-batch [N]
+;;
+;; where N scales the number of keys (default 100000).  Each line of
+;; output is the elapsed seconds, GC count and GC seconds returned by
+;; `benchmark-run' for one workload.
+
+;;; Code:
+
+(require 'benchmark)
+
+(defun hash-table-perf--words (n)
+  "Return a vector of N distinct identifier-like strings."
+  (let ((words (make-vector n nil)))
+    (dotimes (i n)
+      (aset words i (format "%s-%x-%s"
+                            (nth (% i 7) '("buffer" "window" "frame" "face"
+                                           "overlay" "process" "marker"))
+                            (* i 2654435761)
+                            (nth (% i 3) '("get" "set" "p")))))
+    words))
+
+(defun hash-table-perf-completion (n)
+  "Build an `equal' table of N strings, then probe it as completion does."
+  (let ((words (hash-table-perf--words n)))
+    (benchmark-run 1
+      (let ((table (make-hash-table :test 'equal)))
+        (dotimes (i n)
+          (puthash (aref words i) i table))
+        (dotimes (_ 5)
+          (dotimes (i n)
+            (gethash (aref words i) table)
+            (gethash (concat (aref words i) "x") table)))))))
+
+(defun hash-table-perf-symbols (n)
+  "Hit an `eq' table keyed by symbols, as `intern'-heavy code does."
+  (let ((syms (make-vector n nil)))
+    (dotimes (i n)
+      (aset syms i (make-symbol (format "s%d" i))))
+    (benchmark-run 1
+      (let ((table (make-hash-table :test 'eq)))
+        (dotimes (i n)
+          (puthash (aref syms i) i table))
+        (dotimes (_ 10)
+          (dotimes (i n)
+            (gethash (aref syms i) table)))))))
+
+(defun hash-table-perf-churn (n)
+  "Interleave `puthash' and `remhash' on an `eql' table of N fixnums."
+  (benchmark-run 1
+    (let ((table (make-hash-table :test 'eql)))
+      (dotimes (round 10)
+        (dotimes (i n)
+          (if (zerop (% (+ i round) 3))
+              (remhash i table)
+            (puthash i round table)))))))
+
+(defun hash-table-perf-json (n)
+  "Decode a JSON array of N small objects into hash tables."
+  (let ((json (concat "["
+                      (mapconcat
+                       (lambda (i)
+                         (format "{\"label\":\"item%d\",\"kind\":%d,\
+\"detail\":\"(fn %d)\",\"sortText\":\"%08d\"}" i (% i 25) i i))
+                       (number-sequence 1 n) ",")
+                      "]")))
+    (benchmark-run 1
+      (let ((objs (json-parse-string json :object-type 'hash-table)))
+        (seq-doseq (obj objs)
+          (gethash "label" obj)
+          (gethash "kind" obj)
+          (gethash "missing" obj))))))
+
+(defun hash-table-perf-run-batch ()
+  "Run all workloads with the size in `command-line-args-left'."
+  (let ((n (if command-line-args-left
+               (string-to-number (pop command-line-args-left))
+             100000)))
+    (dolist (fn '(hash-table-perf-completion
+                  hash-table-perf-symbols
+                  hash-table-perf-churn
+                  hash-table-perf-json))
+      (let ((byte-compile-warnings nil))
+        (byte-compile fn))
+      (garbage-collect)
+      (message "%-28s %S" fn (funcall fn n)))))
+
+;;; hash-table-perf.el ends here
@@ -0,0 +1,84 @@
+;;; json-perf.el --- JSON parsing and serialization workloads  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Run with
+;;
+;;   src/emacs -Q --batch -l test/manual/json-perf.el \
+;;     -f json-perf-run-batch [N]
+;;
+;; where N is the number of completion items in the payload (default
+;; 20000).  The payload resembles an LSP textDocument/completion
+;; response, whose time is dominated by long documentation strings.
+;; Each line of output is the elapsed seconds, GC count and GC seconds
+;; returned by `benchmark-run' for one workload.
+
+;;; Code:
+
+(require 'benchmark)
+
+(defconst json-perf--documentation
+  (concat "```elisp\n(defun example (arg &optional flag)\n```\n\n"
+          (mapconcat #'identity
+                     (make-list 12 "Return the frobnicated value of ARG, \
+consulting the `example-alist' when FLAG is non-nil.")
+                     " ")
+          "\n\n* Note: \"quoted\" text and a tab\there.")
+  "Markdown documentation attached to every completion item.")
+
+(defun json-perf--payload (n)
+  "Return a completion response with N items as a Lisp object."
+  (let ((items (make-vector n nil)))
+    (dotimes (i n)
+      (aset items i
+            `((label . ,(format "example-function-%d" i))
+              (kind . ,(% i 25))
+              (detail . ,(format "(example-function-%d ARG &optional FLAG)" i))
+              (documentation . ((kind . "markdown")
+                                (value . ,json-perf--documentation)))
+              (sortText . ,(format "%08d" i)))))
+    `((jsonrpc . "2.0")
+      (id . 42)
+      (result . ((isIncomplete . :false)
+                 (items . ,items))))))
+
+(defun json-perf-parse (n)
+  "Parse a serialized completion response of N items."
+  (let ((json (json-serialize (json-perf--payload n))))
+    (benchmark-run 5
+      (json-parse-string json :object-type 'plist))))
+
+(defun json-perf-serialize (n)
+  "Serialize a completion response of N items."
+  (let ((payload (json-perf--payload n)))
+    (benchmark-run 5
+      (json-serialize payload))))
+
+(defun json-perf-run-batch ()
+  "Run all workloads with the size in `command-line-args-left'."
+  (let ((n (if command-line-args-left
+               (string-to-number (pop command-line-args-left))
+             20000)))
+    (dolist (fn '(json-perf-parse
+                  json-perf-serialize))
+      (garbage-collect)
+      (message "%-28s %S" fn (funcall fn n)))))
+
+;;; json-perf.el ends here
@@ -1176,6 +1176,77 @@ START_TEST (test_gap_delete_8)
 }
 END_TEST
 
+
+/* +===================================================================================+
+ * | Snapshot
+ * +===================================================================================+ */
+
+static void
+test_check_snapshot (struct itree_tree *tree,
+                     ptrdiff_t begin, ptrdiff_t end, ptrdiff_t next,
+                     int n, ...)
+{
+  va_list ap;
+  struct itree_interval vec[8];
+  ptrdiff_t after;
+
+  ck_assert_int_eq (itree_snapshot (tree, begin, end, vec, 8, &after), n);
+  ck_assert_int_eq (after, next);
+  va_start (ap, n);
+  for (int i = 0; i < n; ++i)
+    ck_assert_int_eq (vec[i].begin, va_arg (ap, ptrdiff_t));
+  va_end (ap);
+}
+
+START_TEST (test_snapshot_1)
+{
+  enum { N = 4 };
+  struct itree_node nodes[N] = {{.begin = 10, .end = 20},
+                                {.begin = 20, .end = 30},
+                                {.begin = 30, .end = 30},
+                                {.begin = 30, .end = 40}};
+  test_create_tree (nodes, N, true);
+  test_check_snapshot (&tree, 0, 50, PTRDIFF_MAX, 4,
+                       10, 20, 30, 30);
+  test_check_snapshot (&tree, 15, 25, 30, 2,
+                       10, 20);
+  test_check_snapshot (&tree, 0, 10, 10, 0);
+  test_check_snapshot (&tree, 30, 30, PTRDIFF_MAX, 1,
+                       30);
+  test_check_snapshot (&tree, 35, 35, PTRDIFF_MAX, 1,
+                       30);
+  test_check_snapshot (&tree, 40, 50, PTRDIFF_MAX, 0);
+
+  /* Stop when VEC is full.  */
+  struct itree_interval vec[2];
+  ck_assert_int_eq (itree_snapshot (&tree, 0, 50, vec, 2, NULL), 2);
+  ck_assert_int_eq (vec[0].begin, 10);
+  ck_assert_int_eq (vec[1].begin, 20);
+}
+END_TEST
+
+START_TEST (test_snapshot_2)
+{
+  enum { N = 3 };
+  struct itree_node nodes[N] = {{.begin = 10, .end = 20},
+                                {.begin = 20, .end = 30},
+                                {.begin = 30, .end = 40}};
+  test_create_tree (nodes, N, false);
+  itree_insert_gap (&tree, 15, 100, false);
+  itree_delete_gap (&tree, 5, 2);
+  uintmax_t epoch = tree.epoch;
+  ck_assert_int_eq (epoch & 1, 0);
+  /* The snapshot applies the offsets without changing the tree.  */
+  test_check_snapshot (&tree, 0, 200, PTRDIFF_MAX, 3,
+                       8, 118, 128);
+  test_check_snapshot (&tree, 120, 125, 128, 1,
+                       118);
+  ck_assert_int_eq (tree.epoch, epoch);
+  test_check_generator (&tree, 0, 200, 3,
+                        8, 118, 128);
+}
+END_TEST
+
 
 
 static Suite *
@@ -1265,6 +1336,11 @@ basic_suite ()
   tcase_add_test (tc, test_gap_delete_8);
   suite_add_tcase (s, tc);
 
+  tc = tcase_create ("snapshot");
+  tcase_add_test (tc, test_snapshot_1);
+  tcase_add_test (tc, test_snapshot_2);
+  suite_add_tcase (s, tc);
+
   return s;
 }
 
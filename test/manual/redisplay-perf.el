@@ -0,0 +1,254 @@
+;;; redisplay-perf.el --- Redisplay workloads on a text terminal  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Run with
+;;
+;;   make -C test redisplay-perf
+;;
+;; which runs Emacs on a pseudo-terminal of 40 lines and 100 columns
+;; provided by script(1), or in any text terminal with
+;;
+;;   src/emacs -Q -nw -l test/manual/redisplay-perf.el \
+;;     -f redisplay-perf-run [N] [WORKLOAD...] 2>results
+;;
+;; where N is the number of steps of each workload (default 500) and
+;; the WORKLOADs are the names of the workloads to run (default all).
+;; Each step changes the buffer or scrolls, the way a command would,
+;; and redisplays.  Each line of output is the workload's name, the
+;; elapsed seconds, the number of rows produced by redisplay, the
+;; number of frame updates and the number of GCs.  Workloads that
+;; cannot run in this Emacs print "skipped".
+
+;;; Code:
+
+(require 'benchmark)
+
+(defvar tree-sitter-resources-dir)
+
+(defconst redisplay-perf--directory
+  (file-name-directory (or load-file-name buffer-file-name))
+  "The directory of this file.")
+
+(defvar redisplay-perf-steps 500
+  "Number of steps each workload takes.")
+
+(defvar redisplay-perf-workloads nil
+  "Alist of the workloads, in order, and their functions.")
+
+(defmacro redisplay-perf-define (name doc &rest body)
+  "Define a workload NAME described by DOC.
+BODY sets up the current buffer, which is displayed in the selected
+window, and returns a function to call at each step.  It can also
+return nil to skip the workload."
+  (declare (indent 1) (doc-string 2))
+  `(setf (alist-get ',name redisplay-perf-workloads)
+         (lambda () ,doc ,@body)))
+
+(defun redisplay-perf--insert-lines (n &optional format)
+  "Insert N lines formatted with FORMAT, which takes the line number."
+  (dotimes (i n)
+    (insert (format (or format "Line %d of some text that might be code.\n")
+                    i))))
+
+(defun redisplay-perf--type-step ()
+  "Return a step typing words at point."
+  (let ((i 0))
+    (lambda ()
+      (insert (if (zerop (% (setq i (1+ i)) 8)) " " "x")))))
+
+(defun redisplay-perf--scroll-step ()
+  "Return a step scrolling down and back up by screenfuls."
+  (let ((down t))
+    (lambda ()
+      (condition-case nil
+          (if down (scroll-up) (scroll-down))
+        ((beginning-of-buffer end-of-buffer)
+         (setq down (not down)))))))
+
+(defun redisplay-perf--middle ()
+  "Move point to the middle of the window."
+  (goto-char (window-start))
+  (forward-line (/ (window-body-height) 2)))
+
+(redisplay-perf-define type
+  "Type into the middle of a window of text."
+  (redisplay-perf--insert-lines 2000)
+  (redisplay-perf--middle)
+  (redisplay-perf--type-step))
+
+(redisplay-perf-define type-line-numbers
+  "Type with line numbers displayed."
+  (redisplay-perf--insert-lines 2000)
+  (display-line-numbers-mode)
+  (redisplay-perf--middle)
+  (redisplay-perf--type-step))
+
+(redisplay-perf-define type-visual-line
+  "Type with lines wrapped at word boundaries."
+  (redisplay-perf--insert-lines 2000)
+  (visual-line-mode)
+  (redisplay-perf--middle)
+  (redisplay-perf--type-step))
+
+(redisplay-perf-define type-tree-sitter
+  "Type into a C buffer fontified by tree-sitter."
+  (when (and (fboundp 'tree-sitter--testable)
+             (require 'tree-sitter-c-mode nil t))
+    (setq tree-sitter-resources-dir
+          (expand-file-name "../src/tree-sitter-resources"
+                            redisplay-perf--directory))
+    (when (funcall 'tree-sitter--testable
+                   (expand-file-name "lib/c.so" tree-sitter-resources-dir))
+      (redisplay-perf--insert-lines
+       2000 "int\nf%d (int x)\n{\n  return x * 2; /* Comment.  */\n}\n")
+      (let ((font-lock-support-mode 'tree-sitter-lock-mode))
+        (funcall 'tree-sitter-c-mode)
+        (font-lock-mode))
+      (goto-char (point-min))
+      (search-forward "return" nil nil 1000)
+      (recenter)
+      (redisplay-perf--type-step))))
+
+(redisplay-perf-define scroll
+  "Scroll through a 100000-line buffer."
+  (redisplay-perf--insert-lines 100000)
+  (goto-char (point-min))
+  (redisplay-perf--scroll-step))
+
+(redisplay-perf-define scroll-long-lines
+  "Scroll through lines much longer than the window is wide."
+  (dotimes (i 200)
+    (insert (format "%d " i) (make-string 5000 ?x) "\n"))
+  (goto-char (point-min))
+  (redisplay-perf--scroll-step))
+
+(redisplay-perf-define previous-line-long-lines
+  "Move up through long lines whose tabs vary the width of characters."
+  (dotimes (i 20)
+    (insert (format "%d " i))
+    (dotimes (_ 1000)
+      (insert "abc\tdefg "))
+    (insert "\n"))
+  (lambda ()
+    (condition-case nil
+        (previous-line)
+      (beginning-of-buffer (goto-char (point-max))))))
+
+(redisplay-perf-define type-long-line
+  "Type into the middle of a 100000-character line."
+  (insert (make-string 100000 ?x))
+  (goto-char 50000)
+  (recenter)
+  (redisplay-perf--type-step))
+
+(redisplay-perf-define scroll-overlays
+  "Scroll through a buffer with a face overlay on every word."
+  (redisplay-perf--insert-lines 5000)
+  (goto-char (point-min))
+  (let ((i 0))
+    (while (re-search-forward "\\w+" nil t)
+      (overlay-put (make-overlay (match-beginning 0) (match-end 0))
+                   'face (if (zerop (% (setq i (1+ i)) 2)) 'bold 'italic))))
+  (goto-char (point-min))
+  (redisplay-perf--scroll-step))
+
+(redisplay-perf-define type-overlays
+  "Type among face overlays on every word."
+  (redisplay-perf--insert-lines 5000)
+  (goto-char (point-min))
+  (while (re-search-forward "\\w+" nil t)
+    (overlay-put (make-overlay (match-beginning 0) (match-end 0))
+                 'face 'bold))
+  (goto-char (point-min))
+  (redisplay-perf--middle)
+  (redisplay-perf--type-step))
+
+(redisplay-perf-define scroll-bidi
+  "Scroll through lines mixing right-to-left and left-to-right text."
+  (redisplay-perf--insert-lines
+   1000 "%d: שלום עולם, hello world, مرحبا بالعالم (123) end.\n")
+  (goto-char (point-min))
+  (redisplay-perf--scroll-step))
+
+(redisplay-perf-define type-bidi
+  "Type Hebrew into lines mixing right-to-left and left-to-right text."
+  (redisplay-perf--insert-lines
+   2000 "%d: שלום עולם, hello world, مرحبا بالعالم (123) end.\n")
+  (redisplay-perf--middle)
+  (end-of-line)
+  (let ((i 0))
+    (lambda ()
+      (insert (if (zerop (% (setq i (1+ i)) 8)) " " "ש")))))
+
+(defun redisplay-perf--run-1 (setup)
+  "Run the workload whose setup function is SETUP in a fresh buffer.
+Return a list (SECONDS ROWS UPDATES GCS), or nil if it was skipped."
+  (let ((buffer (get-buffer-create "*redisplay-perf*")))
+    (switch-to-buffer buffer)
+    (unwind-protect
+        (let ((step (funcall setup))
+              (rows 0)
+              (redisplay-record-statistics t))
+          (when step
+            (redisplay t)
+            (redisplay-statistics t)
+            (let* ((updates redisplay--frame-updates)
+                   (result
+                    (benchmark-run 1
+                      (dotimes (_ redisplay-perf-steps)
+                        (funcall step)
+                        (redisplay t)
+                        (dolist (entry (redisplay-statistics t))
+                          (setq rows (+ rows (nth 3 entry))))))))
+              (list (car result) rows
+                    (- redisplay--frame-updates updates)
+                    (cadr result)))))
+      (let (kill-buffer-query-functions)
+        (set-buffer-modified-p nil)
+        (kill-buffer buffer)))))
+
+(defun redisplay-perf-run ()
+  "Run the workloads given by `command-line-args-left' and exit."
+  (let ((standard-output #'external-debugging-output)
+        (workloads (reverse redisplay-perf-workloads)))
+    (when (and command-line-args-left
+               (string-match-p "\\`[0-9]+\\'" (car command-line-args-left)))
+      (setq redisplay-perf-steps
+            (string-to-number (pop command-line-args-left))))
+    (when command-line-args-left
+      (setq workloads
+            (mapcar (lambda (name)
+                      (or (assq (intern name) workloads)
+                          (error "No workload named %s" name)))
+                    command-line-args-left)
+            command-line-args-left nil))
+    (condition-case err
+        (dolist (workload workloads)
+          (let ((result (redisplay-perf--run-1 (cdr workload))))
+            (if result
+                (princ (apply #'format
+                              "%-18s %8.3fs %8d rows %6d updates %3d GCs\n"
+                              (car workload) result))
+              (princ (format "%-18s skipped\n" (car workload))))))
+      (error (princ (format "%s\n" (error-message-string err)))))
+    (kill-emacs 0)))
+
+;;; redisplay-perf.el ends here
@@ -1156,6 +1156,155 @@ test-delete-all-overlay-1
     (should-not (delete-all-overlays (current-buffer)))
     (should-not (delete-all-overlays))))
 
+(ert-deftest test-make-overlays-1 ()
+  (with-temp-buffer
+    (should-not (make-overlays nil))
+    (insert (make-string 100 ?\s))
+    (let* ((marker (copy-marker 50))
+           (ovs (make-overlays `((10 20 face bold) (40 ,marker)
+                                 (70 60 a 1 b 2) (200 300))
+                               nil nil t)))
+      (should (= (length ovs) 4))
+      (should (equal (mapcar (lambda (ov)
+                               (list (overlay-start ov) (overlay-end ov)
+                                     (overlay-properties ov)))
+                             ovs)
+                     '((10 20 (face bold)) (40 50 nil)
+                       (60 70 (a 1 b 2)) (101 101 nil))))
+      (should (equal (sort (overlays-in 1 101)
+                           (lambda (a b)
+                             (< (overlay-start a) (overlay-start b))))
+                     ovs))
+      (goto-char 20)
+      (insert "x")
+      (should (= (overlay-end (car ovs)) 21))
+      (should (eq (get-char-property 15 'face) 'bold)))
+    (let ((ov (car (make-overlays '((5 5 evaporate t) (6 7 evaporate t))))))
+      (should-not (overlay-buffer ov))
+      (should (= (length (overlays-at 6)) 1)))
+    (dolist (specs '((10) ((10)) ((10 20 face)) ((10 20 . face)) ((nil 20))))
+      (should-error (make-overlays specs)))
+    (should (= (length (overlays-in 1 (point-max))) 5))
+    (let ((marker (copy-marker 1)))
+      (with-temp-buffer
+        (should-error (make-overlays `((,marker 1))))))))
+
+(ert-deftest test-make-overlays-2 ()
+  "Test `make-overlays' against `make-overlay' with many overlays."
+  (let ((a (generate-new-buffer " *a*"))
+        (b (generate-new-buffer " *b*"))
+        specs)
+    (random "test-make-overlays-2")
+    (unwind-protect
+        (progn
+          (dolist (buf (list a b))
+            (with-current-buffer buf
+              (insert (make-string 3000 ?\s))))
+          (dotimes (round 3)
+            (setq specs nil)
+            (dotimes (i (if (= round 1) 5 2000))
+              (let ((beg (1+ (random 3000))))
+                (push (list beg (+ beg (random 40)) 'id (list round i))
+                      specs)))
+            (with-current-buffer a
+              (dolist (spec specs)
+                (overlay-put (make-overlay (car spec) (cadr spec))
+                             'id (nth 3 spec))))
+            (with-current-buffer b
+              (make-overlays specs))
+            (dolist (buf (list a b))
+              (with-current-buffer buf
+                (goto-char (1+ (* 1000 round)))
+                (insert "xyz")
+                (delete-region 500 510))))
+          (let ((overlays
+                 (lambda (buf)
+                   (with-current-buffer buf
+                     (sort (mapcar (lambda (ov)
+                                     (list (overlay-start ov) (overlay-end ov)
+                                           (overlay-get ov 'id)))
+                                   (overlays-in (point-min) (point-max)))
+                           (lambda (x y) (string< (format "%S" x)
+                                                  (format "%S" y))))))))
+            (should (equal (funcall overlays a) (funcall overlays b))))
+          (dotimes (i 100)
+            (let ((pos (* 30 i)))
+              (should (equal (with-current-buffer a (next-overlay-change pos))
+                             (with-current-buffer b (next-overlay-change pos))))
+              (should (equal (with-current-buffer a
+                               (previous-overlay-change pos))
+                             (with-current-buffer b
+                               (previous-overlay-change pos)))))))
+      (kill-buffer a)
+      (kill-buffer b))))
+
+(ert-deftest test-delete-overlays-in-1 ()
+  (with-temp-buffer
+    (should (= (delete-overlays-in 1 1) 0))
+    (insert (make-string 100 ?\s))
+    (let ((ov1 (make-overlay 10 20))
+          (ov2 (make-overlay 15 30))
+          (ov3 (make-overlay 40 40))
+          (ov4 (make-overlay 50 60))
+          (ov5 (make-overlay 101 101)))
+      (overlay-put ov2 'kind 'hint)
+      (overlay-put ov4 'kind 'hint)
+      (should (= (delete-overlays-in 1 (point-max) nil 'kind 'hint) 2))
+      (should-not (overlay-buffer ov2))
+      (should-not (overlay-buffer ov4))
+      (should (= (delete-overlays-in 20 40) 0))
+      (should (= (delete-overlays-in 20 41) 1))
+      (should-not (overlay-buffer ov3))
+      (should (overlay-buffer ov1))
+      (should (= (delete-overlays-in 1 101 (current-buffer)) 2))
+      (should-not (overlay-buffer ov1))
+      (should-not (overlay-buffer ov5))
+      (should-not (overlays-in (point-min) (point-max))))))
+
+(ert-deftest test-delete-overlays-in-2 ()
+  "Test `delete-overlays-in' against `delete-overlay' with many overlays."
+  (let ((a (generate-new-buffer " *a*"))
+        (b (generate-new-buffer " *b*")))
+    (unwind-protect
+        (progn
+          (dolist (buf (list a b))
+            (with-current-buffer buf
+              (insert (make-string 3000 ?\s))
+              (dotimes (i 3000)
+                (let ((ov (make-overlay (1+ i) (+ 1 i (% (* i 7) 40)))))
+                  (overlay-put ov 'id i)
+                  (overlay-put ov 'kind (% i 3))))))
+          (dolist (args '((1000 2000 nil kind 0) (1500 1510) (1 3001 nil kind 1)
+                          (2999 3001)))
+            (let ((n (apply #'delete-overlays-in
+                            (car args) (cadr args) b (cdddr args))))
+              (with-current-buffer a
+                (let ((ovs (overlays-in (car args) (cadr args))))
+                  (when (cdddr args)
+                    (setq ovs (seq-filter
+                               (lambda (ov)
+                                 (eq (overlay-get ov (nth 3 args))
+                                     (nth 4 args)))
+                               ovs)))
+                  (should (= n (length ovs)))
+                  (mapc #'delete-overlay ovs))))
+            (dolist (buf (list a b))
+              (with-current-buffer buf
+                (goto-char 1200)
+                (insert "xyz")))
+            (let ((overlays
+                   (lambda (buf)
+                     (with-current-buffer buf
+                       (sort (mapcar (lambda (ov)
+                                       (list (overlay-get ov 'id)
+                                             (overlay-start ov)
+                                             (overlay-end ov)))
+                                     (overlays-in (point-min) (point-max)))
+                             (lambda (x y) (< (car x) (car y))))))))
+              (should (equal (funcall overlays a) (funcall overlays b))))))
+      (kill-buffer a)
+      (kill-buffer b))))
+
 
 ;; +==========================================================================+
 ;; | get-pos-property
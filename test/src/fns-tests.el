@@ -398,6 +398,48 @@ fns-tests-sort-kw
                     (should-not (and (> size 0) (eq res seq)))
                     (should (equal seq input))))))))))))
 
+;; `value<' sorts of large sequences of fixnums or ASCII strings take
+;; a path that does not use timsort; check it against a predicate
+;; that does.
+(ert-deftest fns-tests-sort-valuelt-fast ()
+  (random "fast sort seed")
+  (let* ((n 50000)
+         (fixnums (vconcat (mapcar (lambda (_)
+                                     (- (random most-positive-fixnum)
+                                        (/ most-positive-fixnum 2)))
+                                   (make-list n nil))))
+         (small (vconcat (mapcar (lambda (_) (random 100))
+                                 (make-list n nil))))
+         (strings (vconcat (mapcar (lambda (_)
+                                     (let ((s (format "%x" (random 5000))))
+                                       (if (zerop (random 2))
+                                           (string-to-unibyte s)
+                                         s)))
+                                   (make-list n nil))))
+         (raw (vconcat (mapcar (lambda (_)
+                                 (unibyte-string (random 256) (random 256)))
+                               (make-list n nil))))
+         (slow (lambda (a b) (value< a b))))
+    (dolist (input (list fixnums small strings raw))
+      (dolist (reverse '(nil t))
+        (dolist (key '(nil identity))
+          (should (equal (sort input :key key :reverse reverse)
+                         (sort input :lessp slow :key key
+                               :reverse reverse))))))
+    ;; Stability: equal keys keep their relative order.
+    (let* ((pairs (vconcat (mapcar (lambda (i) (cons (random 10) i))
+                                   (number-sequence 1 n))))
+           (sorted (sort pairs :key #'car)))
+      (should (equal sorted (sort pairs :key #'car :lessp slow)))
+      (dotimes (i (1- n))
+        (let ((a (aref sorted i))
+              (b (aref sorted (1+ i))))
+          (should (or (< (car a) (car b)) (< (cdr a) (cdr b)))))))
+    ;; Non-ASCII multibyte strings and mixed numbers use timsort.
+    (dolist (input (list (vconcat strings ["\u00e9t\u00e9" "\u00e9" "z"])
+                         (vconcat small [1.5 -0.5])))
+      (should (equal (sort input) (sort input :lessp slow))))))
+
 (ert-deftest fns-tests-sort-gc ()
   ;; Make sure our temporary storage is traversed by the GC.
   (let* ((n 1000)
@@ -1125,6 +1167,49 @@ test-hash-function-that-mutates-hash-table
        (puthash k k h)))
     (should (= 100 (hash-table-count h)))))
 
+(ert-deftest test-hash-table-churn ()
+  "Interleaved insertions and deletions leave no stale index slots."
+  (dolist (test '(eq eql equal))
+    (let ((h (make-hash-table :test test))
+          (ref (make-vector 500 nil)))
+      (dotimes (round 20)
+        (dotimes (i 500)
+          (let ((key (if (eq test 'equal) (number-to-string i) i)))
+            (if (zerop (% (+ i round) 3))
+                (progn (remhash key h) (aset ref i nil))
+              (puthash key round h)
+              (aset ref i round)))))
+      (should (= (hash-table-count h) (seq-count #'identity ref)))
+      (dotimes (i 500)
+        (should (eq (gethash (if (eq test 'equal) (number-to-string i) i)
+                             h 'missing)
+                    (or (aref ref i) 'missing)))))))
+
+(ert-deftest test-hash-table-maphash-order ()
+  "Without deletions, `maphash' visits entries in insertion order."
+  (let ((h (make-hash-table :test 'equal))
+        keys)
+    (dotimes (i 1000)
+      (puthash (format "k%d" (- 1000 i)) i h))
+    (maphash (lambda (k _v) (push k keys)) h)
+    (should (equal (nreverse keys)
+                   (mapcar (lambda (i) (format "k%d" (- 1000 i)))
+                           (number-sequence 0 999))))))
+
+(ert-deftest test-hash-table-weak-sweep ()
+  (let ((h (make-hash-table :test 'eq :weakness 'key))
+        (kept (make-list 100 nil)))
+    (dotimes (i 100)
+      (setcar (nthcdr i kept) (list i))
+      (puthash (nth i kept) i h)
+      (puthash (list i) i h))
+    (garbage-collect)
+    (should (<= 100 (hash-table-count h)))
+    (dotimes (i 100)
+      (should (eq (gethash (nth i kept) h) i)))
+    (puthash 'new 'value h)
+    (should (eq (gethash 'new h) 'value))))
+
 (ert-deftest test-sxhash-equal ()
   (should (= (sxhash-equal (* most-positive-fixnum most-negative-fixnum))
 	     (sxhash-equal (* most-positive-fixnum most-negative-fixnum))))
@@ -398,5 +398,66 @@ json-serialize/wrong-hash-key-type
     (puthash 1 2 table)
     (should-error (json-serialize table) :type 'wrong-type-argument)))
 
+;;; Streams
+
+(ert-deftest json-stream/chunks ()
+  (let* ((input "{\"a\":[1,\"]}\\\"\"]} [true,null]\n\"x{\" 12 false ")
+         (expected (list (json-parse-string "{\"a\":[1,\"]}\\\"\"]}"
+                                            :object-type 'alist)
+                         [t :null] "x{" 12 :false)))
+    ;; Every way of cutting the input in two, and byte by byte.
+    (dotimes (i (1+ (length input)))
+      (let ((stream (json-make-stream :object-type 'alist)))
+        (should (equal (append (json-stream-feed stream (substring input 0 i))
+                               (json-stream-feed stream (substring input i)))
+                       expected))))
+    (let ((stream (json-make-stream :object-type 'alist))
+          (values nil))
+      (dotimes (i (length input))
+        (setq values (append values (json-stream-feed
+                                     stream (substring input i (1+ i))))))
+      (should (equal values expected)))))
+
+(ert-deftest json-stream/pending ()
+  (let ((stream (json-make-stream)))
+    (should (json-stream-p stream))
+    (should-not (json-stream-p "[]"))
+    ;; A top-level number needs the byte after it.
+    (should (equal (json-stream-feed stream "[1] 23") '([1])))
+    (should (equal (json-stream-feed stream "4") nil))
+    (should (equal (json-stream-feed stream "\n") '(234)))
+    (should (equal (json-stream-feed stream "") nil))
+    (should (equal (json-stream-feed stream "\"é") nil))
+    (should (equal (json-stream-feed stream "\"") '("é")))))
+
+(ert-deftest json-stream/error ()
+  (let ((stream (json-make-stream :null-object nil)))
+    (should-error (json-stream-feed stream "[1] [2,] [null]")
+                  :type 'json-parse-error)
+    ;; The value before the bad one is kept, the one after is parsed
+    ;; on the next call.
+    (should (equal (json-stream-feed stream "") '([1] [nil])))
+    (should-error (json-stream-feed stream "] {}") :type 'json-parse-error)
+    (let ((values (json-stream-feed stream "")))
+      (should (length= values 1))
+      (should (hash-table-empty-p (car values))))
+    (should (equal (json-stream-feed stream "[3] ") '([3])))))
+
+(ert-deftest json-stream/large ()
+  (let* ((n 2000)
+         (value (vconcat (mapcar (lambda (i) (format "item %d" i))
+                                 (number-sequence 1 n))))
+         (json (json-serialize value))
+         (stream (json-make-stream))
+         (values nil))
+    (dotimes (_ 3)
+      (let ((pos 0))
+        (while (< pos (length json))
+          (let ((end (min (length json) (+ pos 1 (random 97)))))
+            (setq values (append values (json-stream-feed
+                                         stream (substring json pos end))))
+            (setq pos end)))))
+    (should (equal values (list value value value)))))
+
 (provide 'json-tests)
 ;;; json-tests.el ends here
@@ -1023,6 +1023,44 @@ process-sentinel-interrupt-event
       ;; ...and the change description should be "interrupt".
       (should (equal '("interrupt\n") events)))))
 
+(ert-deftest process-jsonrpc ()
+  "Test JSON-RPC framing of process input and output."
+  (skip-unless (executable-find "cat"))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let* ((messages nil)
+           (proc (make-process :name "jsonrpc" :command '("cat")
+                               :connection-type 'pipe
+                               :coding 'utf-8-unix
+                               :noquery t
+                               :filter (lambda (_proc message)
+                                         (push message messages)))))
+      (unwind-protect
+          (progn
+            (set-process-jsonrpc proc t :object-type 'plist
+                                 :false-object nil)
+            (process-send-jsonrpc proc '(:id 1 :result "héllo"))
+            ;; Headers are case-insensitive and may include others.
+            (process-send-string
+             proc (concat "content-length:  7\r\n"
+                          "Content-Type: application/vscode-jsonrpc\r\n"
+                          "\r\n[1,2,3]"
+                          "Content-Length: 5\r\n\r\nfalse"
+                          "Content-Length: 2\r\n\r\n"))
+            (process-send-string proc "{")
+            (process-send-string proc "}")
+            (while (< (length messages) 4)
+              (accept-process-output proc 5))
+            (should (equal (nreverse messages)
+                           '((:id 1 :result "héllo") [1 2 3] nil nil)))
+            ;; Back to text.
+            (setq messages nil)
+            (set-process-jsonrpc proc nil)
+            (process-send-string proc "text")
+            (while (not messages)
+              (accept-process-output proc 5))
+            (should (equal messages '("text"))))
+        (delete-process proc)))))
+
 (ert-deftest process-num-processors ()
   "Sanity checks for num-processors."
   (should (equal (num-processors) (num-processors)))
@@ -998,4 +998,78 @@ regex-tests-mutual-exclusive-inf-rec
   ;; relint suppression: Repetition of expression matching an empty string
   (should (equal (string-match "a*\\(?:c\\|b*\\)*" "a") 0)))
 
+(ert-deftest regex-tests-exponential-backtracking ()
+  ;; Patterns that backtrack exponentially must still fail promptly,
+  ;; and report the same match data when they succeed.
+  (let ((as (make-string 5000 ?a)))
+    (should-not (string-match "\\(x+x+\\)+y" (make-string 40 ?x)))
+    (should-not (string-match "\\(a*\\)*b" (concat as "c")))
+    (should-not (string-match "\\(?:a\\|aa\\)+$" (concat as "c")))
+    (should (equal (string-match "\\(a*\\)*b" (concat as "b")) 0))
+    (should (equal (match-data) '(0 5001 5000 5000)))
+    (should (equal (string-match "\\(a*\\)*b" "aaab") 0))
+    (should (equal (match-data) '(0 4 3 3)))
+    ;; Filling in the groups of a match can backtrack exponentially
+    ;; too.
+    (should (equal (string-match "\\(?:\\(?:a*\\)*c\\)\\|a" as) 0))
+    (should (equal (match-data) '(0 1)))
+    (should (equal (string-match "\\(\\(?:\\(a*\\)*c\\)\\|a*\\)" as) 0))
+    (should (equal (match-data) '(0 5000 0 5000)))
+    (should (equal (string-match "\\(?:\\(a*\\)*c\\)\\|\\(a\\)*" as) 0))
+    (should (equal (match-data) '(0 5000 nil nil 4999 5000)))
+    (should (equal (posix-string-match "\\(?:\\(a*\\)*c\\)\\|\\(a\\)*" as) 0))
+    (should (equal (match-data) '(0 5000 nil nil 4999 5000)))
+    (with-temp-buffer
+      (insert as "c\n" as "b")
+      (goto-char (point-min))
+      (should (equal (re-search-forward "\\(a*\\)*b" nil t) (point-max)))
+      (should (equal (match-beginning 0) 5003))
+      (goto-char (point-min))
+      (should (looking-at "\\(?:a\\|aa\\)+c$")))
+    ;; Searching forward does not try a match at each position in
+    ;; turn, which takes quadratic time.
+    (with-temp-buffer
+      (insert (make-string 50000 ?a) "x")
+      (goto-char (point-min))
+      (should (equal (re-search-forward "x\\|\\(a*\\)*b" nil t) (point-max)))
+      (should (equal (match-beginning 0) 50001))
+      (insert "b")
+      (goto-char (point-min))
+      (should (equal (re-search-forward "x\\|\\(a*\\)*b" nil t) 50002))
+      (should (equal (match-beginning 0) 50001)))))
+
+(ert-deftest regex-tests-required-literal ()
+  ;; Forward searches look for strings that every match contains.
+  (with-temp-buffer
+    (insert "src/a.c:1: warning: x\nsrc/b.c:22: error: y\nerror: z\n")
+    ;; Put the gap inside the second "error".
+    (goto-char 37)
+    (insert "?")
+    (delete-char -1)
+    (let ((case-fold-search nil))
+      (goto-char (point-min))
+      (should (re-search-forward "^\\(.*\\):\\([0-9]+\\): error: \\(.*\\)$"
+                                 nil t))
+      (should (equal (match-string 1) "src/b.c"))
+      (should (equal (match-string 3) "y"))
+      (should (re-search-forward "^.*error: \\(.*\\)$" nil t))
+      (should (equal (match-string 1) "z"))
+      (goto-char (point-min))
+      (should-not (re-search-forward "^.*ERROR: " nil t))
+      (should (equal (point) (point-min))))
+    (let ((case-fold-search t))
+      (goto-char (point-min))
+      (should (re-search-forward "b\\.C:[0-9]+: ERROR" nil t))
+      (should (equal (match-beginning 0) 27))))
+  (let ((case-fold-search nil))
+    (should (equal (string-match "a.\\(bc\\)d" "xxabcdxxaxbcd") 8))
+    (should (equal (string-match "[^x]*foo" "x\nfoo") 1))))
+
+(ert-deftest regex-tests-at-dot-string ()
+  ;; \\= in a string search must not look past the end of the string
+  ;; when point is further on in the current buffer.
+  (with-temp-buffer
+    (insert (make-string 1000 ?x))
+    (should-not (string-match "\\=ab" "xyz"))))
+
 ;;; regex-emacs-tests.el ends here
@@ -79,4 +79,90 @@ search-test--replace-match-update-data
         ;;(should (equal (match-end 2) beg4))
         ))))
 
+(ert-deftest search-test--regexp-cache ()
+  (let ((regexp-cache-size 8)
+        (pats (mapcar (lambda (i) (format "x%d\\'" i))
+                      (number-sequence 1 12))))
+    (regexp-cache-statistics t)
+    (dolist (p pats)
+      (should (string-match p (concat "a" (substring p 0 -2)))))
+    (let ((stats (regexp-cache-statistics)))
+      (should (<= (alist-get 'size stats) 8))
+      (should (= (alist-get 'misses stats) 12))
+      (should (>= (alist-get 'evictions stats) 4)))
+    ;; The most recent ones are still there.
+    (dolist (p (last pats 4))
+      (should (string-match p (concat "b" (substring p 0 -2)))))
+    (should (= (alist-get 'hits (regexp-cache-statistics t)) 4))
+    (should (= (alist-get 'hits (regexp-cache-statistics)) 0))
+    ;; A pattern that fails to compile leaves the cache usable.
+    (should-error (string-match "\\(" "") :type 'invalid-regexp)
+    (should (string-match (car (last pats)) "x12"))))
+
+;; Lines of many lengths, so that runs of short lines are counted a
+;; block at a time and long lines are scanned and cached one by one.
+(ert-deftest search-test--newline-blocks ()
+  (with-temp-buffer
+    (let ((ends nil))
+      (dotimes (i 3000)
+        (insert (make-string (* (% (* i 7) 13) (if (zerop (% i 97)) 90 1))
+                             (if (zerop (% i 5)) ?é ?a))
+                "\n")
+        (push (point) ends))
+      (setq ends (vconcat (nreverse ends)))
+      ;; Put the gap in the middle of the text.
+      (goto-char (/ (point-max) 2))
+      (insert "x")
+      (delete-char -1)
+      (dolist (cache '(nil t))
+        (setq cache-long-scans cache)
+        (dolist (n '(1 2 17 100 1000 2999))
+          (goto-char (point-min))
+          (should (= (forward-line n) 0))
+          (should (= (point) (aref ends (1- n))))
+          (should (= (line-number-at-pos) (1+ n)))
+          (should (= (count-lines (point-min) (point)) n))
+          (goto-char (point-max))
+          (should (= (forward-line (- n)) 0))
+          (should (= (point) (aref ends (- 2999 n)))))
+        (goto-char (point-min))
+        (should (= (forward-line 3001) 1))
+        (should (= (line-number-at-pos (point-max)) 3001))))))
+
+;; Scans this long go through the buffer's line index, which must
+;; follow edits of every kind.
+(ert-deftest search-test--line-index ()
+  (with-temp-buffer
+    (dotimes (i 20000)
+      (insert (make-string (% (* i 7) 23) (if (zerop (% i 11)) ?é ?a))
+              "\n"))
+    (let ((check
+           (lambda ()
+             (let ((text (buffer-string)))
+               (dolist (pos (list (point-max) (/ (point-max) 3)
+                                  (- (point-max) 70000)))
+                 (should (= (line-number-at-pos pos)
+                            (1+ (seq-count (lambda (c) (eq c ?\n))
+                                           (substring text 0 (1- pos))))))
+                 (goto-char (point-min))
+                 (forward-line (1- (line-number-at-pos pos)))
+                 (should (= (point) (save-excursion
+                                      (goto-char pos)
+                                      (line-beginning-position)))))))))
+      (funcall check)
+      (goto-char 100000)
+      (insert "one\ntwo\n")
+      (funcall check)
+      (delete-region 5000 90000)
+      (funcall check)
+      (subst-char-in-region 60000 70000 ?\n ?b)
+      (funcall check)
+      (subst-char-in-region 1 30000 ?a ?\n)
+      (funcall check)
+      (goto-char (point-max))
+      (insert (make-string 10000 ?\n))
+      (funcall check)
+      (set-buffer-multibyte nil)
+      (funcall check))))
+
 ;;; search-tests.el ends here
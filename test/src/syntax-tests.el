@@ -98,6 +98,48 @@ parse-partial-sexp-paren-comments
       (should (equal (parse-partial-sexp pointC pointX nil nil ppsC)
                      ppsX)))))
 
+(ert-deftest parse-partial-sexp-checkpoints ()
+  "Test parses from the buffer start, which resume from saved states.
+Compare them with parses that cannot, across changes to the text
+and to its `syntax-table' properties."
+  (with-temp-buffer
+    (emacs-lisp-mode)
+    (dotimes (i 400)
+      (insert (format "(defun f%d (x) \"doc\n%d\" ;; (\n  (list ?\\( x 'y))\n"
+                      i i)))
+    (let ((check
+           (lambda ()
+             (dolist (pos (list 2 5000 (/ (point-max) 2) 9999
+                                (- (point-max) 7) (point-max)))
+               (should (equal (save-excursion
+                                (parse-partial-sexp (point-min) pos))
+                              (save-excursion
+                                ;; An unreachable TARGETDEPTH forces a
+                                ;; parse all the way from the start.
+                                (parse-partial-sexp (point-min) pos
+                                                    most-positive-fixnum))))
+               (goto-char pos)
+               (should (equal (nth 4 (syntax-ppss))
+                              (nth 4 (parse-partial-sexp 1 pos))))))))
+      (funcall check)
+      (goto-char 6000)
+      (insert "\"")
+      (funcall check)
+      (goto-char 3000)
+      (insert "(((")
+      (funcall check)
+      (delete-region 2990 7000)
+      (funcall check)
+      (put-text-property 100 101 'syntax-table (string-to-syntax "\""))
+      (funcall check)
+      (narrow-to-region 50 (point-max))
+      (funcall check)
+      (should (= (progn (goto-char (point-max)) (forward-comment -1) (point))
+                 (let ((syntax-ppss-table (syntax-table)))
+                   (goto-char (point-max))
+                   (forward-comment -1)
+                   (point)))))))
+
 
 ;;; Commentary:
 ;; The next bit tests the handling of comments in syntax.c, in
@@ -222,6 +222,115 @@ baz
       (call-interactively #'beginning-of-defun)
       (should (eq (point) 34)))))
 
+(ert-deftest tree-sitter-scan-lists ()
+  "Scans that jump over nodes of the parse tree land where scans of the
+text do."
+  (let ((text "
+/* Block comment (with parens) */
+int main (int argc, char *argv[])
+{
+  // Line comment \"not a string\"
+  printf (\"%s (%d)\\n\", argv[0], (argc + 1) * 2);
+  if (argc) { return f ((g (1)), \"}\"); } /* done */
+  return 0;
+}
+"))
+    (tree-sitter-tests-doit ".c" text
+      (tree-sitter-c-mode)
+      (let ((scan (lambda ()
+                    (let (result)
+                      (dotimes (i (1- (point-max)))
+                        (let ((pos (1+ i)))
+                          (push (list (ignore-errors (scan-lists pos 1 0))
+                                      (ignore-errors (scan-lists pos -1 0))
+                                      (ignore-errors (scan-lists pos 1 1))
+                                      (ignore-errors (scan-sexps pos 1))
+                                      (ignore-errors (scan-sexps pos -1))
+                                      (progn (goto-char pos)
+                                             (list (forward-comment 1) (point)))
+                                      (progn (goto-char pos)
+                                             (list (forward-comment -1) (point))))
+                                result)))
+                      result))))
+        (should tree-sitter-sitter)
+        (should (equal (let ((parse-sexp-use-tree-sitter t))
+                         (funcall scan))
+                       (funcall scan)))))))
+
+(ert-deftest tree-sitter-query-captures ()
+  "Captures come back as flat triples indexing the capture names."
+  (let ((text "void main (void) {
+  return 0;
+}
+")
+        (query "(function_declarator declarator: (identifier) @name)"))
+    (tree-sitter-tests-doit ".c" text
+      (tree-sitter-c-mode)
+      (should (equal (tree-sitter-query-capture-names query) ["name"]))
+      (should (equal (tree-sitter-query-captures query) [0 6 10]))
+      (should (equal (tree-sitter-query-captures query 20 (point-max)) []))
+      (should-error (tree-sitter-query-captures "(no_such_node) @x")
+                    :type 'tree-sitter-error)
+      (should (equal (tree-sitter-query-captures
+                      "((identifier) @x (#match? @x \"^ma\"))")
+                     [0 6 10]))
+      (should (equal (tree-sitter-query-captures
+                      "((identifier) @x (#eq? @x \"other\"))")
+                     []))
+      (should (equal (tree-sitter-query-captures
+                      "((identifier) @x (#not-eq? @x \"other\"))")
+                     [0 6 10]))
+      (should-error (tree-sitter-query-captures
+                     "((identifier) @x (#any-of? @x \"main\"))")
+                    :type 'tree-sitter-error))))
+
+(ert-deftest tree-sitter-changed-ranges ()
+  "Each change to the parse is reported once."
+  (let ((text "int a;
+int b;
+"))
+    (tree-sitter-tests-doit ".c" text
+      (tree-sitter-c-mode)
+      (tree-sitter-changed-ranges)
+      (goto-char (point-min))
+      (insert "/* ")
+      (should (tree-sitter-changed-ranges))
+      (should-not (tree-sitter-changed-ranges))
+      (insert "*/")
+      (let* ((buffer (current-buffer))
+             (ranges (with-temp-buffer (tree-sitter-changed-ranges buffer))))
+        (should ranges)
+        (should (<= (point-min) (caar ranges) (cdar ranges) (point-max))))
+      (should-not (tree-sitter-changed-ranges)))))
+
+(ert-deftest tree-sitter-shared-across-buffers ()
+  "Buffers of a language share a highlighter, which outlives any one
+of them, and a new buffer can take the parser of a collected one."
+  (let ((text "void main (void) {
+  return 0;
+}
+")
+        faces)
+    (tree-sitter-tests-doit ".c" text
+      (let ((buffer (current-buffer)))
+        (setq faces (tree-sitter-highlights (point-min) (point-max)))
+        (should faces)
+        (tree-sitter-tests-doit ".c" text
+          (should (equal (tree-sitter-highlights (point-min) (point-max))
+                         faces)))
+        (garbage-collect)
+        (set-buffer buffer)
+        (should (equal (tree-sitter-highlights (point-min) (point-max))
+                       faces))))
+    (garbage-collect)
+    (tree-sitter-tests-doit ".c" text
+      (should (equal (tree-sitter-highlights (point-min) (point-max))
+                     faces))
+      (goto-char (point-min))
+      (insert "int a;\n")
+      (should (equal (tree-sitter-node-type (tree-sitter-node-at 1))
+                     "primitive_type")))))
+
 (ert-deftest tree-sitter-c-indent ()
   (let ((text "
 void main (int argc, char *argv []) {
@@ -554,4 +554,136 @@ xdisp-tests--window-border-excludes-tab-and-header-lines
       (tab-line-mode -1)
       (window-border-mode -1))))
 
+;; Moving up through long lines that the behaved-line shortcuts do
+;; not apply to starts from screen line starts cached for the window.
+(ert-deftest xdisp-tests--vertical-motion-long-line-cache ()
+  (skip-unless (not noninteractive))
+  (xdisp-tests--visible-buffer
+   (dotimes (i 3)
+     (insert (format "%d " i))
+     (dotimes (_ (+ 60 (* 30 i)))
+       (insert "ab\tcd efghi "))
+     (insert "\n"))
+   (let ((uncached (lambda (n)
+                     (save-excursion
+                       (force-window-update (selected-window))
+                       (list (vertical-motion n) (point))))))
+     (dolist (text '(nil "\t\tXYZ"))
+       (when text
+         (goto-char 500)
+         (insert text))
+       (goto-char (point-max))
+       (redisplay t)
+       (while (let ((expected (funcall uncached '(3 . -1))))
+                (should (equal (list (vertical-motion '(3 . -1)) (point))
+                               expected))
+                (< (car expected) 0)))
+       (goto-char 1500)
+       (let ((expected (funcall uncached -7)))
+         (should (equal (list (vertical-motion -7) (point)) expected))))
+     ;; Changing settings that move screen line starts must not reuse
+     ;; the screen lines cached before.
+     (dolist (change (list (lambda () (setq-local wrap-prefix "          "))
+                           (lambda ()
+                             (add-to-invisibility-spec 'xdisp-tests--hide))
+                           (lambda ()
+                             (aset buffer-display-table ?e
+                                   (make-vector 10 ?e)))))
+       (erase-buffer)
+       (kill-local-variable 'wrap-prefix)
+       (setq buffer-invisibility-spec nil)
+       (setq buffer-display-table (make-display-table))
+       (dotimes (_ 200)
+         (insert "ab\tcd efghi "))
+       (insert "\n")
+       (put-text-property 2100 2380 'invisible 'xdisp-tests--hide)
+       (redisplay t)
+       (goto-char 2400)
+       (vertical-motion -3)
+       (funcall change)
+       (dolist (pos '(1800 2400))
+         (goto-char pos)
+         (let ((cached (list (vertical-motion -3) (point))))
+           (goto-char pos)
+           (should (equal cached (funcall uncached -3))))))
+     (setq buffer-display-table nil)
+     ;; A screen line can start right after a before-string that ends
+     ;; the screen line before; moving from there must not display the
+     ;; string again.
+     (erase-buffer)
+     (insert "\t")
+     (dotimes (_ 200)
+       (insert "abcd efghi "))
+     (insert "\n")
+     (goto-char 1000)
+     (vertical-motion 0)
+     (let ((start (point)))
+       (dolist (string '("X" "XXX"))
+         (let ((ov (make-overlay (- start (length string))
+                                 (- start (length string)))))
+           (overlay-put ov 'before-string string)
+           (redisplay t)
+           (goto-char 2400)
+           (vertical-motion -20)
+           (goto-char (+ start 150))
+           (let ((cached (list (vertical-motion 1) (point))))
+             (goto-char (+ start 150))
+             (should (equal cached (funcall uncached 1))))
+           (delete-overlay ov)))))))
+
+;; Redisplay records the overlays of the text it displays, and
+;; `get-char-property' consults them while they are up to date.
+(ert-deftest xdisp-tests--recorded-overlays ()
+  (skip-unless (not noninteractive))
+  (xdisp-tests--visible-buffer
+   (dotimes (_ 100)
+     (insert "Some words on a line.\n"))
+   (let ((overlays
+          (mapcar (lambda (i)
+                    (let* ((beg (1+ (% (* i 37) (buffer-size))))
+                           (ov (make-overlay beg (min (point-max)
+                                                      (+ beg (% i 50))))))
+                      (overlay-put ov 'priority i)
+                      (overlay-put ov 'help-echo i)
+                      ov))
+                  (number-sequence 1 300)))
+         (check
+          (lambda ()
+            (dotimes (i (buffer-size))
+              (let ((pos (1+ i))
+                    (expected nil))
+                (dolist (ov (overlays-at (1+ i)))
+                  (when (> (overlay-get ov 'priority) (or expected 0))
+                    (setq expected (overlay-get ov 'help-echo))))
+                (should (eq (get-char-property pos 'help-echo)
+                            expected)))))))
+     (goto-char (point-min))
+     (vertical-motion 30)
+     (funcall check)
+     (vertical-motion -10)
+     (move-overlay (car (last overlays)) (point) (+ (point) 30))
+     (funcall check)
+     (vertical-motion 10)
+     (move-overlay (car (last overlays)) (point) (+ (point) 30))
+     (vertical-motion 1)
+     (delete-overlay (car (last overlays)))
+     (funcall check))))
+
+;; Redisplay statistics record how windows were redisplayed.
+(ert-deftest xdisp-tests--redisplay-statistics ()
+  (let ((redisplay-record-statistics t))
+    (redisplay-statistics t)
+    (should-not (redisplay-statistics))
+    (skip-unless (not noninteractive))
+    (xdisp-tests--visible-buffer
+      (insert "abc")
+      (redisplay t)
+      (let ((entry (car (last (redisplay-statistics t)))))
+        (should (eq (nth 1 entry) (selected-window)))
+        (should (memq (nth 2 entry)
+                      '(line cursor insdel reuse scroll window recenter)))
+        (should (> (nth 3 entry) 0))
+        (should (floatp (nth 5 entry))))
+      (should-not (redisplay-statistics)))))
+
 ;;; xdisp-tests.el ends here
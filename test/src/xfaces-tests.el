@@ -52,6 +52,48 @@ xfaces-internal-color-values-from-color-spec
   (should (equal (color-values-from-color-spec "rgbi:0/0x0/0") nil))
   (should (equal (color-values-from-color-spec "rgbi:0/+0x1/0") nil)))
 
+(ert-deftest xfaces-face-cache-statistics ()
+  (let ((stats (face-cache-statistics)))
+    (should (length= stats 5))
+    (should (seq-every-p #'natnump stats))))
+
+(ert-deftest xfaces-merged-face-memo ()
+  (skip-when noninteractive)
+  ;; Garbage collection empties the memo.
+  (let ((gc-cons-threshold most-positive-fixnum))
+    (with-temp-buffer
+      (switch-to-buffer (current-buffer))
+      (dotimes (i 20)
+        (insert (propertize "word" 'face (if (zerop (% i 2)) 'bold 'italic))
+                " "))
+      (redisplay t)
+      (face-cache-statistics nil t)
+      (force-window-update)
+      (redisplay t)
+      ;; Redisplaying the same text finds its merged faces in the memo.
+      (pcase-let ((`(,_ ,_ ,merges ,hits ,_) (face-cache-statistics nil t)))
+        (should (> merges 0))
+        (should (> hits 0)))
+      ;; Freeing the faces empties the memo, which fills up again.
+      (clear-face-cache)
+      (redisplay t)
+      (pcase-let ((`(,_ ,_ ,merges ,_ ,misses) (face-cache-statistics)))
+        (should (> merges 0))
+        (should (> misses 0)))
+      ;; Anonymous faces can be changed in place, so they are not memoized.
+      (erase-buffer)
+      (dotimes (_ 20)
+        (insert "word "))
+      (clear-face-cache)
+      (redisplay t)
+      (let ((merges (nth 2 (face-cache-statistics))))
+        (erase-buffer)
+        (dotimes (_ 20)
+          (insert (propertize "word" 'face (list :weight 'bold)) " "))
+        (clear-face-cache)
+        (redisplay t)
+        (should (= (nth 2 (face-cache-statistics)) merges))))))
+
 (provide 'xfaces-tests)
 
 ;;; xfaces-tests.el ends here